@@ -0,0 +1,102 @@
+/*****************************************************************************
+* \file      bench_base64.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for base64
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "base64.h"
+#include "cutil_cpu.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define BUF_SIZE 65535u //multiple of 3, no padding
+#define NUM_ROUNDS 5000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_base64(void);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const uint32_t m_kernel_features[] = {0u, CUTIL_CPU_SSE2 | CUTIL_CPU_SSSE3, CUTIL_CPU_ALL};
+static const char *m_kernel_names[] = {"scalar", "ssse3", "best"};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Rates are in binary bytes per second
+ */
+void bench_base64(void)
+{
+   uint8_t *data = (uint8_t*) malloc(BUF_SIZE);
+   uint8_t *decoded = (uint8_t*) malloc(BUF_SIZE);
+   char *text = (char*) malloc(BASE64_ENCODED_SIZE(BUF_SIZE));
+   if ( (data != 0) && (decoded != 0) && (text != 0) )
+   {
+      size_t i;
+      bench_fill_random(data, BUF_SIZE, 4u);
+      for (i = 0u; i < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); i++)
+      {
+         char name[64];
+         int round;
+         size_t decodedLen = 0u;
+         double t0, t1;
+         cutil_cpu_override(m_kernel_features[i]);
+         t0 = bench_time();
+         for (round = 0; round < NUM_ROUNDS; round++)
+         {
+            g_bench_sink += base64_encode(text, data, BUF_SIZE);
+         }
+         t1 = bench_time();
+         sprintf(name, "base64_encode 64 KiB (%s)", m_kernel_names[i]);
+         bench_report_rate(name, (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+
+         t0 = bench_time();
+         for (round = 0; round < NUM_ROUNDS; round++)
+         {
+            g_bench_sink += base64_decode(decoded, text, BASE64_ENCODED_SIZE(BUF_SIZE), &decodedLen);
+         }
+         t1 = bench_time();
+         sprintf(name, "base64_decode 64 KiB (%s)", m_kernel_names[i]);
+         bench_report_rate(name, (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+      }
+      cutil_cpu_reset();
+   }
+   else
+   {
+      printf("out of memory\n");
+   }
+   free(data);
+   free(decoded);
+   free(text);
+}
@@ -0,0 +1,101 @@
+/*****************************************************************************
+* \file      bench_cdc.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for cdc_chunker_t
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "cdc.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define BUF_SIZE ((size_t) 16u << 20)
+#define WRITE_SIZE 65536u
+#define NUM_ROUNDS 4
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_cdc(void);
+static void on_chunk(void *arg, const cdc_chunk_t *chunk);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_cdc(void)
+{
+   uint8_t *data = (uint8_t*) malloc(BUF_SIZE);
+   if (data != 0)
+   {
+      char name[64];
+      uint8_t hash[SHA256_HASH_SIZE];
+      cdc_chunker_t chunker;
+      size_t numChunks = 0u;
+      size_t offset;
+      int round;
+      double t0, t1;
+      bench_fill_random(data, BUF_SIZE, 11u);
+      (void) cdc_chunker_create(&chunker, CDC_MIN_SIZE_DEFAULT, CDC_AVG_SIZE_DEFAULT, CDC_MAX_SIZE_DEFAULT, on_chunk, &numChunks);
+      t0 = bench_time();
+      for (round = 0; round < NUM_ROUNDS; round++)
+      {
+         cdc_chunker_reset(&chunker);
+         for (offset = 0u; offset < BUF_SIZE; offset += WRITE_SIZE)
+         {
+            cdc_chunker_write(&chunker, &data[offset], WRITE_SIZE);
+         }
+         cdc_chunker_finish(&chunker);
+      }
+      t1 = bench_time();
+      sprintf(name, "cdc chunk+sha256 16 MiB (avg %u bytes)", (unsigned) (((size_t) NUM_ROUNDS * BUF_SIZE) / numChunks));
+      bench_report_rate(name, (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+      //the hashing alone, the difference is the cost of finding the boundaries
+      t0 = bench_time();
+      for (round = 0; round < NUM_ROUNDS; round++)
+      {
+         sha256_calc(hash, data, BUF_SIZE);
+         g_bench_sink += hash[0];
+      }
+      t1 = bench_time();
+      bench_report_rate("sha256_calc 16 MiB", (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+   }
+   else
+   {
+      printf("out of memory\n");
+   }
+   free(data);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void on_chunk(void *arg, const cdc_chunk_t *chunk)
+{
+   (*(size_t*) arg)++;
+   g_bench_sink += chunk->hash[0];
+}
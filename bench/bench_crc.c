@@ -0,0 +1,143 @@
+/*****************************************************************************
+* \file      bench_crc.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for CRC32C and CRC-16
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "crc.h"
+#include "cutil_cpu.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define BUF_SIZE 65536u
+#define NUM_ROUNDS 20000
+#define SMALL_SIZE 64u
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_crc(void);
+static void bench_crc32c(const char *label, const uint8_t *buf);
+static uint32_t crc32c_bytewise(const uint32_t *table, const uint8_t *data, size_t len);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_crc(void)
+{
+   uint8_t *buf = (uint8_t*) malloc(BUF_SIZE);
+   if (buf != 0)
+   {
+      uint32_t table[256];
+      unsigned i, k;
+      int round;
+      double t0, t1;
+      bench_fill_random(buf, BUF_SIZE, 1u);
+      //the byte-by-byte table lookup used by application code so far
+      for (i = 0u; i < 256u; i++)
+      {
+         uint32_t c = i;
+         for (k = 0u; k < 8u; k++)
+         {
+            c = (c >> 1) ^ ((c & 1u)? 0x82F63B78u : 0u);
+         }
+         table[i] = c;
+      }
+      t0 = bench_time();
+      for (round = 0; round < NUM_ROUNDS / 10; round++)
+      {
+         g_bench_sink += crc32c_bytewise(table, buf, BUF_SIZE);
+      }
+      t1 = bench_time();
+      bench_report_rate("crc32c bytewise table", (size_t) (NUM_ROUNDS / 10) * BUF_SIZE, t1 - t0);
+
+      cutil_cpu_override(0u);
+      bench_crc32c("slice8", buf);
+      cutil_cpu_reset();
+      if (cutil_cpu_has(CUTIL_CPU_SSE42))
+      {
+         bench_crc32c("sse4.2", buf);
+      }
+
+      t0 = bench_time();
+      for (round = 0; round < NUM_ROUNDS / 10; round++)
+      {
+         g_bench_sink += crc16_calc(CRC16_CCITT_FALSE, buf, BUF_SIZE);
+      }
+      t1 = bench_time();
+      bench_report_rate("crc16_calc CCITT-FALSE", (size_t) (NUM_ROUNDS / 10) * BUF_SIZE, t1 - t0);
+   }
+   else
+   {
+      printf("out of memory\n");
+   }
+   free(buf);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void bench_crc32c(const char *label, const uint8_t *buf)
+{
+   char name[64];
+   int round;
+   size_t offset;
+   double t0, t1;
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      g_bench_sink += crc32c_calc(buf, BUF_SIZE);
+   }
+   t1 = bench_time();
+   sprintf(name, "crc32c_calc 64 KiB (%s)", label);
+   bench_report_rate(name, (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (offset = 0u; offset < BUF_SIZE; offset += SMALL_SIZE)
+      {
+         g_bench_sink += crc32c_calc(&buf[offset], SMALL_SIZE);
+      }
+   }
+   t1 = bench_time();
+   sprintf(name, "crc32c_calc 64 B (%s)", label);
+   bench_report_rate(name, (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+}
+
+static uint32_t crc32c_bytewise(const uint32_t *table, const uint8_t *data, size_t len)
+{
+   size_t i;
+   uint32_t crc = 0xFFFFFFFFu;
+   for (i = 0u; i < len; i++)
+   {
+      crc = (crc >> 8) ^ table[(crc ^ data[i]) & 0xFFu];
+   }
+   return ~crc;
+}
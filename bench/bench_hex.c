@@ -0,0 +1,138 @@
+/*****************************************************************************
+* \file      bench_hex.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for hex
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "hex.h"
+#include "cutil_cpu.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define BUF_SIZE 65536u
+#define NUM_ROUNDS 5000
+#define DIGEST_SIZE 32u //as printed for sha256
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_hex(void);
+static void bench_kernel(const char *label, const uint8_t *data, char *text, uint8_t *decoded);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const uint32_t m_kernel_features[] = {0u, CUTIL_CPU_SSE2 | CUTIL_CPU_SSSE3, CUTIL_CPU_ALL};
+static const char *m_kernel_names[] = {"scalar", "ssse3", "best"};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_hex(void)
+{
+   uint8_t *data = (uint8_t*) malloc(BUF_SIZE);
+   uint8_t *decoded = (uint8_t*) malloc(BUF_SIZE);
+   char *text = (char*) malloc(HEX_ENCODED_SIZE(BUF_SIZE) + 1u);
+   if ( (data != 0) && (decoded != 0) && (text != 0) )
+   {
+      size_t i;
+      int round;
+      double t0, t1;
+      bench_fill_random(data, BUF_SIZE, 3u);
+      //the per-byte sprintf loop this module replaces
+      t0 = bench_time();
+      for (round = 0; round < NUM_ROUNDS / 100; round++)
+      {
+         for (i = 0u; i < BUF_SIZE; i++)
+         {
+            sprintf(&text[i * 2u], "%02x", data[i]);
+         }
+         g_bench_sink += (uint8_t) text[round];
+      }
+      t1 = bench_time();
+      bench_report_rate("sprintf %02x loop", (size_t) (NUM_ROUNDS / 100) * BUF_SIZE, t1 - t0);
+      for (i = 0u; i < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); i++)
+      {
+         cutil_cpu_override(m_kernel_features[i]);
+         bench_kernel(m_kernel_names[i], data, text, decoded);
+      }
+      cutil_cpu_reset();
+   }
+   else
+   {
+      printf("out of memory\n");
+   }
+   free(data);
+   free(decoded);
+   free(text);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Rates are in binary bytes per second
+ */
+static void bench_kernel(const char *label, const uint8_t *data, char *text, uint8_t *decoded)
+{
+   char name[64];
+   int round;
+   size_t offset;
+   double t0, t1;
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      g_bench_sink += hex_encode(text, data, BUF_SIZE);
+   }
+   t1 = bench_time();
+   sprintf(name, "hex_encode 64 KiB (%s)", label);
+   bench_report_rate(name, (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      g_bench_sink += hex_decode(decoded, text, HEX_ENCODED_SIZE(BUF_SIZE));
+   }
+   t1 = bench_time();
+   sprintf(name, "hex_decode 64 KiB (%s)", label);
+   bench_report_rate(name, (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS / 10; round++)
+   {
+      for (offset = 0u; offset < BUF_SIZE; offset += DIGEST_SIZE)
+      {
+         g_bench_sink += hex_encode(text, &data[offset], DIGEST_SIZE);
+      }
+   }
+   t1 = bench_time();
+   sprintf(name, "hex_encode digests (%s)", label);
+   bench_report_ops(name, (size_t) (NUM_ROUNDS / 10) * (BUF_SIZE / DIGEST_SIZE), t1 - t0);
+}
@@ -0,0 +1,93 @@
+/*****************************************************************************
+* \file      bench_hmac_sha256.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for HMAC-SHA256
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "hmac_sha256.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define BUF_SIZE ((size_t) 1u << 20)
+#define MESSAGE_SIZE 64u
+#define NUM_ROUNDS 5
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_hmac_sha256(void);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_hmac_sha256(void)
+{
+   uint8_t *data = (uint8_t*) malloc(BUF_SIZE);
+   if (data != 0)
+   {
+      static const char keyData[] = "0123456789abcdef0123456789abcdef";
+      hmac_sha256_key_t key;
+      uint8_t mac[HMAC_SHA256_MAC_SIZE];
+      int round;
+      size_t offset;
+      double t0, t1;
+      bench_fill_random(data, BUF_SIZE, 8u);
+      //key pads hashed again for every message
+      t0 = bench_time();
+      for (round = 0; round < NUM_ROUNDS; round++)
+      {
+         for (offset = 0u; offset < BUF_SIZE; offset += MESSAGE_SIZE)
+         {
+            hmac_sha256(mac, keyData, sizeof(keyData) - 1u, &data[offset], MESSAGE_SIZE);
+            g_bench_sink += mac[0];
+         }
+      }
+      t1 = bench_time();
+      bench_report_ops("hmac_sha256 64 bytes (key per call)", (size_t) NUM_ROUNDS * (BUF_SIZE / MESSAGE_SIZE), t1 - t0);
+
+      hmac_sha256_key_init(&key, keyData, sizeof(keyData) - 1u);
+      t0 = bench_time();
+      for (round = 0; round < NUM_ROUNDS; round++)
+      {
+         for (offset = 0u; offset < BUF_SIZE; offset += MESSAGE_SIZE)
+         {
+            hmac_sha256_calc(mac, &key, &data[offset], MESSAGE_SIZE);
+            g_bench_sink += mac[0];
+         }
+      }
+      t1 = bench_time();
+      bench_report_ops("hmac_sha256_calc 64 bytes (key state)", (size_t) NUM_ROUNDS * (BUF_SIZE / MESSAGE_SIZE), t1 - t0);
+      hmac_sha256_key_clear(&key);
+   }
+   else
+   {
+      printf("out of memory\n");
+   }
+   free(data);
+}
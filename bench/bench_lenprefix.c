@@ -0,0 +1,123 @@
+/*****************************************************************************
+* \file      bench_lenprefix.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for lenprefix
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "lenprefix.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_MESSAGES 65536u
+#define NUM_ROUNDS 200
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_lenprefix(void);
+static void bench_distribution(const char *label, uint8_t *buf, const uint8_t *random, lenprefix_msg_t *msgs, unsigned longMask);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_lenprefix(void)
+{
+   uint8_t *buf = (uint8_t*) malloc(NUM_MESSAGES * (LENPREFIX_MAX_HEADER_SIZE + 192u));
+   uint8_t *random = (uint8_t*) malloc(NUM_MESSAGES);
+   lenprefix_msg_t *msgs = (lenprefix_msg_t*) malloc(NUM_MESSAGES * sizeof(lenprefix_msg_t));
+   if ( (buf != 0) && (random != 0) && (msgs != 0) )
+   {
+      bench_fill_random(random, NUM_MESSAGES, 2u);
+      bench_distribution("1 in 8 long", buf, random, msgs, 7u);
+      bench_distribution("1 in 2 long", buf, random, msgs, 1u);
+   }
+   else
+   {
+      printf("out of memory\n");
+   }
+   free(buf);
+   free(random);
+   free(msgs);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Payloads are 0..63 bytes, randomly selected ones get 128 bytes more (and thus a 4-byte header).
+ * The per-message decode loop branches on the header size, the scan does not.
+ */
+static void bench_distribution(const char *label, uint8_t *buf, const uint8_t *random, lenprefix_msg_t *msgs, unsigned longMask)
+{
+   char name[64];
+   size_t i;
+   size_t size = 0u;
+   int round;
+   double t0, t1;
+   for (i = 0u; i < NUM_MESSAGES; i++)
+   {
+      uint32_t length = (random[i] & 63u) + ((((unsigned) random[i] >> 6) & longMask) == 0u? 128u : 0u);
+      size += lenprefix_encode(&buf[size], length);
+      size += length;
+   }
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      size_t pos = 0u;
+      size_t n = 0u;
+      while (pos < size)
+      {
+         uint32_t length;
+         size_t headerSize = lenprefix_decode(&buf[pos], size - pos, &length);
+         if ( (headerSize == 0u) || (length > size - pos - headerSize) )
+         {
+            break;
+         }
+         msgs[n].offset = pos + headerSize;
+         msgs[n].length = length;
+         n++;
+         pos += headerSize + length;
+      }
+      g_bench_sink += n;
+   }
+   t1 = bench_time();
+   sprintf(name, "lenprefix_decode loop (%s)", label);
+   bench_report_ops(name, (size_t) NUM_ROUNDS * NUM_MESSAGES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      g_bench_sink += lenprefix_scan(buf, size, msgs, NUM_MESSAGES, (size_t*) 0);
+   }
+   t1 = bench_time();
+   sprintf(name, "lenprefix_scan (%s)", label);
+   bench_report_ops(name, (size_t) NUM_ROUNDS * NUM_MESSAGES, t1 - t0);
+}
@@ -0,0 +1,176 @@
+/*****************************************************************************
+* \file      bench_main.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmark runner for cutil
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "cutil_cpu.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+typedef void (bench_func_t)(void);
+
+typedef struct bench_entry_tag
+{
+   const char *name;
+   bench_func_t *func;
+} bench_entry_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_soa_numa(void);
+void bench_base64(void);
+void bench_crc(void);
+void bench_hex(void);
+void bench_lenprefix(void);
+void bench_numconv(void);
+void bench_pack(void);
+void bench_pack_array(void);
+void bench_pack_scale(void);
+void bench_pack_signal(void);
+void bench_pack_struct(void);
+void bench_pack_varint(void);
+void bench_sha256(void);
+void bench_sha256_tree(void);
+void bench_hmac_sha256(void);
+void bench_xxh3(void);
+void bench_cdc(void);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+volatile uint64_t g_bench_sink;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const bench_entry_t m_benchmarks[] =
+{
+   {"soa_numa", bench_soa_numa},
+   {"base64", bench_base64},
+   {"crc", bench_crc},
+   {"hex", bench_hex},
+   {"lenprefix", bench_lenprefix},
+   {"numconv", bench_numconv},
+   {"pack", bench_pack},
+   {"pack_array", bench_pack_array},
+   {"pack_scale", bench_pack_scale},
+   {"pack_signal", bench_pack_signal},
+   {"pack_struct", bench_pack_struct},
+   {"pack_varint", bench_pack_varint},
+   {"sha256", bench_sha256},
+   {"sha256_tree", bench_sha256_tree},
+   {"hmac_sha256", bench_hmac_sha256},
+   {"xxh3", bench_xxh3},
+   {"cdc", bench_cdc},
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Usage: cutil_bench [name ...]
+ * Runs all benchmarks when no name is given.
+ */
+int main(int argc, char **argv)
+{
+   size_t i;
+   int j;
+   char features[128];
+   const size_t numBenchmarks = sizeof(m_benchmarks) / sizeof(m_benchmarks[0]);
+   cutil_cpu_describe(cutil_cpu_features(), features, sizeof(features));
+   printf("CPU features: %s\n", features);
+   for (i = 0u; i < numBenchmarks; i++)
+   {
+      int selected = (argc < 2);
+      for (j = 1; j < argc; j++)
+      {
+         if (strcmp(argv[j], m_benchmarks[i].name) == 0)
+         {
+            selected = 1;
+         }
+      }
+      if (selected)
+      {
+         printf("== %s ==\n", m_benchmarks[i].name);
+         m_benchmarks[i].func();
+      }
+   }
+   return 0;
+}
+
+/**
+ * Returns monotonic time in seconds
+ */
+double bench_time(void)
+{
+#ifdef _WIN32
+   LARGE_INTEGER freq, now;
+   QueryPerformanceFrequency(&freq);
+   QueryPerformanceCounter(&now);
+   return (double) now.QuadPart / (double) freq.QuadPart;
+#else
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+#endif
+}
+
+/**
+ * Deterministic pseudo-random data (xorshift32)
+ */
+void bench_fill_random(uint8_t *buf, size_t len, uint32_t seed)
+{
+   size_t i;
+   uint32_t x = (seed != 0u)? seed : 0x12345678u;
+   for (i = 0u; i < len; i++)
+   {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      buf[i] = (uint8_t) x;
+   }
+}
+
+void bench_report_rate(const char *name, size_t numBytes, double seconds)
+{
+   printf("%-40s %10.3f GB/s\n", name, ((double) numBytes / seconds) * 1e-9);
+}
+
+void bench_report_ops(const char *name, size_t numOps, double seconds)
+{
+   printf("%-40s %10.3f Mops/s\n", name, ((double) numOps / seconds) * 1e-6);
+}
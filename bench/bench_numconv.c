@@ -0,0 +1,205 @@
+/*****************************************************************************
+* \file      bench_numconv.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for numconv
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "bench.h"
+#include "numconv.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_VALUES 4096u
+#define NUM_ROUNDS 100
+#define TEXT_SIZE 32u
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_numconv(void);
+static void bench_integers(const uint64_t *values, char *text);
+static void bench_doubles(const double *values, char *text);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_numconv(void)
+{
+   uint64_t *integers = (uint64_t*) malloc(NUM_VALUES * sizeof(uint64_t));
+   double *doubles = (double*) malloc(NUM_VALUES * sizeof(double));
+   char *text = (char*) malloc(NUM_VALUES * TEXT_SIZE);
+   if ( (integers != 0) && (doubles != 0) && (text != 0) )
+   {
+      size_t i;
+      bench_fill_random((uint8_t*) integers, NUM_VALUES * sizeof(uint64_t), 5u);
+      for (i = 0u; i < NUM_VALUES; i++)
+      {
+         //mix of magnitudes, as in typical telemetry or JSON payloads
+         integers[i] >>= (integers[i] & 63u);
+         doubles[i] = (double) (int64_t) (integers[i] % 2000001u - 1000000u) / ((i & 1u)? 1000.0 : 3.0);
+      }
+      bench_integers(integers, text);
+      bench_doubles(doubles, text);
+   }
+   else
+   {
+      printf("out of memory\n");
+   }
+   free(integers);
+   free(doubles);
+   free(text);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void bench_integers(const uint64_t *values, char *text)
+{
+   size_t i;
+   int round;
+   double t0, t1;
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (i = 0u; i < NUM_VALUES; i++)
+      {
+         g_bench_sink += (uint64_t) snprintf(&text[i * TEXT_SIZE], TEXT_SIZE, "%" PRIu64, values[i]);
+      }
+   }
+   t1 = bench_time();
+   bench_report_ops("snprintf %" PRIu64, (size_t) NUM_ROUNDS * NUM_VALUES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (i = 0u; i < NUM_VALUES; i++)
+      {
+         char *p = &text[i * TEXT_SIZE];
+         p[numconv_formatU64(p, values[i])] = '\0';
+      }
+      g_bench_sink += (uint8_t) text[round];
+   }
+   t1 = bench_time();
+   bench_report_ops("numconv_formatU64", (size_t) NUM_ROUNDS * NUM_VALUES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (i = 0u; i < NUM_VALUES; i++)
+      {
+         g_bench_sink += strtoull(&text[i * TEXT_SIZE], (char**) 0, 10);
+      }
+   }
+   t1 = bench_time();
+   bench_report_ops("strtoull", (size_t) NUM_ROUNDS * NUM_VALUES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (i = 0u; i < NUM_VALUES; i++)
+      {
+         const char *p = &text[i * TEXT_SIZE];
+         uint64_t value = 0u;
+         numconv_parseU64(p, strlen(p), &value);
+         g_bench_sink += value;
+      }
+   }
+   t1 = bench_time();
+   bench_report_ops("numconv_parseU64", (size_t) NUM_ROUNDS * NUM_VALUES, t1 - t0);
+}
+
+/**
+ * snprintf uses %.17g, the shortest format that always round trips.
+ */
+static void bench_doubles(const double *values, char *text)
+{
+   size_t i;
+   int round;
+   double t0, t1;
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS / 10; round++)
+   {
+      for (i = 0u; i < NUM_VALUES; i++)
+      {
+         g_bench_sink += (uint64_t) snprintf(&text[i * TEXT_SIZE], TEXT_SIZE, "%.17g", values[i]);
+      }
+   }
+   t1 = bench_time();
+   bench_report_ops("snprintf %.17g", (size_t) (NUM_ROUNDS / 10) * NUM_VALUES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS / 10; round++)
+   {
+      for (i = 0u; i < NUM_VALUES; i++)
+      {
+         g_bench_sink += (uint64_t) (int64_t) strtod(&text[i * TEXT_SIZE], (char**) 0);
+      }
+   }
+   t1 = bench_time();
+   bench_report_ops("strtod (17 digits)", (size_t) (NUM_ROUNDS / 10) * NUM_VALUES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS / 10; round++)
+   {
+      for (i = 0u; i < NUM_VALUES; i++)
+      {
+         char *p = &text[i * TEXT_SIZE];
+         p[numconv_formatDouble(p, values[i])] = '\0';
+      }
+      g_bench_sink += (uint8_t) text[round];
+   }
+   t1 = bench_time();
+   bench_report_ops("numconv_formatDouble", (size_t) (NUM_ROUNDS / 10) * NUM_VALUES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS / 10; round++)
+   {
+      for (i = 0u; i < NUM_VALUES; i++)
+      {
+         g_bench_sink += (uint64_t) (int64_t) strtod(&text[i * TEXT_SIZE], (char**) 0);
+      }
+   }
+   t1 = bench_time();
+   bench_report_ops("strtod (shortest)", (size_t) (NUM_ROUNDS / 10) * NUM_VALUES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS / 10; round++)
+   {
+      for (i = 0u; i < NUM_VALUES; i++)
+      {
+         const char *p = &text[i * TEXT_SIZE];
+         double value = 0.0;
+         numconv_parseDouble(p, strlen(p), &value);
+         g_bench_sink += (uint64_t) (int64_t) value;
+      }
+   }
+   t1 = bench_time();
+   bench_report_ops("numconv_parseDouble (shortest)", (size_t) (NUM_ROUNDS / 10) * NUM_VALUES, t1 - t0);
+}
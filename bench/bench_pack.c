@@ -0,0 +1,189 @@
+/*****************************************************************************
+* \file      bench_pack.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Throughput of generic versus fixed-width pack routines
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "pack.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define BUF_SIZE ((size_t) 1u << 16)
+#define NUM_ROUNDS 2000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_pack(void);
+static void bench_width(uint8_t *buf, unsigned width);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_pack(void)
+{
+   uint8_t *buf = (uint8_t*) malloc(BUF_SIZE);
+   if (buf == 0)
+   {
+      printf("out of memory\n");
+      return;
+   }
+   bench_fill_random(buf, BUF_SIZE, 1u);
+   bench_width(buf, 2u);
+   bench_width(buf, 4u);
+   bench_width(buf, 8u);
+   free(buf);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Each round unpacks every element of buf and packs it back again, first using the
+ * length-generic functions and then using the fixed-width inline functions.
+ */
+static void bench_width(uint8_t *buf, unsigned width)
+{
+   char name[64];
+   int round;
+   size_t i;
+   uint64_t sum = 0u;
+   const size_t numBytes = (size_t) NUM_ROUNDS * BUF_SIZE * 2u;
+   double t0, t1;
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (i = 0u; i < BUF_SIZE; i += width)
+      {
+         uint64_t value = (width == 8u)? unpackLE64(&buf[i], width) : unpackLE(&buf[i], width);
+         sum += value;
+         if (width == 8u)
+         {
+            packLE64(&buf[i], value + 1u, width);
+         }
+         else
+         {
+            packLE(&buf[i], (uint32_t) value + 1u, width);
+         }
+      }
+   }
+   t1 = bench_time();
+   sprintf(name, "packLE/unpackLE u%u", width * 8u);
+   bench_report_rate(name, numBytes, t1 - t0);
+
+   if (width < 8u) //there is no 64-bit variant of packBE
+   {
+      t0 = bench_time();
+      for (round = 0; round < NUM_ROUNDS; round++)
+      {
+         for (i = 0u; i < BUF_SIZE; i += width)
+         {
+            uint32_t value = unpackBE(&buf[i], width);
+            sum += value;
+            packBE(&buf[i], value + 1u, width);
+         }
+      }
+      t1 = bench_time();
+      sprintf(name, "packBE/unpackBE u%u", width * 8u);
+      bench_report_rate(name, numBytes, t1 - t0);
+   }
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      switch (width)
+      {
+      case 2u:
+         for (i = 0u; i < BUF_SIZE; i += 2u)
+         {
+            uint16_t value = unpack_u16le(&buf[i]);
+            sum += value;
+            pack_u16le(&buf[i], (uint16_t) (value + 1u));
+         }
+         break;
+      case 4u:
+         for (i = 0u; i < BUF_SIZE; i += 4u)
+         {
+            uint32_t value = unpack_u32le(&buf[i]);
+            sum += value;
+            pack_u32le(&buf[i], value + 1u);
+         }
+         break;
+      default:
+         for (i = 0u; i < BUF_SIZE; i += 8u)
+         {
+            uint64_t value = unpack_u64le(&buf[i]);
+            sum += value;
+            pack_u64le(&buf[i], value + 1u);
+         }
+         break;
+      }
+   }
+   t1 = bench_time();
+   sprintf(name, "pack_u%ule/unpack_u%ule", width * 8u, width * 8u);
+   bench_report_rate(name, numBytes, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      switch (width)
+      {
+      case 2u:
+         for (i = 0u; i < BUF_SIZE; i += 2u)
+         {
+            uint16_t value = unpack_u16be(&buf[i]);
+            sum += value;
+            pack_u16be(&buf[i], (uint16_t) (value + 1u));
+         }
+         break;
+      case 4u:
+         for (i = 0u; i < BUF_SIZE; i += 4u)
+         {
+            uint32_t value = unpack_u32be(&buf[i]);
+            sum += value;
+            pack_u32be(&buf[i], value + 1u);
+         }
+         break;
+      default:
+         for (i = 0u; i < BUF_SIZE; i += 8u)
+         {
+            uint64_t value = unpack_u64be(&buf[i]);
+            sum += value;
+            pack_u64be(&buf[i], value + 1u);
+         }
+         break;
+      }
+   }
+   t1 = bench_time();
+   sprintf(name, "pack_u%ube/unpack_u%ube", width * 8u, width * 8u);
+   bench_report_rate(name, numBytes, t1 - t0);
+   g_bench_sink += sum;
+}
@@ -0,0 +1,166 @@
+/*****************************************************************************
+* \file      bench_pack_array.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Throughput of bulk array pack versus per-element pack
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "pack.h"
+#include "pack_array.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_ELEMENTS 4096u
+#define NUM_ROUNDS 20000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_pack_array(void);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_pack_array(void)
+{
+   int round;
+   size_t i;
+   const size_t numBytes16 = (size_t) NUM_ROUNDS * NUM_ELEMENTS * sizeof(uint16_t);
+   const size_t numBytes32 = (size_t) NUM_ROUNDS * NUM_ELEMENTS * sizeof(uint32_t);
+   const size_t numBytes64 = (size_t) NUM_ROUNDS * NUM_ELEMENTS * sizeof(uint64_t);
+   double t0, t1;
+   uint64_t *values = (uint64_t*) malloc(NUM_ELEMENTS * sizeof(uint64_t));
+   uint8_t *buf = (uint8_t*) malloc(NUM_ELEMENTS * sizeof(uint64_t));
+   if ( (values == 0) || (buf == 0) )
+   {
+      printf("out of memory\n");
+      free(values);
+      free(buf);
+      return;
+   }
+   bench_fill_random((uint8_t*) values, NUM_ELEMENTS * sizeof(uint64_t), 7u);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      const uint16_t *src = (const uint16_t*) values;
+      for (i = 0u; i < NUM_ELEMENTS; i++)
+      {
+         packBE(&buf[i * 2u], src[i], 2u);
+      }
+      g_bench_sink += buf[round & 0xFF];
+   }
+   t1 = bench_time();
+   bench_report_rate("packBE loop u16", numBytes16, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      packArrayU16BE(buf, (const uint16_t*) values, NUM_ELEMENTS);
+      g_bench_sink += buf[round & 0xFF];
+   }
+   t1 = bench_time();
+   bench_report_rate("packArrayU16BE", numBytes16, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      const uint32_t *src = (const uint32_t*) values;
+      for (i = 0u; i < NUM_ELEMENTS; i++)
+      {
+         packBE(&buf[i * 4u], src[i], 4u);
+      }
+      g_bench_sink += buf[round & 0xFF];
+   }
+   t1 = bench_time();
+   bench_report_rate("packBE loop u32", numBytes32, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      packArrayU32BE(buf, (const uint32_t*) values, NUM_ELEMENTS);
+      g_bench_sink += buf[round & 0xFF];
+   }
+   t1 = bench_time();
+   bench_report_rate("packArrayU32BE", numBytes32, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      uint32_t *dst = (uint32_t*) values;
+      for (i = 0u; i < NUM_ELEMENTS; i++)
+      {
+         dst[i] = unpackLE(&buf[i * 4u], 4u);
+      }
+      g_bench_sink += dst[round & 0xFF];
+   }
+   t1 = bench_time();
+   bench_report_rate("unpackLE loop u32", numBytes32, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      unpackArrayU32LE((uint32_t*) values, buf, NUM_ELEMENTS);
+      g_bench_sink += values[round & 0xFF];
+   }
+   t1 = bench_time();
+   bench_report_rate("unpackArrayU32LE", numBytes32, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (i = 0u; i < NUM_ELEMENTS; i++)
+      {
+         pack_u64be(&buf[i * 8u], values[i]);
+      }
+      g_bench_sink += buf[round & 0xFF];
+   }
+   t1 = bench_time();
+   bench_report_rate("pack_u64be loop", numBytes64, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      packArrayU64BE(buf, values, NUM_ELEMENTS);
+      g_bench_sink += buf[round & 0xFF];
+   }
+   t1 = bench_time();
+   bench_report_rate("packArrayU64BE", numBytes64, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      swapArrayU64(values, NUM_ELEMENTS);
+      g_bench_sink += values[round & 0xFF];
+   }
+   t1 = bench_time();
+   bench_report_rate("swapArrayU64", numBytes64, t1 - t0);
+
+   free(values);
+   free(buf);
+}
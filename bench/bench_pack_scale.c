@@ -0,0 +1,178 @@
+/*****************************************************************************
+* \file      bench_pack_scale.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for pack_scale
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "pack_scale.h"
+#include "cutil_cpu.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_SAMPLES 4096u
+#define NUM_ROUNDS 20000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_pack_scale(void);
+static void bench_loops(int16_t *raw, float *f32, double *f64);
+static void bench_kernel(const char *label, int16_t *raw, float *f32, double *f64);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const uint32_t m_kernel_features[] = {0u, CUTIL_CPU_ALL};
+static const char *m_kernel_names[] = {"scalar", "best"};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_pack_scale(void)
+{
+   int16_t *raw = (int16_t*) malloc(NUM_SAMPLES * sizeof(int16_t));
+   float *f32 = (float*) malloc(NUM_SAMPLES * sizeof(float));
+   double *f64 = (double*) malloc(NUM_SAMPLES * sizeof(double));
+   if ( (raw != 0) && (f32 != 0) && (f64 != 0) )
+   {
+      size_t i;
+      bench_fill_random((uint8_t*) raw, NUM_SAMPLES * sizeof(int16_t), 4u);
+      bench_loops(raw, f32, f64);
+      for (i = 0u; i < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); i++)
+      {
+         cutil_cpu_override(m_kernel_features[i]);
+         bench_kernel(m_kernel_names[i], raw, f32, f64);
+      }
+      cutil_cpu_reset();
+   }
+   else
+   {
+      printf("out of memory\n");
+   }
+   free(raw);
+   free(f32);
+   free(f64);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The per-sample loops this module replaces (rounding and saturation written out as usual)
+ */
+static void bench_loops(int16_t *raw, float *f32, double *f64)
+{
+   size_t i;
+   int round;
+   double t0, t1;
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (i = 0u; i < NUM_SAMPLES; i++)
+      {
+         f32[i] = raw[i] * 0.1f - 40.0f;
+      }
+      g_bench_sink += (uint64_t) (int64_t) f32[round % NUM_SAMPLES];
+   }
+   t1 = bench_time();
+   bench_report_ops("s16 -> f32 loop", (size_t) NUM_ROUNDS * NUM_SAMPLES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (i = 0u; i < NUM_SAMPLES; i++)
+      {
+         float x = (f32[i] + 40.0f) / 0.1f;
+         x = (x > 32767.0f)? 32767.0f : (x < -32768.0f)? -32768.0f : x;
+         raw[i] = (int16_t) ((x < 0.0f)? (x - 0.5f) : (x + 0.5f));
+      }
+      g_bench_sink += (uint16_t) raw[round % NUM_SAMPLES];
+   }
+   t1 = bench_time();
+   bench_report_ops("f32 -> s16 loop", (size_t) NUM_ROUNDS * NUM_SAMPLES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (i = 0u; i < NUM_SAMPLES; i++)
+      {
+         f64[i] = raw[i] * 0.1 - 40.0;
+      }
+      g_bench_sink += (uint64_t) (int64_t) f64[round % NUM_SAMPLES];
+   }
+   t1 = bench_time();
+   bench_report_ops("s16 -> f64 loop", (size_t) NUM_ROUNDS * NUM_SAMPLES, t1 - t0);
+}
+
+static void bench_kernel(const char *label, int16_t *raw, float *f32, double *f64)
+{
+   char name[64];
+   int round;
+   double t0, t1;
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      pack_scale_s16ToF32(f32, raw, NUM_SAMPLES, 0.1f, -40.0f);
+      g_bench_sink += (uint64_t) (int64_t) f32[round % NUM_SAMPLES];
+   }
+   t1 = bench_time();
+   sprintf(name, "pack_scale_s16ToF32 (%s)", label);
+   bench_report_ops(name, (size_t) NUM_ROUNDS * NUM_SAMPLES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      pack_scale_f32ToS16(raw, f32, NUM_SAMPLES, 0.1f, -40.0f);
+      g_bench_sink += (uint16_t) raw[round % NUM_SAMPLES];
+   }
+   t1 = bench_time();
+   sprintf(name, "pack_scale_f32ToS16 (%s)", label);
+   bench_report_ops(name, (size_t) NUM_ROUNDS * NUM_SAMPLES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      pack_scale_s16ToF64(f64, raw, NUM_SAMPLES, 0.1, -40.0);
+      g_bench_sink += (uint64_t) (int64_t) f64[round % NUM_SAMPLES];
+   }
+   t1 = bench_time();
+   sprintf(name, "pack_scale_s16ToF64 (%s)", label);
+   bench_report_ops(name, (size_t) NUM_ROUNDS * NUM_SAMPLES, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      pack_scale_f64ToS16(raw, f64, NUM_SAMPLES, 0.1, -40.0);
+      g_bench_sink += (uint16_t) raw[round % NUM_SAMPLES];
+   }
+   t1 = bench_time();
+   sprintf(name, "pack_scale_f64ToS16 (%s)", label);
+   bench_report_ops(name, (size_t) NUM_ROUNDS * NUM_SAMPLES, t1 - t0);
+}
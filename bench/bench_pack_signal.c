@@ -0,0 +1,143 @@
+/*****************************************************************************
+* \file      bench_pack_signal.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Signal extraction throughput
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include "bench.h"
+#include "pack_signal.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define FRAME_SIZE 64u
+#define NUM_SIGNALS 32u
+#define NUM_FRAMES 256u
+#define NUM_ROUNDS 2000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_pack_signal(void);
+static uint64_t get_bitwise(const pack_signal_t *signal, const uint8_t *frame);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static uint8_t m_frames[NUM_FRAMES][FRAME_SIZE];
+static pack_signal_t m_signals[NUM_SIGNALS];
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Extracts 32 signals of 3 to 20 bits (mixed bit order) from each of 256 CAN FD frames.
+ */
+void bench_pack_signal(void)
+{
+   static const uint8_t lengths[4] = {3u, 12u, 20u, 7u};
+   int round;
+   size_t f, i;
+   unsigned bit = 0u;
+   uint64_t values[NUM_SIGNALS];
+   const size_t numOps = (size_t) NUM_ROUNDS * NUM_FRAMES * NUM_SIGNALS;
+   double t0, t1;
+   bench_fill_random(&m_frames[0][0], sizeof(m_frames), 11u);
+   for (i = 0u; i < NUM_SIGNALS; i++)
+   {
+      m_signals[i].bitLength = lengths[i % 4u];
+      m_signals[i].flags = (i & 1u)? PACK_SIGNAL_MOTOROLA : PACK_SIGNAL_INTEL;
+      //Motorola start bits name the MSB which is the top bit of the first byte for byte aligned signals
+      m_signals[i].startBit = (uint16_t) ((m_signals[i].flags == PACK_SIGNAL_MOTOROLA)? ((bit & ~7u) + 7u - (bit & 7u)) : bit);
+      bit += m_signals[i].bitLength + 3u;
+   }
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (f = 0u; f < NUM_FRAMES; f++)
+      {
+         for (i = 0u; i < NUM_SIGNALS; i++)
+         {
+            g_bench_sink += get_bitwise(&m_signals[i], m_frames[f]);
+         }
+      }
+   }
+   t1 = bench_time();
+   bench_report_ops("bit by bit", numOps, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (f = 0u; f < NUM_FRAMES; f++)
+      {
+         for (i = 0u; i < NUM_SIGNALS; i++)
+         {
+            g_bench_sink += pack_signal_get(&m_signals[i], m_frames[f], FRAME_SIZE);
+         }
+      }
+   }
+   t1 = bench_time();
+   bench_report_ops("pack_signal_get", numOps, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (f = 0u; f < NUM_FRAMES; f++)
+      {
+         pack_signal_extract(m_signals, NUM_SIGNALS, m_frames[f], FRAME_SIZE, values);
+         g_bench_sink += values[f % NUM_SIGNALS];
+      }
+   }
+   t1 = bench_time();
+   bench_report_ops("pack_signal_extract", numOps, t1 - t0);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static uint64_t get_bitwise(const pack_signal_t *signal, const uint8_t *frame)
+{
+   uint64_t value = 0u;
+   unsigned i;
+   unsigned bit = signal->startBit;
+   for (i = 0u; i < signal->bitLength; i++)
+   {
+      unsigned b = (frame[bit / 8u] >> (bit % 8u)) & 1u;
+      if (signal->flags & PACK_SIGNAL_MOTOROLA)
+      {
+         value = (value << 1) | b;
+         bit = ((bit % 8u) == 0u)? bit + 15u : bit - 1u;
+      }
+      else
+      {
+         value |= (uint64_t) b << i;
+         bit++;
+      }
+   }
+   return value;
+}
@@ -0,0 +1,150 @@
+/*****************************************************************************
+* \file      bench_pack_struct.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Throughput of descriptor-driven struct serialization
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "pack.h"
+#include "pack_struct.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_RECORDS 4096u
+#define NUM_ROUNDS 2000
+#define WIRE_SIZE 32u
+
+typedef struct record_tag
+{
+   uint32_t id;
+   uint32_t sequence;
+   uint16_t x;
+   uint16_t y;
+   uint16_t z;
+   uint16_t status;
+   uint64_t timestamp;
+   uint32_t value;
+   uint32_t crc;
+} record_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_pack_struct(void);
+static void pack_by_hand(uint8_t *dst, const record_t *records, size_t count);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const pack_field_t m_fields[] =
+{
+   PACK_FIELD(record_t, id, PACK_FIELD_BIG_ENDIAN),
+   PACK_FIELD(record_t, sequence, PACK_FIELD_BIG_ENDIAN),
+   PACK_FIELD(record_t, x, PACK_FIELD_BIG_ENDIAN),
+   PACK_FIELD(record_t, y, PACK_FIELD_BIG_ENDIAN),
+   PACK_FIELD(record_t, z, PACK_FIELD_BIG_ENDIAN),
+   PACK_FIELD(record_t, status, PACK_FIELD_BIG_ENDIAN),
+   PACK_FIELD(record_t, timestamp, PACK_FIELD_BIG_ENDIAN),
+   PACK_FIELD(record_t, value, PACK_FIELD_BIG_ENDIAN),
+   PACK_FIELD(record_t, crc, PACK_FIELD_BIG_ENDIAN)
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_pack_struct(void)
+{
+   int round;
+   pack_plan_t plan;
+   double t0, t1;
+   const size_t numBytes = (size_t) NUM_ROUNDS * NUM_RECORDS * WIRE_SIZE;
+   record_t *records = (record_t*) malloc(NUM_RECORDS * sizeof(record_t));
+   uint8_t *buf = (uint8_t*) malloc(NUM_RECORDS * WIRE_SIZE);
+   if ( (records == 0) || (buf == 0) ||
+        (pack_plan_create(&plan, m_fields, sizeof(m_fields) / sizeof(m_fields[0])) != 0) )
+   {
+      printf("initialization failed\n");
+      free(records);
+      free(buf);
+      return;
+   }
+   bench_fill_random((uint8_t*) records, NUM_RECORDS * sizeof(record_t), 3u);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      pack_by_hand(buf, records, NUM_RECORDS);
+      g_bench_sink += buf[round & 0xFF];
+   }
+   t1 = bench_time();
+   bench_report_rate("packBE sequence", numBytes, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      g_bench_sink += pack_plan_pack(&plan, buf, records, NUM_RECORDS, sizeof(record_t));
+   }
+   t1 = bench_time();
+   bench_report_rate("pack_plan_pack", numBytes, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      g_bench_sink += pack_plan_unpack(&plan, records, NUM_RECORDS, sizeof(record_t), buf);
+   }
+   t1 = bench_time();
+   bench_report_rate("pack_plan_unpack", numBytes, t1 - t0);
+
+   pack_plan_destroy(&plan);
+   free(records);
+   free(buf);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void pack_by_hand(uint8_t *dst, const record_t *records, size_t count)
+{
+   size_t i;
+   for (i = 0u; i < count; i++)
+   {
+      const record_t *r = &records[i];
+      uint8_t *p = &dst[i * WIRE_SIZE];
+      packU32BE(p, r->id);
+      packU32BE(p, r->sequence);
+      packU16BE(p, r->x);
+      packU16BE(p, r->y);
+      packU16BE(p, r->z);
+      packU16BE(p, r->status);
+      packBE(p, (uint32_t) (r->timestamp >> 32), 4);
+      packBE(p + 4, (uint32_t) r->timestamp, 4);
+      p += 8;
+      packU32BE(p, r->value);
+      packU32BE(p, r->crc);
+   }
+}
@@ -0,0 +1,126 @@
+/*****************************************************************************
+* \file      bench_pack_varint.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Decoding throughput of LEB128 and stream-vbyte
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "pack_varint.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_VALUES 8192u
+#define NUM_ROUNDS 5000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_pack_varint(void);
+static void bench_distribution(const char *label, uint32_t *values, uint32_t *decoded, uint8_t *buf, unsigned maxBits);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_pack_varint(void)
+{
+   uint32_t *values = (uint32_t*) malloc(NUM_VALUES * sizeof(uint32_t));
+   uint32_t *decoded = (uint32_t*) malloc(NUM_VALUES * sizeof(uint32_t));
+   uint8_t *buf = (uint8_t*) malloc(STREAMVBYTE_MAX_SIZE(NUM_VALUES) + VARINT_MAX_SIZE_U32 * NUM_VALUES);
+   if ( (values != 0) && (decoded != 0) && (buf != 0) )
+   {
+      bench_distribution("7-bit", values, decoded, buf, 7u);
+      bench_distribution("16-bit", values, decoded, buf, 16u);
+      bench_distribution("32-bit", values, decoded, buf, 32u);
+   }
+   else
+   {
+      printf("out of memory\n");
+   }
+   free(values);
+   free(decoded);
+   free(buf);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Reports decoded bytes (4 per value) per second for values uniformly distributed in [0, 2^maxBits).
+ */
+static void bench_distribution(const char *label, uint32_t *values, uint32_t *decoded, uint8_t *buf, unsigned maxBits)
+{
+   char name[64];
+   int round;
+   size_t i;
+   size_t size;
+   const size_t numBytes = (size_t) NUM_ROUNDS * NUM_VALUES * sizeof(uint32_t);
+   double t0, t1;
+   bench_fill_random((uint8_t*) values, NUM_VALUES * sizeof(uint32_t), maxBits);
+   if (maxBits < 32u)
+   {
+      for (i = 0u; i < NUM_VALUES; i++)
+      {
+         values[i] &= (1u << maxBits) - 1u;
+      }
+   }
+
+   size = packVarintArrayU32(buf, values, NUM_VALUES);
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      size_t offset = 0u;
+      for (i = 0u; i < NUM_VALUES; i++)
+      {
+         offset += unpackVarintU32(&buf[offset], size - offset, &decoded[i]);
+      }
+      g_bench_sink += decoded[round % NUM_VALUES];
+   }
+   t1 = bench_time();
+   sprintf(name, "unpackVarintU32 loop (%s)", label);
+   bench_report_rate(name, numBytes, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      g_bench_sink += unpackVarintArrayU32(decoded, NUM_VALUES, buf, size);
+   }
+   t1 = bench_time();
+   sprintf(name, "unpackVarintArrayU32 (%s)", label);
+   bench_report_rate(name, numBytes, t1 - t0);
+
+   size = streamvbyteEncode(buf, values, NUM_VALUES);
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      g_bench_sink += streamvbyteDecode(decoded, NUM_VALUES, buf, size);
+   }
+   t1 = bench_time();
+   sprintf(name, "streamvbyteDecode (%s)", label);
+   bench_report_rate(name, numBytes, t1 - t0);
+}
@@ -0,0 +1,195 @@
+/*****************************************************************************
+* \file      bench_sha256.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for sha256
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "sha256.h"
+#include "cutil_cpu.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define BUF_SIZE ((size_t) 1u << 20)
+#define NUM_ROUNDS 50
+#define SMALL_MESSAGE_SIZE 64u
+#define MAX_RECORDS (BUF_SIZE / SMALL_MESSAGE_SIZE)
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_sha256(void);
+static void bench_kernel(const char *label, const uint8_t *data);
+static void bench_sha512_family(const uint8_t *data);
+static void bench_many(const uint8_t *data, size_t recordSize, const void **inputs, size_t *lens, uint8_t (*hashes)[32]);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const uint32_t m_kernel_features[] = {0u, CUTIL_CPU_ALL};
+static const char *m_kernel_names[] = {"scalar", "best"};
+static const uint32_t m_many_features[] = {0u, CUTIL_CPU_SSE2, CUTIL_CPU_AVX2 | CUTIL_CPU_SSE2, CUTIL_CPU_ALL};
+static const char *m_many_names[] = {"scalar", "sse2", "avx2", "best"};
+static const size_t m_record_sizes[] = {64u, 256u, 1024u};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_sha256(void)
+{
+   uint8_t *data = (uint8_t*) malloc(BUF_SIZE);
+   const void **inputs = (const void**) malloc(MAX_RECORDS * sizeof(void*));
+   size_t *lens = (size_t*) malloc(MAX_RECORDS * sizeof(size_t));
+   uint8_t (*hashes)[32] = (uint8_t(*)[32]) malloc(MAX_RECORDS * 32u);
+   if ( (data != 0) && (inputs != 0) && (lens != 0) && (hashes != 0) )
+   {
+      size_t i;
+      bench_fill_random(data, BUF_SIZE, 6u);
+      for (i = 0u; i < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); i++)
+      {
+         cutil_cpu_override(m_kernel_features[i]);
+         bench_kernel(m_kernel_names[i], data);
+      }
+      cutil_cpu_reset();
+      bench_sha512_family(data);
+      for (i = 0u; i < sizeof(m_record_sizes) / sizeof(m_record_sizes[0]); i++)
+      {
+         bench_many(data, m_record_sizes[i], inputs, lens, hashes);
+      }
+   }
+   else
+   {
+      printf("out of memory\n");
+   }
+   free(data);
+   free((void*) inputs);
+   free(lens);
+   free(hashes);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void bench_kernel(const char *label, const uint8_t *data)
+{
+   char name[64];
+   uint8_t hash[SHA256_HASH_SIZE];
+   int round;
+   size_t offset;
+   double t0, t1;
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      sha256_calc(hash, data, BUF_SIZE);
+      g_bench_sink += hash[0];
+   }
+   t1 = bench_time();
+   sprintf(name, "sha256_calc 1 MiB (%s)", label);
+   bench_report_rate(name, (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS / 10; round++)
+   {
+      for (offset = 0u; offset < BUF_SIZE; offset += SMALL_MESSAGE_SIZE)
+      {
+         sha256_calc(hash, &data[offset], SMALL_MESSAGE_SIZE);
+         g_bench_sink += hash[0];
+      }
+   }
+   t1 = bench_time();
+   sprintf(name, "sha256_calc 64 bytes (%s)", label);
+   bench_report_ops(name, (size_t) (NUM_ROUNDS / 10) * (BUF_SIZE / SMALL_MESSAGE_SIZE), t1 - t0);
+}
+
+static void bench_sha512_family(const uint8_t *data)
+{
+   uint8_t hash[SHA512_HASH_SIZE];
+   int round;
+   double t0, t1;
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      sha512_calc(hash, data, BUF_SIZE);
+      g_bench_sink += hash[0];
+   }
+   t1 = bench_time();
+   bench_report_rate("sha512_calc 1 MiB", (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      sha512_256_calc(hash, data, BUF_SIZE);
+      g_bench_sink += hash[0];
+   }
+   t1 = bench_time();
+   bench_report_rate("sha512_256_calc 1 MiB", (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+}
+
+/**
+ * Messages per second for a batch of equally sized records: looping over sha256_calc with the
+ * best single-buffer kernel versus sha256_calc_many with each lane width.
+ */
+static void bench_many(const uint8_t *data, size_t recordSize, const void **inputs, size_t *lens, uint8_t (*hashes)[32])
+{
+   char name[64];
+   const size_t numRecords = BUF_SIZE / recordSize;
+   int round;
+   size_t i;
+   double t0, t1;
+   for (i = 0u; i < numRecords; i++)
+   {
+      inputs[i] = &data[i * recordSize];
+      lens[i] = recordSize;
+   }
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS / 10; round++)
+   {
+      for (i = 0u; i < numRecords; i++)
+      {
+         sha256_calc(hashes[i], inputs[i], lens[i]);
+      }
+      g_bench_sink += hashes[0][0];
+   }
+   t1 = bench_time();
+   sprintf(name, "sha256_calc loop %u bytes", (unsigned) recordSize);
+   bench_report_ops(name, (size_t) (NUM_ROUNDS / 10) * numRecords, t1 - t0);
+   for (i = 0u; i < sizeof(m_many_features) / sizeof(m_many_features[0]); i++)
+   {
+      cutil_cpu_override(m_many_features[i]);
+      t0 = bench_time();
+      for (round = 0; round < NUM_ROUNDS / 10; round++)
+      {
+         sha256_calc_many(hashes, inputs, lens, numRecords);
+         g_bench_sink += hashes[0][0];
+      }
+      t1 = bench_time();
+      sprintf(name, "sha256_calc_many %u bytes (%s)", (unsigned) recordSize, m_many_names[i]);
+      bench_report_ops(name, (size_t) (NUM_ROUNDS / 10) * numRecords, t1 - t0);
+   }
+   cutil_cpu_reset();
+}
@@ -0,0 +1,98 @@
+/*****************************************************************************
+* \file      bench_sha256_tree.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for sha256_tree
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "sha256_tree.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define BUF_SIZE ((size_t) 64u << 20)
+#define LEAF_SIZE ((size_t) 64u << 10)
+#define NUM_ROUNDS 5
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_sha256_tree(void);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const unsigned m_thread_counts[] = {1u, 2u, 4u, 0u};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_sha256_tree(void)
+{
+   uint8_t *data = (uint8_t*) malloc(BUF_SIZE);
+   if (data != 0)
+   {
+      char name[64];
+      uint8_t root[SHA256_HASH_SIZE];
+      int round;
+      size_t i;
+      double t0, t1;
+      bench_fill_random(data, BUF_SIZE, 7u);
+      t0 = bench_time();
+      for (round = 0; round < NUM_ROUNDS; round++)
+      {
+         sha256_calc(root, data, BUF_SIZE);
+         g_bench_sink += root[0];
+      }
+      t1 = bench_time();
+      bench_report_rate("sha256_calc 64 MiB", (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+      for (i = 0u; i < sizeof(m_thread_counts) / sizeof(m_thread_counts[0]); i++)
+      {
+         t0 = bench_time();
+         for (round = 0; round < NUM_ROUNDS; round++)
+         {
+            (void) sha256_tree_calc(root, NULL, data, BUF_SIZE, LEAF_SIZE, m_thread_counts[i]);
+            g_bench_sink += root[0];
+         }
+         t1 = bench_time();
+         if (m_thread_counts[i] == 0u)
+         {
+            sprintf(name, "sha256_tree_calc 64 MiB (all cpus)");
+         }
+         else
+         {
+            sprintf(name, "sha256_tree_calc 64 MiB (%u threads)", m_thread_counts[i]);
+         }
+         bench_report_rate(name, (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+      }
+   }
+   else
+   {
+      printf("out of memory\n");
+   }
+   free(data);
+}
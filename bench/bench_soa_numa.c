@@ -0,0 +1,195 @@
+/*****************************************************************************
+* \file      bench_soa_numa.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Local vs remote node access with and without soa_numa_t
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "soa.h"
+#include "soa_numa.h"
+#ifndef _WIN32
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define MAX_THREADS 16
+#define OBJECTS_PER_THREAD 50000
+#define OBJECT_SIZE 32u
+#define NUM_ROUNDS 200
+
+typedef struct worker_tag
+{
+   soa_numa_t *numa;      //NULL when objects are preallocated by main thread
+   uint64_t **objects;
+   size_t num_local;
+   size_t num_remote;
+   size_t num_unknown;
+   double seconds;
+} worker_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+#ifndef _WIN32
+static void *worker_main(void *arg);
+static void run_workers(const char *name, worker_t *workers, int numThreads);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_soa_numa(void)
+{
+#ifdef _WIN32
+   printf("not supported on this platform\n");
+#else
+   worker_t workers[MAX_THREADS];
+   soa_t shared;
+   soa_numa_t numa;
+   int i;
+   size_t j;
+   long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+   int numThreads = (numCpus < 2)? 2 : (numCpus > MAX_THREADS)? MAX_THREADS : (int) numCpus;
+
+   printf("max_node=%d threads=%d objects/thread=%d\n", soa_numa_max_node(), numThreads, OBJECTS_PER_THREAD);
+
+   //Baseline: all objects are allocated and first touched by the main thread
+   soa_init(&shared);
+   for (i = 0; i < numThreads; i++)
+   {
+      memset(&workers[i], 0, sizeof(worker_t));
+      workers[i].objects = (uint64_t**) malloc(OBJECTS_PER_THREAD * sizeof(uint64_t*));
+      for (j = 0u; j < OBJECTS_PER_THREAD; j++)
+      {
+         workers[i].objects[j] = (uint64_t*) soa_alloc(&shared, OBJECT_SIZE);
+         memset(workers[i].objects[j], 0, OBJECT_SIZE);
+      }
+   }
+   run_workers("soa_t (main thread first-touch)", workers, numThreads);
+   soa_destroy(&shared);
+
+   //Each thread allocates from the arena of its own node
+   soa_numa_init(&numa);
+   for (i = 0; i < numThreads; i++)
+   {
+      workers[i].numa = &numa;
+   }
+   run_workers("soa_numa_t (node-local arenas)", workers, numThreads);
+   for (i = 0; i < numThreads; i++)
+   {
+      for (j = 0u; j < OBJECTS_PER_THREAD; j++)
+      {
+         soa_numa_free(&numa, workers[i].objects[j], OBJECT_SIZE);
+      }
+      free(workers[i].objects);
+   }
+   soa_numa_destroy(&numa);
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+#ifndef _WIN32
+static void *worker_main(void *arg)
+{
+   worker_t *worker = (worker_t*) arg;
+   size_t j;
+   int round;
+   int node;
+   double t0;
+   uint64_t sum = 0u;
+   if (worker->numa != 0)
+   {
+      for (j = 0u; j < OBJECTS_PER_THREAD; j++)
+      {
+         worker->objects[j] = (uint64_t*) soa_numa_alloc(worker->numa, OBJECT_SIZE);
+         memset(worker->objects[j], 0, OBJECT_SIZE);
+      }
+   }
+   node = soa_numa_current_node();
+   worker->num_local = worker->num_remote = worker->num_unknown = 0u;
+   for (j = 0u; j < OBJECTS_PER_THREAD; j++)
+   {
+      int objectNode = soa_numa_node_of(worker->objects[j]);
+      if (objectNode < 0)
+      {
+         worker->num_unknown++;
+      }
+      else if (objectNode == node)
+      {
+         worker->num_local++;
+      }
+      else
+      {
+         worker->num_remote++;
+      }
+   }
+   t0 = bench_time();
+   for (round = 0; round < NUM_ROUNDS; round++)
+   {
+      for (j = 0u; j < OBJECTS_PER_THREAD; j++)
+      {
+         uint64_t *p = worker->objects[j];
+         p[0] += (uint64_t) round;
+         sum += p[1];
+      }
+   }
+   worker->seconds = bench_time() - t0;
+   g_bench_sink += sum;
+   return NULL;
+}
+
+static void run_workers(const char *name, worker_t *workers, int numThreads)
+{
+   pthread_t threads[MAX_THREADS];
+   size_t numLocal = 0u, numRemote = 0u, numUnknown = 0u;
+   double maxSeconds = 0.0;
+   int i;
+   for (i = 0; i < numThreads; i++)
+   {
+      pthread_create(&threads[i], NULL, worker_main, &workers[i]);
+   }
+   for (i = 0; i < numThreads; i++)
+   {
+      pthread_join(threads[i], NULL);
+      numLocal += workers[i].num_local;
+      numRemote += workers[i].num_remote;
+      numUnknown += workers[i].num_unknown;
+      if (workers[i].seconds > maxSeconds)
+      {
+         maxSeconds = workers[i].seconds;
+      }
+   }
+   printf("%-36s local=%zu remote=%zu unknown=%zu\n", name, numLocal, numRemote, numUnknown);
+   bench_report_ops(name, (size_t) numThreads * OBJECTS_PER_THREAD * NUM_ROUNDS, maxSeconds);
+}
+#endif
@@ -0,0 +1,145 @@
+/*****************************************************************************
+* \file      bench_xxh3.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for xxh3
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "xxh3.h"
+#include "sha256.h"
+#include "cutil_cpu.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define BUF_SIZE ((size_t) 1u << 20)
+#define NUM_ROUNDS 50
+#define NUM_KEY_ROUNDS 5
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_xxh3(void);
+static void bench_keys(const uint8_t *data, size_t keySize);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const uint32_t m_kernel_features[] = {0u, CUTIL_CPU_SSE2, CUTIL_CPU_AVX2 | CUTIL_CPU_SSE2, CUTIL_CPU_ALL};
+static const char *m_kernel_names[] = {"scalar", "sse2", "avx2", "best"};
+static const size_t m_key_sizes[] = {8u, 16u, 32u, 100u};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void bench_xxh3(void)
+{
+   uint8_t *data = (uint8_t*) malloc(BUF_SIZE);
+   if (data != 0)
+   {
+      char name[64];
+      uint8_t hash[SHA256_HASH_SIZE];
+      int round;
+      size_t i;
+      double t0, t1;
+      bench_fill_random(data, BUF_SIZE, 9u);
+      for (i = 0u; i < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); i++)
+      {
+         cutil_cpu_override(m_kernel_features[i]);
+         t0 = bench_time();
+         for (round = 0; round < NUM_ROUNDS; round++)
+         {
+            g_bench_sink += (uint32_t) xxh3_64(data, BUF_SIZE, 0u);
+         }
+         t1 = bench_time();
+         sprintf(name, "xxh3_64 1 MiB (%s)", m_kernel_names[i]);
+         bench_report_rate(name, (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+      }
+      cutil_cpu_reset();
+      t0 = bench_time();
+      for (round = 0; round < NUM_ROUNDS; round++)
+      {
+         g_bench_sink += (uint32_t) xxh3_128(data, BUF_SIZE, 0u).lo;
+      }
+      t1 = bench_time();
+      bench_report_rate("xxh3_128 1 MiB", (size_t) NUM_ROUNDS * BUF_SIZE, t1 - t0);
+      t0 = bench_time();
+      for (round = 0; round < NUM_ROUNDS / 10; round++)
+      {
+         sha256_calc(hash, data, BUF_SIZE);
+         g_bench_sink += hash[0];
+      }
+      t1 = bench_time();
+      bench_report_rate("sha256_calc 1 MiB", (size_t) (NUM_ROUNDS / 10) * BUF_SIZE, t1 - t0);
+      for (i = 0u; i < sizeof(m_key_sizes) / sizeof(m_key_sizes[0]); i++)
+      {
+         bench_keys(data, m_key_sizes[i]);
+      }
+   }
+   else
+   {
+      printf("out of memory\n");
+   }
+   free(data);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Hash table style keys: many short independent inputs
+ */
+static void bench_keys(const uint8_t *data, size_t keySize)
+{
+   char name[64];
+   uint8_t hash[SHA256_HASH_SIZE];
+   const size_t numKeys = BUF_SIZE / keySize;
+   int round;
+   size_t i;
+   double t0, t1;
+   t0 = bench_time();
+   for (round = 0; round < NUM_KEY_ROUNDS; round++)
+   {
+      for (i = 0u; i < numKeys; i++)
+      {
+         g_bench_sink += (uint32_t) xxh3_64(&data[i * keySize], keySize, 0u);
+      }
+   }
+   t1 = bench_time();
+   sprintf(name, "xxh3_64 %u byte keys", (unsigned) keySize);
+   bench_report_ops(name, (size_t) NUM_KEY_ROUNDS * numKeys, t1 - t0);
+   t0 = bench_time();
+   for (i = 0u; i < numKeys; i++)
+   {
+      sha256_calc(hash, &data[i * keySize], keySize);
+      g_bench_sink += hash[0];
+   }
+   t1 = bench_time();
+   sprintf(name, "sha256_calc %u byte keys", (unsigned) keySize);
+   bench_report_ops(name, numKeys, t1 - t0);
+}
@@ -0,0 +1,59 @@
+/*****************************************************************************
+* \file      base64.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Base64 encoding and decoding (RFC 4648)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef BASE64_H
+#define BASE64_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define BASE64_ENCODED_SIZE(n) ((((n) + 2u) / 3u) * 4u) //with padding, excluding null terminator
+#define BASE64_DECODED_MAX_SIZE(n) (((n) / 4u) * 3u)
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Encodes using the standard alphabet with '=' padding. Writes exactly BASE64_ENCODED_SIZE(len)
+ * characters (no null terminator) and returns that number.
+ */
+size_t base64_encode(char *dst, const uint8_t *src, size_t len);
+
+/**
+ * Decodes len characters of padded standard Base64 into dst, which must hold at least the exact decoded size.
+ * Returns false for input that is not in canonical form: length not a multiple of 4, characters outside the
+ * alphabet (including whitespace), misplaced padding or non-zero bits in the last character before padding.
+ */
+bool base64_decode(uint8_t *dst, const char *src, size_t len, size_t *dstLen);
+
+#endif //BASE64_H
@@ -0,0 +1,82 @@
+/*****************************************************************************
+* \file      cdc.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Content-defined chunking (FastCDC gear hash) for deduplication
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef CDC_H__
+#define CDC_H__
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+#include "sha256.h"
+#include "filestream.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define CDC_MIN_SIZE_DEFAULT 2048u
+#define CDC_AVG_SIZE_DEFAULT 8192u
+#define CDC_MAX_SIZE_DEFAULT 65536u
+
+typedef struct cdc_chunk_tag
+{
+   uint64_t offset;   //position of the first byte in the stream
+   uint32_t length;
+   uint8_t hash[SHA256_HASH_SIZE];
+} cdc_chunk_t;
+
+typedef void (cdc_chunk_func_t)(void *arg, const cdc_chunk_t *chunk);
+
+/**
+ * Splits a byte stream into chunks whose boundaries depend on the content only (FastCDC with
+ * normalized chunking), so that an insertion only changes the chunks around it.
+ * Each chunk is hashed with SHA-256 while the data passes through, the input is never copied.
+ */
+typedef struct cdc_chunker_tag
+{
+   uint32_t min_size;
+   uint32_t avg_size;
+   uint32_t max_size;
+   uint64_t mask_small;  //used below avg_size, more bits than mask_large which makes cuts less likely
+   uint64_t mask_large;
+   uint64_t gear_hash;
+   uint64_t offset;      //offset of current chunk
+   uint32_t chunk_len;
+   sha256_ctx_t sha;
+   cdc_chunk_func_t *on_chunk;
+   void *arg;
+} cdc_chunker_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+int cdc_chunker_create(cdc_chunker_t *self, uint32_t minSize, uint32_t avgSize, uint32_t maxSize, cdc_chunk_func_t *onChunk, void *arg);
+void cdc_chunker_reset(cdc_chunker_t *self);
+void cdc_chunker_write(cdc_chunker_t *self, const uint8_t *data, size_t len);
+void cdc_chunker_finish(cdc_chunker_t *self);
+void cdc_chunker_handler(cdc_chunker_t *self, ifstream_handler_t *handler);
+
+#endif //CDC_H__
@@ -0,0 +1,70 @@
+/*****************************************************************************
+* \file      crc.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     CRC32C and CRC-16 checksums
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef CRC_H__
+#define CRC_H__
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * CRC-16 variants, named as in the Williams/Rocksoft catalogue.
+ * All of them have check value (CRC of "123456789") given in the comment.
+ */
+typedef enum crc16_variant_tag
+{
+   CRC16_CCITT_FALSE,   //poly 0x1021, init 0xFFFF (also known as CRC-16/AUTOSAR), check 0x29B1
+   CRC16_XMODEM,        //poly 0x1021, init 0x0000, check 0x31C3
+   CRC16_KERMIT,        //poly 0x1021 reflected, init 0x0000, check 0x2189
+   CRC16_X25,           //poly 0x1021 reflected, init 0xFFFF, xorout 0xFFFF (HDLC), check 0x906E
+   CRC16_MODBUS,        //poly 0x8005 reflected, init 0xFFFF, check 0x4B37
+   CRC16_ARC,           //poly 0x8005 reflected, init 0x0000, check 0xBB3D
+   CRC16_NUM_VARIANTS
+} crc16_variant_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The update functions take the CRC of all preceding data and return the CRC including
+ * the new data, so a message can be checksummed piece by piece as it is read or written.
+ * Start with 0 for CRC32C and with crc16_init(variant) for CRC-16.
+ */
+uint32_t crc32c_calc(const uint8_t *data, size_t len);
+uint32_t crc32c_update(uint32_t crc, const uint8_t *data, size_t len);
+
+uint16_t crc16_init(crc16_variant_t variant);
+uint16_t crc16_calc(crc16_variant_t variant, const uint8_t *data, size_t len);
+uint16_t crc16_update(crc16_variant_t variant, uint16_t crc, const uint8_t *data, size_t len);
+
+#endif //CRC_H__
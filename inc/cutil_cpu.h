@@ -0,0 +1,102 @@
+/*****************************************************************************
+* \file      cutil_cpu.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Runtime CPU feature detection and kernel dispatch
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef CUTIL_CPU_H__
+#define CUTIL_CPU_H__
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define CUTIL_CPU_SSE2      0x0001u
+#define CUTIL_CPU_SSSE3     0x0002u
+#define CUTIL_CPU_SSE41     0x0004u
+#define CUTIL_CPU_SSE42     0x0008u
+#define CUTIL_CPU_PCLMUL    0x0010u
+#define CUTIL_CPU_POPCNT    0x0020u
+#define CUTIL_CPU_AVX       0x0040u
+#define CUTIL_CPU_AVX2      0x0080u
+#define CUTIL_CPU_BMI2      0x0100u
+#define CUTIL_CPU_AVX512F   0x0200u
+#define CUTIL_CPU_AVX512BW  0x0400u
+#define CUTIL_CPU_SHA       0x0800u
+#define CUTIL_CPU_ALL       0x0FFFu
+
+/**
+ * Name of the environment variable that restricts the detected features (read once, on first use).
+ * It holds a comma separated list of feature names, e.g. "sse2,ssse3" keeps only those two
+ * while "-avx2,-avx512f" removes features from the detected set. "none" disables all of them.
+ * Features that the CPU lacks can never be enabled this way.
+ */
+#define CUTIL_CPU_ENV_NAME "CUTIL_CPU_FEATURES"
+
+//Generic function pointer type, cast back to the real type before calling
+typedef void (cutil_cpu_func_t)(void);
+
+typedef struct cutil_cpu_variant_tag
+{
+   const char *name;
+   uint32_t required;      //all of these features must be available
+   cutil_cpu_func_t *func;
+} cutil_cpu_variant_t;
+
+/**
+ * Dispatch slot for one kernel. Variants are listed best first and the last one must be a
+ * portable fallback (required == 0). The selection is made on first use and is redone
+ * automatically after cutil_cpu_override/cutil_cpu_reset.
+ */
+typedef struct cutil_cpu_dispatch_tag
+{
+   const cutil_cpu_variant_t *variants;
+   size_t numVariants;
+   const cutil_cpu_variant_t *selected;
+   uint32_t generation;
+} cutil_cpu_dispatch_t;
+
+#define CUTIL_CPU_DISPATCH_INIT(variants) \
+   { (variants), sizeof(variants) / sizeof((variants)[0]), (const cutil_cpu_variant_t*) 0, 0u }
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+uint32_t cutil_cpu_detect(void);
+uint32_t cutil_cpu_features(void);
+bool cutil_cpu_has(uint32_t features);
+void cutil_cpu_override(uint32_t features);
+void cutil_cpu_reset(void);
+uint32_t cutil_cpu_parseFeatures(const char *str, uint32_t available);
+size_t cutil_cpu_describe(uint32_t features, char *buf, size_t bufSize);
+
+const cutil_cpu_variant_t *cutil_cpu_select(const cutil_cpu_variant_t *variants, size_t numVariants, uint32_t features);
+cutil_cpu_func_t *cutil_cpu_resolve(cutil_cpu_dispatch_t *dispatch);
+const char *cutil_cpu_resolvedName(cutil_cpu_dispatch_t *dispatch);
+
+#endif //CUTIL_CPU_H__
@@ -0,0 +1,57 @@
+/*****************************************************************************
+* \file      hex.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Hexadecimal encoding and decoding
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef HEX_H
+#define HEX_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define HEX_ENCODED_SIZE(n) ((n) * 2u) //excluding null terminator
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Encoders write exactly HEX_ENCODED_SIZE(len) characters (no null terminator) and return that number.
+ */
+size_t hex_encode(char *dst, const uint8_t *src, size_t len);
+size_t hex_encodeUpper(char *dst, const uint8_t *src, size_t len);
+
+/**
+ * Decodes len characters (upper or lower case) into len / 2 bytes.
+ * Returns false if len is odd or if any character is not a hex digit (dst is then undefined).
+ */
+bool hex_decode(uint8_t *dst, const char *src, size_t len);
+
+#endif //HEX_H
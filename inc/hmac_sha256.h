@@ -0,0 +1,72 @@
+/*****************************************************************************
+* \file      hmac_sha256.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     HMAC-SHA256 with precomputed key state
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef HMAC_SHA256_H__
+#define HMAC_SHA256_H__
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "sha256.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define HMAC_SHA256_MAC_SIZE SHA256_HASH_SIZE
+
+/**
+ * SHA-256 chaining values after hashing (key ^ ipad) and (key ^ opad). Computed once per key,
+ * after that a MAC only costs the message blocks plus the inner and outer finalizations.
+ */
+typedef struct hmac_sha256_key_tag
+{
+   uint32_t inner[8];
+   uint32_t outer[8];
+} hmac_sha256_key_t;
+
+typedef struct hmac_sha256_ctx_tag
+{
+   sha256_ctx_t inner;
+   uint32_t outer[8];
+} hmac_sha256_ctx_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void hmac_sha256_key_init(hmac_sha256_key_t *key, const void *keyData, size_t keyLen);
+void hmac_sha256_key_clear(hmac_sha256_key_t *key);
+
+void hmac_sha256_calc(uint8_t mac[32], const hmac_sha256_key_t *key, const void *msg, size_t len);
+void hmac_sha256_init(hmac_sha256_ctx_t *ctx, const hmac_sha256_key_t *key);
+void hmac_sha256_update(hmac_sha256_ctx_t *ctx, const void *data, size_t len);
+void hmac_sha256_final(hmac_sha256_ctx_t *ctx, uint8_t mac[32]);
+
+void hmac_sha256(uint8_t mac[32], const void *keyData, size_t keyLen, const void *msg, size_t len);
+bool hmac_sha256_verify(const uint8_t expected[32], const uint8_t *mac, size_t macLen);
+
+#endif //HMAC_SHA256_H__
@@ -0,0 +1,113 @@
+/*****************************************************************************
+* \file      lenprefix.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Length-prefix message headers (1 or 4 bytes)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef LENPREFIX_H
+#define LENPREFIX_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+#include "pack.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Lengths up to LENPREFIX_SHORT_MAX are encoded as a single byte.
+ * Longer lengths are encoded as a 4-byte big-endian value with the highest bit set.
+ */
+#define LENPREFIX_SHORT_MAX 127u
+#define LENPREFIX_LONG_MAX 0x7FFFFFFFu
+#define LENPREFIX_LONG_FLAG 0x80u
+#define LENPREFIX_MAX_HEADER_SIZE 4u
+
+typedef struct lenprefix_msg_tag
+{
+   size_t offset;   //offset of the payload (just after the header)
+   uint32_t length; //payload length
+} lenprefix_msg_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+size_t lenprefix_scan(const uint8_t *buf, size_t len, lenprefix_msg_t *msgs, size_t maxMsgs, size_t *consumed);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC INLINE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Returns header size (1 or 4) needed for a payload of given length, 0 if length is too large.
+ */
+static inline size_t lenprefix_headerSize(uint32_t length)
+{
+   return (length <= LENPREFIX_SHORT_MAX)? 1u : (length <= LENPREFIX_LONG_MAX)? 4u : 0u;
+}
+
+/**
+ * Writes the header for a payload of given length. Returns number of bytes written (0 if length is too large).
+ */
+static inline size_t lenprefix_encode(uint8_t *dst, uint32_t length)
+{
+   if (length <= LENPREFIX_SHORT_MAX)
+   {
+      dst[0] = (uint8_t) length;
+      return 1u;
+   }
+   if (length <= LENPREFIX_LONG_MAX)
+   {
+      pack_u32be(dst, length | ((uint32_t) LENPREFIX_LONG_FLAG << 24));
+      return 4u;
+   }
+   return 0u;
+}
+
+/**
+ * Reads a header from src (len bytes available).
+ * Returns the header size (1 or 4) or 0 when more bytes are needed to complete the header.
+ */
+static inline size_t lenprefix_decode(const uint8_t *src, size_t len, uint32_t *length)
+{
+   if (len == 0u)
+   {
+      return 0u;
+   }
+   if ( (src[0] & LENPREFIX_LONG_FLAG) == 0u)
+   {
+      *length = src[0];
+      return 1u;
+   }
+   if (len < 4u)
+   {
+      return 0u;
+   }
+   *length = unpack_u32be(src) & LENPREFIX_LONG_MAX;
+   return 4u;
+}
+
+#endif //LENPREFIX_H
@@ -0,0 +1,67 @@
+/*****************************************************************************
+* \file      numconv.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Number to text conversion and back
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef NUMCONV_H
+#define NUMCONV_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+//Maximum number of characters written by the format functions (they never write a null terminator)
+#define NUMCONV_U32_MAX_SIZE 10u
+#define NUMCONV_S32_MAX_SIZE 11u
+#define NUMCONV_U64_MAX_SIZE 20u
+#define NUMCONV_S64_MAX_SIZE 20u
+#define NUMCONV_DOUBLE_MAX_SIZE 25u
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The format functions return the number of characters written.
+ */
+size_t numconv_formatU32(char *dst, uint32_t value);
+size_t numconv_formatS32(char *dst, int32_t value);
+size_t numconv_formatU64(char *dst, uint64_t value);
+size_t numconv_formatS64(char *dst, int64_t value);
+size_t numconv_formatDouble(char *dst, double value);
+
+/**
+ * The parse functions read the longest valid number at the start of src (at most len characters, no leading
+ * whitespace or '+') and return the number of characters consumed, 0 if there is no number or if it is out of range.
+ */
+size_t numconv_parseU64(const char *src, size_t len, uint64_t *value);
+size_t numconv_parseS64(const char *src, size_t len, int64_t *value);
+size_t numconv_parseDouble(const char *src, size_t len, double *value);
+
+#endif //NUMCONV_H
@@ -1,21 +1,85 @@
 #ifndef PACK_H
 #define PACK_H
+#include <string.h>
 #ifdef USE_PLATFORM_TYPES
 #include "Platform_Types.h"
 #define _PACK_UINT8 uint8
-#define _PACK_UINT16 uint32
+#define _PACK_UINT16 uint16
 #define _PACK_UINT32 uint32
 #define _PACK_UINT64 uint64
+#define _PACK_SINT8 sint8
+#define _PACK_SINT16 sint16
+#define _PACK_SINT32 sint32
+#define _PACK_SINT64 sint64
+#define _PACK_FLOAT32 float32
+#define _PACK_FLOAT64 float64
 #else
 #include <stdint.h>
 #define _PACK_UINT8 uint8_t
-#define _PACK_UINT16 uint32_t
+#define _PACK_UINT16 uint16_t
 #define _PACK_UINT32 uint32_t
 #define _PACK_UINT64 uint64_t
+#define _PACK_SINT8 int8_t
+#define _PACK_SINT16 int16_t
+#define _PACK_SINT32 int32_t
+#define _PACK_SINT64 int64_t
+#define _PACK_FLOAT32 float
+#define _PACK_FLOAT64 double
 #endif
 
 #define _PACK_BASE_TYPE _PACK_UINT32
 
+//set PLATFORM_BYTE_ORDER to one of below values for performance boost
+#define PLATFORM_LITTLE_ENDIAN 0
+#define PLATFORM_BIG_ENDIAN    1
+
+/*
+ * Byte order used by the inline pack functions. When it is known at compile time they compile into
+ * a single (unaligned) load or store plus a byte swap, otherwise into portable shift operations.
+ */
+#if defined(PLATFORM_BYTE_ORDER)
+#define _PACK_NATIVE_ORDER PLATFORM_BYTE_ORDER
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define _PACK_NATIVE_ORDER PLATFORM_LITTLE_ENDIAN
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define _PACK_NATIVE_ORDER PLATFORM_BIG_ENDIAN
+#elif defined(_MSC_VER)
+#define _PACK_NATIVE_ORDER PLATFORM_LITTLE_ENDIAN
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define _PACK_BSWAP16(x) __builtin_bswap16(x)
+#define _PACK_BSWAP32(x) __builtin_bswap32(x)
+#define _PACK_BSWAP64(x) __builtin_bswap64(x)
+#elif defined(_MSC_VER)
+#include <stdlib.h>
+#define _PACK_BSWAP16(x) _byteswap_ushort(x)
+#define _PACK_BSWAP32(x) _byteswap_ulong(x)
+#define _PACK_BSWAP64(x) _byteswap_uint64(x)
+#else
+#define _PACK_BSWAP16(x) ((_PACK_UINT16) (((x) >> 8) | ((x) << 8)))
+#define _PACK_BSWAP32(x) ((((x) & 0xFF000000u) >> 24) | (((x) & 0x00FF0000u) >> 8) | \
+                          (((x) & 0x0000FF00u) << 8) | (((x) & 0x000000FFu) << 24))
+#define _PACK_BSWAP64(x) ((((_PACK_UINT64) _PACK_BSWAP32((_PACK_UINT32) (x))) << 32) | \
+                          (_PACK_UINT64) _PACK_BSWAP32((_PACK_UINT32) ((x) >> 32)))
+#endif
+
+#if defined(_PACK_NATIVE_ORDER) && (_PACK_NATIVE_ORDER == PLATFORM_LITTLE_ENDIAN)
+#define _PACK_LE16(x) (x)
+#define _PACK_LE32(x) (x)
+#define _PACK_LE64(x) (x)
+#define _PACK_BE16(x) _PACK_BSWAP16(x)
+#define _PACK_BE32(x) _PACK_BSWAP32(x)
+#define _PACK_BE64(x) _PACK_BSWAP64(x)
+#elif defined(_PACK_NATIVE_ORDER)
+#define _PACK_LE16(x) _PACK_BSWAP16(x)
+#define _PACK_LE32(x) _PACK_BSWAP32(x)
+#define _PACK_LE64(x) _PACK_BSWAP64(x)
+#define _PACK_BE16(x) (x)
+#define _PACK_BE32(x) (x)
+#define _PACK_BE64(x) (x)
+#endif
+
 #define packU8(p,v) packBE(p,v,1);p+=1
 #define packU16BE(p,v) packBE(p,v,2);p+=2
 #define packU32BE(p,v) packBE(p,v,4);p+=4
@@ -36,9 +100,320 @@ _PACK_UINT32 unpackLE(const _PACK_UINT8* p, _PACK_UINT8 u8Size);
 void packLE64(_PACK_UINT8* p, _PACK_UINT64 value, _PACK_UINT8 u8Size); //forces data to be 64-bits (8 bytes), even on 32-bit machines
 _PACK_UINT64 unpackLE64(const _PACK_UINT8* p, _PACK_UINT8 u8Size); //forces data to be 64-bits (8 bytes), even on 32-bit machines
 
-//set PLATFORM_BYTE_ORDER to one of below values for performance boost
-#define PLATFORM_LITTLE_ENDIAN 0
-#define PLATFORM_BIG_ENDIAN    1
+/***************** Fixed-width inline pack functions *******************/
+/*
+ * pack_<type><order>(p, value) writes sizeof(type) bytes to p.
+ * unpack_<type><order>(p) reads sizeof(type) bytes from p.
+ * Neither of them advance p nor do any bounds checking.
+ */
+static inline void pack_u8(_PACK_UINT8* p, _PACK_UINT8 value)
+{
+   *p = value;
+}
 
-#endif //PACK_H
+static inline _PACK_UINT8 unpack_u8(const _PACK_UINT8* p)
+{
+   return *p;
+}
+
+static inline void pack_u16le(_PACK_UINT8* p, _PACK_UINT16 value)
+{
+#ifdef _PACK_NATIVE_ORDER
+   value = _PACK_LE16(value);
+   memcpy(p, &value, 2);
+#else
+   p[0] = (_PACK_UINT8) value;
+   p[1] = (_PACK_UINT8) (value >> 8);
+#endif
+}
+
+static inline _PACK_UINT16 unpack_u16le(const _PACK_UINT8* p)
+{
+#ifdef _PACK_NATIVE_ORDER
+   _PACK_UINT16 value;
+   memcpy(&value, p, 2);
+   return _PACK_LE16(value);
+#else
+   return (_PACK_UINT16) ((_PACK_UINT16) p[0] |
+          ((_PACK_UINT16) p[1] << 8));
+#endif
+}
+
+static inline void pack_u16be(_PACK_UINT8* p, _PACK_UINT16 value)
+{
+#ifdef _PACK_NATIVE_ORDER
+   value = _PACK_BE16(value);
+   memcpy(p, &value, 2);
+#else
+   p[0] = (_PACK_UINT8) (value >> 8);
+   p[1] = (_PACK_UINT8) value;
+#endif
+}
+
+static inline _PACK_UINT16 unpack_u16be(const _PACK_UINT8* p)
+{
+#ifdef _PACK_NATIVE_ORDER
+   _PACK_UINT16 value;
+   memcpy(&value, p, 2);
+   return _PACK_BE16(value);
+#else
+   return (_PACK_UINT16) (((_PACK_UINT16) p[0] << 8) |
+          (_PACK_UINT16) p[1]);
+#endif
+}
+
+static inline void pack_u32le(_PACK_UINT8* p, _PACK_UINT32 value)
+{
+#ifdef _PACK_NATIVE_ORDER
+   value = _PACK_LE32(value);
+   memcpy(p, &value, 4);
+#else
+   p[0] = (_PACK_UINT8) value;
+   p[1] = (_PACK_UINT8) (value >> 8);
+   p[2] = (_PACK_UINT8) (value >> 16);
+   p[3] = (_PACK_UINT8) (value >> 24);
+#endif
+}
+
+static inline _PACK_UINT32 unpack_u32le(const _PACK_UINT8* p)
+{
+#ifdef _PACK_NATIVE_ORDER
+   _PACK_UINT32 value;
+   memcpy(&value, p, 4);
+   return _PACK_LE32(value);
+#else
+   return (_PACK_UINT32) ((_PACK_UINT32) p[0] |
+          ((_PACK_UINT32) p[1] << 8) |
+          ((_PACK_UINT32) p[2] << 16) |
+          ((_PACK_UINT32) p[3] << 24));
+#endif
+}
+
+static inline void pack_u32be(_PACK_UINT8* p, _PACK_UINT32 value)
+{
+#ifdef _PACK_NATIVE_ORDER
+   value = _PACK_BE32(value);
+   memcpy(p, &value, 4);
+#else
+   p[0] = (_PACK_UINT8) (value >> 24);
+   p[1] = (_PACK_UINT8) (value >> 16);
+   p[2] = (_PACK_UINT8) (value >> 8);
+   p[3] = (_PACK_UINT8) value;
+#endif
+}
+
+static inline _PACK_UINT32 unpack_u32be(const _PACK_UINT8* p)
+{
+#ifdef _PACK_NATIVE_ORDER
+   _PACK_UINT32 value;
+   memcpy(&value, p, 4);
+   return _PACK_BE32(value);
+#else
+   return (_PACK_UINT32) (((_PACK_UINT32) p[0] << 24) |
+          ((_PACK_UINT32) p[1] << 16) |
+          ((_PACK_UINT32) p[2] << 8) |
+          (_PACK_UINT32) p[3]);
+#endif
+}
+
+static inline void pack_u64le(_PACK_UINT8* p, _PACK_UINT64 value)
+{
+#ifdef _PACK_NATIVE_ORDER
+   value = _PACK_LE64(value);
+   memcpy(p, &value, 8);
+#else
+   p[0] = (_PACK_UINT8) value;
+   p[1] = (_PACK_UINT8) (value >> 8);
+   p[2] = (_PACK_UINT8) (value >> 16);
+   p[3] = (_PACK_UINT8) (value >> 24);
+   p[4] = (_PACK_UINT8) (value >> 32);
+   p[5] = (_PACK_UINT8) (value >> 40);
+   p[6] = (_PACK_UINT8) (value >> 48);
+   p[7] = (_PACK_UINT8) (value >> 56);
+#endif
+}
+
+static inline _PACK_UINT64 unpack_u64le(const _PACK_UINT8* p)
+{
+#ifdef _PACK_NATIVE_ORDER
+   _PACK_UINT64 value;
+   memcpy(&value, p, 8);
+   return _PACK_LE64(value);
+#else
+   return (_PACK_UINT64) ((_PACK_UINT64) p[0] |
+          ((_PACK_UINT64) p[1] << 8) |
+          ((_PACK_UINT64) p[2] << 16) |
+          ((_PACK_UINT64) p[3] << 24) |
+          ((_PACK_UINT64) p[4] << 32) |
+          ((_PACK_UINT64) p[5] << 40) |
+          ((_PACK_UINT64) p[6] << 48) |
+          ((_PACK_UINT64) p[7] << 56));
+#endif
+}
+
+static inline void pack_u64be(_PACK_UINT8* p, _PACK_UINT64 value)
+{
+#ifdef _PACK_NATIVE_ORDER
+   value = _PACK_BE64(value);
+   memcpy(p, &value, 8);
+#else
+   p[0] = (_PACK_UINT8) (value >> 56);
+   p[1] = (_PACK_UINT8) (value >> 48);
+   p[2] = (_PACK_UINT8) (value >> 40);
+   p[3] = (_PACK_UINT8) (value >> 32);
+   p[4] = (_PACK_UINT8) (value >> 24);
+   p[5] = (_PACK_UINT8) (value >> 16);
+   p[6] = (_PACK_UINT8) (value >> 8);
+   p[7] = (_PACK_UINT8) value;
+#endif
+}
+
+static inline _PACK_UINT64 unpack_u64be(const _PACK_UINT8* p)
+{
+#ifdef _PACK_NATIVE_ORDER
+   _PACK_UINT64 value;
+   memcpy(&value, p, 8);
+   return _PACK_BE64(value);
+#else
+   return (_PACK_UINT64) (((_PACK_UINT64) p[0] << 56) |
+          ((_PACK_UINT64) p[1] << 48) |
+          ((_PACK_UINT64) p[2] << 40) |
+          ((_PACK_UINT64) p[3] << 32) |
+          ((_PACK_UINT64) p[4] << 24) |
+          ((_PACK_UINT64) p[5] << 16) |
+          ((_PACK_UINT64) p[6] << 8) |
+          (_PACK_UINT64) p[7]);
+#endif
+}
+
+static inline void pack_s8(_PACK_UINT8* p, _PACK_SINT8 value)
+{
+   *p = (_PACK_UINT8) value;
+}
+
+static inline _PACK_SINT8 unpack_s8(const _PACK_UINT8* p)
+{
+   return (_PACK_SINT8) *p;
+}
+
+static inline void pack_s16le(_PACK_UINT8* p, _PACK_SINT16 value)
+{
+   pack_u16le(p, (_PACK_UINT16) value);
+}
+
+static inline _PACK_SINT16 unpack_s16le(const _PACK_UINT8* p)
+{
+   return (_PACK_SINT16) unpack_u16le(p);
+}
+
+static inline void pack_s16be(_PACK_UINT8* p, _PACK_SINT16 value)
+{
+   pack_u16be(p, (_PACK_UINT16) value);
+}
 
+static inline _PACK_SINT16 unpack_s16be(const _PACK_UINT8* p)
+{
+   return (_PACK_SINT16) unpack_u16be(p);
+}
+
+static inline void pack_s32le(_PACK_UINT8* p, _PACK_SINT32 value)
+{
+   pack_u32le(p, (_PACK_UINT32) value);
+}
+
+static inline _PACK_SINT32 unpack_s32le(const _PACK_UINT8* p)
+{
+   return (_PACK_SINT32) unpack_u32le(p);
+}
+
+static inline void pack_s32be(_PACK_UINT8* p, _PACK_SINT32 value)
+{
+   pack_u32be(p, (_PACK_UINT32) value);
+}
+
+static inline _PACK_SINT32 unpack_s32be(const _PACK_UINT8* p)
+{
+   return (_PACK_SINT32) unpack_u32be(p);
+}
+
+static inline void pack_s64le(_PACK_UINT8* p, _PACK_SINT64 value)
+{
+   pack_u64le(p, (_PACK_UINT64) value);
+}
+
+static inline _PACK_SINT64 unpack_s64le(const _PACK_UINT8* p)
+{
+   return (_PACK_SINT64) unpack_u64le(p);
+}
+
+static inline void pack_s64be(_PACK_UINT8* p, _PACK_SINT64 value)
+{
+   pack_u64be(p, (_PACK_UINT64) value);
+}
+
+static inline _PACK_SINT64 unpack_s64be(const _PACK_UINT8* p)
+{
+   return (_PACK_SINT64) unpack_u64be(p);
+}
+
+static inline void pack_f32le(_PACK_UINT8* p, _PACK_FLOAT32 value)
+{
+   _PACK_UINT32 tmp;
+   memcpy(&tmp, &value, sizeof(tmp));
+   pack_u32le(p, tmp);
+}
+
+static inline _PACK_FLOAT32 unpack_f32le(const _PACK_UINT8* p)
+{
+   _PACK_FLOAT32 value;
+   _PACK_UINT32 tmp = unpack_u32le(p);
+   memcpy(&value, &tmp, sizeof(value));
+   return value;
+}
+
+static inline void pack_f32be(_PACK_UINT8* p, _PACK_FLOAT32 value)
+{
+   _PACK_UINT32 tmp;
+   memcpy(&tmp, &value, sizeof(tmp));
+   pack_u32be(p, tmp);
+}
+
+static inline _PACK_FLOAT32 unpack_f32be(const _PACK_UINT8* p)
+{
+   _PACK_FLOAT32 value;
+   _PACK_UINT32 tmp = unpack_u32be(p);
+   memcpy(&value, &tmp, sizeof(value));
+   return value;
+}
+
+static inline void pack_f64le(_PACK_UINT8* p, _PACK_FLOAT64 value)
+{
+   _PACK_UINT64 tmp;
+   memcpy(&tmp, &value, sizeof(tmp));
+   pack_u64le(p, tmp);
+}
+
+static inline _PACK_FLOAT64 unpack_f64le(const _PACK_UINT8* p)
+{
+   _PACK_FLOAT64 value;
+   _PACK_UINT64 tmp = unpack_u64le(p);
+   memcpy(&value, &tmp, sizeof(value));
+   return value;
+}
+
+static inline void pack_f64be(_PACK_UINT8* p, _PACK_FLOAT64 value)
+{
+   _PACK_UINT64 tmp;
+   memcpy(&tmp, &value, sizeof(tmp));
+   pack_u64be(p, tmp);
+}
+
+static inline _PACK_FLOAT64 unpack_f64be(const _PACK_UINT8* p)
+{
+   _PACK_FLOAT64 value;
+   _PACK_UINT64 tmp = unpack_u64be(p);
+   memcpy(&value, &tmp, sizeof(value));
+   return value;
+}
+
+#endif //PACK_H
@@ -0,0 +1,64 @@
+/*****************************************************************************
+* \file      pack_array.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Bulk array pack/unpack with byte order conversion
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef PACK_ARRAY_H
+#define PACK_ARRAY_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/*
+ * packArray<type><order>(dst, src, n) serializes n elements from src into dst (n * sizeof(type) bytes).
+ * unpackArray<type><order>(dst, src, n) deserializes n elements from src into dst.
+ * The byte buffer has no alignment requirement. dst and src must either be the same address
+ * (in-place conversion) or not overlap at all.
+ */
+void packArrayU16LE(uint8_t *dst, const uint16_t *src, size_t n);
+void packArrayU16BE(uint8_t *dst, const uint16_t *src, size_t n);
+void packArrayU32LE(uint8_t *dst, const uint32_t *src, size_t n);
+void packArrayU32BE(uint8_t *dst, const uint32_t *src, size_t n);
+void packArrayU64LE(uint8_t *dst, const uint64_t *src, size_t n);
+void packArrayU64BE(uint8_t *dst, const uint64_t *src, size_t n);
+
+void unpackArrayU16LE(uint16_t *dst, const uint8_t *src, size_t n);
+void unpackArrayU16BE(uint16_t *dst, const uint8_t *src, size_t n);
+void unpackArrayU32LE(uint32_t *dst, const uint8_t *src, size_t n);
+void unpackArrayU32BE(uint32_t *dst, const uint8_t *src, size_t n);
+void unpackArrayU64LE(uint64_t *dst, const uint8_t *src, size_t n);
+void unpackArrayU64BE(uint64_t *dst, const uint8_t *src, size_t n);
+
+//unconditionally reverses the byte order of each element (in-place)
+void swapArrayU16(uint16_t *data, size_t n);
+void swapArrayU32(uint32_t *data, size_t n);
+void swapArrayU64(uint64_t *data, size_t n);
+
+#endif //PACK_ARRAY_H
@@ -0,0 +1,223 @@
+/*****************************************************************************
+* \file      pack_cursor.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Bounds-checked writer and reader cursors for the pack routines
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef PACK_CURSOR_H
+#define PACK_CURSOR_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pack.h"
+#include "adt_bytearray.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Typical usage is to reserve space for a whole record once and then use the unchecked
+ * put functions for the individual fields. The checked write functions do their own
+ * reservation. Any failed reservation sets the sticky error flag after which all further
+ * reservations fail, which means the error only needs to be checked once at the end.
+ */
+typedef struct pack_writer_tag
+{
+   uint8_t *begin;
+   uint8_t *pos;
+   uint8_t *end;
+   adt_bytearray_t *array; //NULL when writing into a fixed size buffer
+   bool error;
+} pack_writer_t;
+
+typedef struct pack_reader_tag
+{
+   const uint8_t *begin;
+   const uint8_t *pos;
+   const uint8_t *end;
+   bool error;
+} pack_reader_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void pack_writer_init(pack_writer_t *self, uint8_t *buf, size_t size);
+void pack_writer_initArray(pack_writer_t *self, adt_bytearray_t *array);
+bool pack_writer_reserveSlow(pack_writer_t *self, size_t size);
+bool pack_writer_finish(pack_writer_t *self);
+void pack_reader_init(pack_reader_t *self, const uint8_t *buf, size_t size);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC INLINE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Makes sure that at least size more bytes can be put. Returns false (and sets the error flag)
+ * when the buffer is fixed and too small or when the byte array cannot grow.
+ */
+static inline bool pack_writer_reserve(pack_writer_t *self, size_t size)
+{
+   if ( (!self->error) && ((size_t) (self->end - self->pos) >= size) )
+   {
+      return true;
+   }
+   return pack_writer_reserveSlow(self, size);
+}
+
+static inline size_t pack_writer_length(const pack_writer_t *self)
+{
+   return (size_t) (self->pos - self->begin);
+}
+
+static inline bool pack_writer_error(const pack_writer_t *self)
+{
+   return self->error;
+}
+
+static inline void pack_writer_putBytes(pack_writer_t *self, const void *data, size_t size)
+{
+   memcpy(self->pos, data, size);
+   self->pos += size;
+}
+
+static inline bool pack_writer_writeBytes(pack_writer_t *self, const void *data, size_t size)
+{
+   if (!pack_writer_reserve(self, size))
+   {
+      return false;
+   }
+   pack_writer_putBytes(self, data, size);
+   return true;
+}
+
+/**
+ * Makes sure that at least size more bytes can be read. Returns false (and sets the error flag) otherwise.
+ */
+static inline bool pack_reader_require(pack_reader_t *self, size_t size)
+{
+   if ( (!self->error) && ((size_t) (self->end - self->pos) >= size) )
+   {
+      return true;
+   }
+   self->error = true;
+   return false;
+}
+
+static inline size_t pack_reader_remaining(const pack_reader_t *self)
+{
+   return (size_t) (self->end - self->pos);
+}
+
+static inline bool pack_reader_error(const pack_reader_t *self)
+{
+   return self->error;
+}
+
+static inline void pack_reader_getBytes(pack_reader_t *self, void *data, size_t size)
+{
+   memcpy(data, self->pos, size);
+   self->pos += size;
+}
+
+static inline bool pack_reader_readBytes(pack_reader_t *self, void *data, size_t size)
+{
+   if (!pack_reader_require(self, size))
+   {
+      return false;
+   }
+   pack_reader_getBytes(self, data, size);
+   return true;
+}
+
+static inline bool pack_reader_skip(pack_reader_t *self, size_t size)
+{
+   if (!pack_reader_require(self, size))
+   {
+      return false;
+   }
+   self->pos += size;
+   return true;
+}
+
+/*
+ * For each type and byte order:
+ *  pack_writer_put<T>   writes without checking (space must have been reserved)
+ *  pack_writer_write<T> reserves and writes, returns false on failure
+ *  pack_reader_get<T>   reads without checking (length must have been required)
+ *  pack_reader_read<T>  checks and reads, returns 0 on failure
+ */
+#define _PACK_CURSOR_DEFINE(suffix, type, size, packFunc, unpackFunc) \
+static inline void pack_writer_put##suffix(pack_writer_t *self, type value) \
+{ \
+   packFunc(self->pos, value); \
+   self->pos += (size); \
+} \
+static inline bool pack_writer_write##suffix(pack_writer_t *self, type value) \
+{ \
+   if (!pack_writer_reserve(self, (size))) \
+   { \
+      return false; \
+   } \
+   pack_writer_put##suffix(self, value); \
+   return true; \
+} \
+static inline type pack_reader_get##suffix(pack_reader_t *self) \
+{ \
+   type value = unpackFunc(self->pos); \
+   self->pos += (size); \
+   return value; \
+} \
+static inline type pack_reader_read##suffix(pack_reader_t *self) \
+{ \
+   if (!pack_reader_require(self, (size))) \
+   { \
+      return (type) 0; \
+   } \
+   return pack_reader_get##suffix(self); \
+}
+
+_PACK_CURSOR_DEFINE(U8, _PACK_UINT8, 1u, pack_u8, unpack_u8)
+_PACK_CURSOR_DEFINE(S8, _PACK_SINT8, 1u, pack_s8, unpack_s8)
+_PACK_CURSOR_DEFINE(U16LE, _PACK_UINT16, 2u, pack_u16le, unpack_u16le)
+_PACK_CURSOR_DEFINE(U16BE, _PACK_UINT16, 2u, pack_u16be, unpack_u16be)
+_PACK_CURSOR_DEFINE(S16LE, _PACK_SINT16, 2u, pack_s16le, unpack_s16le)
+_PACK_CURSOR_DEFINE(S16BE, _PACK_SINT16, 2u, pack_s16be, unpack_s16be)
+_PACK_CURSOR_DEFINE(U32LE, _PACK_UINT32, 4u, pack_u32le, unpack_u32le)
+_PACK_CURSOR_DEFINE(U32BE, _PACK_UINT32, 4u, pack_u32be, unpack_u32be)
+_PACK_CURSOR_DEFINE(S32LE, _PACK_SINT32, 4u, pack_s32le, unpack_s32le)
+_PACK_CURSOR_DEFINE(S32BE, _PACK_SINT32, 4u, pack_s32be, unpack_s32be)
+_PACK_CURSOR_DEFINE(U64LE, _PACK_UINT64, 8u, pack_u64le, unpack_u64le)
+_PACK_CURSOR_DEFINE(U64BE, _PACK_UINT64, 8u, pack_u64be, unpack_u64be)
+_PACK_CURSOR_DEFINE(S64LE, _PACK_SINT64, 8u, pack_s64le, unpack_s64le)
+_PACK_CURSOR_DEFINE(S64BE, _PACK_SINT64, 8u, pack_s64be, unpack_s64be)
+_PACK_CURSOR_DEFINE(F32LE, _PACK_FLOAT32, 4u, pack_f32le, unpack_f32le)
+_PACK_CURSOR_DEFINE(F32BE, _PACK_FLOAT32, 4u, pack_f32be, unpack_f32be)
+_PACK_CURSOR_DEFINE(F64LE, _PACK_FLOAT64, 8u, pack_f64le, unpack_f64le)
+_PACK_CURSOR_DEFINE(F64BE, _PACK_FLOAT64, 8u, pack_f64be, unpack_f64be)
+
+#endif //PACK_CURSOR_H
@@ -0,0 +1,78 @@
+/*****************************************************************************
+* \file      pack_scale.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Fixed-point scaling between raw signal values and physical values
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef PACK_SCALE_H
+#define PACK_SCALE_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/*
+ * pack_scale_<raw>To<phys>(dst, src, n, scale, offset) converts n raw values to physical values:
+ *    dst[i] = (phys) src[i] * scale + offset
+ * where the multiplication and the addition are rounded separately (no fused multiply-add).
+ */
+void pack_scale_s8ToF32(float *dst, const int8_t *src, size_t n, float scale, float offset);
+void pack_scale_u8ToF32(float *dst, const uint8_t *src, size_t n, float scale, float offset);
+void pack_scale_s16ToF32(float *dst, const int16_t *src, size_t n, float scale, float offset);
+void pack_scale_u16ToF32(float *dst, const uint16_t *src, size_t n, float scale, float offset);
+void pack_scale_s32ToF32(float *dst, const int32_t *src, size_t n, float scale, float offset);
+void pack_scale_u32ToF32(float *dst, const uint32_t *src, size_t n, float scale, float offset);
+
+void pack_scale_s8ToF64(double *dst, const int8_t *src, size_t n, double scale, double offset);
+void pack_scale_u8ToF64(double *dst, const uint8_t *src, size_t n, double scale, double offset);
+void pack_scale_s16ToF64(double *dst, const int16_t *src, size_t n, double scale, double offset);
+void pack_scale_u16ToF64(double *dst, const uint16_t *src, size_t n, double scale, double offset);
+void pack_scale_s32ToF64(double *dst, const int32_t *src, size_t n, double scale, double offset);
+void pack_scale_u32ToF64(double *dst, const uint32_t *src, size_t n, double scale, double offset);
+
+/*
+ * pack_scale_<phys>To<raw>(dst, src, n, scale, offset) is the reverse conversion:
+ *    dst[i] = saturate(round((src[i] - offset) / scale))
+ * Rounding is to nearest with ties to even. Values outside of the raw type's range saturate to its
+ * minimum or maximum, NaN converts to 0. scale must not be zero.
+ */
+void pack_scale_f32ToS8(int8_t *dst, const float *src, size_t n, float scale, float offset);
+void pack_scale_f32ToU8(uint8_t *dst, const float *src, size_t n, float scale, float offset);
+void pack_scale_f32ToS16(int16_t *dst, const float *src, size_t n, float scale, float offset);
+void pack_scale_f32ToU16(uint16_t *dst, const float *src, size_t n, float scale, float offset);
+void pack_scale_f32ToS32(int32_t *dst, const float *src, size_t n, float scale, float offset);
+void pack_scale_f32ToU32(uint32_t *dst, const float *src, size_t n, float scale, float offset);
+
+void pack_scale_f64ToS8(int8_t *dst, const double *src, size_t n, double scale, double offset);
+void pack_scale_f64ToU8(uint8_t *dst, const double *src, size_t n, double scale, double offset);
+void pack_scale_f64ToS16(int16_t *dst, const double *src, size_t n, double scale, double offset);
+void pack_scale_f64ToU16(uint16_t *dst, const double *src, size_t n, double scale, double offset);
+void pack_scale_f64ToS32(int32_t *dst, const double *src, size_t n, double scale, double offset);
+void pack_scale_f64ToU32(uint32_t *dst, const double *src, size_t n, double scale, double offset);
+
+#endif //PACK_SCALE_H
@@ -0,0 +1,94 @@
+/*****************************************************************************
+* \file      pack_signal.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Bit-level signal packing (Intel and Motorola bit order)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef PACK_SIGNAL_H
+#define PACK_SIGNAL_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define PACK_SIGNAL_INTEL     0x00u //little endian, startBit is the least significant bit
+#define PACK_SIGNAL_MOTOROLA  0x01u //big endian, startBit is the most significant bit
+#define PACK_SIGNAL_SIGNED    0x02u //two's complement, sign-extended to 64 bits on extraction
+
+//frames up to this size are copied once into a padded buffer by the bulk functions (CAN FD maximum)
+#define PACK_SIGNAL_MAX_BULK_FRAME_SIZE 64u
+
+/**
+ * Bit positions use the DBC convention: bit n is bit (n % 8) of byte (n / 8) where bit 0 is the
+ * least significant bit. An Intel signal continues towards higher bit numbers, a Motorola signal
+ * continues towards lower bits within a byte and then to bit 7 of the next byte.
+ */
+typedef struct pack_signal_tag
+{
+   uint16_t startBit;
+   uint8_t bitLength; //1..64
+   uint8_t flags;
+} pack_signal_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+bool pack_signal_isValid(const pack_signal_t *signal, size_t frameLen);
+
+/*
+ * Single signal access. Bits outside of the frame read as zero and are never written,
+ * use pack_signal_isValid to detect such signals up front.
+ */
+uint64_t pack_signal_get(const pack_signal_t *signal, const uint8_t *frame, size_t frameLen);
+void pack_signal_set(const pack_signal_t *signal, uint8_t *frame, size_t frameLen, uint64_t value);
+
+/*
+ * Bulk access to many signals of the same frame in a single pass.
+ * values[i] belongs to signals[i]. Extracted signed signals are sign-extended.
+ */
+void pack_signal_extract(const pack_signal_t *signals, size_t numSignals, const uint8_t *frame, size_t frameLen, uint64_t *values);
+void pack_signal_insert(const pack_signal_t *signals, size_t numSignals, uint8_t *frame, size_t frameLen, const uint64_t *values);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC INLINE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static inline int64_t pack_signal_signExtend(uint64_t value, uint8_t bitLength)
+{
+   if ( (bitLength < 64u) && ((value >> (bitLength - 1u)) & 1u) )
+   {
+      value |= ~(uint64_t) 0u << bitLength;
+   }
+   return (int64_t) value;
+}
+
+static inline int64_t pack_signal_getSigned(const pack_signal_t *signal, const uint8_t *frame, size_t frameLen)
+{
+   return pack_signal_signExtend(pack_signal_get(signal, frame, frameLen), signal->bitLength);
+}
+
+#endif //PACK_SIGNAL_H
@@ -0,0 +1,93 @@
+/*****************************************************************************
+* \file      pack_struct.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Table-driven serialization of C structs
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef PACK_STRUCT_H
+#define PACK_STRUCT_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define PACK_FIELD_UNSIGNED       0x00u
+#define PACK_FIELD_SIGNED         0x01u //sign-extend when the wire size is smaller than the member
+#define PACK_FIELD_LITTLE_ENDIAN  0x00u
+#define PACK_FIELD_BIG_ENDIAN     0x02u
+
+/**
+ * Describes one struct member. Fields are serialized in table order without padding.
+ * wireSize may be smaller than memberSize (e.g. a uint32_t sent as 3 bytes).
+ */
+typedef struct pack_field_tag
+{
+   uint32_t offset;
+   uint8_t memberSize; //1, 2, 4 or 8
+   uint8_t wireSize;   //1..memberSize
+   uint8_t flags;
+} pack_field_t;
+
+#define PACK_FIELD(type, member, flags) \
+   { (uint32_t) offsetof(type, member), (uint8_t) sizeof(((type*) 0)->member), \
+     (uint8_t) sizeof(((type*) 0)->member), (uint8_t) (flags) }
+
+#define PACK_FIELD_NARROW(type, member, wireSize, flags) \
+   { (uint32_t) offsetof(type, member), (uint8_t) sizeof(((type*) 0)->member), \
+     (uint8_t) (wireSize), (uint8_t) (flags) }
+
+typedef struct pack_op_tag
+{
+   uint8_t type;
+   uint8_t memberSize; //width of swapped/converted element
+   uint8_t wireSize;   //only used by conversions
+   uint8_t flags;      //only used by conversions
+   uint32_t count;     //bytes to copy or number of elements to swap/convert
+   uint32_t structOffset;
+   uint32_t wireOffset;
+} pack_op_t;
+
+/**
+ * Compiled form of a field table where adjacent fields needing the same treatment
+ * (plain copy or byte swap of equal width) are merged into a single operation.
+ */
+typedef struct pack_plan_tag
+{
+   pack_op_t *ops;
+   size_t numOps;
+   size_t wireSize; //serialized size of one struct
+} pack_plan_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+int pack_plan_create(pack_plan_t *self, const pack_field_t *fields, size_t numFields);
+void pack_plan_destroy(pack_plan_t *self);
+size_t pack_plan_pack(const pack_plan_t *self, uint8_t *dst, const void *src, size_t count, size_t stride);
+size_t pack_plan_unpack(const pack_plan_t *self, void *dst, size_t count, size_t stride, const uint8_t *src);
+
+#endif //PACK_STRUCT_H
@@ -0,0 +1,106 @@
+/*****************************************************************************
+* \file      pack_varint.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Variable-length integer encoding (LEB128, zigzag and stream-vbyte)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef PACK_VARINT_H
+#define PACK_VARINT_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define VARINT_MAX_SIZE_U32 5u
+#define VARINT_MAX_SIZE_U64 10u
+
+//Worst case size of streamvbyteEncode output (control bytes followed by 4 bytes per value)
+#define STREAMVBYTE_MAX_SIZE(n) ((((n) + 3u) / 4u) + ((n) * 4u))
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/*
+ * LEB128: 7 bits per byte, least significant group first, high bit set on all but the last byte.
+ * pack functions return the number of bytes written to dst (which must have room for VARINT_MAX_SIZE_*).
+ * unpack functions return the number of bytes consumed, or 0 when src is truncated or the encoded
+ * value does not fit the type.
+ */
+size_t packVarintU32(uint8_t *dst, uint32_t value);
+size_t packVarintU64(uint8_t *dst, uint64_t value);
+size_t packVarintS32(uint8_t *dst, int32_t value);
+size_t packVarintS64(uint8_t *dst, int64_t value);
+size_t unpackVarintU32(const uint8_t *src, size_t len, uint32_t *value);
+size_t unpackVarintU64(const uint8_t *src, size_t len, uint64_t *value);
+size_t unpackVarintS32(const uint8_t *src, size_t len, int32_t *value);
+size_t unpackVarintS64(const uint8_t *src, size_t len, int64_t *value);
+size_t varintSizeU32(uint32_t value);
+size_t varintSizeU64(uint64_t value);
+
+/*
+ * Batch functions for consecutive LEB128 values.
+ * unpackVarintArrayU32 decodes exactly n values and returns the number of bytes consumed (0 on error).
+ */
+size_t packVarintArrayU32(uint8_t *dst, const uint32_t *src, size_t n);
+size_t unpackVarintArrayU32(uint32_t *dst, size_t n, const uint8_t *src, size_t len);
+
+/*
+ * Stream-vbyte: one control byte holding four 2-bit length codes per group of four values,
+ * all control bytes first followed by 1-4 little-endian data bytes per value.
+ * Unlike LEB128 the lengths are known up front which lets the decoder expand four values per shuffle.
+ * Both return the number of bytes written/consumed (decode returns 0 on truncated input).
+ */
+size_t streamvbyteEncode(uint8_t *dst, const uint32_t *src, size_t n);
+size_t streamvbyteDecode(uint32_t *dst, size_t n, const uint8_t *src, size_t len);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC INLINE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+//zigzag maps signed integers of small magnitude to small unsigned integers (0,-1,1,-2 => 0,1,2,3)
+static inline uint32_t zigzagEncode32(int32_t value)
+{
+   return ((uint32_t) value << 1) ^ (uint32_t) -(int32_t) ((uint32_t) value >> 31);
+}
+
+static inline int32_t zigzagDecode32(uint32_t value)
+{
+   return (int32_t) ((value >> 1) ^ (uint32_t) -(int32_t) (value & 1u));
+}
+
+static inline uint64_t zigzagEncode64(int64_t value)
+{
+   return ((uint64_t) value << 1) ^ (uint64_t) -(int64_t) ((uint64_t) value >> 63);
+}
+
+static inline int64_t zigzagDecode64(uint64_t value)
+{
+   return (int64_t) ((value >> 1) ^ (uint64_t) -(int64_t) (value & 1u));
+}
+
+#endif //PACK_VARINT_H
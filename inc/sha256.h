@@ -33,19 +33,77 @@
 //////////////////////////////////////////////////////////////////////////////
 // INCLUDES
 //////////////////////////////////////////////////////////////////////////////
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 //////////////////////////////////////////////////////////////////////////////
 // PUBLIC CONSTANTS AND DATA TYPES
 //////////////////////////////////////////////////////////////////////////////
+#define SHA256_BLOCK_SIZE 64u
+#define SHA256_HASH_SIZE 32u
 
-//////////////////////////////////////////////////////////////////////////////
-// PUBLIC VARIABLES
-//////////////////////////////////////////////////////////////////////////////
-void sha256_calc(uint8_t hash[32], const void *input, size_t len);
+/**
+ * Streaming hash state. Partial blocks are buffered until a full 64-byte block is available,
+ * full blocks in the caller's data are processed in place.
+ */
+typedef struct sha256_ctx_tag
+{
+   uint32_t state[8];
+   uint64_t total_len; //bytes
+   uint8_t buf[SHA256_BLOCK_SIZE];
+   size_t buf_len;
+} sha256_ctx_t;
+
+/**
+ * Serialized sha256_ctx_t (all integers big-endian):
+ *    version (1 byte), number of pending bytes n (1 byte), total_len (8 bytes),
+ *    state (8 x 4 bytes), pending bytes (n bytes), CRC32C of everything before it (4 bytes)
+ */
+#define SHA256_MIDSTATE_VERSION 1u
+#define SHA256_MIDSTATE_HEADER_SIZE 42u
+#define SHA256_MIDSTATE_SIZE(numPending) (SHA256_MIDSTATE_HEADER_SIZE + (numPending) + 4u)
+#define SHA256_MIDSTATE_MAX_SIZE SHA256_MIDSTATE_SIZE(SHA256_BLOCK_SIZE - 1u)
+
+#define SHA512_BLOCK_SIZE 128u
+#define SHA512_HASH_SIZE 64u
+#define SHA384_HASH_SIZE 48u
+#define SHA512_256_HASH_SIZE 32u
+
+/**
+ * Streaming state shared by SHA-512, SHA-384 and SHA-512/256, which only differ in initial state
+ * and in how many bytes of the final state that are output (hash_len).
+ */
+typedef struct sha512_ctx_tag
+{
+   uint64_t state[8];
+   uint64_t total_len; //bytes
+   uint8_t buf[SHA512_BLOCK_SIZE];
+   size_t buf_len;
+   size_t hash_len;
+} sha512_ctx_t;
 
 //////////////////////////////////////////////////////////////////////////////
 // PUBLIC FUNCTION PROTOTYPES
 //////////////////////////////////////////////////////////////////////////////
+void sha256_calc(uint8_t hash[32], const void *input, size_t len);
+
+void sha256_init(sha256_ctx_t *ctx);
+void sha256_init_midstate(sha256_ctx_t *ctx, const uint32_t state[8], uint64_t numBytes);
+void sha256_update(sha256_ctx_t *ctx, const void *data, size_t len);
+void sha256_final(sha256_ctx_t *ctx, uint8_t hash[32]);
+size_t sha256_export(const sha256_ctx_t *ctx, uint8_t *dst, size_t dstSize);
+bool sha256_import(sha256_ctx_t *ctx, const uint8_t *src, size_t len);
+
+void sha256_calc_many(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n);
+
+void sha512_calc(uint8_t hash[64], const void *input, size_t len);
+void sha384_calc(uint8_t hash[48], const void *input, size_t len);
+void sha512_256_calc(uint8_t hash[32], const void *input, size_t len);
 
+void sha512_init(sha512_ctx_t *ctx);
+void sha384_init(sha512_ctx_t *ctx);
+void sha512_256_init(sha512_ctx_t *ctx);
+void sha512_update(sha512_ctx_t *ctx, const void *data, size_t len);
+void sha512_final(sha512_ctx_t *ctx, uint8_t *hash);
 
 #endif //SHA256_H
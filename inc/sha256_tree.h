@@ -0,0 +1,61 @@
+/*****************************************************************************
+* \file      sha256_tree.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Merkle tree hashing of large inputs on top of SHA-256
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef SHA256_TREE_H__
+#define SHA256_TREE_H__
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+#include "sha256.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The input is split into leaves of leafSize bytes (the last leaf may be shorter, empty input is a
+ * single empty leaf). The tree follows RFC 6962:
+ *    leaf hash = SHA-256(0x00 || leaf data)
+ *    node hash = SHA-256(0x01 || left || right)
+ * where the left subtree always holds the largest power of two leaves that is less than the
+ * number of leaves below the node. The root therefore only depends on the data and leafSize,
+ * not on the number of threads.
+ */
+#define SHA256_TREE_LEAF_PREFIX 0x00u
+#define SHA256_TREE_NODE_PREFIX 0x01u
+#define SHA256_TREE_MAX_THREADS 64u
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+size_t sha256_tree_num_leaves(size_t len, size_t leafSize);
+int sha256_tree_calc(uint8_t root[32], uint8_t (*leafHashes)[32], const void *data, size_t len, size_t leafSize, unsigned numThreads);
+void sha256_tree_leaf(uint8_t hash[32], const void *data, size_t len);
+void sha256_tree_root(uint8_t root[32], const uint8_t (*leafHashes)[32], size_t numLeaves);
+
+#endif //SHA256_TREE_H__
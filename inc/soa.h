@@ -13,10 +13,17 @@
 
 #define SOA_SMALL_OBJECT_MAX_SIZE 32 //maximum size (in bytes) of object to be considered "small"
 #define SOA_DEFAULT_NUM_BLOCKS 255u
+#ifndef SOA_OBJECT_ALIGN_SIZE
+#define SOA_OBJECT_ALIGN_SIZE 4u //sizes are rounded up to a multiple of this value (one FSA per size class)
+#endif
+#define SOA_NUM_SIZE_CLASSES ((SOA_SMALL_OBJECT_MAX_SIZE + SOA_OBJECT_ALIGN_SIZE - 1u) / SOA_OBJECT_ALIGN_SIZE)
+#define SOA_SIZE_CLASS(size) (((size) - 1u) / SOA_OBJECT_ALIGN_SIZE)
 
 typedef struct soa_tag
 {
-  soa_fsa_t* fsa[SOA_SMALL_OBJECT_MAX_SIZE];
+  soa_fsa_t* fsa[SOA_NUM_SIZE_CLASSES];
+  const soa_memory_handler_t *memoryHandler;
+  soa_budget_t budget; //the allocator must not be moved in memory once it has been initialized
 } soa_t;
 
 /***************** Public Function Declarations *******************/
@@ -25,6 +32,12 @@ void soa_destroy(soa_t *allocator);
 void soa_initFSA(soa_t *allocator, size_t blockSize, unsigned char numBlocks);
 void *soa_alloc(soa_t *allocator, size_t size);
 void soa_free(soa_t *allocator, void* ptr, size_t size);
+void *soa_realloc(soa_t *allocator, void *ptr, size_t oldSize, size_t newSize);
+void soa_setMemoryHandler(soa_t *allocator, const soa_memory_handler_t *handler);
+void soa_setLimits(soa_t *allocator, size_t softLimit, size_t hardLimit);
+void soa_setPressureHandler(soa_t *allocator, soa_pressure_handler_t *handler, void *arg);
+size_t soa_bytesUsed(const soa_t *allocator);
+size_t soa_trim(soa_t *allocator);
 
 
 #endif //SOA_H__
@@ -0,0 +1,63 @@
+/*****************************************************************************
+* \file      soa_budget.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Memory budget for the small object allocator
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef SOA_BUDGET_H__
+#define SOA_BUDGET_H__
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdbool.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define SOA_BUDGET_UNLIMITED 0u
+
+/**
+ * Called when memory is about to grow beyond the soft limit.
+ * The handler may release memory (e.g. call soa_trim or evict cached objects) before the request is re-evaluated.
+ */
+typedef void (soa_pressure_handler_t)(void *arg, size_t bytesUsed, size_t bytesRequested);
+
+typedef struct soa_budget_tag
+{
+   size_t used;       //bytes currently held in chunks and large objects
+   size_t soft_limit;
+   size_t hard_limit;
+   soa_pressure_handler_t *handler;
+   void *arg;
+   bool in_handler;
+} soa_budget_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void soa_budget_init(soa_budget_t *budget);
+bool soa_budget_charge(soa_budget_t *budget, size_t numBytes);
+void soa_budget_release(soa_budget_t *budget, size_t numBytes);
+
+#endif //SOA_BUDGET_H__
@@ -12,6 +12,16 @@
 
 #include <stdlib.h>
 
+/**
+* Optional provider of chunk memory. When no handler is given chunks are allocated using malloc/free.
+*/
+typedef struct soa_memory_handler_tag
+{
+  void *arg;
+  void* (*alloc)(void *arg, size_t size);
+  void (*free)(void *arg, void *ptr, size_t size);
+} soa_memory_handler_t;
+
 typedef struct soa_chunk_tag
 {
   unsigned char *blockData;
@@ -21,6 +31,8 @@ typedef struct soa_chunk_tag
 
 void soa_chunk_init(soa_chunk_t *chunk, size_t blockSize, unsigned char numBlocks);
 void soa_chunk_destroy(soa_chunk_t *chunk);
+void soa_chunk_initHandler(soa_chunk_t *chunk, size_t blockSize, unsigned char numBlocks, const soa_memory_handler_t *handler);
+void soa_chunk_destroyHandler(soa_chunk_t *chunk, size_t blockSize, unsigned char numBlocks, const soa_memory_handler_t *handler);
 void *soa_chunk_alloc(soa_chunk_t *chunk,size_t blockSize);
 void soa_chunk_free(soa_chunk_t *chunk,void *p, size_t blockSize);
 
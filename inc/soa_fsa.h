@@ -10,6 +10,7 @@
 #ifndef SOA_FSA_H__
 #define SOA_FSA_H__
 #include "soa_chunk.h"
+#include "soa_budget.h"
 
 typedef struct soa_fsa_tag
 {
@@ -17,6 +18,8 @@ typedef struct soa_fsa_tag
   unsigned char numBlocks;
   soa_chunk_t *chunks, *allocChunk, *deallocChunk;
   size_t chunks_len;
+  const soa_memory_handler_t *memoryHandler;
+  soa_budget_t *budget; //optional, chunk memory is charged to it
 } soa_fsa_t;
 
 /***************** Public Function Declarations *******************/
@@ -24,5 +27,8 @@ void soa_fsa_init(soa_fsa_t *allocator,size_t blockSize, unsigned char numBlocks
 void soa_fsa_destroy(soa_fsa_t *allocator);
 void *soa_fsa_alloc(soa_fsa_t *allocator);
 void soa_fsa_free(soa_fsa_t *allocator, void* ptr);
+size_t soa_fsa_trim(soa_fsa_t *allocator);
+void soa_fsa_setMemoryHandler(soa_fsa_t *allocator, const soa_memory_handler_t *handler);
+void soa_fsa_setBudget(soa_fsa_t *allocator, soa_budget_t *budget);
 
 #endif //SOA_FSA_H__
@@ -0,0 +1,102 @@
+/*****************************************************************************
+* \file      soa_numa.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     NUMA-aware small object allocator (one arena per memory node)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef SOA_NUMA_H__
+#define SOA_NUMA_H__
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "soa.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define SOA_NUMA_MAX_NODES 8
+#ifndef SOA_NUMA_REGION_SIZE
+#define SOA_NUMA_REGION_SIZE ((size_t) 1u << 30) //virtual address space reserved per node
+#endif
+#define SOA_NUMA_NUM_FREE_LISTS 8
+
+#ifdef _WIN32
+#define SOA_NUMA_MUTEX_T CRITICAL_SECTION
+#else
+#define SOA_NUMA_MUTEX_T pthread_mutex_t
+#endif
+
+/**
+ * Address range reserved for a single node. Chunk memory is carved out of it and
+ * recycled through small free lists (chunks of the same size class have the same size).
+ */
+typedef struct soa_numa_region_tag
+{
+   uint8_t *base;
+   size_t size;
+   size_t used;
+   size_t free_size[SOA_NUMA_NUM_FREE_LISTS];
+   void *free_head[SOA_NUMA_NUM_FREE_LISTS];
+} soa_numa_region_t;
+
+typedef struct soa_numa_arena_tag
+{
+   soa_t soa;
+   soa_numa_region_t region;
+   soa_memory_handler_t memoryHandler;
+   SOA_NUMA_MUTEX_T lock;
+   int node;
+   bool is_bound;      //true when region is bound to node using mbind
+   uint64_t num_alloc; //statistics
+   uint64_t num_free;
+} soa_numa_arena_t;
+
+typedef struct soa_numa_tag
+{
+   int num_arenas;
+   soa_numa_arena_t arenas[SOA_NUMA_MAX_NODES];
+} soa_numa_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+int soa_numa_max_node(void);
+int soa_numa_current_node(void);
+int soa_numa_node_of(const void *ptr);
+
+void soa_numa_init(soa_numa_t *self);
+void soa_numa_init_nodes(soa_numa_t *self, int numNodes);
+void soa_numa_destroy(soa_numa_t *self);
+void *soa_numa_alloc(soa_numa_t *self, size_t size);
+void *soa_numa_alloc_on_node(soa_numa_t *self, int node, size_t size);
+void soa_numa_free(soa_numa_t *self, void *ptr, size_t size);
+int soa_numa_arena_of(const soa_numa_t *self, const void *ptr);
+
+#endif //SOA_NUMA_H__
@@ -0,0 +1,80 @@
+/*****************************************************************************
+* \file      soa_pool.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Handle-based object pool on top of the fixed size allocator
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef SOA_POOL_H__
+#define SOA_POOL_H__
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "soa_fsa.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A handle is a 32-bit value where the lower SOA_HANDLE_INDEX_BITS hold the slot index
+ * and the remaining upper bits hold the generation of that slot.
+ * Generation 0 is never used which means that the value 0 is never a valid handle.
+ */
+#define SOA_HANDLE_INDEX_BITS 20u
+#define SOA_HANDLE_INDEX_MASK ((1u << SOA_HANDLE_INDEX_BITS) - 1u)
+#define SOA_HANDLE_GENERATION_MAX ((1u << (32u - SOA_HANDLE_INDEX_BITS)) - 1u)
+#define SOA_HANDLE_INVALID 0u
+
+typedef uint32_t soa_handle_t;
+
+typedef struct soa_pool_slot_tag
+{
+   void *ptr;           //NULL when slot is free
+   uint32_t next_free;  //index of next free slot (only used while slot is free)
+   uint32_t generation;
+} soa_pool_slot_t;
+
+typedef struct soa_pool_tag
+{
+   soa_fsa_t fsa;
+   soa_pool_slot_t *slots;
+   uint32_t slots_len;  //number of slots ever taken into use
+   uint32_t slots_cap;
+   uint32_t free_slot;  //head of free slot list
+   uint32_t num_live;
+} soa_pool_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void soa_pool_init(soa_pool_t *pool, size_t blockSize, unsigned char numBlocks);
+void soa_pool_destroy(soa_pool_t *pool);
+soa_handle_t soa_pool_alloc(soa_pool_t *pool);
+void soa_pool_free(soa_pool_t *pool, soa_handle_t handle);
+void *soa_pool_get(const soa_pool_t *pool, soa_handle_t handle);
+bool soa_pool_is_valid(const soa_pool_t *pool, soa_handle_t handle);
+size_t soa_pool_compact(soa_pool_t *pool, size_t maxMoves);
+
+#endif //SOA_POOL_H__
@@ -0,0 +1,81 @@
+/*****************************************************************************
+* \file      xxh3.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     XXH3 64-bit and 128-bit non-cryptographic hash
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef XXH3_H__
+#define XXH3_H__
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * XXH3 (from xxHash 0.8) is a fast hash for hash tables, deduplication keys and checksums
+ * where an attacker is not expected to craft collisions. The results are identical to
+ * XXH3_64bits_withSeed and XXH3_128bits_withSeed of the reference implementation.
+ */
+#define XXH3_SECRET_SIZE 192u
+#define XXH3_BUFFER_SIZE 256u
+#define XXH3_NUM_ACC 8u
+
+typedef struct xxh3_128_tag
+{
+   uint64_t lo;
+   uint64_t hi;
+} xxh3_128_t;
+
+/**
+ * Streaming state, the same state can be finalized as a 64-bit or a 128-bit hash.
+ * The buffer always keeps the last 64 consumed bytes at its end since the final stripe may
+ * overlap data that was already consumed.
+ */
+typedef struct xxh3_state_tag
+{
+   uint64_t acc[XXH3_NUM_ACC];
+   uint8_t secret[XXH3_SECRET_SIZE];
+   uint8_t buffer[XXH3_BUFFER_SIZE];
+   size_t buffered;
+   size_t stripes_in_block; //stripes accumulated since the last scramble
+   uint64_t total_len;
+   uint64_t seed;
+} xxh3_state_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+uint64_t xxh3_64(const void *data, size_t len, uint64_t seed);
+xxh3_128_t xxh3_128(const void *data, size_t len, uint64_t seed);
+
+void xxh3_init(xxh3_state_t *state, uint64_t seed);
+void xxh3_update(xxh3_state_t *state, const void *data, size_t len);
+uint64_t xxh3_digest64(const xxh3_state_t *state);
+xxh3_128_t xxh3_digest128(const xxh3_state_t *state);
+
+#endif //XXH3_H__
@@ -0,0 +1,384 @@
+/*****************************************************************************
+* \file      base64.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Base64 encoding and decoding (RFC 4648)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include "base64.h"
+#include "cutil_cpu.h"
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define BASE64_X86_SIMD
+#include <immintrin.h>
+#endif
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define INVALID 0xFFu
+#define PAD '='
+
+typedef void (encode_func_t)(char *dst, const uint8_t *src, size_t len);
+//len is a non-zero multiple of 4
+typedef bool (decode_func_t)(uint8_t *dst, const char *src, size_t len);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void encode_scalar(char *dst, const uint8_t *src, size_t len);
+static bool decode_scalar(uint8_t *dst, const char *src, size_t len);
+#ifdef BASE64_X86_SIMD
+static __m128i encode_reshuffle_ssse3(__m128i in);
+static __m128i encode_translate_ssse3(__m128i in);
+static void encode_ssse3(char *dst, const uint8_t *src, size_t len);
+static void encode_avx2(char *dst, const uint8_t *src, size_t len);
+static bool decode_ssse3(uint8_t *dst, const char *src, size_t len);
+static bool decode_avx2(uint8_t *dst, const char *src, size_t len);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const char m_alphabet[64] =
+{
+   'A','B','C','D','E','F','G','H','I','J','K','L','M','N','O','P',
+   'Q','R','S','T','U','V','W','X','Y','Z','a','b','c','d','e','f',
+   'g','h','i','j','k','l','m','n','o','p','q','r','s','t','u','v',
+   'w','x','y','z','0','1','2','3','4','5','6','7','8','9','+','/'
+};
+
+//character to 6-bit value, INVALID for characters outside the alphabet (including the padding character)
+static const uint8_t m_decode_table[256] =
+{
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+   0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+   0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+   0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+static const cutil_cpu_variant_t m_encode_variants[] =
+{
+#ifdef BASE64_X86_SIMD
+   {"avx2", CUTIL_CPU_AVX2, (cutil_cpu_func_t*) encode_avx2},
+   {"ssse3", CUTIL_CPU_SSSE3, (cutil_cpu_func_t*) encode_ssse3},
+#endif
+   {"scalar", 0u, (cutil_cpu_func_t*) encode_scalar}
+};
+static const cutil_cpu_variant_t m_decode_variants[] =
+{
+#ifdef BASE64_X86_SIMD
+   {"avx2", CUTIL_CPU_AVX2, (cutil_cpu_func_t*) decode_avx2},
+   {"ssse3", CUTIL_CPU_SSSE3, (cutil_cpu_func_t*) decode_ssse3},
+#endif
+   {"scalar", 0u, (cutil_cpu_func_t*) decode_scalar}
+};
+static cutil_cpu_dispatch_t m_encode_dispatch = CUTIL_CPU_DISPATCH_INIT(m_encode_variants);
+static cutil_cpu_dispatch_t m_decode_dispatch = CUTIL_CPU_DISPATCH_INIT(m_decode_variants);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+size_t base64_encode(char *dst, const uint8_t *src, size_t len)
+{
+   encode_func_t *func = (encode_func_t*) cutil_cpu_resolve(&m_encode_dispatch);
+   func(dst, src, len);
+   return BASE64_ENCODED_SIZE(len);
+}
+
+bool base64_decode(uint8_t *dst, const char *src, size_t len, size_t *dstLen)
+{
+   size_t size;
+   decode_func_t *func;
+   if ( (len % 4u) != 0u)
+   {
+      return false;
+   }
+   if (len == 0u)
+   {
+      size = 0u;
+   }
+   else
+   {
+      size = BASE64_DECODED_MAX_SIZE(len) - ((src[len - 1u] == PAD)? ((src[len - 2u] == PAD)? 2u : 1u) : 0u);
+      func = (decode_func_t*) cutil_cpu_resolve(&m_decode_dispatch);
+      if (!func(dst, src, len))
+      {
+         return false;
+      }
+   }
+   if (dstLen != 0)
+   {
+      *dstLen = size;
+   }
+   return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void encode_scalar(char *dst, const uint8_t *src, size_t len)
+{
+   size_t i;
+   for (i = 0u; i + 3u <= len; i += 3u)
+   {
+      uint32_t value = ((uint32_t) src[i] << 16) | ((uint32_t) src[i + 1u] << 8) | src[i + 2u];
+      *dst++ = m_alphabet[value >> 18];
+      *dst++ = m_alphabet[(value >> 12) & 0x3Fu];
+      *dst++ = m_alphabet[(value >> 6) & 0x3Fu];
+      *dst++ = m_alphabet[value & 0x3Fu];
+   }
+   if (i < len)
+   {
+      uint32_t value = (uint32_t) src[i] << 16;
+      if (i + 1u < len)
+      {
+         value |= (uint32_t) src[i + 1u] << 8;
+      }
+      dst[0] = m_alphabet[value >> 18];
+      dst[1] = m_alphabet[(value >> 12) & 0x3Fu];
+      dst[2] = (i + 1u < len)? m_alphabet[(value >> 6) & 0x3Fu] : PAD;
+      dst[3] = PAD;
+   }
+}
+
+static bool decode_scalar(uint8_t *dst, const char *src, size_t len)
+{
+   size_t i;
+   uint32_t invalid = 0u;
+   const unsigned char *s = (const unsigned char*) src;
+   uint32_t a, b, c, d;
+   for (i = 0u; i + 4u < len; i += 4u)
+   {
+      a = m_decode_table[s[i]];
+      b = m_decode_table[s[i + 1u]];
+      c = m_decode_table[s[i + 2u]];
+      d = m_decode_table[s[i + 3u]];
+      invalid |= a | b | c | d;
+      a = (a << 18) | (b << 12) | (c << 6) | d;
+      *dst++ = (uint8_t) (a >> 16);
+      *dst++ = (uint8_t) (a >> 8);
+      *dst++ = (uint8_t) a;
+   }
+   //last quad may be padded, in which case the unused bits must be zero
+   a = m_decode_table[s[i]];
+   b = m_decode_table[s[i + 1u]];
+   invalid |= a | b;
+   if (s[i + 3u] != PAD)
+   {
+      c = m_decode_table[s[i + 2u]];
+      d = m_decode_table[s[i + 3u]];
+      invalid |= c | d;
+      a = (a << 18) | (b << 12) | (c << 6) | d;
+      dst[2] = (uint8_t) a;
+      dst[1] = (uint8_t) (a >> 8);
+   }
+   else if (s[i + 2u] != PAD)
+   {
+      c = m_decode_table[s[i + 2u]];
+      invalid |= c | ((c & 0x03u)? INVALID : 0u);
+      a = (a << 18) | (b << 12) | (c << 6);
+      dst[1] = (uint8_t) (a >> 8);
+   }
+   else
+   {
+      invalid |= (b & 0x0Fu)? INVALID : 0u;
+      a = (a << 18) | (b << 12);
+   }
+   dst[0] = (uint8_t) (a >> 16);
+   return (invalid & 0x80u) == 0u;
+}
+
+#ifdef BASE64_X86_SIMD
+/**
+ * Spreads 12 input bytes (3 per 32-bit lane) into 16 bytes holding one 6-bit index each.
+ */
+__attribute__((target("ssse3")))
+static __m128i encode_reshuffle_ssse3(__m128i in)
+{
+   __m128i t0, t1, t2, t3;
+   in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+   t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+   t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+   t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+   t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+   return _mm_or_si128(t1, t3);
+}
+
+/**
+ * Maps 6-bit indices to the alphabet by adding an offset looked up from the index range.
+ */
+__attribute__((target("ssse3")))
+static __m128i encode_translate_ssse3(__m128i in)
+{
+   const __m128i offsets = _mm_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+   __m128i range = _mm_subs_epu8(in, _mm_set1_epi8(51));
+   range = _mm_sub_epi8(range, _mm_cmpgt_epi8(in, _mm_set1_epi8(25)));
+   return _mm_add_epi8(in, _mm_shuffle_epi8(offsets, range));
+}
+
+__attribute__((target("ssse3")))
+static void encode_ssse3(char *dst, const uint8_t *src, size_t len)
+{
+   size_t i = 0u;
+   //each step loads 16 bytes but consumes 12
+   for (; i + 16u <= len; i += 12u)
+   {
+      __m128i in = _mm_loadu_si128((const __m128i*) &src[i]);
+      _mm_storeu_si128((__m128i*) dst, encode_translate_ssse3(encode_reshuffle_ssse3(in)));
+      dst += 16u;
+   }
+   encode_scalar(dst, &src[i], len - i);
+}
+
+__attribute__((target("avx2")))
+static void encode_avx2(char *dst, const uint8_t *src, size_t len)
+{
+   size_t i = 0u;
+   const __m256i shuffle = _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                                           10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+   const __m256i offsets = _mm256_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0,
+                                            65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+   //each lane loads 16 bytes and consumes 12
+   for (; i + 28u <= len; i += 24u)
+   {
+      __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*) &src[i])),
+                                           _mm_loadu_si128((const __m128i*) &src[i + 12u]), 1);
+      __m256i t0, t1, t2, t3, range;
+      in = _mm256_shuffle_epi8(in, shuffle);
+      t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00));
+      t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+      t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0));
+      t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+      in = _mm256_or_si256(t1, t3);
+      range = _mm256_subs_epu8(in, _mm256_set1_epi8(51));
+      range = _mm256_sub_epi8(range, _mm256_cmpgt_epi8(in, _mm256_set1_epi8(25)));
+      _mm256_storeu_si256((__m256i*) dst, _mm256_add_epi8(in, _mm256_shuffle_epi8(offsets, range)));
+      dst += 32u;
+   }
+   //the tail goes to the (non-VEX) SSSE3 encoder by sibcall, clear the upper halves first
+   _mm256_zeroupper();
+   encode_ssse3(dst, &src[i], len - i);
+}
+
+/**
+ * Validates and translates characters by table lookups on their high and low nibbles: every invalid
+ * character has a common bit in both lookups. Four 6-bit values are then merged into 3 bytes.
+ * Blocks stop at least 8 characters before the end so that the 16-byte store (of which 12 bytes
+ * are used) stays within the decoded size and never touches the padded last quad.
+ */
+__attribute__((target("ssse3")))
+static bool decode_ssse3(uint8_t *dst, const char *src, size_t len)
+{
+   size_t i = 0u;
+   const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                       0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+   const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                       0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+   const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+   const __m128i mask2F = _mm_set1_epi8(0x2F);
+   for (; i + 24u <= len; i += 16u)
+   {
+      __m128i str = _mm_loadu_si128((const __m128i*) &src[i]);
+      __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(str, 4), mask2F);
+      __m128i loNibbles = _mm_and_si128(str, mask2F);
+      __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+      __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+      __m128i roll;
+      if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0)
+      {
+         return false;
+      }
+      //'/' is the only character sharing its lookup with another range
+      roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(_mm_cmpeq_epi8(str, mask2F), hiNibbles));
+      str = _mm_add_epi8(str, roll);
+      str = _mm_maddubs_epi16(str, _mm_set1_epi32(0x01400140));
+      str = _mm_madd_epi16(str, _mm_set1_epi32(0x00011000));
+      str = _mm_shuffle_epi8(str, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+      _mm_storeu_si128((__m128i*) &dst[(i / 4u) * 3u], str);
+   }
+   return decode_scalar(&dst[(i / 4u) * 3u], &src[i], len - i);
+}
+
+/**
+ * Same as decode_ssse3 on 32 characters at a time. Blocks stop at least 16 characters before the end
+ * so that the 32-byte store (of which 24 bytes are used) stays within the decoded size.
+ */
+__attribute__((target("avx2")))
+static bool decode_avx2(uint8_t *dst, const char *src, size_t len)
+{
+   size_t i = 0u;
+   const __m256i lutLo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                          0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                          0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                          0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+   const __m256i lutHi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                          0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                          0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                          0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+   const __m256i lutRoll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                            0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+   const __m256i mask2F = _mm256_set1_epi8(0x2F);
+   const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                         2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+   for (; i + 48u <= len; i += 32u)
+   {
+      __m256i str = _mm256_loadu_si256((const __m256i*) &src[i]);
+      __m256i hiNibbles = _mm256_and_si256(_mm256_srli_epi32(str, 4), mask2F);
+      __m256i loNibbles = _mm256_and_si256(str, mask2F);
+      __m256i hi = _mm256_shuffle_epi8(lutHi, hiNibbles);
+      __m256i lo = _mm256_shuffle_epi8(lutLo, loNibbles);
+      __m256i roll;
+      if (!_mm256_testz_si256(lo, hi))
+      {
+         _mm256_zeroupper();
+         return false;
+      }
+      roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(_mm256_cmpeq_epi8(str, mask2F), hiNibbles));
+      str = _mm256_add_epi8(str, roll);
+      str = _mm256_maddubs_epi16(str, _mm256_set1_epi32(0x01400140));
+      str = _mm256_madd_epi16(str, _mm256_set1_epi32(0x00011000));
+      str = _mm256_shuffle_epi8(str, pack);
+      //move the 12 bytes of the upper lane next to those of the lower lane
+      str = _mm256_permutevar8x32_epi32(str, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+      _mm256_storeu_si256((__m256i*) &dst[(i / 4u) * 3u], str);
+   }
+   _mm256_zeroupper();
+   return decode_ssse3(&dst[(i / 4u) * 3u], &src[i], len - i);
+}
+#endif
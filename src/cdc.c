@@ -0,0 +1,326 @@
+/*****************************************************************************
+* \file      cdc.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Content-defined chunking (FastCDC gear hash) for deduplication
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+#include "cdc.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define MIN_AVG_BITS 8u  //smallest average chunk size is 256 bytes
+#define MAX_AVG_BITS 28u
+#define NORMALIZATION_LEVEL 2u
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static uint64_t high_bits_mask(unsigned numBits);
+static size_t min_len(size_t a, size_t b);
+static size_t scan(cdc_chunker_t *self, const uint8_t *data, size_t len, bool *isBoundary);
+static void emit_chunk(cdc_chunker_t *self);
+static void handler_open(void *arg);
+static void handler_close(void *arg);
+static void handler_write(void *arg, const uint8_t *pChunk, uint32_t chunkLen);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//random value per byte value, fixed so that boundaries are stable between runs and builds
+//(splitmix64 sequence starting from 0x6A09E667F3BCC908)
+static const uint64_t m_gear_table[256] =
+{
+   0x1AC046DDA8E86E2Aull, 0xBE2C3B00B1D348C8ull, 0x9B1A66A95412FF75ull, 0xC448C2B1F05F7E4Cull,
+   0xC111CA6B8F6E73C4ull, 0xB54861920D05B01Dull, 0x8D61500F4A7BBE16ull, 0x5E0C25471F89E02Eull,
+   0x48105A3D28F0E221ull, 0x2169F8846B637746ull, 0x3D628782E0C0D863ull, 0xA5DDB2216078AA40ull,
+   0xC8119D17F0571101ull, 0x98E2E2EB8F33280Full, 0x8CD1E28860679CC4ull, 0x9DCA6189C923AEF3ull,
+   0x9D8D3071BA4F04C4ull, 0x5D395ADA34220C26ull, 0xE6DE42A441A1E28Eull, 0x308FBF68CC864F59ull,
+   0x216A3C81332862F9ull, 0xBACECA0A77F3132Eull, 0xDF2A2215339CA69Cull, 0x3E4C11A103A5D859ull,
+   0x6D0F173FFEC5F603ull, 0x0BF4BC630D193BB6ull, 0x5F76C4AD104B57FDull, 0x99CA459F4E93F651ull,
+   0x4751799D68CF88A0ull, 0xA6B1639E3B42B61Cull, 0x278B01031924EA35ull, 0x430253EB7E993605ull,
+   0x5F4E14147961F2E8ull, 0x52AEAD5EF08AC45Full, 0x583DCA09AF910274ull, 0x4A8B9D4B576480CBull,
+   0xBEE913DC4EF28B44ull, 0x7DE79C7A57AF8587ull, 0x1ECF42B9E34CD874ull, 0x38ADAC4AB1F3AAD1ull,
+   0x80FF3025878A34B8ull, 0xF10A8816C7AC2D95ull, 0xEFF8DC4B1FA1C5D4ull, 0x0B0EBE1144FE022Full,
+   0x4D46A271E58E80A2ull, 0x09CD31F10075274Full, 0xA82F74EAA55BC441ull, 0x497F6541631D47A4ull,
+   0x888B7EDE7346DB17ull, 0x256147DC71C784E0ull, 0x8A5D6ED77045CD6Cull, 0xA9FC0986DE332F0Bull,
+   0x2F597787E8C75C47ull, 0x3648FB06E09EEFE8ull, 0xCEAC1655A16AEE55ull, 0x614C72624B61148Dull,
+   0x4CBDD6AEC064C0F0ull, 0x6620E70990008130ull, 0x0F7C12BF3C7E6FC3ull, 0x33A8B131D6275B9Bull,
+   0xFA11BD2037C759CAull, 0x720DDAD5E616729Aull, 0xF7D65A62AA36F6CDull, 0x79C452AC75DB451Dull,
+   0xB67B17D3A1221EC5ull, 0xA121663523494B41ull, 0xB0299B3EC41C4CEDull, 0x6FC29450ADCAD869ull,
+   0x47E9B8EC3FC8CBB7ull, 0x62FDC189D1AF50F0ull, 0xE2A4894D230C71C5ull, 0x2B29E84F96F10A17ull,
+   0x6A06D8F31CC8127Bull, 0xD2CFF0EC00D51E42ull, 0x53A34F9751FA14DBull, 0x5527BDF3764839BDull,
+   0x5B2B498AA588F2D2ull, 0x036C60FB15914351ull, 0x796DFF2C504AE68Cull, 0xA0B68B3DEB4A26EEull,
+   0x538D384072828564ull, 0x5C8365C92D8E618Eull, 0xADCBD6468938043Eull, 0xA62E0A7BFD3C7A87ull,
+   0xF94882172A2802D2ull, 0xE1460D5AF30B3DF4ull, 0x875AF97CF2A77A1Eull, 0xCD4CED68DC5D03FEull,
+   0x34B85BBB2ED2CBB8ull, 0x14382EBA487C2A39ull, 0x1BF2B642EC0D725Eull, 0x3180C22F85FD4A6Eull,
+   0x6287E68C688B0A6Aull, 0xC781DBD269C1579Bull, 0x967FBA740D8851EEull, 0x8BCB6289F451EAB1ull,
+   0xB00AF395B957706Aull, 0xD66F731A7EBC0D9Aull, 0x0753E0B1E260C0FFull, 0x9123B3FC244C22F0ull,
+   0xEA18DF1333DF68C7ull, 0x9EEC6B6E47EE4D7Full, 0xFB67CA727D5A7EECull, 0xFF8B16C00C21C99Eull,
+   0x358784CDB4CB66ECull, 0x03216B3236E1A9F0ull, 0xB04C2B63EFD0FF13ull, 0x7C706FDD841F7FDEull,
+   0x7D73537D5868A02Aull, 0x79D2F0856B8F869Bull, 0x3ED8CD3A1F18F1DCull, 0xA63E972135A79123ull,
+   0xBAE6B248EA01376Full, 0xC6A62EFD6E07E935ull, 0x95BD020EB8287729ull, 0xDDC64B8AA63F411Bull,
+   0xE3B876DB230A4B8Cull, 0xFC2662A03A990C51ull, 0xC4164AB8549560B2ull, 0x03661AB91FDC46CFull,
+   0x407D681D863D005Eull, 0x748CAD2BDEA25F24ull, 0xA6AF3A8FBBE02591ull, 0x4FE003A7AE850547ull,
+   0x016D512803FE9519ull, 0xD3C80BA79B797D64ull, 0x519A33023219D39Full, 0xA9B8738FD7958FCAull,
+   0xB068AFBCD3E6CFACull, 0x12D82D1C233B6A89ull, 0x52FF395050D637EFull, 0x0B9289ABD111C12Bull,
+   0x280A50D348204E9Dull, 0xC3E4BFBBB3B183F7ull, 0x460AC41C779FB804ull, 0x50A570F9E185EC4Bull,
+   0x3F4DA17A82D062A7ull, 0xD09EC8514E2854B2ull, 0xD693AD5620641415ull, 0xA7B39DBE6975C0CAull,
+   0xA0D0F63F4D9AEF1Aull, 0x15AF0CBC4969C7D5ull, 0x278011EAAB5C3F0Eull, 0x5E1CF19380CE0C38ull,
+   0xB1BA4D9029A2956Dull, 0x73F08E7440C16206ull, 0x6F9B01FFB859822Eull, 0x5A11189A2B6728E2ull,
+   0xA8558B99A4170496ull, 0x7F2F938318E74C32ull, 0xBEA616A7FD5E3BC4ull, 0xDBFEAFDD8425000Dull,
+   0x38C230DF150C847Full, 0x17EC72A519ACCD61ull, 0x036FA2FBC835B4F6ull, 0x3F4902D125DDCAEEull,
+   0xC9DC1FEC3A0AC22Full, 0x4FC8D70C9EE4D990ull, 0xAAE8A531B1C93DA2ull, 0xE1FA0E077E0CEC8Cull,
+   0x90356A76CA9C574Bull, 0x2A26CC7A2879D838ull, 0xCF4ED251A2AE162Bull, 0x098B973C62C609EAull,
+   0x1BE77277EF4B9126ull, 0x2ACB7CAC64D26155ull, 0xD876DBE01E1E90ACull, 0x51AD90E39FF2711Dull,
+   0x56C2DBC758D198B0ull, 0x1F4E0301F8842F44ull, 0x708969745130B1A1ull, 0x9A4311B95A6A991Dull,
+   0x9AFCEDE497E4DDB6ull, 0xCF3169E617E9CA2Dull, 0x1B4ECBBF8E54CF3Dull, 0x5E9CE5D535BE41B4ull,
+   0xE7FAA5BAF8248EA5ull, 0x3675637ACE70BDCEull, 0xD980D9032EC07C88ull, 0xEC6E37A873ECF8B1ull,
+   0xF9D4074F810C18DBull, 0xB60A4B86DAA6EF2Aull, 0x4E899A8F297395DBull, 0x7165C4BD2470CDA3ull,
+   0x8253B43083C02137ull, 0x3E025A61EE7FD941ull, 0x322E76006C21FE35ull, 0x0AD2377D2E13ED73ull,
+   0x46C5CCA798EB198Eull, 0x0F73C7B0B88BE5A0ull, 0x9BDBEB2841204B09ull, 0x4D196436AAE8E99Bull,
+   0x7F3BBA1F8A36D062ull, 0xE65247C253EC319Full, 0x536EC5F02D4E4335ull, 0x13A17A653A4E29ABull,
+   0x6EB9F62FF9E69BCDull, 0x9BE0C43EEE73606Bull, 0x42AA9B137474A26Aull, 0x38D992C2B7969B10ull,
+   0x00584830AF6DCB06ull, 0x21FBD546CA9DC7B4ull, 0x613143AEF10F037Eull, 0x249018DD3524B6EBull,
+   0x625F5025EB78A5DBull, 0x89DFFC140591EA45ull, 0xEABE2CB345BB7FA9ull, 0xB3D74FDD70015B81ull,
+   0xD31BF6AC6E6EFF00ull, 0xFFA32024D7E7A05Eull, 0x32675789370B11C1ull, 0x26CF04B6940262D0ull,
+   0x7016E72357D61660ull, 0x25818A6720CEBD3Full, 0xDB731160B31E0635ull, 0x380407A507C37907ull,
+   0xCADF246DD50299F4ull, 0xBF8F0F184D6C4A16ull, 0x38119A0902B7A6D0ull, 0x06AC8FE2EC3606B2ull,
+   0x7ABC00C02CC859CCull, 0xF93819575BBF449Eull, 0x2D9DC57E43F28641ull, 0xEA5DF4A5436EAF2Full,
+   0xCAB3B92F92D36E8Bull, 0x211BCFA592B9E1BFull, 0x67AE1DA4C7D43427ull, 0xAD700AD7CCAEA894ull,
+   0x2B107D3D815D86D8ull, 0x0010B23E14C8BEF3ull, 0x2B1D0F1D75D26F7Bull, 0x3B4FF56C622E7F43ull,
+   0x6CACAA7EC6E2F69Eull, 0xF134B52034EB99DDull, 0x9A2F4C1D1B73A531ull, 0xF3E4AD23B672706Dull,
+   0x5C39B33BABB430D6ull, 0xB3C783A4732B3FD5ull, 0xEFD45192CEB437ADull, 0x7D16C00FF3817BC1ull,
+   0xF69003865FCA895Eull, 0xBD83805FAEE0202Eull, 0x398C44E739DF0DECull, 0x7B190C1260F2583Eull,
+   0xF33479F42BF6780Cull, 0x1E4B54E22FBE719Dull, 0x03D1F2EE77632020ull, 0x2A7414B98717FDC8ull,
+   0x8534A1646BABF432ull, 0x55AF162AF065B106ull, 0x47CDBD2911F272E8ull, 0x7D9F49A5D5FCE2E7ull,
+   0x0196FE50064DBCA7ull, 0x69C325A23AB5755Full, 0xB9CABFD1DE7DE997ull, 0x869756F713A06D5Eull
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * avgSize must be a power of two and minSize <= avgSize <= maxSize. onChunk is called once for
+ * every chunk, the chunk (and its hash) is only valid during the call.
+ * Returns 0 on success, -1 on failure (errno is EINVAL for invalid sizes).
+ */
+int cdc_chunker_create(cdc_chunker_t *self, uint32_t minSize, uint32_t avgSize, uint32_t maxSize, cdc_chunk_func_t *onChunk, void *arg)
+{
+   unsigned bits = 0u;
+   if ( (self == 0) || (onChunk == 0) || (minSize == 0u) || (minSize > avgSize) || (avgSize > maxSize) ||
+        ( (avgSize & (avgSize - 1u)) != 0u) )
+   {
+      errno = EINVAL;
+      return -1;
+   }
+   while ( (1u << bits) < avgSize)
+   {
+      bits++;
+   }
+   if ( (bits < MIN_AVG_BITS) || (bits > MAX_AVG_BITS) )
+   {
+      errno = EINVAL;
+      return -1;
+   }
+   self->min_size = minSize;
+   self->avg_size = avgSize;
+   self->max_size = maxSize;
+   self->mask_small = high_bits_mask(bits + NORMALIZATION_LEVEL);
+   self->mask_large = high_bits_mask(bits - NORMALIZATION_LEVEL);
+   self->on_chunk = onChunk;
+   self->arg = arg;
+   cdc_chunker_reset(self);
+   return 0;
+}
+
+/**
+ * Starts a new stream at offset 0, any unfinished chunk is dropped.
+ */
+void cdc_chunker_reset(cdc_chunker_t *self)
+{
+   self->gear_hash = 0u;
+   self->offset = 0u;
+   self->chunk_len = 0u;
+   sha256_init(&self->sha);
+}
+
+void cdc_chunker_write(cdc_chunker_t *self, const uint8_t *data, size_t len)
+{
+   while (len > 0u)
+   {
+      bool isBoundary;
+      size_t n = scan(self, data, len, &isBoundary);
+      sha256_update(&self->sha, data, n);
+      if (isBoundary)
+      {
+         emit_chunk(self);
+      }
+      data += n;
+      len -= n;
+   }
+}
+
+/**
+ * Emits the last chunk (which may be shorter than min_size) at the end of the stream.
+ */
+void cdc_chunker_finish(cdc_chunker_t *self)
+{
+   if (self->chunk_len > 0u)
+   {
+      emit_chunk(self);
+   }
+}
+
+/**
+ * Sets up handler so that the chunker can be fed by an ifstream_t: open resets the chunker,
+ * write feeds it and close emits the last chunk.
+ */
+void cdc_chunker_handler(cdc_chunker_t *self, ifstream_handler_t *handler)
+{
+   handler->arg = (void*) self;
+   handler->open = handler_open;
+   handler->close = handler_close;
+   handler->write = handler_write;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+/**
+ * The gear hash is shifted left for every byte, so its high bits depend on the most bytes
+ * (up to 64). The masks therefore select the top bits.
+ */
+static uint64_t high_bits_mask(unsigned numBits)
+{
+   return ~(uint64_t) 0u << (64u - numBits);
+}
+
+static size_t min_len(size_t a, size_t b)
+{
+   return (a < b)? a : b;
+}
+
+/**
+ * Consumes bytes of the current chunk until a boundary is found or data runs out. Returns the
+ * number of bytes consumed, isBoundary is set when the last consumed byte ends the chunk.
+ * The first min_size bytes of a chunk are skipped without hashing (a cut is not allowed there).
+ */
+static size_t scan(cdc_chunker_t *self, const uint8_t *data, size_t len, bool *isBoundary)
+{
+   //the loops only touch locals, so the compiler does not have to reload the chunker fields
+   const uint64_t maskSmall = self->mask_small;
+   const uint64_t maskLarge = self->mask_large;
+   uint64_t hash = self->gear_hash;
+   size_t chunkLen = self->chunk_len;
+   size_t i = 0u;
+   size_t start;
+   bool boundary = false;
+   if (chunkLen < self->min_size)
+   {
+      i = self->min_size - chunkLen;
+      if (i > len)
+      {
+         i = len;
+      }
+      chunkLen += i;
+   }
+   start = i;
+   if (chunkLen < self->avg_size)
+   {
+      const size_t end = i + min_len(len - i, self->avg_size - chunkLen);
+      for (; i < end; i++)
+      {
+         hash = (hash << 1) + m_gear_table[data[i]];
+         if ( (hash & maskSmall) == 0u)
+         {
+            boundary = true;
+            i++;
+            break;
+         }
+      }
+      chunkLen += i - start;
+      start = i;
+   }
+   if ( !boundary && (chunkLen < self->max_size) )
+   {
+      const size_t end = i + min_len(len - i, self->max_size - chunkLen);
+      for (; i < end; i++)
+      {
+         hash = (hash << 1) + m_gear_table[data[i]];
+         if ( (hash & maskLarge) == 0u)
+         {
+            boundary = true;
+            i++;
+            break;
+         }
+      }
+      chunkLen += i - start;
+   }
+   if (chunkLen >= self->max_size)
+   {
+      boundary = true;
+   }
+   *isBoundary = boundary;
+   self->gear_hash = hash;
+   self->chunk_len = (uint32_t) chunkLen;
+   return i;
+}
+
+static void emit_chunk(cdc_chunker_t *self)
+{
+   cdc_chunk_t chunk;
+   chunk.offset = self->offset;
+   chunk.length = self->chunk_len;
+   sha256_final(&self->sha, chunk.hash);
+   self->on_chunk(self->arg, &chunk);
+   self->offset += self->chunk_len;
+   self->gear_hash = 0u;
+   self->chunk_len = 0u;
+   sha256_init(&self->sha);
+}
+
+static void handler_open(void *arg)
+{
+   cdc_chunker_reset((cdc_chunker_t*) arg);
+}
+
+static void handler_close(void *arg)
+{
+   cdc_chunker_finish((cdc_chunker_t*) arg);
+}
+
+static void handler_write(void *arg, const uint8_t *pChunk, uint32_t chunkLen)
+{
+   cdc_chunker_write((cdc_chunker_t*) arg, pChunk, chunkLen);
+}
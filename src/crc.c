@@ -0,0 +1,1016 @@
+/*****************************************************************************
+* \file      crc.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     CRC32C and CRC-16 checksums
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdbool.h>
+#include <string.h>
+#include "crc.h"
+#include "pack.h"
+#include "cutil_cpu.h"
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define CRC_X86_SSE42
+#include <immintrin.h>
+#endif
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define CRC32C_POLY 0x82F63B78u //reflected form of 0x1EDC6F41
+#define LANE_SIZE 256u          //bytes per lane in the interleaved SSE4.2 kernel
+
+//Works on the raw CRC register (no pre/post inversion)
+typedef uint32_t (crc32c_func_t)(uint32_t reg, const uint8_t *data, size_t len);
+
+typedef struct crc16_params_tag
+{
+   uint16_t poly;   //normal (non-reflected) form
+   uint16_t init;
+   uint16_t xorout;
+   bool reflected;
+} crc16_params_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static uint16_t reflect16(uint16_t value);
+static uint32_t crc32c_slice8(uint32_t reg, const uint8_t *data, size_t len);
+#ifdef CRC_X86_SSE42
+static uint32_t crc32c_shift(unsigned numLanes, uint32_t reg);
+static uint32_t crc32c_sse42(uint32_t reg, const uint8_t *data, size_t len);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const crc16_params_t m_crc16_params[CRC16_NUM_VARIANTS] =
+{
+   {0x1021u, 0xFFFFu, 0x0000u, false}, //CRC16_CCITT_FALSE
+   {0x1021u, 0x0000u, 0x0000u, false}, //CRC16_XMODEM
+   {0x1021u, 0x0000u, 0x0000u, true},  //CRC16_KERMIT
+   {0x1021u, 0xFFFFu, 0xFFFFu, true},  //CRC16_X25
+   {0x8005u, 0xFFFFu, 0x0000u, true},  //CRC16_MODBUS
+   {0x8005u, 0x0000u, 0x0000u, true}   //CRC16_ARC
+};
+
+//slicing-by-8 tables, m_crc32c_table[k][b] is the register for byte b followed by k zero bytes
+static const uint32_t m_crc32c_table[8][256] =
+{
+   {
+      0x00000000u, 0xF26B8303u, 0xE13B70F7u, 0x1350F3F4u, 0xC79A971Fu, 0x35F1141Cu, 0x26A1E7E8u, 0xD4CA64EBu,
+      0x8AD958CFu, 0x78B2DBCCu, 0x6BE22838u, 0x9989AB3Bu, 0x4D43CFD0u, 0xBF284CD3u, 0xAC78BF27u, 0x5E133C24u,
+      0x105EC76Fu, 0xE235446Cu, 0xF165B798u, 0x030E349Bu, 0xD7C45070u, 0x25AFD373u, 0x36FF2087u, 0xC494A384u,
+      0x9A879FA0u, 0x68EC1CA3u, 0x7BBCEF57u, 0x89D76C54u, 0x5D1D08BFu, 0xAF768BBCu, 0xBC267848u, 0x4E4DFB4Bu,
+      0x20BD8EDEu, 0xD2D60DDDu, 0xC186FE29u, 0x33ED7D2Au, 0xE72719C1u, 0x154C9AC2u, 0x061C6936u, 0xF477EA35u,
+      0xAA64D611u, 0x580F5512u, 0x4B5FA6E6u, 0xB93425E5u, 0x6DFE410Eu, 0x9F95C20Du, 0x8CC531F9u, 0x7EAEB2FAu,
+      0x30E349B1u, 0xC288CAB2u, 0xD1D83946u, 0x23B3BA45u, 0xF779DEAEu, 0x05125DADu, 0x1642AE59u, 0xE4292D5Au,
+      0xBA3A117Eu, 0x4851927Du, 0x5B016189u, 0xA96AE28Au, 0x7DA08661u, 0x8FCB0562u, 0x9C9BF696u, 0x6EF07595u,
+      0x417B1DBCu, 0xB3109EBFu, 0xA0406D4Bu, 0x522BEE48u, 0x86E18AA3u, 0x748A09A0u, 0x67DAFA54u, 0x95B17957u,
+      0xCBA24573u, 0x39C9C670u, 0x2A993584u, 0xD8F2B687u, 0x0C38D26Cu, 0xFE53516Fu, 0xED03A29Bu, 0x1F682198u,
+      0x5125DAD3u, 0xA34E59D0u, 0xB01EAA24u, 0x42752927u, 0x96BF4DCCu, 0x64D4CECFu, 0x77843D3Bu, 0x85EFBE38u,
+      0xDBFC821Cu, 0x2997011Fu, 0x3AC7F2EBu, 0xC8AC71E8u, 0x1C661503u, 0xEE0D9600u, 0xFD5D65F4u, 0x0F36E6F7u,
+      0x61C69362u, 0x93AD1061u, 0x80FDE395u, 0x72966096u, 0xA65C047Du, 0x5437877Eu, 0x4767748Au, 0xB50CF789u,
+      0xEB1FCBADu, 0x197448AEu, 0x0A24BB5Au, 0xF84F3859u, 0x2C855CB2u, 0xDEEEDFB1u, 0xCDBE2C45u, 0x3FD5AF46u,
+      0x7198540Du, 0x83F3D70Eu, 0x90A324FAu, 0x62C8A7F9u, 0xB602C312u, 0x44694011u, 0x5739B3E5u, 0xA55230E6u,
+      0xFB410CC2u, 0x092A8FC1u, 0x1A7A7C35u, 0xE811FF36u, 0x3CDB9BDDu, 0xCEB018DEu, 0xDDE0EB2Au, 0x2F8B6829u,
+      0x82F63B78u, 0x709DB87Bu, 0x63CD4B8Fu, 0x91A6C88Cu, 0x456CAC67u, 0xB7072F64u, 0xA457DC90u, 0x563C5F93u,
+      0x082F63B7u, 0xFA44E0B4u, 0xE9141340u, 0x1B7F9043u, 0xCFB5F4A8u, 0x3DDE77ABu, 0x2E8E845Fu, 0xDCE5075Cu,
+      0x92A8FC17u, 0x60C37F14u, 0x73938CE0u, 0x81F80FE3u, 0x55326B08u, 0xA759E80Bu, 0xB4091BFFu, 0x466298FCu,
+      0x1871A4D8u, 0xEA1A27DBu, 0xF94AD42Fu, 0x0B21572Cu, 0xDFEB33C7u, 0x2D80B0C4u, 0x3ED04330u, 0xCCBBC033u,
+      0xA24BB5A6u, 0x502036A5u, 0x4370C551u, 0xB11B4652u, 0x65D122B9u, 0x97BAA1BAu, 0x84EA524Eu, 0x7681D14Du,
+      0x2892ED69u, 0xDAF96E6Au, 0xC9A99D9Eu, 0x3BC21E9Du, 0xEF087A76u, 0x1D63F975u, 0x0E330A81u, 0xFC588982u,
+      0xB21572C9u, 0x407EF1CAu, 0x532E023Eu, 0xA145813Du, 0x758FE5D6u, 0x87E466D5u, 0x94B49521u, 0x66DF1622u,
+      0x38CC2A06u, 0xCAA7A905u, 0xD9F75AF1u, 0x2B9CD9F2u, 0xFF56BD19u, 0x0D3D3E1Au, 0x1E6DCDEEu, 0xEC064EEDu,
+      0xC38D26C4u, 0x31E6A5C7u, 0x22B65633u, 0xD0DDD530u, 0x0417B1DBu, 0xF67C32D8u, 0xE52CC12Cu, 0x1747422Fu,
+      0x49547E0Bu, 0xBB3FFD08u, 0xA86F0EFCu, 0x5A048DFFu, 0x8ECEE914u, 0x7CA56A17u, 0x6FF599E3u, 0x9D9E1AE0u,
+      0xD3D3E1ABu, 0x21B862A8u, 0x32E8915Cu, 0xC083125Fu, 0x144976B4u, 0xE622F5B7u, 0xF5720643u, 0x07198540u,
+      0x590AB964u, 0xAB613A67u, 0xB831C993u, 0x4A5A4A90u, 0x9E902E7Bu, 0x6CFBAD78u, 0x7FAB5E8Cu, 0x8DC0DD8Fu,
+      0xE330A81Au, 0x115B2B19u, 0x020BD8EDu, 0xF0605BEEu, 0x24AA3F05u, 0xD6C1BC06u, 0xC5914FF2u, 0x37FACCF1u,
+      0x69E9F0D5u, 0x9B8273D6u, 0x88D28022u, 0x7AB90321u, 0xAE7367CAu, 0x5C18E4C9u, 0x4F48173Du, 0xBD23943Eu,
+      0xF36E6F75u, 0x0105EC76u, 0x12551F82u, 0xE03E9C81u, 0x34F4F86Au, 0xC69F7B69u, 0xD5CF889Du, 0x27A40B9Eu,
+      0x79B737BAu, 0x8BDCB4B9u, 0x988C474Du, 0x6AE7C44Eu, 0xBE2DA0A5u, 0x4C4623A6u, 0x5F16D052u, 0xAD7D5351u
+   },
+   {
+      0x00000000u, 0x13A29877u, 0x274530EEu, 0x34E7A899u, 0x4E8A61DCu, 0x5D28F9ABu, 0x69CF5132u, 0x7A6DC945u,
+      0x9D14C3B8u, 0x8EB65BCFu, 0xBA51F356u, 0xA9F36B21u, 0xD39EA264u, 0xC03C3A13u, 0xF4DB928Au, 0xE7790AFDu,
+      0x3FC5F181u, 0x2C6769F6u, 0x1880C16Fu, 0x0B225918u, 0x714F905Du, 0x62ED082Au, 0x560AA0B3u, 0x45A838C4u,
+      0xA2D13239u, 0xB173AA4Eu, 0x859402D7u, 0x96369AA0u, 0xEC5B53E5u, 0xFFF9CB92u, 0xCB1E630Bu, 0xD8BCFB7Cu,
+      0x7F8BE302u, 0x6C297B75u, 0x58CED3ECu, 0x4B6C4B9Bu, 0x310182DEu, 0x22A31AA9u, 0x1644B230u, 0x05E62A47u,
+      0xE29F20BAu, 0xF13DB8CDu, 0xC5DA1054u, 0xD6788823u, 0xAC154166u, 0xBFB7D911u, 0x8B507188u, 0x98F2E9FFu,
+      0x404E1283u, 0x53EC8AF4u, 0x670B226Du, 0x74A9BA1Au, 0x0EC4735Fu, 0x1D66EB28u, 0x298143B1u, 0x3A23DBC6u,
+      0xDD5AD13Bu, 0xCEF8494Cu, 0xFA1FE1D5u, 0xE9BD79A2u, 0x93D0B0E7u, 0x80722890u, 0xB4958009u, 0xA737187Eu,
+      0xFF17C604u, 0xECB55E73u, 0xD852F6EAu, 0xCBF06E9Du, 0xB19DA7D8u, 0xA23F3FAFu, 0x96D89736u, 0x857A0F41u,
+      0x620305BCu, 0x71A19DCBu, 0x45463552u, 0x56E4AD25u, 0x2C896460u, 0x3F2BFC17u, 0x0BCC548Eu, 0x186ECCF9u,
+      0xC0D23785u, 0xD370AFF2u, 0xE797076Bu, 0xF4359F1Cu, 0x8E585659u, 0x9DFACE2Eu, 0xA91D66B7u, 0xBABFFEC0u,
+      0x5DC6F43Du, 0x4E646C4Au, 0x7A83C4D3u, 0x69215CA4u, 0x134C95E1u, 0x00EE0D96u, 0x3409A50Fu, 0x27AB3D78u,
+      0x809C2506u, 0x933EBD71u, 0xA7D915E8u, 0xB47B8D9Fu, 0xCE1644DAu, 0xDDB4DCADu, 0xE9537434u, 0xFAF1EC43u,
+      0x1D88E6BEu, 0x0E2A7EC9u, 0x3ACDD650u, 0x296F4E27u, 0x53028762u, 0x40A01F15u, 0x7447B78Cu, 0x67E52FFBu,
+      0xBF59D487u, 0xACFB4CF0u, 0x981CE469u, 0x8BBE7C1Eu, 0xF1D3B55Bu, 0xE2712D2Cu, 0xD69685B5u, 0xC5341DC2u,
+      0x224D173Fu, 0x31EF8F48u, 0x050827D1u, 0x16AABFA6u, 0x6CC776E3u, 0x7F65EE94u, 0x4B82460Du, 0x5820DE7Au,
+      0xFBC3FAF9u, 0xE861628Eu, 0xDC86CA17u, 0xCF245260u, 0xB5499B25u, 0xA6EB0352u, 0x920CABCBu, 0x81AE33BCu,
+      0x66D73941u, 0x7575A136u, 0x419209AFu, 0x523091D8u, 0x285D589Du, 0x3BFFC0EAu, 0x0F186873u, 0x1CBAF004u,
+      0xC4060B78u, 0xD7A4930Fu, 0xE3433B96u, 0xF0E1A3E1u, 0x8A8C6AA4u, 0x992EF2D3u, 0xADC95A4Au, 0xBE6BC23Du,
+      0x5912C8C0u, 0x4AB050B7u, 0x7E57F82Eu, 0x6DF56059u, 0x1798A91Cu, 0x043A316Bu, 0x30DD99F2u, 0x237F0185u,
+      0x844819FBu, 0x97EA818Cu, 0xA30D2915u, 0xB0AFB162u, 0xCAC27827u, 0xD960E050u, 0xED8748C9u, 0xFE25D0BEu,
+      0x195CDA43u, 0x0AFE4234u, 0x3E19EAADu, 0x2DBB72DAu, 0x57D6BB9Fu, 0x447423E8u, 0x70938B71u, 0x63311306u,
+      0xBB8DE87Au, 0xA82F700Du, 0x9CC8D894u, 0x8F6A40E3u, 0xF50789A6u, 0xE6A511D1u, 0xD242B948u, 0xC1E0213Fu,
+      0x26992BC2u, 0x353BB3B5u, 0x01DC1B2Cu, 0x127E835Bu, 0x68134A1Eu, 0x7BB1D269u, 0x4F567AF0u, 0x5CF4E287u,
+      0x04D43CFDu, 0x1776A48Au, 0x23910C13u, 0x30339464u, 0x4A5E5D21u, 0x59FCC556u, 0x6D1B6DCFu, 0x7EB9F5B8u,
+      0x99C0FF45u, 0x8A626732u, 0xBE85CFABu, 0xAD2757DCu, 0xD74A9E99u, 0xC4E806EEu, 0xF00FAE77u, 0xE3AD3600u,
+      0x3B11CD7Cu, 0x28B3550Bu, 0x1C54FD92u, 0x0FF665E5u, 0x759BACA0u, 0x663934D7u, 0x52DE9C4Eu, 0x417C0439u,
+      0xA6050EC4u, 0xB5A796B3u, 0x81403E2Au, 0x92E2A65Du, 0xE88F6F18u, 0xFB2DF76Fu, 0xCFCA5FF6u, 0xDC68C781u,
+      0x7B5FDFFFu, 0x68FD4788u, 0x5C1AEF11u, 0x4FB87766u, 0x35D5BE23u, 0x26772654u, 0x12908ECDu, 0x013216BAu,
+      0xE64B1C47u, 0xF5E98430u, 0xC10E2CA9u, 0xD2ACB4DEu, 0xA8C17D9Bu, 0xBB63E5ECu, 0x8F844D75u, 0x9C26D502u,
+      0x449A2E7Eu, 0x5738B609u, 0x63DF1E90u, 0x707D86E7u, 0x0A104FA2u, 0x19B2D7D5u, 0x2D557F4Cu, 0x3EF7E73Bu,
+      0xD98EEDC6u, 0xCA2C75B1u, 0xFECBDD28u, 0xED69455Fu, 0x97048C1Au, 0x84A6146Du, 0xB041BCF4u, 0xA3E32483u
+   },
+   {
+      0x00000000u, 0xA541927Eu, 0x4F6F520Du, 0xEA2EC073u, 0x9EDEA41Au, 0x3B9F3664u, 0xD1B1F617u, 0x74F06469u,
+      0x38513EC5u, 0x9D10ACBBu, 0x773E6CC8u, 0xD27FFEB6u, 0xA68F9ADFu, 0x03CE08A1u, 0xE9E0C8D2u, 0x4CA15AACu,
+      0x70A27D8Au, 0xD5E3EFF4u, 0x3FCD2F87u, 0x9A8CBDF9u, 0xEE7CD990u, 0x4B3D4BEEu, 0xA1138B9Du, 0x045219E3u,
+      0x48F3434Fu, 0xEDB2D131u, 0x079C1142u, 0xA2DD833Cu, 0xD62DE755u, 0x736C752Bu, 0x9942B558u, 0x3C032726u,
+      0xE144FB14u, 0x4405696Au, 0xAE2BA919u, 0x0B6A3B67u, 0x7F9A5F0Eu, 0xDADBCD70u, 0x30F50D03u, 0x95B49F7Du,
+      0xD915C5D1u, 0x7C5457AFu, 0x967A97DCu, 0x333B05A2u, 0x47CB61CBu, 0xE28AF3B5u, 0x08A433C6u, 0xADE5A1B8u,
+      0x91E6869Eu, 0x34A714E0u, 0xDE89D493u, 0x7BC846EDu, 0x0F382284u, 0xAA79B0FAu, 0x40577089u, 0xE516E2F7u,
+      0xA9B7B85Bu, 0x0CF62A25u, 0xE6D8EA56u, 0x43997828u, 0x37691C41u, 0x92288E3Fu, 0x78064E4Cu, 0xDD47DC32u,
+      0xC76580D9u, 0x622412A7u, 0x880AD2D4u, 0x2D4B40AAu, 0x59BB24C3u, 0xFCFAB6BDu, 0x16D476CEu, 0xB395E4B0u,
+      0xFF34BE1Cu, 0x5A752C62u, 0xB05BEC11u, 0x151A7E6Fu, 0x61EA1A06u, 0xC4AB8878u, 0x2E85480Bu, 0x8BC4DA75u,
+      0xB7C7FD53u, 0x12866F2Du, 0xF8A8AF5Eu, 0x5DE93D20u, 0x29195949u, 0x8C58CB37u, 0x66760B44u, 0xC337993Au,
+      0x8F96C396u, 0x2AD751E8u, 0xC0F9919Bu, 0x65B803E5u, 0x1148678Cu, 0xB409F5F2u, 0x5E273581u, 0xFB66A7FFu,
+      0x26217BCDu, 0x8360E9B3u, 0x694E29C0u, 0xCC0FBBBEu, 0xB8FFDFD7u, 0x1DBE4DA9u, 0xF7908DDAu, 0x52D11FA4u,
+      0x1E704508u, 0xBB31D776u, 0x511F1705u, 0xF45E857Bu, 0x80AEE112u, 0x25EF736Cu, 0xCFC1B31Fu, 0x6A802161u,
+      0x56830647u, 0xF3C29439u, 0x19EC544Au, 0xBCADC634u, 0xC85DA25Du, 0x6D1C3023u, 0x8732F050u, 0x2273622Eu,
+      0x6ED23882u, 0xCB93AAFCu, 0x21BD6A8Fu, 0x84FCF8F1u, 0xF00C9C98u, 0x554D0EE6u, 0xBF63CE95u, 0x1A225CEBu,
+      0x8B277743u, 0x2E66E53Du, 0xC448254Eu, 0x6109B730u, 0x15F9D359u, 0xB0B84127u, 0x5A968154u, 0xFFD7132Au,
+      0xB3764986u, 0x1637DBF8u, 0xFC191B8Bu, 0x595889F5u, 0x2DA8ED9Cu, 0x88E97FE2u, 0x62C7BF91u, 0xC7862DEFu,
+      0xFB850AC9u, 0x5EC498B7u, 0xB4EA58C4u, 0x11ABCABAu, 0x655BAED3u, 0xC01A3CADu, 0x2A34FCDEu, 0x8F756EA0u,
+      0xC3D4340Cu, 0x6695A672u, 0x8CBB6601u, 0x29FAF47Fu, 0x5D0A9016u, 0xF84B0268u, 0x1265C21Bu, 0xB7245065u,
+      0x6A638C57u, 0xCF221E29u, 0x250CDE5Au, 0x804D4C24u, 0xF4BD284Du, 0x51FCBA33u, 0xBBD27A40u, 0x1E93E83Eu,
+      0x5232B292u, 0xF77320ECu, 0x1D5DE09Fu, 0xB81C72E1u, 0xCCEC1688u, 0x69AD84F6u, 0x83834485u, 0x26C2D6FBu,
+      0x1AC1F1DDu, 0xBF8063A3u, 0x55AEA3D0u, 0xF0EF31AEu, 0x841F55C7u, 0x215EC7B9u, 0xCB7007CAu, 0x6E3195B4u,
+      0x2290CF18u, 0x87D15D66u, 0x6DFF9D15u, 0xC8BE0F6Bu, 0xBC4E6B02u, 0x190FF97Cu, 0xF321390Fu, 0x5660AB71u,
+      0x4C42F79Au, 0xE90365E4u, 0x032DA597u, 0xA66C37E9u, 0xD29C5380u, 0x77DDC1FEu, 0x9DF3018Du, 0x38B293F3u,
+      0x7413C95Fu, 0xD1525B21u, 0x3B7C9B52u, 0x9E3D092Cu, 0xEACD6D45u, 0x4F8CFF3Bu, 0xA5A23F48u, 0x00E3AD36u,
+      0x3CE08A10u, 0x99A1186Eu, 0x738FD81Du, 0xD6CE4A63u, 0xA23E2E0Au, 0x077FBC74u, 0xED517C07u, 0x4810EE79u,
+      0x04B1B4D5u, 0xA1F026ABu, 0x4BDEE6D8u, 0xEE9F74A6u, 0x9A6F10CFu, 0x3F2E82B1u, 0xD50042C2u, 0x7041D0BCu,
+      0xAD060C8Eu, 0x08479EF0u, 0xE2695E83u, 0x4728CCFDu, 0x33D8A894u, 0x96993AEAu, 0x7CB7FA99u, 0xD9F668E7u,
+      0x9557324Bu, 0x3016A035u, 0xDA386046u, 0x7F79F238u, 0x0B899651u, 0xAEC8042Fu, 0x44E6C45Cu, 0xE1A75622u,
+      0xDDA47104u, 0x78E5E37Au, 0x92CB2309u, 0x378AB177u, 0x437AD51Eu, 0xE63B4760u, 0x0C158713u, 0xA954156Du,
+      0xE5F54FC1u, 0x40B4DDBFu, 0xAA9A1DCCu, 0x0FDB8FB2u, 0x7B2BEBDBu, 0xDE6A79A5u, 0x3444B9D6u, 0x91052BA8u
+   },
+   {
+      0x00000000u, 0xDD45AAB8u, 0xBF672381u, 0x62228939u, 0x7B2231F3u, 0xA6679B4Bu, 0xC4451272u, 0x1900B8CAu,
+      0xF64463E6u, 0x2B01C95Eu, 0x49234067u, 0x9466EADFu, 0x8D665215u, 0x5023F8ADu, 0x32017194u, 0xEF44DB2Cu,
+      0xE964B13Du, 0x34211B85u, 0x560392BCu, 0x8B463804u, 0x924680CEu, 0x4F032A76u, 0x2D21A34Fu, 0xF06409F7u,
+      0x1F20D2DBu, 0xC2657863u, 0xA047F15Au, 0x7D025BE2u, 0x6402E328u, 0xB9474990u, 0xDB65C0A9u, 0x06206A11u,
+      0xD725148Bu, 0x0A60BE33u, 0x6842370Au, 0xB5079DB2u, 0xAC072578u, 0x71428FC0u, 0x136006F9u, 0xCE25AC41u,
+      0x2161776Du, 0xFC24DDD5u, 0x9E0654ECu, 0x4343FE54u, 0x5A43469Eu, 0x8706EC26u, 0xE524651Fu, 0x3861CFA7u,
+      0x3E41A5B6u, 0xE3040F0Eu, 0x81268637u, 0x5C632C8Fu, 0x45639445u, 0x98263EFDu, 0xFA04B7C4u, 0x27411D7Cu,
+      0xC805C650u, 0x15406CE8u, 0x7762E5D1u, 0xAA274F69u, 0xB327F7A3u, 0x6E625D1Bu, 0x0C40D422u, 0xD1057E9Au,
+      0xABA65FE7u, 0x76E3F55Fu, 0x14C17C66u, 0xC984D6DEu, 0xD0846E14u, 0x0DC1C4ACu, 0x6FE34D95u, 0xB2A6E72Du,
+      0x5DE23C01u, 0x80A796B9u, 0xE2851F80u, 0x3FC0B538u, 0x26C00DF2u, 0xFB85A74Au, 0x99A72E73u, 0x44E284CBu,
+      0x42C2EEDAu, 0x9F874462u, 0xFDA5CD5Bu, 0x20E067E3u, 0x39E0DF29u, 0xE4A57591u, 0x8687FCA8u, 0x5BC25610u,
+      0xB4868D3Cu, 0x69C32784u, 0x0BE1AEBDu, 0xD6A40405u, 0xCFA4BCCFu, 0x12E11677u, 0x70C39F4Eu, 0xAD8635F6u,
+      0x7C834B6Cu, 0xA1C6E1D4u, 0xC3E468EDu, 0x1EA1C255u, 0x07A17A9Fu, 0xDAE4D027u, 0xB8C6591Eu, 0x6583F3A6u,
+      0x8AC7288Au, 0x57828232u, 0x35A00B0Bu, 0xE8E5A1B3u, 0xF1E51979u, 0x2CA0B3C1u, 0x4E823AF8u, 0x93C79040u,
+      0x95E7FA51u, 0x48A250E9u, 0x2A80D9D0u, 0xF7C57368u, 0xEEC5CBA2u, 0x3380611Au, 0x51A2E823u, 0x8CE7429Bu,
+      0x63A399B7u, 0xBEE6330Fu, 0xDCC4BA36u, 0x0181108Eu, 0x1881A844u, 0xC5C402FCu, 0xA7E68BC5u, 0x7AA3217Du,
+      0x52A0C93Fu, 0x8FE56387u, 0xEDC7EABEu, 0x30824006u, 0x2982F8CCu, 0xF4C75274u, 0x96E5DB4Du, 0x4BA071F5u,
+      0xA4E4AAD9u, 0x79A10061u, 0x1B838958u, 0xC6C623E0u, 0xDFC69B2Au, 0x02833192u, 0x60A1B8ABu, 0xBDE41213u,
+      0xBBC47802u, 0x6681D2BAu, 0x04A35B83u, 0xD9E6F13Bu, 0xC0E649F1u, 0x1DA3E349u, 0x7F816A70u, 0xA2C4C0C8u,
+      0x4D801BE4u, 0x90C5B15Cu, 0xF2E73865u, 0x2FA292DDu, 0x36A22A17u, 0xEBE780AFu, 0x89C50996u, 0x5480A32Eu,
+      0x8585DDB4u, 0x58C0770Cu, 0x3AE2FE35u, 0xE7A7548Du, 0xFEA7EC47u, 0x23E246FFu, 0x41C0CFC6u, 0x9C85657Eu,
+      0x73C1BE52u, 0xAE8414EAu, 0xCCA69DD3u, 0x11E3376Bu, 0x08E38FA1u, 0xD5A62519u, 0xB784AC20u, 0x6AC10698u,
+      0x6CE16C89u, 0xB1A4C631u, 0xD3864F08u, 0x0EC3E5B0u, 0x17C35D7Au, 0xCA86F7C2u, 0xA8A47EFBu, 0x75E1D443u,
+      0x9AA50F6Fu, 0x47E0A5D7u, 0x25C22CEEu, 0xF8878656u, 0xE1873E9Cu, 0x3CC29424u, 0x5EE01D1Du, 0x83A5B7A5u,
+      0xF90696D8u, 0x24433C60u, 0x4661B559u, 0x9B241FE1u, 0x8224A72Bu, 0x5F610D93u, 0x3D4384AAu, 0xE0062E12u,
+      0x0F42F53Eu, 0xD2075F86u, 0xB025D6BFu, 0x6D607C07u, 0x7460C4CDu, 0xA9256E75u, 0xCB07E74Cu, 0x16424DF4u,
+      0x106227E5u, 0xCD278D5Du, 0xAF050464u, 0x7240AEDCu, 0x6B401616u, 0xB605BCAEu, 0xD4273597u, 0x09629F2Fu,
+      0xE6264403u, 0x3B63EEBBu, 0x59416782u, 0x8404CD3Au, 0x9D0475F0u, 0x4041DF48u, 0x22635671u, 0xFF26FCC9u,
+      0x2E238253u, 0xF36628EBu, 0x9144A1D2u, 0x4C010B6Au, 0x5501B3A0u, 0x88441918u, 0xEA669021u, 0x37233A99u,
+      0xD867E1B5u, 0x05224B0Du, 0x6700C234u, 0xBA45688Cu, 0xA345D046u, 0x7E007AFEu, 0x1C22F3C7u, 0xC167597Fu,
+      0xC747336Eu, 0x1A0299D6u, 0x782010EFu, 0xA565BA57u, 0xBC65029Du, 0x6120A825u, 0x0302211Cu, 0xDE478BA4u,
+      0x31035088u, 0xEC46FA30u, 0x8E647309u, 0x5321D9B1u, 0x4A21617Bu, 0x9764CBC3u, 0xF54642FAu, 0x2803E842u
+   },
+   {
+      0x00000000u, 0x38116FACu, 0x7022DF58u, 0x4833B0F4u, 0xE045BEB0u, 0xD854D11Cu, 0x906761E8u, 0xA8760E44u,
+      0xC5670B91u, 0xFD76643Du, 0xB545D4C9u, 0x8D54BB65u, 0x2522B521u, 0x1D33DA8Du, 0x55006A79u, 0x6D1105D5u,
+      0x8F2261D3u, 0xB7330E7Fu, 0xFF00BE8Bu, 0xC711D127u, 0x6F67DF63u, 0x5776B0CFu, 0x1F45003Bu, 0x27546F97u,
+      0x4A456A42u, 0x725405EEu, 0x3A67B51Au, 0x0276DAB6u, 0xAA00D4F2u, 0x9211BB5Eu, 0xDA220BAAu, 0xE2336406u,
+      0x1BA8B557u, 0x23B9DAFBu, 0x6B8A6A0Fu, 0x539B05A3u, 0xFBED0BE7u, 0xC3FC644Bu, 0x8BCFD4BFu, 0xB3DEBB13u,
+      0xDECFBEC6u, 0xE6DED16Au, 0xAEED619Eu, 0x96FC0E32u, 0x3E8A0076u, 0x069B6FDAu, 0x4EA8DF2Eu, 0x76B9B082u,
+      0x948AD484u, 0xAC9BBB28u, 0xE4A80BDCu, 0xDCB96470u, 0x74CF6A34u, 0x4CDE0598u, 0x04EDB56Cu, 0x3CFCDAC0u,
+      0x51EDDF15u, 0x69FCB0B9u, 0x21CF004Du, 0x19DE6FE1u, 0xB1A861A5u, 0x89B90E09u, 0xC18ABEFDu, 0xF99BD151u,
+      0x37516AAEu, 0x0F400502u, 0x4773B5F6u, 0x7F62DA5Au, 0xD714D41Eu, 0xEF05BBB2u, 0xA7360B46u, 0x9F2764EAu,
+      0xF236613Fu, 0xCA270E93u, 0x8214BE67u, 0xBA05D1CBu, 0x1273DF8Fu, 0x2A62B023u, 0x625100D7u, 0x5A406F7Bu,
+      0xB8730B7Du, 0x806264D1u, 0xC851D425u, 0xF040BB89u, 0x5836B5CDu, 0x6027DA61u, 0x28146A95u, 0x10050539u,
+      0x7D1400ECu, 0x45056F40u, 0x0D36DFB4u, 0x3527B018u, 0x9D51BE5Cu, 0xA540D1F0u, 0xED736104u, 0xD5620EA8u,
+      0x2CF9DFF9u, 0x14E8B055u, 0x5CDB00A1u, 0x64CA6F0Du, 0xCCBC6149u, 0xF4AD0EE5u, 0xBC9EBE11u, 0x848FD1BDu,
+      0xE99ED468u, 0xD18FBBC4u, 0x99BC0B30u, 0xA1AD649Cu, 0x09DB6AD8u, 0x31CA0574u, 0x79F9B580u, 0x41E8DA2Cu,
+      0xA3DBBE2Au, 0x9BCAD186u, 0xD3F96172u, 0xEBE80EDEu, 0x439E009Au, 0x7B8F6F36u, 0x33BCDFC2u, 0x0BADB06Eu,
+      0x66BCB5BBu, 0x5EADDA17u, 0x169E6AE3u, 0x2E8F054Fu, 0x86F90B0Bu, 0xBEE864A7u, 0xF6DBD453u, 0xCECABBFFu,
+      0x6EA2D55Cu, 0x56B3BAF0u, 0x1E800A04u, 0x269165A8u, 0x8EE76BECu, 0xB6F60440u, 0xFEC5B4B4u, 0xC6D4DB18u,
+      0xABC5DECDu, 0x93D4B161u, 0xDBE70195u, 0xE3F66E39u, 0x4B80607Du, 0x73910FD1u, 0x3BA2BF25u, 0x03B3D089u,
+      0xE180B48Fu, 0xD991DB23u, 0x91A26BD7u, 0xA9B3047Bu, 0x01C50A3Fu, 0x39D46593u, 0x71E7D567u, 0x49F6BACBu,
+      0x24E7BF1Eu, 0x1CF6D0B2u, 0x54C56046u, 0x6CD40FEAu, 0xC4A201AEu, 0xFCB36E02u, 0xB480DEF6u, 0x8C91B15Au,
+      0x750A600Bu, 0x4D1B0FA7u, 0x0528BF53u, 0x3D39D0FFu, 0x954FDEBBu, 0xAD5EB117u, 0xE56D01E3u, 0xDD7C6E4Fu,
+      0xB06D6B9Au, 0x887C0436u, 0xC04FB4C2u, 0xF85EDB6Eu, 0x5028D52Au, 0x6839BA86u, 0x200A0A72u, 0x181B65DEu,
+      0xFA2801D8u, 0xC2396E74u, 0x8A0ADE80u, 0xB21BB12Cu, 0x1A6DBF68u, 0x227CD0C4u, 0x6A4F6030u, 0x525E0F9Cu,
+      0x3F4F0A49u, 0x075E65E5u, 0x4F6DD511u, 0x777CBABDu, 0xDF0AB4F9u, 0xE71BDB55u, 0xAF286BA1u, 0x9739040Du,
+      0x59F3BFF2u, 0x61E2D05Eu, 0x29D160AAu, 0x11C00F06u, 0xB9B60142u, 0x81A76EEEu, 0xC994DE1Au, 0xF185B1B6u,
+      0x9C94B463u, 0xA485DBCFu, 0xECB66B3Bu, 0xD4A70497u, 0x7CD10AD3u, 0x44C0657Fu, 0x0CF3D58Bu, 0x34E2BA27u,
+      0xD6D1DE21u, 0xEEC0B18Du, 0xA6F30179u, 0x9EE26ED5u, 0x36946091u, 0x0E850F3Du, 0x46B6BFC9u, 0x7EA7D065u,
+      0x13B6D5B0u, 0x2BA7BA1Cu, 0x63940AE8u, 0x5B856544u, 0xF3F36B00u, 0xCBE204ACu, 0x83D1B458u, 0xBBC0DBF4u,
+      0x425B0AA5u, 0x7A4A6509u, 0x3279D5FDu, 0x0A68BA51u, 0xA21EB415u, 0x9A0FDBB9u, 0xD23C6B4Du, 0xEA2D04E1u,
+      0x873C0134u, 0xBF2D6E98u, 0xF71EDE6Cu, 0xCF0FB1C0u, 0x6779BF84u, 0x5F68D028u, 0x175B60DCu, 0x2F4A0F70u,
+      0xCD796B76u, 0xF56804DAu, 0xBD5BB42Eu, 0x854ADB82u, 0x2D3CD5C6u, 0x152DBA6Au, 0x5D1E0A9Eu, 0x650F6532u,
+      0x081E60E7u, 0x300F0F4Bu, 0x783CBFBFu, 0x402DD013u, 0xE85BDE57u, 0xD04AB1FBu, 0x9879010Fu, 0xA0686EA3u
+   },
+   {
+      0x00000000u, 0xEF306B19u, 0xDB8CA0C3u, 0x34BCCBDAu, 0xB2F53777u, 0x5DC55C6Eu, 0x697997B4u, 0x8649FCADu,
+      0x6006181Fu, 0x8F367306u, 0xBB8AB8DCu, 0x54BAD3C5u, 0xD2F32F68u, 0x3DC34471u, 0x097F8FABu, 0xE64FE4B2u,
+      0xC00C303Eu, 0x2F3C5B27u, 0x1B8090FDu, 0xF4B0FBE4u, 0x72F90749u, 0x9DC96C50u, 0xA975A78Au, 0x4645CC93u,
+      0xA00A2821u, 0x4F3A4338u, 0x7B8688E2u, 0x94B6E3FBu, 0x12FF1F56u, 0xFDCF744Fu, 0xC973BF95u, 0x2643D48Cu,
+      0x85F4168Du, 0x6AC47D94u, 0x5E78B64Eu, 0xB148DD57u, 0x370121FAu, 0xD8314AE3u, 0xEC8D8139u, 0x03BDEA20u,
+      0xE5F20E92u, 0x0AC2658Bu, 0x3E7EAE51u, 0xD14EC548u, 0x570739E5u, 0xB83752FCu, 0x8C8B9926u, 0x63BBF23Fu,
+      0x45F826B3u, 0xAAC84DAAu, 0x9E748670u, 0x7144ED69u, 0xF70D11C4u, 0x183D7ADDu, 0x2C81B107u, 0xC3B1DA1Eu,
+      0x25FE3EACu, 0xCACE55B5u, 0xFE729E6Fu, 0x1142F576u, 0x970B09DBu, 0x783B62C2u, 0x4C87A918u, 0xA3B7C201u,
+      0x0E045BEBu, 0xE13430F2u, 0xD588FB28u, 0x3AB89031u, 0xBCF16C9Cu, 0x53C10785u, 0x677DCC5Fu, 0x884DA746u,
+      0x6E0243F4u, 0x813228EDu, 0xB58EE337u, 0x5ABE882Eu, 0xDCF77483u, 0x33C71F9Au, 0x077BD440u, 0xE84BBF59u,
+      0xCE086BD5u, 0x213800CCu, 0x1584CB16u, 0xFAB4A00Fu, 0x7CFD5CA2u, 0x93CD37BBu, 0xA771FC61u, 0x48419778u,
+      0xAE0E73CAu, 0x413E18D3u, 0x7582D309u, 0x9AB2B810u, 0x1CFB44BDu, 0xF3CB2FA4u, 0xC777E47Eu, 0x28478F67u,
+      0x8BF04D66u, 0x64C0267Fu, 0x507CEDA5u, 0xBF4C86BCu, 0x39057A11u, 0xD6351108u, 0xE289DAD2u, 0x0DB9B1CBu,
+      0xEBF65579u, 0x04C63E60u, 0x307AF5BAu, 0xDF4A9EA3u, 0x5903620Eu, 0xB6330917u, 0x828FC2CDu, 0x6DBFA9D4u,
+      0x4BFC7D58u, 0xA4CC1641u, 0x9070DD9Bu, 0x7F40B682u, 0xF9094A2Fu, 0x16392136u, 0x2285EAECu, 0xCDB581F5u,
+      0x2BFA6547u, 0xC4CA0E5Eu, 0xF076C584u, 0x1F46AE9Du, 0x990F5230u, 0x763F3929u, 0x4283F2F3u, 0xADB399EAu,
+      0x1C08B7D6u, 0xF338DCCFu, 0xC7841715u, 0x28B47C0Cu, 0xAEFD80A1u, 0x41CDEBB8u, 0x75712062u, 0x9A414B7Bu,
+      0x7C0EAFC9u, 0x933EC4D0u, 0xA7820F0Au, 0x48B26413u, 0xCEFB98BEu, 0x21CBF3A7u, 0x1577387Du, 0xFA475364u,
+      0xDC0487E8u, 0x3334ECF1u, 0x0788272Bu, 0xE8B84C32u, 0x6EF1B09Fu, 0x81C1DB86u, 0xB57D105Cu, 0x5A4D7B45u,
+      0xBC029FF7u, 0x5332F4EEu, 0x678E3F34u, 0x88BE542Du, 0x0EF7A880u, 0xE1C7C399u, 0xD57B0843u, 0x3A4B635Au,
+      0x99FCA15Bu, 0x76CCCA42u, 0x42700198u, 0xAD406A81u, 0x2B09962Cu, 0xC439FD35u, 0xF08536EFu, 0x1FB55DF6u,
+      0xF9FAB944u, 0x16CAD25Du, 0x22761987u, 0xCD46729Eu, 0x4B0F8E33u, 0xA43FE52Au, 0x90832EF0u, 0x7FB345E9u,
+      0x59F09165u, 0xB6C0FA7Cu, 0x827C31A6u, 0x6D4C5ABFu, 0xEB05A612u, 0x0435CD0Bu, 0x308906D1u, 0xDFB96DC8u,
+      0x39F6897Au, 0xD6C6E263u, 0xE27A29B9u, 0x0D4A42A0u, 0x8B03BE0Du, 0x6433D514u, 0x508F1ECEu, 0xBFBF75D7u,
+      0x120CEC3Du, 0xFD3C8724u, 0xC9804CFEu, 0x26B027E7u, 0xA0F9DB4Au, 0x4FC9B053u, 0x7B757B89u, 0x94451090u,
+      0x720AF422u, 0x9D3A9F3Bu, 0xA98654E1u, 0x46B63FF8u, 0xC0FFC355u, 0x2FCFA84Cu, 0x1B736396u, 0xF443088Fu,
+      0xD200DC03u, 0x3D30B71Au, 0x098C7CC0u, 0xE6BC17D9u, 0x60F5EB74u, 0x8FC5806Du, 0xBB794BB7u, 0x544920AEu,
+      0xB206C41Cu, 0x5D36AF05u, 0x698A64DFu, 0x86BA0FC6u, 0x00F3F36Bu, 0xEFC39872u, 0xDB7F53A8u, 0x344F38B1u,
+      0x97F8FAB0u, 0x78C891A9u, 0x4C745A73u, 0xA344316Au, 0x250DCDC7u, 0xCA3DA6DEu, 0xFE816D04u, 0x11B1061Du,
+      0xF7FEE2AFu, 0x18CE89B6u, 0x2C72426Cu, 0xC3422975u, 0x450BD5D8u, 0xAA3BBEC1u, 0x9E87751Bu, 0x71B71E02u,
+      0x57F4CA8Eu, 0xB8C4A197u, 0x8C786A4Du, 0x63480154u, 0xE501FDF9u, 0x0A3196E0u, 0x3E8D5D3Au, 0xD1BD3623u,
+      0x37F2D291u, 0xD8C2B988u, 0xEC7E7252u, 0x034E194Bu, 0x8507E5E6u, 0x6A378EFFu, 0x5E8B4525u, 0xB1BB2E3Cu
+   },
+   {
+      0x00000000u, 0x68032CC8u, 0xD0065990u, 0xB8057558u, 0xA5E0C5D1u, 0xCDE3E919u, 0x75E69C41u, 0x1DE5B089u,
+      0x4E2DFD53u, 0x262ED19Bu, 0x9E2BA4C3u, 0xF628880Bu, 0xEBCD3882u, 0x83CE144Au, 0x3BCB6112u, 0x53C84DDAu,
+      0x9C5BFAA6u, 0xF458D66Eu, 0x4C5DA336u, 0x245E8FFEu, 0x39BB3F77u, 0x51B813BFu, 0xE9BD66E7u, 0x81BE4A2Fu,
+      0xD27607F5u, 0xBA752B3Du, 0x02705E65u, 0x6A7372ADu, 0x7796C224u, 0x1F95EEECu, 0xA7909BB4u, 0xCF93B77Cu,
+      0x3D5B83BDu, 0x5558AF75u, 0xED5DDA2Du, 0x855EF6E5u, 0x98BB466Cu, 0xF0B86AA4u, 0x48BD1FFCu, 0x20BE3334u,
+      0x73767EEEu, 0x1B755226u, 0xA370277Eu, 0xCB730BB6u, 0xD696BB3Fu, 0xBE9597F7u, 0x0690E2AFu, 0x6E93CE67u,
+      0xA100791Bu, 0xC90355D3u, 0x7106208Bu, 0x19050C43u, 0x04E0BCCAu, 0x6CE39002u, 0xD4E6E55Au, 0xBCE5C992u,
+      0xEF2D8448u, 0x872EA880u, 0x3F2BDDD8u, 0x5728F110u, 0x4ACD4199u, 0x22CE6D51u, 0x9ACB1809u, 0xF2C834C1u,
+      0x7AB7077Au, 0x12B42BB2u, 0xAAB15EEAu, 0xC2B27222u, 0xDF57C2ABu, 0xB754EE63u, 0x0F519B3Bu, 0x6752B7F3u,
+      0x349AFA29u, 0x5C99D6E1u, 0xE49CA3B9u, 0x8C9F8F71u, 0x917A3FF8u, 0xF9791330u, 0x417C6668u, 0x297F4AA0u,
+      0xE6ECFDDCu, 0x8EEFD114u, 0x36EAA44Cu, 0x5EE98884u, 0x430C380Du, 0x2B0F14C5u, 0x930A619Du, 0xFB094D55u,
+      0xA8C1008Fu, 0xC0C22C47u, 0x78C7591Fu, 0x10C475D7u, 0x0D21C55Eu, 0x6522E996u, 0xDD279CCEu, 0xB524B006u,
+      0x47EC84C7u, 0x2FEFA80Fu, 0x97EADD57u, 0xFFE9F19Fu, 0xE20C4116u, 0x8A0F6DDEu, 0x320A1886u, 0x5A09344Eu,
+      0x09C17994u, 0x61C2555Cu, 0xD9C72004u, 0xB1C40CCCu, 0xAC21BC45u, 0xC422908Du, 0x7C27E5D5u, 0x1424C91Du,
+      0xDBB77E61u, 0xB3B452A9u, 0x0BB127F1u, 0x63B20B39u, 0x7E57BBB0u, 0x16549778u, 0xAE51E220u, 0xC652CEE8u,
+      0x959A8332u, 0xFD99AFFAu, 0x459CDAA2u, 0x2D9FF66Au, 0x307A46E3u, 0x58796A2Bu, 0xE07C1F73u, 0x887F33BBu,
+      0xF56E0EF4u, 0x9D6D223Cu, 0x25685764u, 0x4D6B7BACu, 0x508ECB25u, 0x388DE7EDu, 0x808892B5u, 0xE88BBE7Du,
+      0xBB43F3A7u, 0xD340DF6Fu, 0x6B45AA37u, 0x034686FFu, 0x1EA33676u, 0x76A01ABEu, 0xCEA56FE6u, 0xA6A6432Eu,
+      0x6935F452u, 0x0136D89Au, 0xB933ADC2u, 0xD130810Au, 0xCCD53183u, 0xA4D61D4Bu, 0x1CD36813u, 0x74D044DBu,
+      0x27180901u, 0x4F1B25C9u, 0xF71E5091u, 0x9F1D7C59u, 0x82F8CCD0u, 0xEAFBE018u, 0x52FE9540u, 0x3AFDB988u,
+      0xC8358D49u, 0xA036A181u, 0x1833D4D9u, 0x7030F811u, 0x6DD54898u, 0x05D66450u, 0xBDD31108u, 0xD5D03DC0u,
+      0x8618701Au, 0xEE1B5CD2u, 0x561E298Au, 0x3E1D0542u, 0x23F8B5CBu, 0x4BFB9903u, 0xF3FEEC5Bu, 0x9BFDC093u,
+      0x546E77EFu, 0x3C6D5B27u, 0x84682E7Fu, 0xEC6B02B7u, 0xF18EB23Eu, 0x998D9EF6u, 0x2188EBAEu, 0x498BC766u,
+      0x1A438ABCu, 0x7240A674u, 0xCA45D32Cu, 0xA246FFE4u, 0xBFA34F6Du, 0xD7A063A5u, 0x6FA516FDu, 0x07A63A35u,
+      0x8FD9098Eu, 0xE7DA2546u, 0x5FDF501Eu, 0x37DC7CD6u, 0x2A39CC5Fu, 0x423AE097u, 0xFA3F95CFu, 0x923CB907u,
+      0xC1F4F4DDu, 0xA9F7D815u, 0x11F2AD4Du, 0x79F18185u, 0x6414310Cu, 0x0C171DC4u, 0xB412689Cu, 0xDC114454u,
+      0x1382F328u, 0x7B81DFE0u, 0xC384AAB8u, 0xAB878670u, 0xB66236F9u, 0xDE611A31u, 0x66646F69u, 0x0E6743A1u,
+      0x5DAF0E7Bu, 0x35AC22B3u, 0x8DA957EBu, 0xE5AA7B23u, 0xF84FCBAAu, 0x904CE762u, 0x2849923Au, 0x404ABEF2u,
+      0xB2828A33u, 0xDA81A6FBu, 0x6284D3A3u, 0x0A87FF6Bu, 0x17624FE2u, 0x7F61632Au, 0xC7641672u, 0xAF673ABAu,
+      0xFCAF7760u, 0x94AC5BA8u, 0x2CA92EF0u, 0x44AA0238u, 0x594FB2B1u, 0x314C9E79u, 0x8949EB21u, 0xE14AC7E9u,
+      0x2ED97095u, 0x46DA5C5Du, 0xFEDF2905u, 0x96DC05CDu, 0x8B39B544u, 0xE33A998Cu, 0x5B3FECD4u, 0x333CC01Cu,
+      0x60F48DC6u, 0x08F7A10Eu, 0xB0F2D456u, 0xD8F1F89Eu, 0xC5144817u, 0xAD1764DFu, 0x15121187u, 0x7D113D4Fu
+   },
+   {
+      0x00000000u, 0x493C7D27u, 0x9278FA4Eu, 0xDB448769u, 0x211D826Du, 0x6821FF4Au, 0xB3657823u, 0xFA590504u,
+      0x423B04DAu, 0x0B0779FDu, 0xD043FE94u, 0x997F83B3u, 0x632686B7u, 0x2A1AFB90u, 0xF15E7CF9u, 0xB86201DEu,
+      0x847609B4u, 0xCD4A7493u, 0x160EF3FAu, 0x5F328EDDu, 0xA56B8BD9u, 0xEC57F6FEu, 0x37137197u, 0x7E2F0CB0u,
+      0xC64D0D6Eu, 0x8F717049u, 0x5435F720u, 0x1D098A07u, 0xE7508F03u, 0xAE6CF224u, 0x7528754Du, 0x3C14086Au,
+      0x0D006599u, 0x443C18BEu, 0x9F789FD7u, 0xD644E2F0u, 0x2C1DE7F4u, 0x65219AD3u, 0xBE651DBAu, 0xF759609Du,
+      0x4F3B6143u, 0x06071C64u, 0xDD439B0Du, 0x947FE62Au, 0x6E26E32Eu, 0x271A9E09u, 0xFC5E1960u, 0xB5626447u,
+      0x89766C2Du, 0xC04A110Au, 0x1B0E9663u, 0x5232EB44u, 0xA86BEE40u, 0xE1579367u, 0x3A13140Eu, 0x732F6929u,
+      0xCB4D68F7u, 0x827115D0u, 0x593592B9u, 0x1009EF9Eu, 0xEA50EA9Au, 0xA36C97BDu, 0x782810D4u, 0x31146DF3u,
+      0x1A00CB32u, 0x533CB615u, 0x8878317Cu, 0xC1444C5Bu, 0x3B1D495Fu, 0x72213478u, 0xA965B311u, 0xE059CE36u,
+      0x583BCFE8u, 0x1107B2CFu, 0xCA4335A6u, 0x837F4881u, 0x79264D85u, 0x301A30A2u, 0xEB5EB7CBu, 0xA262CAECu,
+      0x9E76C286u, 0xD74ABFA1u, 0x0C0E38C8u, 0x453245EFu, 0xBF6B40EBu, 0xF6573DCCu, 0x2D13BAA5u, 0x642FC782u,
+      0xDC4DC65Cu, 0x9571BB7Bu, 0x4E353C12u, 0x07094135u, 0xFD504431u, 0xB46C3916u, 0x6F28BE7Fu, 0x2614C358u,
+      0x1700AEABu, 0x5E3CD38Cu, 0x857854E5u, 0xCC4429C2u, 0x361D2CC6u, 0x7F2151E1u, 0xA465D688u, 0xED59ABAFu,
+      0x553BAA71u, 0x1C07D756u, 0xC743503Fu, 0x8E7F2D18u, 0x7426281Cu, 0x3D1A553Bu, 0xE65ED252u, 0xAF62AF75u,
+      0x9376A71Fu, 0xDA4ADA38u, 0x010E5D51u, 0x48322076u, 0xB26B2572u, 0xFB575855u, 0x2013DF3Cu, 0x692FA21Bu,
+      0xD14DA3C5u, 0x9871DEE2u, 0x4335598Bu, 0x0A0924ACu, 0xF05021A8u, 0xB96C5C8Fu, 0x6228DBE6u, 0x2B14A6C1u,
+      0x34019664u, 0x7D3DEB43u, 0xA6796C2Au, 0xEF45110Du, 0x151C1409u, 0x5C20692Eu, 0x8764EE47u, 0xCE589360u,
+      0x763A92BEu, 0x3F06EF99u, 0xE44268F0u, 0xAD7E15D7u, 0x572710D3u, 0x1E1B6DF4u, 0xC55FEA9Du, 0x8C6397BAu,
+      0xB0779FD0u, 0xF94BE2F7u, 0x220F659Eu, 0x6B3318B9u, 0x916A1DBDu, 0xD856609Au, 0x0312E7F3u, 0x4A2E9AD4u,
+      0xF24C9B0Au, 0xBB70E62Du, 0x60346144u, 0x29081C63u, 0xD3511967u, 0x9A6D6440u, 0x4129E329u, 0x08159E0Eu,
+      0x3901F3FDu, 0x703D8EDAu, 0xAB7909B3u, 0xE2457494u, 0x181C7190u, 0x51200CB7u, 0x8A648BDEu, 0xC358F6F9u,
+      0x7B3AF727u, 0x32068A00u, 0xE9420D69u, 0xA07E704Eu, 0x5A27754Au, 0x131B086Du, 0xC85F8F04u, 0x8163F223u,
+      0xBD77FA49u, 0xF44B876Eu, 0x2F0F0007u, 0x66337D20u, 0x9C6A7824u, 0xD5560503u, 0x0E12826Au, 0x472EFF4Du,
+      0xFF4CFE93u, 0xB67083B4u, 0x6D3404DDu, 0x240879FAu, 0xDE517CFEu, 0x976D01D9u, 0x4C2986B0u, 0x0515FB97u,
+      0x2E015D56u, 0x673D2071u, 0xBC79A718u, 0xF545DA3Fu, 0x0F1CDF3Bu, 0x4620A21Cu, 0x9D642575u, 0xD4585852u,
+      0x6C3A598Cu, 0x250624ABu, 0xFE42A3C2u, 0xB77EDEE5u, 0x4D27DBE1u, 0x041BA6C6u, 0xDF5F21AFu, 0x96635C88u,
+      0xAA7754E2u, 0xE34B29C5u, 0x380FAEACu, 0x7133D38Bu, 0x8B6AD68Fu, 0xC256ABA8u, 0x19122CC1u, 0x502E51E6u,
+      0xE84C5038u, 0xA1702D1Fu, 0x7A34AA76u, 0x3308D751u, 0xC951D255u, 0x806DAF72u, 0x5B29281Bu, 0x1215553Cu,
+      0x230138CFu, 0x6A3D45E8u, 0xB179C281u, 0xF845BFA6u, 0x021CBAA2u, 0x4B20C785u, 0x906440ECu, 0xD9583DCBu,
+      0x613A3C15u, 0x28064132u, 0xF342C65Bu, 0xBA7EBB7Cu, 0x4027BE78u, 0x091BC35Fu, 0xD25F4436u, 0x9B633911u,
+      0xA777317Bu, 0xEE4B4C5Cu, 0x350FCB35u, 0x7C33B612u, 0x866AB316u, 0xCF56CE31u, 0x14124958u, 0x5D2E347Fu,
+      0xE54C35A1u, 0xAC704886u, 0x7734CFEFu, 0x3E08B2C8u, 0xC451B7CCu, 0x8D6DCAEBu, 0x56294D82u, 0x1F1530A5u
+   }
+};
+#ifdef CRC_X86_SSE42
+//advances a register over LANE_SIZE (index 0) or 2 * LANE_SIZE (index 1) zero bytes, one table per register byte.
+//Advancing over zero bytes is linear, so entry b of table j is the XOR of the advanced single-bit registers
+//for the bits set in b << (8 * j).
+static const uint32_t m_crc32c_shift[2][4][256] =
+{
+   {
+      {
+         0x00000000u, 0xDCB17AA4u, 0xBC8E83B9u, 0x603FF91Du, 0x7CF17183u, 0xA0400B27u, 0xC07FF23Au, 0x1CCE889Eu,
+         0xF9E2E306u, 0x255399A2u, 0x456C60BFu, 0x99DD1A1Bu, 0x85139285u, 0x59A2E821u, 0x399D113Cu, 0xE52C6B98u,
+         0xF629B0FDu, 0x2A98CA59u, 0x4AA73344u, 0x961649E0u, 0x8AD8C17Eu, 0x5669BBDAu, 0x365642C7u, 0xEAE73863u,
+         0x0FCB53FBu, 0xD37A295Fu, 0xB345D042u, 0x6FF4AAE6u, 0x733A2278u, 0xAF8B58DCu, 0xCFB4A1C1u, 0x1305DB65u,
+         0xE9BF170Bu, 0x350E6DAFu, 0x553194B2u, 0x8980EE16u, 0x954E6688u, 0x49FF1C2Cu, 0x29C0E531u, 0xF5719F95u,
+         0x105DF40Du, 0xCCEC8EA9u, 0xACD377B4u, 0x70620D10u, 0x6CAC858Eu, 0xB01DFF2Au, 0xD0220637u, 0x0C937C93u,
+         0x1F96A7F6u, 0xC327DD52u, 0xA318244Fu, 0x7FA95EEBu, 0x6367D675u, 0xBFD6ACD1u, 0xDFE955CCu, 0x03582F68u,
+         0xE67444F0u, 0x3AC53E54u, 0x5AFAC749u, 0x864BBDEDu, 0x9A853573u, 0x46344FD7u, 0x260BB6CAu, 0xFABACC6Eu,
+         0xD69258E7u, 0x0A232243u, 0x6A1CDB5Eu, 0xB6ADA1FAu, 0xAA632964u, 0x76D253C0u, 0x16EDAADDu, 0xCA5CD079u,
+         0x2F70BBE1u, 0xF3C1C145u, 0x93FE3858u, 0x4F4F42FCu, 0x5381CA62u, 0x8F30B0C6u, 0xEF0F49DBu, 0x33BE337Fu,
+         0x20BBE81Au, 0xFC0A92BEu, 0x9C356BA3u, 0x40841107u, 0x5C4A9999u, 0x80FBE33Du, 0xE0C41A20u, 0x3C756084u,
+         0xD9590B1Cu, 0x05E871B8u, 0x65D788A5u, 0xB966F201u, 0xA5A87A9Fu, 0x7919003Bu, 0x1926F926u, 0xC5978382u,
+         0x3F2D4FECu, 0xE39C3548u, 0x83A3CC55u, 0x5F12B6F1u, 0x43DC3E6Fu, 0x9F6D44CBu, 0xFF52BDD6u, 0x23E3C772u,
+         0xC6CFACEAu, 0x1A7ED64Eu, 0x7A412F53u, 0xA6F055F7u, 0xBA3EDD69u, 0x668FA7CDu, 0x06B05ED0u, 0xDA012474u,
+         0xC904FF11u, 0x15B585B5u, 0x758A7CA8u, 0xA93B060Cu, 0xB5F58E92u, 0x6944F436u, 0x097B0D2Bu, 0xD5CA778Fu,
+         0x30E61C17u, 0xEC5766B3u, 0x8C689FAEu, 0x50D9E50Au, 0x4C176D94u, 0x90A61730u, 0xF099EE2Du, 0x2C289489u,
+         0xA8C8C73Fu, 0x7479BD9Bu, 0x14464486u, 0xC8F73E22u, 0xD439B6BCu, 0x0888CC18u, 0x68B73505u, 0xB4064FA1u,
+         0x512A2439u, 0x8D9B5E9Du, 0xEDA4A780u, 0x3115DD24u, 0x2DDB55BAu, 0xF16A2F1Eu, 0x9155D603u, 0x4DE4ACA7u,
+         0x5EE177C2u, 0x82500D66u, 0xE26FF47Bu, 0x3EDE8EDFu, 0x22100641u, 0xFEA17CE5u, 0x9E9E85F8u, 0x422FFF5Cu,
+         0xA70394C4u, 0x7BB2EE60u, 0x1B8D177Du, 0xC73C6DD9u, 0xDBF2E547u, 0x07439FE3u, 0x677C66FEu, 0xBBCD1C5Au,
+         0x4177D034u, 0x9DC6AA90u, 0xFDF9538Du, 0x21482929u, 0x3D86A1B7u, 0xE137DB13u, 0x8108220Eu, 0x5DB958AAu,
+         0xB8953332u, 0x64244996u, 0x041BB08Bu, 0xD8AACA2Fu, 0xC46442B1u, 0x18D53815u, 0x78EAC108u, 0xA45BBBACu,
+         0xB75E60C9u, 0x6BEF1A6Du, 0x0BD0E370u, 0xD76199D4u, 0xCBAF114Au, 0x171E6BEEu, 0x772192F3u, 0xAB90E857u,
+         0x4EBC83CFu, 0x920DF96Bu, 0xF2320076u, 0x2E837AD2u, 0x324DF24Cu, 0xEEFC88E8u, 0x8EC371F5u, 0x52720B51u,
+         0x7E5A9FD8u, 0xA2EBE57Cu, 0xC2D41C61u, 0x1E6566C5u, 0x02ABEE5Bu, 0xDE1A94FFu, 0xBE256DE2u, 0x62941746u,
+         0x87B87CDEu, 0x5B09067Au, 0x3B36FF67u, 0xE78785C3u, 0xFB490D5Du, 0x27F877F9u, 0x47C78EE4u, 0x9B76F440u,
+         0x88732F25u, 0x54C25581u, 0x34FDAC9Cu, 0xE84CD638u, 0xF4825EA6u, 0x28332402u, 0x480CDD1Fu, 0x94BDA7BBu,
+         0x7191CC23u, 0xAD20B687u, 0xCD1F4F9Au, 0x11AE353Eu, 0x0D60BDA0u, 0xD1D1C704u, 0xB1EE3E19u, 0x6D5F44BDu,
+         0x97E588D3u, 0x4B54F277u, 0x2B6B0B6Au, 0xF7DA71CEu, 0xEB14F950u, 0x37A583F4u, 0x579A7AE9u, 0x8B2B004Du,
+         0x6E076BD5u, 0xB2B61171u, 0xD289E86Cu, 0x0E3892C8u, 0x12F61A56u, 0xCE4760F2u, 0xAE7899EFu, 0x72C9E34Bu,
+         0x61CC382Eu, 0xBD7D428Au, 0xDD42BB97u, 0x01F3C133u, 0x1D3D49ADu, 0xC18C3309u, 0xA1B3CA14u, 0x7D02B0B0u,
+         0x982EDB28u, 0x449FA18Cu, 0x24A05891u, 0xF8112235u, 0xE4DFAAABu, 0x386ED00Fu, 0x58512912u, 0x84E053B6u
+      },
+      {
+         0x00000000u, 0x547DF88Fu, 0xA8FBF11Eu, 0xFC860991u, 0x541B94CDu, 0x00666C42u, 0xFCE065D3u, 0xA89D9D5Cu,
+         0xA837299Au, 0xFC4AD115u, 0x00CCD884u, 0x54B1200Bu, 0xFC2CBD57u, 0xA85145D8u, 0x54D74C49u, 0x00AAB4C6u,
+         0x558225C5u, 0x01FFDD4Au, 0xFD79D4DBu, 0xA9042C54u, 0x0199B108u, 0x55E44987u, 0xA9624016u, 0xFD1FB899u,
+         0xFDB50C5Fu, 0xA9C8F4D0u, 0x554EFD41u, 0x013305CEu, 0xA9AE9892u, 0xFDD3601Du, 0x0155698Cu, 0x55289103u,
+         0xAB044B8Au, 0xFF79B305u, 0x03FFBA94u, 0x5782421Bu, 0xFF1FDF47u, 0xAB6227C8u, 0x57E42E59u, 0x0399D6D6u,
+         0x03336210u, 0x574E9A9Fu, 0xABC8930Eu, 0xFFB56B81u, 0x5728F6DDu, 0x03550E52u, 0xFFD307C3u, 0xABAEFF4Cu,
+         0xFE866E4Fu, 0xAAFB96C0u, 0x567D9F51u, 0x020067DEu, 0xAA9DFA82u, 0xFEE0020Du, 0x02660B9Cu, 0x561BF313u,
+         0x56B147D5u, 0x02CCBF5Au, 0xFE4AB6CBu, 0xAA374E44u, 0x02AAD318u, 0x56D72B97u, 0xAA512206u, 0xFE2CDA89u,
+         0x53E4E1E5u, 0x0799196Au, 0xFB1F10FBu, 0xAF62E874u, 0x07FF7528u, 0x53828DA7u, 0xAF048436u, 0xFB797CB9u,
+         0xFBD3C87Fu, 0xAFAE30F0u, 0x53283961u, 0x0755C1EEu, 0xAFC85CB2u, 0xFBB5A43Du, 0x0733ADACu, 0x534E5523u,
+         0x0666C420u, 0x521B3CAFu, 0xAE9D353Eu, 0xFAE0CDB1u, 0x527D50EDu, 0x0600A862u, 0xFA86A1F3u, 0xAEFB597Cu,
+         0xAE51EDBAu, 0xFA2C1535u, 0x06AA1CA4u, 0x52D7E42Bu, 0xFA4A7977u, 0xAE3781F8u, 0x52B18869u, 0x06CC70E6u,
+         0xF8E0AA6Fu, 0xAC9D52E0u, 0x501B5B71u, 0x0466A3FEu, 0xACFB3EA2u, 0xF886C62Du, 0x0400CFBCu, 0x507D3733u,
+         0x50D783F5u, 0x04AA7B7Au, 0xF82C72EBu, 0xAC518A64u, 0x04CC1738u, 0x50B1EFB7u, 0xAC37E626u, 0xF84A1EA9u,
+         0xAD628FAAu, 0xF91F7725u, 0x05997EB4u, 0x51E4863Bu, 0xF9791B67u, 0xAD04E3E8u, 0x5182EA79u, 0x05FF12F6u,
+         0x0555A630u, 0x51285EBFu, 0xADAE572Eu, 0xF9D3AFA1u, 0x514E32FDu, 0x0533CA72u, 0xF9B5C3E3u, 0xADC83B6Cu,
+         0xA7C9C3CAu, 0xF3B43B45u, 0x0F3232D4u, 0x5B4FCA5Bu, 0xF3D25707u, 0xA7AFAF88u, 0x5B29A619u, 0x0F545E96u,
+         0x0FFEEA50u, 0x5B8312DFu, 0xA7051B4Eu, 0xF378E3C1u, 0x5BE57E9Du, 0x0F988612u, 0xF31E8F83u, 0xA763770Cu,
+         0xF24BE60Fu, 0xA6361E80u, 0x5AB01711u, 0x0ECDEF9Eu, 0xA65072C2u, 0xF22D8A4Du, 0x0EAB83DCu, 0x5AD67B53u,
+         0x5A7CCF95u, 0x0E01371Au, 0xF2873E8Bu, 0xA6FAC604u, 0x0E675B58u, 0x5A1AA3D7u, 0xA69CAA46u, 0xF2E152C9u,
+         0x0CCD8840u, 0x58B070CFu, 0xA436795Eu, 0xF04B81D1u, 0x58D61C8Du, 0x0CABE402u, 0xF02DED93u, 0xA450151Cu,
+         0xA4FAA1DAu, 0xF0875955u, 0x0C0150C4u, 0x587CA84Bu, 0xF0E13517u, 0xA49CCD98u, 0x581AC409u, 0x0C673C86u,
+         0x594FAD85u, 0x0D32550Au, 0xF1B45C9Bu, 0xA5C9A414u, 0x0D543948u, 0x5929C1C7u, 0xA5AFC856u, 0xF1D230D9u,
+         0xF178841Fu, 0xA5057C90u, 0x59837501u, 0x0DFE8D8Eu, 0xA56310D2u, 0xF11EE85Du, 0x0D98E1CCu, 0x59E51943u,
+         0xF42D222Fu, 0xA050DAA0u, 0x5CD6D331u, 0x08AB2BBEu, 0xA036B6E2u, 0xF44B4E6Du, 0x08CD47FCu, 0x5CB0BF73u,
+         0x5C1A0BB5u, 0x0867F33Au, 0xF4E1FAABu, 0xA09C0224u, 0x08019F78u, 0x5C7C67F7u, 0xA0FA6E66u, 0xF48796E9u,
+         0xA1AF07EAu, 0xF5D2FF65u, 0x0954F6F4u, 0x5D290E7Bu, 0xF5B49327u, 0xA1C96BA8u, 0x5D4F6239u, 0x09329AB6u,
+         0x09982E70u, 0x5DE5D6FFu, 0xA163DF6Eu, 0xF51E27E1u, 0x5D83BABDu, 0x09FE4232u, 0xF5784BA3u, 0xA105B32Cu,
+         0x5F2969A5u, 0x0B54912Au, 0xF7D298BBu, 0xA3AF6034u, 0x0B32FD68u, 0x5F4F05E7u, 0xA3C90C76u, 0xF7B4F4F9u,
+         0xF71E403Fu, 0xA363B8B0u, 0x5FE5B121u, 0x0B9849AEu, 0xA305D4F2u, 0xF7782C7Du, 0x0BFE25ECu, 0x5F83DD63u,
+         0x0AAB4C60u, 0x5ED6B4EFu, 0xA250BD7Eu, 0xF62D45F1u, 0x5EB0D8ADu, 0x0ACD2022u, 0xF64B29B3u, 0xA236D13Cu,
+         0xA29C65FAu, 0xF6E19D75u, 0x0A6794E4u, 0x5E1A6C6Bu, 0xF687F137u, 0xA2FA09B8u, 0x5E7C0029u, 0x0A01F8A6u
+      },
+      {
+         0x00000000u, 0x4A7FF165u, 0x94FFE2CAu, 0xDE8013AFu, 0x2C13B365u, 0x666C4200u, 0xB8EC51AFu, 0xF293A0CAu,
+         0x582766CAu, 0x125897AFu, 0xCCD88400u, 0x86A77565u, 0x7434D5AFu, 0x3E4B24CAu, 0xE0CB3765u, 0xAAB4C600u,
+         0xB04ECD94u, 0xFA313CF1u, 0x24B12F5Eu, 0x6ECEDE3Bu, 0x9C5D7EF1u, 0xD6228F94u, 0x08A29C3Bu, 0x42DD6D5Eu,
+         0xE869AB5Eu, 0xA2165A3Bu, 0x7C964994u, 0x36E9B8F1u, 0xC47A183Bu, 0x8E05E95Eu, 0x5085FAF1u, 0x1AFA0B94u,
+         0x6571EDD9u, 0x2F0E1CBCu, 0xF18E0F13u, 0xBBF1FE76u, 0x49625EBCu, 0x031DAFD9u, 0xDD9DBC76u, 0x97E24D13u,
+         0x3D568B13u, 0x77297A76u, 0xA9A969D9u, 0xE3D698BCu, 0x11453876u, 0x5B3AC913u, 0x85BADABCu, 0xCFC52BD9u,
+         0xD53F204Du, 0x9F40D128u, 0x41C0C287u, 0x0BBF33E2u, 0xF92C9328u, 0xB353624Du, 0x6DD371E2u, 0x27AC8087u,
+         0x8D184687u, 0xC767B7E2u, 0x19E7A44Du, 0x53985528u, 0xA10BF5E2u, 0xEB740487u, 0x35F41728u, 0x7F8BE64Du,
+         0xCAE3DBB2u, 0x809C2AD7u, 0x5E1C3978u, 0x1463C81Du, 0xE6F068D7u, 0xAC8F99B2u, 0x720F8A1Du, 0x38707B78u,
+         0x92C4BD78u, 0xD8BB4C1Du, 0x063B5FB2u, 0x4C44AED7u, 0xBED70E1Du, 0xF4A8FF78u, 0x2A28ECD7u, 0x60571DB2u,
+         0x7AAD1626u, 0x30D2E743u, 0xEE52F4ECu, 0xA42D0589u, 0x56BEA543u, 0x1CC15426u, 0xC2414789u, 0x883EB6ECu,
+         0x228A70ECu, 0x68F58189u, 0xB6759226u, 0xFC0A6343u, 0x0E99C389u, 0x44E632ECu, 0x9A662143u, 0xD019D026u,
+         0xAF92366Bu, 0xE5EDC70Eu, 0x3B6DD4A1u, 0x711225C4u, 0x8381850Eu, 0xC9FE746Bu, 0x177E67C4u, 0x5D0196A1u,
+         0xF7B550A1u, 0xBDCAA1C4u, 0x634AB26Bu, 0x2935430Eu, 0xDBA6E3C4u, 0x91D912A1u, 0x4F59010Eu, 0x0526F06Bu,
+         0x1FDCFBFFu, 0x55A30A9Au, 0x8B231935u, 0xC15CE850u, 0x33CF489Au, 0x79B0B9FFu, 0xA730AA50u, 0xED4F5B35u,
+         0x47FB9D35u, 0x0D846C50u, 0xD3047FFFu, 0x997B8E9Au, 0x6BE82E50u, 0x2197DF35u, 0xFF17CC9Au, 0xB5683DFFu,
+         0x902BC195u, 0xDA5430F0u, 0x04D4235Fu, 0x4EABD23Au, 0xBC3872F0u, 0xF6478395u, 0x28C7903Au, 0x62B8615Fu,
+         0xC80CA75Fu, 0x8273563Au, 0x5CF34595u, 0x168CB4F0u, 0xE41F143Au, 0xAE60E55Fu, 0x70E0F6F0u, 0x3A9F0795u,
+         0x20650C01u, 0x6A1AFD64u, 0xB49AEECBu, 0xFEE51FAEu, 0x0C76BF64u, 0x46094E01u, 0x98895DAEu, 0xD2F6ACCBu,
+         0x78426ACBu, 0x323D9BAEu, 0xECBD8801u, 0xA6C27964u, 0x5451D9AEu, 0x1E2E28CBu, 0xC0AE3B64u, 0x8AD1CA01u,
+         0xF55A2C4Cu, 0xBF25DD29u, 0x61A5CE86u, 0x2BDA3FE3u, 0xD9499F29u, 0x93366E4Cu, 0x4DB67DE3u, 0x07C98C86u,
+         0xAD7D4A86u, 0xE702BBE3u, 0x3982A84Cu, 0x73FD5929u, 0x816EF9E3u, 0xCB110886u, 0x15911B29u, 0x5FEEEA4Cu,
+         0x4514E1D8u, 0x0F6B10BDu, 0xD1EB0312u, 0x9B94F277u, 0x690752BDu, 0x2378A3D8u, 0xFDF8B077u, 0xB7874112u,
+         0x1D338712u, 0x574C7677u, 0x89CC65D8u, 0xC3B394BDu, 0x31203477u, 0x7B5FC512u, 0xA5DFD6BDu, 0xEFA027D8u,
+         0x5AC81A27u, 0x10B7EB42u, 0xCE37F8EDu, 0x84480988u, 0x76DBA942u, 0x3CA45827u, 0xE2244B88u, 0xA85BBAEDu,
+         0x02EF7CEDu, 0x48908D88u, 0x96109E27u, 0xDC6F6F42u, 0x2EFCCF88u, 0x64833EEDu, 0xBA032D42u, 0xF07CDC27u,
+         0xEA86D7B3u, 0xA0F926D6u, 0x7E793579u, 0x3406C41Cu, 0xC69564D6u, 0x8CEA95B3u, 0x526A861Cu, 0x18157779u,
+         0xB2A1B179u, 0xF8DE401Cu, 0x265E53B3u, 0x6C21A2D6u, 0x9EB2021Cu, 0xD4CDF379u, 0x0A4DE0D6u, 0x403211B3u,
+         0x3FB9F7FEu, 0x75C6069Bu, 0xAB461534u, 0xE139E451u, 0x13AA449Bu, 0x59D5B5FEu, 0x8755A651u, 0xCD2A5734u,
+         0x679E9134u, 0x2DE16051u, 0xF36173FEu, 0xB91E829Bu, 0x4B8D2251u, 0x01F2D334u, 0xDF72C09Bu, 0x950D31FEu,
+         0x8FF73A6Au, 0xC588CB0Fu, 0x1B08D8A0u, 0x517729C5u, 0xA3E4890Fu, 0xE99B786Au, 0x371B6BC5u, 0x7D649AA0u,
+         0xD7D05CA0u, 0x9DAFADC5u, 0x432FBE6Au, 0x09504F0Fu, 0xFBC3EFC5u, 0xB1BC1EA0u, 0x6F3C0D0Fu, 0x2543FC6Au
+      },
+      {
+         0x00000000u, 0x25BBF5DBu, 0x4B77EBB6u, 0x6ECC1E6Du, 0x96EFD76Cu, 0xB35422B7u, 0xDD983CDAu, 0xF823C901u,
+         0x2833D829u, 0x0D882DF2u, 0x6344339Fu, 0x46FFC644u, 0xBEDC0F45u, 0x9B67FA9Eu, 0xF5ABE4F3u, 0xD0101128u,
+         0x5067B052u, 0x75DC4589u, 0x1B105BE4u, 0x3EABAE3Fu, 0xC688673Eu, 0xE33392E5u, 0x8DFF8C88u, 0xA8447953u,
+         0x7854687Bu, 0x5DEF9DA0u, 0x332383CDu, 0x16987616u, 0xEEBBBF17u, 0xCB004ACCu, 0xA5CC54A1u, 0x8077A17Au,
+         0xA0CF60A4u, 0x8574957Fu, 0xEBB88B12u, 0xCE037EC9u, 0x3620B7C8u, 0x139B4213u, 0x7D575C7Eu, 0x58ECA9A5u,
+         0x88FCB88Du, 0xAD474D56u, 0xC38B533Bu, 0xE630A6E0u, 0x1E136FE1u, 0x3BA89A3Au, 0x55648457u, 0x70DF718Cu,
+         0xF0A8D0F6u, 0xD513252Du, 0xBBDF3B40u, 0x9E64CE9Bu, 0x6647079Au, 0x43FCF241u, 0x2D30EC2Cu, 0x088B19F7u,
+         0xD89B08DFu, 0xFD20FD04u, 0x93ECE369u, 0xB65716B2u, 0x4E74DFB3u, 0x6BCF2A68u, 0x05033405u, 0x20B8C1DEu,
+         0x4472B7B9u, 0x61C94262u, 0x0F055C0Fu, 0x2ABEA9D4u, 0xD29D60D5u, 0xF726950Eu, 0x99EA8B63u, 0xBC517EB8u,
+         0x6C416F90u, 0x49FA9A4Bu, 0x27368426u, 0x028D71FDu, 0xFAAEB8FCu, 0xDF154D27u, 0xB1D9534Au, 0x9462A691u,
+         0x141507EBu, 0x31AEF230u, 0x5F62EC5Du, 0x7AD91986u, 0x82FAD087u, 0xA741255Cu, 0xC98D3B31u, 0xEC36CEEAu,
+         0x3C26DFC2u, 0x199D2A19u, 0x77513474u, 0x52EAC1AFu, 0xAAC908AEu, 0x8F72FD75u, 0xE1BEE318u, 0xC40516C3u,
+         0xE4BDD71Du, 0xC10622C6u, 0xAFCA3CABu, 0x8A71C970u, 0x72520071u, 0x57E9F5AAu, 0x3925EBC7u, 0x1C9E1E1Cu,
+         0xCC8E0F34u, 0xE935FAEFu, 0x87F9E482u, 0xA2421159u, 0x5A61D858u, 0x7FDA2D83u, 0x111633EEu, 0x34ADC635u,
+         0xB4DA674Fu, 0x91619294u, 0xFFAD8CF9u, 0xDA167922u, 0x2235B023u, 0x078E45F8u, 0x69425B95u, 0x4CF9AE4Eu,
+         0x9CE9BF66u, 0xB9524ABDu, 0xD79E54D0u, 0xF225A10Bu, 0x0A06680Au, 0x2FBD9DD1u, 0x417183BCu, 0x64CA7667u,
+         0x88E56F72u, 0xAD5E9AA9u, 0xC39284C4u, 0xE629711Fu, 0x1E0AB81Eu, 0x3BB14DC5u, 0x557D53A8u, 0x70C6A673u,
+         0xA0D6B75Bu, 0x856D4280u, 0xEBA15CEDu, 0xCE1AA936u, 0x36396037u, 0x138295ECu, 0x7D4E8B81u, 0x58F57E5Au,
+         0xD882DF20u, 0xFD392AFBu, 0x93F53496u, 0xB64EC14Du, 0x4E6D084Cu, 0x6BD6FD97u, 0x051AE3FAu, 0x20A11621u,
+         0xF0B10709u, 0xD50AF2D2u, 0xBBC6ECBFu, 0x9E7D1964u, 0x665ED065u, 0x43E525BEu, 0x2D293BD3u, 0x0892CE08u,
+         0x282A0FD6u, 0x0D91FA0Du, 0x635DE460u, 0x46E611BBu, 0xBEC5D8BAu, 0x9B7E2D61u, 0xF5B2330Cu, 0xD009C6D7u,
+         0x0019D7FFu, 0x25A22224u, 0x4B6E3C49u, 0x6ED5C992u, 0x96F60093u, 0xB34DF548u, 0xDD81EB25u, 0xF83A1EFEu,
+         0x784DBF84u, 0x5DF64A5Fu, 0x333A5432u, 0x1681A1E9u, 0xEEA268E8u, 0xCB199D33u, 0xA5D5835Eu, 0x806E7685u,
+         0x507E67ADu, 0x75C59276u, 0x1B098C1Bu, 0x3EB279C0u, 0xC691B0C1u, 0xE32A451Au, 0x8DE65B77u, 0xA85DAEACu,
+         0xCC97D8CBu, 0xE92C2D10u, 0x87E0337Du, 0xA25BC6A6u, 0x5A780FA7u, 0x7FC3FA7Cu, 0x110FE411u, 0x34B411CAu,
+         0xE4A400E2u, 0xC11FF539u, 0xAFD3EB54u, 0x8A681E8Fu, 0x724BD78Eu, 0x57F02255u, 0x393C3C38u, 0x1C87C9E3u,
+         0x9CF06899u, 0xB94B9D42u, 0xD787832Fu, 0xF23C76F4u, 0x0A1FBFF5u, 0x2FA44A2Eu, 0x41685443u, 0x64D3A198u,
+         0xB4C3B0B0u, 0x9178456Bu, 0xFFB45B06u, 0xDA0FAEDDu, 0x222C67DCu, 0x07979207u, 0x695B8C6Au, 0x4CE079B1u,
+         0x6C58B86Fu, 0x49E34DB4u, 0x272F53D9u, 0x0294A602u, 0xFAB76F03u, 0xDF0C9AD8u, 0xB1C084B5u, 0x947B716Eu,
+         0x446B6046u, 0x61D0959Du, 0x0F1C8BF0u, 0x2AA77E2Bu, 0xD284B72Au, 0xF73F42F1u, 0x99F35C9Cu, 0xBC48A947u,
+         0x3C3F083Du, 0x1984FDE6u, 0x7748E38Bu, 0x52F31650u, 0xAAD0DF51u, 0x8F6B2A8Au, 0xE1A734E7u, 0xC41CC13Cu,
+         0x140CD014u, 0x31B725CFu, 0x5F7B3BA2u, 0x7AC0CE79u, 0x82E30778u, 0xA758F2A3u, 0xC994ECCEu, 0xEC2F1915u
+      }
+   },
+   {
+      {
+         0x00000000u, 0xBD6F81F8u, 0x7F337501u, 0xC25CF4F9u, 0xFE66EA02u, 0x43096BFAu, 0x81559F03u, 0x3C3A1EFBu,
+         0xF921A2F5u, 0x444E230Du, 0x8612D7F4u, 0x3B7D560Cu, 0x074748F7u, 0xBA28C90Fu, 0x78743DF6u, 0xC51BBC0Eu,
+         0xF7AF331Bu, 0x4AC0B2E3u, 0x889C461Au, 0x35F3C7E2u, 0x09C9D919u, 0xB4A658E1u, 0x76FAAC18u, 0xCB952DE0u,
+         0x0E8E91EEu, 0xB3E11016u, 0x71BDE4EFu, 0xCCD26517u, 0xF0E87BECu, 0x4D87FA14u, 0x8FDB0EEDu, 0x32B48F15u,
+         0xEAB210C7u, 0x57DD913Fu, 0x958165C6u, 0x28EEE43Eu, 0x14D4FAC5u, 0xA9BB7B3Du, 0x6BE78FC4u, 0xD6880E3Cu,
+         0x1393B232u, 0xAEFC33CAu, 0x6CA0C733u, 0xD1CF46CBu, 0xEDF55830u, 0x509AD9C8u, 0x92C62D31u, 0x2FA9ACC9u,
+         0x1D1D23DCu, 0xA072A224u, 0x622E56DDu, 0xDF41D725u, 0xE37BC9DEu, 0x5E144826u, 0x9C48BCDFu, 0x21273D27u,
+         0xE43C8129u, 0x595300D1u, 0x9B0FF428u, 0x266075D0u, 0x1A5A6B2Bu, 0xA735EAD3u, 0x65691E2Au, 0xD8069FD2u,
+         0xD088577Fu, 0x6DE7D687u, 0xAFBB227Eu, 0x12D4A386u, 0x2EEEBD7Du, 0x93813C85u, 0x51DDC87Cu, 0xECB24984u,
+         0x29A9F58Au, 0x94C67472u, 0x569A808Bu, 0xEBF50173u, 0xD7CF1F88u, 0x6AA09E70u, 0xA8FC6A89u, 0x1593EB71u,
+         0x27276464u, 0x9A48E59Cu, 0x58141165u, 0xE57B909Du, 0xD9418E66u, 0x642E0F9Eu, 0xA672FB67u, 0x1B1D7A9Fu,
+         0xDE06C691u, 0x63694769u, 0xA135B390u, 0x1C5A3268u, 0x20602C93u, 0x9D0FAD6Bu, 0x5F535992u, 0xE23CD86Au,
+         0x3A3A47B8u, 0x8755C640u, 0x450932B9u, 0xF866B341u, 0xC45CADBAu, 0x79332C42u, 0xBB6FD8BBu, 0x06005943u,
+         0xC31BE54Du, 0x7E7464B5u, 0xBC28904Cu, 0x014711B4u, 0x3D7D0F4Fu, 0x80128EB7u, 0x424E7A4Eu, 0xFF21FBB6u,
+         0xCD9574A3u, 0x70FAF55Bu, 0xB2A601A2u, 0x0FC9805Au, 0x33F39EA1u, 0x8E9C1F59u, 0x4CC0EBA0u, 0xF1AF6A58u,
+         0x34B4D656u, 0x89DB57AEu, 0x4B87A357u, 0xF6E822AFu, 0xCAD23C54u, 0x77BDBDACu, 0xB5E14955u, 0x088EC8ADu,
+         0xA4FCD80Fu, 0x199359F7u, 0xDBCFAD0Eu, 0x66A02CF6u, 0x5A9A320Du, 0xE7F5B3F5u, 0x25A9470Cu, 0x98C6C6F4u,
+         0x5DDD7AFAu, 0xE0B2FB02u, 0x22EE0FFBu, 0x9F818E03u, 0xA3BB90F8u, 0x1ED41100u, 0xDC88E5F9u, 0x61E76401u,
+         0x5353EB14u, 0xEE3C6AECu, 0x2C609E15u, 0x910F1FEDu, 0xAD350116u, 0x105A80EEu, 0xD2067417u, 0x6F69F5EFu,
+         0xAA7249E1u, 0x171DC819u, 0xD5413CE0u, 0x682EBD18u, 0x5414A3E3u, 0xE97B221Bu, 0x2B27D6E2u, 0x9648571Au,
+         0x4E4EC8C8u, 0xF3214930u, 0x317DBDC9u, 0x8C123C31u, 0xB02822CAu, 0x0D47A332u, 0xCF1B57CBu, 0x7274D633u,
+         0xB76F6A3Du, 0x0A00EBC5u, 0xC85C1F3Cu, 0x75339EC4u, 0x4909803Fu, 0xF46601C7u, 0x363AF53Eu, 0x8B5574C6u,
+         0xB9E1FBD3u, 0x048E7A2Bu, 0xC6D28ED2u, 0x7BBD0F2Au, 0x478711D1u, 0xFAE89029u, 0x38B464D0u, 0x85DBE528u,
+         0x40C05926u, 0xFDAFD8DEu, 0x3FF32C27u, 0x829CADDFu, 0xBEA6B324u, 0x03C932DCu, 0xC195C625u, 0x7CFA47DDu,
+         0x74748F70u, 0xC91B0E88u, 0x0B47FA71u, 0xB6287B89u, 0x8A126572u, 0x377DE48Au, 0xF5211073u, 0x484E918Bu,
+         0x8D552D85u, 0x303AAC7Du, 0xF2665884u, 0x4F09D97Cu, 0x7333C787u, 0xCE5C467Fu, 0x0C00B286u, 0xB16F337Eu,
+         0x83DBBC6Bu, 0x3EB43D93u, 0xFCE8C96Au, 0x41874892u, 0x7DBD5669u, 0xC0D2D791u, 0x028E2368u, 0xBFE1A290u,
+         0x7AFA1E9Eu, 0xC7959F66u, 0x05C96B9Fu, 0xB8A6EA67u, 0x849CF49Cu, 0x39F37564u, 0xFBAF819Du, 0x46C00065u,
+         0x9EC69FB7u, 0x23A91E4Fu, 0xE1F5EAB6u, 0x5C9A6B4Eu, 0x60A075B5u, 0xDDCFF44Du, 0x1F9300B4u, 0xA2FC814Cu,
+         0x67E73D42u, 0xDA88BCBAu, 0x18D44843u, 0xA5BBC9BBu, 0x9981D740u, 0x24EE56B8u, 0xE6B2A241u, 0x5BDD23B9u,
+         0x6969ACACu, 0xD4062D54u, 0x165AD9ADu, 0xAB355855u, 0x970F46AEu, 0x2A60C756u, 0xE83C33AFu, 0x5553B257u,
+         0x90480E59u, 0x2D278FA1u, 0xEF7B7B58u, 0x5214FAA0u, 0x6E2EE45Bu, 0xD34165A3u, 0x111D915Au, 0xAC7210A2u
+      },
+      {
+         0x00000000u, 0x4C15C6EFu, 0x982B8DDEu, 0xD43E4B31u, 0x35BB6D4Du, 0x79AEABA2u, 0xAD90E093u, 0xE185267Cu,
+         0x6B76DA9Au, 0x27631C75u, 0xF35D5744u, 0xBF4891ABu, 0x5ECDB7D7u, 0x12D87138u, 0xC6E63A09u, 0x8AF3FCE6u,
+         0xD6EDB534u, 0x9AF873DBu, 0x4EC638EAu, 0x02D3FE05u, 0xE356D879u, 0xAF431E96u, 0x7B7D55A7u, 0x37689348u,
+         0xBD9B6FAEu, 0xF18EA941u, 0x25B0E270u, 0x69A5249Fu, 0x882002E3u, 0xC435C40Cu, 0x100B8F3Du, 0x5C1E49D2u,
+         0xA8371C99u, 0xE422DA76u, 0x301C9147u, 0x7C0957A8u, 0x9D8C71D4u, 0xD199B73Bu, 0x05A7FC0Au, 0x49B23AE5u,
+         0xC341C603u, 0x8F5400ECu, 0x5B6A4BDDu, 0x177F8D32u, 0xF6FAAB4Eu, 0xBAEF6DA1u, 0x6ED12690u, 0x22C4E07Fu,
+         0x7EDAA9ADu, 0x32CF6F42u, 0xE6F12473u, 0xAAE4E29Cu, 0x4B61C4E0u, 0x0774020Fu, 0xD34A493Eu, 0x9F5F8FD1u,
+         0x15AC7337u, 0x59B9B5D8u, 0x8D87FEE9u, 0xC1923806u, 0x20171E7Au, 0x6C02D895u, 0xB83C93A4u, 0xF429554Bu,
+         0x55824FC3u, 0x1997892Cu, 0xCDA9C21Du, 0x81BC04F2u, 0x6039228Eu, 0x2C2CE461u, 0xF812AF50u, 0xB40769BFu,
+         0x3EF49559u, 0x72E153B6u, 0xA6DF1887u, 0xEACADE68u, 0x0B4FF814u, 0x475A3EFBu, 0x936475CAu, 0xDF71B325u,
+         0x836FFAF7u, 0xCF7A3C18u, 0x1B447729u, 0x5751B1C6u, 0xB6D497BAu, 0xFAC15155u, 0x2EFF1A64u, 0x62EADC8Bu,
+         0xE819206Du, 0xA40CE682u, 0x7032ADB3u, 0x3C276B5Cu, 0xDDA24D20u, 0x91B78BCFu, 0x4589C0FEu, 0x099C0611u,
+         0xFDB5535Au, 0xB1A095B5u, 0x659EDE84u, 0x298B186Bu, 0xC80E3E17u, 0x841BF8F8u, 0x5025B3C9u, 0x1C307526u,
+         0x96C389C0u, 0xDAD64F2Fu, 0x0EE8041Eu, 0x42FDC2F1u, 0xA378E48Du, 0xEF6D2262u, 0x3B536953u, 0x7746AFBCu,
+         0x2B58E66Eu, 0x674D2081u, 0xB3736BB0u, 0xFF66AD5Fu, 0x1EE38B23u, 0x52F64DCCu, 0x86C806FDu, 0xCADDC012u,
+         0x402E3CF4u, 0x0C3BFA1Bu, 0xD805B12Au, 0x941077C5u, 0x759551B9u, 0x39809756u, 0xEDBEDC67u, 0xA1AB1A88u,
+         0xAB049F86u, 0xE7115969u, 0x332F1258u, 0x7F3AD4B7u, 0x9EBFF2CBu, 0xD2AA3424u, 0x06947F15u, 0x4A81B9FAu,
+         0xC072451Cu, 0x8C6783F3u, 0x5859C8C2u, 0x144C0E2Du, 0xF5C92851u, 0xB9DCEEBEu, 0x6DE2A58Fu, 0x21F76360u,
+         0x7DE92AB2u, 0x31FCEC5Du, 0xE5C2A76Cu, 0xA9D76183u, 0x485247FFu, 0x04478110u, 0xD079CA21u, 0x9C6C0CCEu,
+         0x169FF028u, 0x5A8A36C7u, 0x8EB47DF6u, 0xC2A1BB19u, 0x23249D65u, 0x6F315B8Au, 0xBB0F10BBu, 0xF71AD654u,
+         0x0333831Fu, 0x4F2645F0u, 0x9B180EC1u, 0xD70DC82Eu, 0x3688EE52u, 0x7A9D28BDu, 0xAEA3638Cu, 0xE2B6A563u,
+         0x68455985u, 0x24509F6Au, 0xF06ED45Bu, 0xBC7B12B4u, 0x5DFE34C8u, 0x11EBF227u, 0xC5D5B916u, 0x89C07FF9u,
+         0xD5DE362Bu, 0x99CBF0C4u, 0x4DF5BBF5u, 0x01E07D1Au, 0xE0655B66u, 0xAC709D89u, 0x784ED6B8u, 0x345B1057u,
+         0xBEA8ECB1u, 0xF2BD2A5Eu, 0x2683616Fu, 0x6A96A780u, 0x8B1381FCu, 0xC7064713u, 0x13380C22u, 0x5F2DCACDu,
+         0xFE86D045u, 0xB29316AAu, 0x66AD5D9Bu, 0x2AB89B74u, 0xCB3DBD08u, 0x87287BE7u, 0x531630D6u, 0x1F03F639u,
+         0x95F00ADFu, 0xD9E5CC30u, 0x0DDB8701u, 0x41CE41EEu, 0xA04B6792u, 0xEC5EA17Du, 0x3860EA4Cu, 0x74752CA3u,
+         0x286B6571u, 0x647EA39Eu, 0xB040E8AFu, 0xFC552E40u, 0x1DD0083Cu, 0x51C5CED3u, 0x85FB85E2u, 0xC9EE430Du,
+         0x431DBFEBu, 0x0F087904u, 0xDB363235u, 0x9723F4DAu, 0x76A6D2A6u, 0x3AB31449u, 0xEE8D5F78u, 0xA2989997u,
+         0x56B1CCDCu, 0x1AA40A33u, 0xCE9A4102u, 0x828F87EDu, 0x630AA191u, 0x2F1F677Eu, 0xFB212C4Fu, 0xB734EAA0u,
+         0x3DC71646u, 0x71D2D0A9u, 0xA5EC9B98u, 0xE9F95D77u, 0x087C7B0Bu, 0x4469BDE4u, 0x9057F6D5u, 0xDC42303Au,
+         0x805C79E8u, 0xCC49BF07u, 0x1877F436u, 0x546232D9u, 0xB5E714A5u, 0xF9F2D24Au, 0x2DCC997Bu, 0x61D95F94u,
+         0xEB2AA372u, 0xA73F659Du, 0x73012EACu, 0x3F14E843u, 0xDE91CE3Fu, 0x928408D0u, 0x46BA43E1u, 0x0AAF850Eu
+      },
+      {
+         0x00000000u, 0x53E549FDu, 0xA7CA93FAu, 0xF42FDA07u, 0x4A795105u, 0x199C18F8u, 0xEDB3C2FFu, 0xBE568B02u,
+         0x94F2A20Au, 0xC717EBF7u, 0x333831F0u, 0x60DD780Du, 0xDE8BF30Fu, 0x8D6EBAF2u, 0x794160F5u, 0x2AA42908u,
+         0x2C0932E5u, 0x7FEC7B18u, 0x8BC3A11Fu, 0xD826E8E2u, 0x667063E0u, 0x35952A1Du, 0xC1BAF01Au, 0x925FB9E7u,
+         0xB8FB90EFu, 0xEB1ED912u, 0x1F310315u, 0x4CD44AE8u, 0xF282C1EAu, 0xA1678817u, 0x55485210u, 0x06AD1BEDu,
+         0x581265CAu, 0x0BF72C37u, 0xFFD8F630u, 0xAC3DBFCDu, 0x126B34CFu, 0x418E7D32u, 0xB5A1A735u, 0xE644EEC8u,
+         0xCCE0C7C0u, 0x9F058E3Du, 0x6B2A543Au, 0x38CF1DC7u, 0x869996C5u, 0xD57CDF38u, 0x2153053Fu, 0x72B64CC2u,
+         0x741B572Fu, 0x27FE1ED2u, 0xD3D1C4D5u, 0x80348D28u, 0x3E62062Au, 0x6D874FD7u, 0x99A895D0u, 0xCA4DDC2Du,
+         0xE0E9F525u, 0xB30CBCD8u, 0x472366DFu, 0x14C62F22u, 0xAA90A420u, 0xF975EDDDu, 0x0D5A37DAu, 0x5EBF7E27u,
+         0xB024CB94u, 0xE3C18269u, 0x17EE586Eu, 0x440B1193u, 0xFA5D9A91u, 0xA9B8D36Cu, 0x5D97096Bu, 0x0E724096u,
+         0x24D6699Eu, 0x77332063u, 0x831CFA64u, 0xD0F9B399u, 0x6EAF389Bu, 0x3D4A7166u, 0xC965AB61u, 0x9A80E29Cu,
+         0x9C2DF971u, 0xCFC8B08Cu, 0x3BE76A8Bu, 0x68022376u, 0xD654A874u, 0x85B1E189u, 0x719E3B8Eu, 0x227B7273u,
+         0x08DF5B7Bu, 0x5B3A1286u, 0xAF15C881u, 0xFCF0817Cu, 0x42A60A7Eu, 0x11434383u, 0xE56C9984u, 0xB689D079u,
+         0xE836AE5Eu, 0xBBD3E7A3u, 0x4FFC3DA4u, 0x1C197459u, 0xA24FFF5Bu, 0xF1AAB6A6u, 0x05856CA1u, 0x5660255Cu,
+         0x7CC40C54u, 0x2F2145A9u, 0xDB0E9FAEu, 0x88EBD653u, 0x36BD5D51u, 0x655814ACu, 0x9177CEABu, 0xC2928756u,
+         0xC43F9CBBu, 0x97DAD546u, 0x63F50F41u, 0x301046BCu, 0x8E46CDBEu, 0xDDA38443u, 0x298C5E44u, 0x7A6917B9u,
+         0x50CD3EB1u, 0x0328774Cu, 0xF707AD4Bu, 0xA4E2E4B6u, 0x1AB46FB4u, 0x49512649u, 0xBD7EFC4Eu, 0xEE9BB5B3u,
+         0x65A5E1D9u, 0x3640A824u, 0xC26F7223u, 0x918A3BDEu, 0x2FDCB0DCu, 0x7C39F921u, 0x88162326u, 0xDBF36ADBu,
+         0xF15743D3u, 0xA2B20A2Eu, 0x569DD029u, 0x057899D4u, 0xBB2E12D6u, 0xE8CB5B2Bu, 0x1CE4812Cu, 0x4F01C8D1u,
+         0x49ACD33Cu, 0x1A499AC1u, 0xEE6640C6u, 0xBD83093Bu, 0x03D58239u, 0x5030CBC4u, 0xA41F11C3u, 0xF7FA583Eu,
+         0xDD5E7136u, 0x8EBB38CBu, 0x7A94E2CCu, 0x2971AB31u, 0x97272033u, 0xC4C269CEu, 0x30EDB3C9u, 0x6308FA34u,
+         0x3DB78413u, 0x6E52CDEEu, 0x9A7D17E9u, 0xC9985E14u, 0x77CED516u, 0x242B9CEBu, 0xD00446ECu, 0x83E10F11u,
+         0xA9452619u, 0xFAA06FE4u, 0x0E8FB5E3u, 0x5D6AFC1Eu, 0xE33C771Cu, 0xB0D93EE1u, 0x44F6E4E6u, 0x1713AD1Bu,
+         0x11BEB6F6u, 0x425BFF0Bu, 0xB674250Cu, 0xE5916CF1u, 0x5BC7E7F3u, 0x0822AE0Eu, 0xFC0D7409u, 0xAFE83DF4u,
+         0x854C14FCu, 0xD6A95D01u, 0x22868706u, 0x7163CEFBu, 0xCF3545F9u, 0x9CD00C04u, 0x68FFD603u, 0x3B1A9FFEu,
+         0xD5812A4Du, 0x866463B0u, 0x724BB9B7u, 0x21AEF04Au, 0x9FF87B48u, 0xCC1D32B5u, 0x3832E8B2u, 0x6BD7A14Fu,
+         0x41738847u, 0x1296C1BAu, 0xE6B91BBDu, 0xB55C5240u, 0x0B0AD942u, 0x58EF90BFu, 0xACC04AB8u, 0xFF250345u,
+         0xF98818A8u, 0xAA6D5155u, 0x5E428B52u, 0x0DA7C2AFu, 0xB3F149ADu, 0xE0140050u, 0x143BDA57u, 0x47DE93AAu,
+         0x6D7ABAA2u, 0x3E9FF35Fu, 0xCAB02958u, 0x995560A5u, 0x2703EBA7u, 0x74E6A25Au, 0x80C9785Du, 0xD32C31A0u,
+         0x8D934F87u, 0xDE76067Au, 0x2A59DC7Du, 0x79BC9580u, 0xC7EA1E82u, 0x940F577Fu, 0x60208D78u, 0x33C5C485u,
+         0x1961ED8Du, 0x4A84A470u, 0xBEAB7E77u, 0xED4E378Au, 0x5318BC88u, 0x00FDF575u, 0xF4D22F72u, 0xA737668Fu,
+         0xA19A7D62u, 0xF27F349Fu, 0x0650EE98u, 0x55B5A765u, 0xEBE32C67u, 0xB806659Au, 0x4C29BF9Du, 0x1FCCF660u,
+         0x3568DF68u, 0x668D9695u, 0x92A24C92u, 0xC147056Fu, 0x7F118E6Du, 0x2CF4C790u, 0xD8DB1D97u, 0x8B3E546Au
+      },
+      {
+         0x00000000u, 0xCB4BC3B2u, 0x937BF195u, 0x58303227u, 0x231B95DBu, 0xE8505669u, 0xB060644Eu, 0x7B2BA7FCu,
+         0x46372BB6u, 0x8D7CE804u, 0xD54CDA23u, 0x1E071991u, 0x652CBE6Du, 0xAE677DDFu, 0xF6574FF8u, 0x3D1C8C4Au,
+         0x8C6E576Cu, 0x472594DEu, 0x1F15A6F9u, 0xD45E654Bu, 0xAF75C2B7u, 0x643E0105u, 0x3C0E3322u, 0xF745F090u,
+         0xCA597CDAu, 0x0112BF68u, 0x59228D4Fu, 0x92694EFDu, 0xE942E901u, 0x22092AB3u, 0x7A391894u, 0xB172DB26u,
+         0x1D30D829u, 0xD67B1B9Bu, 0x8E4B29BCu, 0x4500EA0Eu, 0x3E2B4DF2u, 0xF5608E40u, 0xAD50BC67u, 0x661B7FD5u,
+         0x5B07F39Fu, 0x904C302Du, 0xC87C020Au, 0x0337C1B8u, 0x781C6644u, 0xB357A5F6u, 0xEB6797D1u, 0x202C5463u,
+         0x915E8F45u, 0x5A154CF7u, 0x02257ED0u, 0xC96EBD62u, 0xB2451A9Eu, 0x790ED92Cu, 0x213EEB0Bu, 0xEA7528B9u,
+         0xD769A4F3u, 0x1C226741u, 0x44125566u, 0x8F5996D4u, 0xF4723128u, 0x3F39F29Au, 0x6709C0BDu, 0xAC42030Fu,
+         0x3A61B052u, 0xF12A73E0u, 0xA91A41C7u, 0x62518275u, 0x197A2589u, 0xD231E63Bu, 0x8A01D41Cu, 0x414A17AEu,
+         0x7C569BE4u, 0xB71D5856u, 0xEF2D6A71u, 0x2466A9C3u, 0x5F4D0E3Fu, 0x9406CD8Du, 0xCC36FFAAu, 0x077D3C18u,
+         0xB60FE73Eu, 0x7D44248Cu, 0x257416ABu, 0xEE3FD519u, 0x951472E5u, 0x5E5FB157u, 0x066F8370u, 0xCD2440C2u,
+         0xF038CC88u, 0x3B730F3Au, 0x63433D1Du, 0xA808FEAFu, 0xD3235953u, 0x18689AE1u, 0x4058A8C6u, 0x8B136B74u,
+         0x2751687Bu, 0xEC1AABC9u, 0xB42A99EEu, 0x7F615A5Cu, 0x044AFDA0u, 0xCF013E12u, 0x97310C35u, 0x5C7ACF87u,
+         0x616643CDu, 0xAA2D807Fu, 0xF21DB258u, 0x395671EAu, 0x427DD616u, 0x893615A4u, 0xD1062783u, 0x1A4DE431u,
+         0xAB3F3F17u, 0x6074FCA5u, 0x3844CE82u, 0xF30F0D30u, 0x8824AACCu, 0x436F697Eu, 0x1B5F5B59u, 0xD01498EBu,
+         0xED0814A1u, 0x2643D713u, 0x7E73E534u, 0xB5382686u, 0xCE13817Au, 0x055842C8u, 0x5D6870EFu, 0x9623B35Du,
+         0x74C360A4u, 0xBF88A316u, 0xE7B89131u, 0x2CF35283u, 0x57D8F57Fu, 0x9C9336CDu, 0xC4A304EAu, 0x0FE8C758u,
+         0x32F44B12u, 0xF9BF88A0u, 0xA18FBA87u, 0x6AC47935u, 0x11EFDEC9u, 0xDAA41D7Bu, 0x82942F5Cu, 0x49DFECEEu,
+         0xF8AD37C8u, 0x33E6F47Au, 0x6BD6C65Du, 0xA09D05EFu, 0xDBB6A213u, 0x10FD61A1u, 0x48CD5386u, 0x83869034u,
+         0xBE9A1C7Eu, 0x75D1DFCCu, 0x2DE1EDEBu, 0xE6AA2E59u, 0x9D8189A5u, 0x56CA4A17u, 0x0EFA7830u, 0xC5B1BB82u,
+         0x69F3B88Du, 0xA2B87B3Fu, 0xFA884918u, 0x31C38AAAu, 0x4AE82D56u, 0x81A3EEE4u, 0xD993DCC3u, 0x12D81F71u,
+         0x2FC4933Bu, 0xE48F5089u, 0xBCBF62AEu, 0x77F4A11Cu, 0x0CDF06E0u, 0xC794C552u, 0x9FA4F775u, 0x54EF34C7u,
+         0xE59DEFE1u, 0x2ED62C53u, 0x76E61E74u, 0xBDADDDC6u, 0xC6867A3Au, 0x0DCDB988u, 0x55FD8BAFu, 0x9EB6481Du,
+         0xA3AAC457u, 0x68E107E5u, 0x30D135C2u, 0xFB9AF670u, 0x80B1518Cu, 0x4BFA923Eu, 0x13CAA019u, 0xD88163ABu,
+         0x4EA2D0F6u, 0x85E91344u, 0xDDD92163u, 0x1692E2D1u, 0x6DB9452Du, 0xA6F2869Fu, 0xFEC2B4B8u, 0x3589770Au,
+         0x0895FB40u, 0xC3DE38F2u, 0x9BEE0AD5u, 0x50A5C967u, 0x2B8E6E9Bu, 0xE0C5AD29u, 0xB8F59F0Eu, 0x73BE5CBCu,
+         0xC2CC879Au, 0x09874428u, 0x51B7760Fu, 0x9AFCB5BDu, 0xE1D71241u, 0x2A9CD1F3u, 0x72ACE3D4u, 0xB9E72066u,
+         0x84FBAC2Cu, 0x4FB06F9Eu, 0x17805DB9u, 0xDCCB9E0Bu, 0xA7E039F7u, 0x6CABFA45u, 0x349BC862u, 0xFFD00BD0u,
+         0x539208DFu, 0x98D9CB6Du, 0xC0E9F94Au, 0x0BA23AF8u, 0x70899D04u, 0xBBC25EB6u, 0xE3F26C91u, 0x28B9AF23u,
+         0x15A52369u, 0xDEEEE0DBu, 0x86DED2FCu, 0x4D95114Eu, 0x36BEB6B2u, 0xFDF57500u, 0xA5C54727u, 0x6E8E8495u,
+         0xDFFC5FB3u, 0x14B79C01u, 0x4C87AE26u, 0x87CC6D94u, 0xFCE7CA68u, 0x37AC09DAu, 0x6F9C3BFDu, 0xA4D7F84Fu,
+         0x99CB7405u, 0x5280B7B7u, 0x0AB08590u, 0xC1FB4622u, 0xBAD0E1DEu, 0x719B226Cu, 0x29AB104Bu, 0xE2E0D3F9u
+      }
+   }
+};
+#endif
+//byte-wise tables in the order of crc16_variant_t (reflected variants use the reflected polynomial)
+static const uint16_t m_crc16_table[CRC16_NUM_VARIANTS][256] =
+{
+   {
+      0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+      0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+      0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+      0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+      0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,
+      0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+      0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,
+      0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+      0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+      0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+      0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,
+      0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+      0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,
+      0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+      0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+      0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+      0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,
+      0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+      0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,
+      0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+      0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+      0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+      0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,
+      0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+      0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,
+      0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+      0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+      0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+      0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,
+      0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+      0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,
+      0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u
+   },
+   {
+      0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+      0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+      0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+      0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+      0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,
+      0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+      0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,
+      0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+      0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+      0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+      0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,
+      0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+      0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,
+      0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+      0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+      0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+      0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,
+      0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+      0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,
+      0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+      0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+      0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+      0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,
+      0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+      0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,
+      0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+      0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+      0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+      0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,
+      0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+      0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,
+      0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u
+   },
+   {
+      0x0000u, 0x1189u, 0x2312u, 0x329Bu, 0x4624u, 0x57ADu, 0x6536u, 0x74BFu,
+      0x8C48u, 0x9DC1u, 0xAF5Au, 0xBED3u, 0xCA6Cu, 0xDBE5u, 0xE97Eu, 0xF8F7u,
+      0x1081u, 0x0108u, 0x3393u, 0x221Au, 0x56A5u, 0x472Cu, 0x75B7u, 0x643Eu,
+      0x9CC9u, 0x8D40u, 0xBFDBu, 0xAE52u, 0xDAEDu, 0xCB64u, 0xF9FFu, 0xE876u,
+      0x2102u, 0x308Bu, 0x0210u, 0x1399u, 0x6726u, 0x76AFu, 0x4434u, 0x55BDu,
+      0xAD4Au, 0xBCC3u, 0x8E58u, 0x9FD1u, 0xEB6Eu, 0xFAE7u, 0xC87Cu, 0xD9F5u,
+      0x3183u, 0x200Au, 0x1291u, 0x0318u, 0x77A7u, 0x662Eu, 0x54B5u, 0x453Cu,
+      0xBDCBu, 0xAC42u, 0x9ED9u, 0x8F50u, 0xFBEFu, 0xEA66u, 0xD8FDu, 0xC974u,
+      0x4204u, 0x538Du, 0x6116u, 0x709Fu, 0x0420u, 0x15A9u, 0x2732u, 0x36BBu,
+      0xCE4Cu, 0xDFC5u, 0xED5Eu, 0xFCD7u, 0x8868u, 0x99E1u, 0xAB7Au, 0xBAF3u,
+      0x5285u, 0x430Cu, 0x7197u, 0x601Eu, 0x14A1u, 0x0528u, 0x37B3u, 0x263Au,
+      0xDECDu, 0xCF44u, 0xFDDFu, 0xEC56u, 0x98E9u, 0x8960u, 0xBBFBu, 0xAA72u,
+      0x6306u, 0x728Fu, 0x4014u, 0x519Du, 0x2522u, 0x34ABu, 0x0630u, 0x17B9u,
+      0xEF4Eu, 0xFEC7u, 0xCC5Cu, 0xDDD5u, 0xA96Au, 0xB8E3u, 0x8A78u, 0x9BF1u,
+      0x7387u, 0x620Eu, 0x5095u, 0x411Cu, 0x35A3u, 0x242Au, 0x16B1u, 0x0738u,
+      0xFFCFu, 0xEE46u, 0xDCDDu, 0xCD54u, 0xB9EBu, 0xA862u, 0x9AF9u, 0x8B70u,
+      0x8408u, 0x9581u, 0xA71Au, 0xB693u, 0xC22Cu, 0xD3A5u, 0xE13Eu, 0xF0B7u,
+      0x0840u, 0x19C9u, 0x2B52u, 0x3ADBu, 0x4E64u, 0x5FEDu, 0x6D76u, 0x7CFFu,
+      0x9489u, 0x8500u, 0xB79Bu, 0xA612u, 0xD2ADu, 0xC324u, 0xF1BFu, 0xE036u,
+      0x18C1u, 0x0948u, 0x3BD3u, 0x2A5Au, 0x5EE5u, 0x4F6Cu, 0x7DF7u, 0x6C7Eu,
+      0xA50Au, 0xB483u, 0x8618u, 0x9791u, 0xE32Eu, 0xF2A7u, 0xC03Cu, 0xD1B5u,
+      0x2942u, 0x38CBu, 0x0A50u, 0x1BD9u, 0x6F66u, 0x7EEFu, 0x4C74u, 0x5DFDu,
+      0xB58Bu, 0xA402u, 0x9699u, 0x8710u, 0xF3AFu, 0xE226u, 0xD0BDu, 0xC134u,
+      0x39C3u, 0x284Au, 0x1AD1u, 0x0B58u, 0x7FE7u, 0x6E6Eu, 0x5CF5u, 0x4D7Cu,
+      0xC60Cu, 0xD785u, 0xE51Eu, 0xF497u, 0x8028u, 0x91A1u, 0xA33Au, 0xB2B3u,
+      0x4A44u, 0x5BCDu, 0x6956u, 0x78DFu, 0x0C60u, 0x1DE9u, 0x2F72u, 0x3EFBu,
+      0xD68Du, 0xC704u, 0xF59Fu, 0xE416u, 0x90A9u, 0x8120u, 0xB3BBu, 0xA232u,
+      0x5AC5u, 0x4B4Cu, 0x79D7u, 0x685Eu, 0x1CE1u, 0x0D68u, 0x3FF3u, 0x2E7Au,
+      0xE70Eu, 0xF687u, 0xC41Cu, 0xD595u, 0xA12Au, 0xB0A3u, 0x8238u, 0x93B1u,
+      0x6B46u, 0x7ACFu, 0x4854u, 0x59DDu, 0x2D62u, 0x3CEBu, 0x0E70u, 0x1FF9u,
+      0xF78Fu, 0xE606u, 0xD49Du, 0xC514u, 0xB1ABu, 0xA022u, 0x92B9u, 0x8330u,
+      0x7BC7u, 0x6A4Eu, 0x58D5u, 0x495Cu, 0x3DE3u, 0x2C6Au, 0x1EF1u, 0x0F78u
+   },
+   {
+      0x0000u, 0x1189u, 0x2312u, 0x329Bu, 0x4624u, 0x57ADu, 0x6536u, 0x74BFu,
+      0x8C48u, 0x9DC1u, 0xAF5Au, 0xBED3u, 0xCA6Cu, 0xDBE5u, 0xE97Eu, 0xF8F7u,
+      0x1081u, 0x0108u, 0x3393u, 0x221Au, 0x56A5u, 0x472Cu, 0x75B7u, 0x643Eu,
+      0x9CC9u, 0x8D40u, 0xBFDBu, 0xAE52u, 0xDAEDu, 0xCB64u, 0xF9FFu, 0xE876u,
+      0x2102u, 0x308Bu, 0x0210u, 0x1399u, 0x6726u, 0x76AFu, 0x4434u, 0x55BDu,
+      0xAD4Au, 0xBCC3u, 0x8E58u, 0x9FD1u, 0xEB6Eu, 0xFAE7u, 0xC87Cu, 0xD9F5u,
+      0x3183u, 0x200Au, 0x1291u, 0x0318u, 0x77A7u, 0x662Eu, 0x54B5u, 0x453Cu,
+      0xBDCBu, 0xAC42u, 0x9ED9u, 0x8F50u, 0xFBEFu, 0xEA66u, 0xD8FDu, 0xC974u,
+      0x4204u, 0x538Du, 0x6116u, 0x709Fu, 0x0420u, 0x15A9u, 0x2732u, 0x36BBu,
+      0xCE4Cu, 0xDFC5u, 0xED5Eu, 0xFCD7u, 0x8868u, 0x99E1u, 0xAB7Au, 0xBAF3u,
+      0x5285u, 0x430Cu, 0x7197u, 0x601Eu, 0x14A1u, 0x0528u, 0x37B3u, 0x263Au,
+      0xDECDu, 0xCF44u, 0xFDDFu, 0xEC56u, 0x98E9u, 0x8960u, 0xBBFBu, 0xAA72u,
+      0x6306u, 0x728Fu, 0x4014u, 0x519Du, 0x2522u, 0x34ABu, 0x0630u, 0x17B9u,
+      0xEF4Eu, 0xFEC7u, 0xCC5Cu, 0xDDD5u, 0xA96Au, 0xB8E3u, 0x8A78u, 0x9BF1u,
+      0x7387u, 0x620Eu, 0x5095u, 0x411Cu, 0x35A3u, 0x242Au, 0x16B1u, 0x0738u,
+      0xFFCFu, 0xEE46u, 0xDCDDu, 0xCD54u, 0xB9EBu, 0xA862u, 0x9AF9u, 0x8B70u,
+      0x8408u, 0x9581u, 0xA71Au, 0xB693u, 0xC22Cu, 0xD3A5u, 0xE13Eu, 0xF0B7u,
+      0x0840u, 0x19C9u, 0x2B52u, 0x3ADBu, 0x4E64u, 0x5FEDu, 0x6D76u, 0x7CFFu,
+      0x9489u, 0x8500u, 0xB79Bu, 0xA612u, 0xD2ADu, 0xC324u, 0xF1BFu, 0xE036u,
+      0x18C1u, 0x0948u, 0x3BD3u, 0x2A5Au, 0x5EE5u, 0x4F6Cu, 0x7DF7u, 0x6C7Eu,
+      0xA50Au, 0xB483u, 0x8618u, 0x9791u, 0xE32Eu, 0xF2A7u, 0xC03Cu, 0xD1B5u,
+      0x2942u, 0x38CBu, 0x0A50u, 0x1BD9u, 0x6F66u, 0x7EEFu, 0x4C74u, 0x5DFDu,
+      0xB58Bu, 0xA402u, 0x9699u, 0x8710u, 0xF3AFu, 0xE226u, 0xD0BDu, 0xC134u,
+      0x39C3u, 0x284Au, 0x1AD1u, 0x0B58u, 0x7FE7u, 0x6E6Eu, 0x5CF5u, 0x4D7Cu,
+      0xC60Cu, 0xD785u, 0xE51Eu, 0xF497u, 0x8028u, 0x91A1u, 0xA33Au, 0xB2B3u,
+      0x4A44u, 0x5BCDu, 0x6956u, 0x78DFu, 0x0C60u, 0x1DE9u, 0x2F72u, 0x3EFBu,
+      0xD68Du, 0xC704u, 0xF59Fu, 0xE416u, 0x90A9u, 0x8120u, 0xB3BBu, 0xA232u,
+      0x5AC5u, 0x4B4Cu, 0x79D7u, 0x685Eu, 0x1CE1u, 0x0D68u, 0x3FF3u, 0x2E7Au,
+      0xE70Eu, 0xF687u, 0xC41Cu, 0xD595u, 0xA12Au, 0xB0A3u, 0x8238u, 0x93B1u,
+      0x6B46u, 0x7ACFu, 0x4854u, 0x59DDu, 0x2D62u, 0x3CEBu, 0x0E70u, 0x1FF9u,
+      0xF78Fu, 0xE606u, 0xD49Du, 0xC514u, 0xB1ABu, 0xA022u, 0x92B9u, 0x8330u,
+      0x7BC7u, 0x6A4Eu, 0x58D5u, 0x495Cu, 0x3DE3u, 0x2C6Au, 0x1EF1u, 0x0F78u
+   },
+   {
+      0x0000u, 0xC0C1u, 0xC181u, 0x0140u, 0xC301u, 0x03C0u, 0x0280u, 0xC241u,
+      0xC601u, 0x06C0u, 0x0780u, 0xC741u, 0x0500u, 0xC5C1u, 0xC481u, 0x0440u,
+      0xCC01u, 0x0CC0u, 0x0D80u, 0xCD41u, 0x0F00u, 0xCFC1u, 0xCE81u, 0x0E40u,
+      0x0A00u, 0xCAC1u, 0xCB81u, 0x0B40u, 0xC901u, 0x09C0u, 0x0880u, 0xC841u,
+      0xD801u, 0x18C0u, 0x1980u, 0xD941u, 0x1B00u, 0xDBC1u, 0xDA81u, 0x1A40u,
+      0x1E00u, 0xDEC1u, 0xDF81u, 0x1F40u, 0xDD01u, 0x1DC0u, 0x1C80u, 0xDC41u,
+      0x1400u, 0xD4C1u, 0xD581u, 0x1540u, 0xD701u, 0x17C0u, 0x1680u, 0xD641u,
+      0xD201u, 0x12C0u, 0x1380u, 0xD341u, 0x1100u, 0xD1C1u, 0xD081u, 0x1040u,
+      0xF001u, 0x30C0u, 0x3180u, 0xF141u, 0x3300u, 0xF3C1u, 0xF281u, 0x3240u,
+      0x3600u, 0xF6C1u, 0xF781u, 0x3740u, 0xF501u, 0x35C0u, 0x3480u, 0xF441u,
+      0x3C00u, 0xFCC1u, 0xFD81u, 0x3D40u, 0xFF01u, 0x3FC0u, 0x3E80u, 0xFE41u,
+      0xFA01u, 0x3AC0u, 0x3B80u, 0xFB41u, 0x3900u, 0xF9C1u, 0xF881u, 0x3840u,
+      0x2800u, 0xE8C1u, 0xE981u, 0x2940u, 0xEB01u, 0x2BC0u, 0x2A80u, 0xEA41u,
+      0xEE01u, 0x2EC0u, 0x2F80u, 0xEF41u, 0x2D00u, 0xEDC1u, 0xEC81u, 0x2C40u,
+      0xE401u, 0x24C0u, 0x2580u, 0xE541u, 0x2700u, 0xE7C1u, 0xE681u, 0x2640u,
+      0x2200u, 0xE2C1u, 0xE381u, 0x2340u, 0xE101u, 0x21C0u, 0x2080u, 0xE041u,
+      0xA001u, 0x60C0u, 0x6180u, 0xA141u, 0x6300u, 0xA3C1u, 0xA281u, 0x6240u,
+      0x6600u, 0xA6C1u, 0xA781u, 0x6740u, 0xA501u, 0x65C0u, 0x6480u, 0xA441u,
+      0x6C00u, 0xACC1u, 0xAD81u, 0x6D40u, 0xAF01u, 0x6FC0u, 0x6E80u, 0xAE41u,
+      0xAA01u, 0x6AC0u, 0x6B80u, 0xAB41u, 0x6900u, 0xA9C1u, 0xA881u, 0x6840u,
+      0x7800u, 0xB8C1u, 0xB981u, 0x7940u, 0xBB01u, 0x7BC0u, 0x7A80u, 0xBA41u,
+      0xBE01u, 0x7EC0u, 0x7F80u, 0xBF41u, 0x7D00u, 0xBDC1u, 0xBC81u, 0x7C40u,
+      0xB401u, 0x74C0u, 0x7580u, 0xB541u, 0x7700u, 0xB7C1u, 0xB681u, 0x7640u,
+      0x7200u, 0xB2C1u, 0xB381u, 0x7340u, 0xB101u, 0x71C0u, 0x7080u, 0xB041u,
+      0x5000u, 0x90C1u, 0x9181u, 0x5140u, 0x9301u, 0x53C0u, 0x5280u, 0x9241u,
+      0x9601u, 0x56C0u, 0x5780u, 0x9741u, 0x5500u, 0x95C1u, 0x9481u, 0x5440u,
+      0x9C01u, 0x5CC0u, 0x5D80u, 0x9D41u, 0x5F00u, 0x9FC1u, 0x9E81u, 0x5E40u,
+      0x5A00u, 0x9AC1u, 0x9B81u, 0x5B40u, 0x9901u, 0x59C0u, 0x5880u, 0x9841u,
+      0x8801u, 0x48C0u, 0x4980u, 0x8941u, 0x4B00u, 0x8BC1u, 0x8A81u, 0x4A40u,
+      0x4E00u, 0x8EC1u, 0x8F81u, 0x4F40u, 0x8D01u, 0x4DC0u, 0x4C80u, 0x8C41u,
+      0x4400u, 0x84C1u, 0x8581u, 0x4540u, 0x8701u, 0x47C0u, 0x4680u, 0x8641u,
+      0x8201u, 0x42C0u, 0x4380u, 0x8341u, 0x4100u, 0x81C1u, 0x8081u, 0x4040u
+   },
+   {
+      0x0000u, 0xC0C1u, 0xC181u, 0x0140u, 0xC301u, 0x03C0u, 0x0280u, 0xC241u,
+      0xC601u, 0x06C0u, 0x0780u, 0xC741u, 0x0500u, 0xC5C1u, 0xC481u, 0x0440u,
+      0xCC01u, 0x0CC0u, 0x0D80u, 0xCD41u, 0x0F00u, 0xCFC1u, 0xCE81u, 0x0E40u,
+      0x0A00u, 0xCAC1u, 0xCB81u, 0x0B40u, 0xC901u, 0x09C0u, 0x0880u, 0xC841u,
+      0xD801u, 0x18C0u, 0x1980u, 0xD941u, 0x1B00u, 0xDBC1u, 0xDA81u, 0x1A40u,
+      0x1E00u, 0xDEC1u, 0xDF81u, 0x1F40u, 0xDD01u, 0x1DC0u, 0x1C80u, 0xDC41u,
+      0x1400u, 0xD4C1u, 0xD581u, 0x1540u, 0xD701u, 0x17C0u, 0x1680u, 0xD641u,
+      0xD201u, 0x12C0u, 0x1380u, 0xD341u, 0x1100u, 0xD1C1u, 0xD081u, 0x1040u,
+      0xF001u, 0x30C0u, 0x3180u, 0xF141u, 0x3300u, 0xF3C1u, 0xF281u, 0x3240u,
+      0x3600u, 0xF6C1u, 0xF781u, 0x3740u, 0xF501u, 0x35C0u, 0x3480u, 0xF441u,
+      0x3C00u, 0xFCC1u, 0xFD81u, 0x3D40u, 0xFF01u, 0x3FC0u, 0x3E80u, 0xFE41u,
+      0xFA01u, 0x3AC0u, 0x3B80u, 0xFB41u, 0x3900u, 0xF9C1u, 0xF881u, 0x3840u,
+      0x2800u, 0xE8C1u, 0xE981u, 0x2940u, 0xEB01u, 0x2BC0u, 0x2A80u, 0xEA41u,
+      0xEE01u, 0x2EC0u, 0x2F80u, 0xEF41u, 0x2D00u, 0xEDC1u, 0xEC81u, 0x2C40u,
+      0xE401u, 0x24C0u, 0x2580u, 0xE541u, 0x2700u, 0xE7C1u, 0xE681u, 0x2640u,
+      0x2200u, 0xE2C1u, 0xE381u, 0x2340u, 0xE101u, 0x21C0u, 0x2080u, 0xE041u,
+      0xA001u, 0x60C0u, 0x6180u, 0xA141u, 0x6300u, 0xA3C1u, 0xA281u, 0x6240u,
+      0x6600u, 0xA6C1u, 0xA781u, 0x6740u, 0xA501u, 0x65C0u, 0x6480u, 0xA441u,
+      0x6C00u, 0xACC1u, 0xAD81u, 0x6D40u, 0xAF01u, 0x6FC0u, 0x6E80u, 0xAE41u,
+      0xAA01u, 0x6AC0u, 0x6B80u, 0xAB41u, 0x6900u, 0xA9C1u, 0xA881u, 0x6840u,
+      0x7800u, 0xB8C1u, 0xB981u, 0x7940u, 0xBB01u, 0x7BC0u, 0x7A80u, 0xBA41u,
+      0xBE01u, 0x7EC0u, 0x7F80u, 0xBF41u, 0x7D00u, 0xBDC1u, 0xBC81u, 0x7C40u,
+      0xB401u, 0x74C0u, 0x7580u, 0xB541u, 0x7700u, 0xB7C1u, 0xB681u, 0x7640u,
+      0x7200u, 0xB2C1u, 0xB381u, 0x7340u, 0xB101u, 0x71C0u, 0x7080u, 0xB041u,
+      0x5000u, 0x90C1u, 0x9181u, 0x5140u, 0x9301u, 0x53C0u, 0x5280u, 0x9241u,
+      0x9601u, 0x56C0u, 0x5780u, 0x9741u, 0x5500u, 0x95C1u, 0x9481u, 0x5440u,
+      0x9C01u, 0x5CC0u, 0x5D80u, 0x9D41u, 0x5F00u, 0x9FC1u, 0x9E81u, 0x5E40u,
+      0x5A00u, 0x9AC1u, 0x9B81u, 0x5B40u, 0x9901u, 0x59C0u, 0x5880u, 0x9841u,
+      0x8801u, 0x48C0u, 0x4980u, 0x8941u, 0x4B00u, 0x8BC1u, 0x8A81u, 0x4A40u,
+      0x4E00u, 0x8EC1u, 0x8F81u, 0x4F40u, 0x8D01u, 0x4DC0u, 0x4C80u, 0x8C41u,
+      0x4400u, 0x84C1u, 0x8581u, 0x4540u, 0x8701u, 0x47C0u, 0x4680u, 0x8641u,
+      0x8201u, 0x42C0u, 0x4380u, 0x8341u, 0x4100u, 0x81C1u, 0x8081u, 0x4040u
+   }
+};
+
+static const cutil_cpu_variant_t m_crc32c_variants[] =
+{
+#ifdef CRC_X86_SSE42
+   {"sse4.2", CUTIL_CPU_SSE42, (cutil_cpu_func_t*) crc32c_sse42},
+#endif
+   {"slice8", 0u, (cutil_cpu_func_t*) crc32c_slice8}
+};
+static cutil_cpu_dispatch_t m_crc32c_dispatch = CUTIL_CPU_DISPATCH_INIT(m_crc32c_variants);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+uint32_t crc32c_calc(const uint8_t *data, size_t len)
+{
+   return crc32c_update(0u, data, len);
+}
+
+/**
+ * CRC-32C (Castagnoli), as used by iSCSI, SCTP and ext4. Check value 0xE3069283.
+ */
+uint32_t crc32c_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+   crc32c_func_t *func;
+   if ( (data == 0) || (len == 0u) )
+   {
+      return crc;
+   }
+   func = (crc32c_func_t*) cutil_cpu_resolve(&m_crc32c_dispatch);
+   return ~func(~crc, data, len);
+}
+
+/**
+ * Returns the CRC of an empty message, which is the starting value for crc16_update.
+ */
+uint16_t crc16_init(crc16_variant_t variant)
+{
+   if ( (unsigned) variant < CRC16_NUM_VARIANTS)
+   {
+      const crc16_params_t *params = &m_crc16_params[variant];
+      return (uint16_t) ((params->reflected? reflect16(params->init) : params->init) ^ params->xorout);
+   }
+   return 0u;
+}
+
+uint16_t crc16_calc(crc16_variant_t variant, const uint8_t *data, size_t len)
+{
+   return crc16_update(variant, crc16_init(variant), data, len);
+}
+
+uint16_t crc16_update(crc16_variant_t variant, uint16_t crc, const uint8_t *data, size_t len)
+{
+   if ( ((unsigned) variant < CRC16_NUM_VARIANTS) && (data != 0) )
+   {
+      size_t i;
+      const crc16_params_t *params = &m_crc16_params[variant];
+      const uint16_t *table = m_crc16_table[variant];
+      uint16_t reg = (uint16_t) (crc ^ params->xorout);
+      if (params->reflected)
+      {
+         for (i = 0u; i < len; i++)
+         {
+            reg = (uint16_t) ((reg >> 8) ^ table[(reg ^ data[i]) & 0xFFu]);
+         }
+      }
+      else
+      {
+         for (i = 0u; i < len; i++)
+         {
+            reg = (uint16_t) ((reg << 8) ^ table[((reg >> 8) ^ data[i]) & 0xFFu]);
+         }
+      }
+      crc = (uint16_t) (reg ^ params->xorout);
+   }
+   return crc;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static uint16_t reflect16(uint16_t value)
+{
+   unsigned i;
+   uint16_t result = 0u;
+   for (i = 0u; i < 16u; i++)
+   {
+      if (value & (1u << i))
+      {
+         result |= (uint16_t) (0x8000u >> i);
+      }
+   }
+   return result;
+}
+
+static uint32_t crc32c_slice8(uint32_t reg, const uint8_t *data, size_t len)
+{
+   while (len >= 8u)
+   {
+      uint32_t lo = reg ^ unpack_u32le(data);
+      uint32_t hi = unpack_u32le(data + 4u);
+      reg = m_crc32c_table[7][lo & 0xFFu] ^ m_crc32c_table[6][(lo >> 8) & 0xFFu] ^
+            m_crc32c_table[5][(lo >> 16) & 0xFFu] ^ m_crc32c_table[4][lo >> 24] ^
+            m_crc32c_table[3][hi & 0xFFu] ^ m_crc32c_table[2][(hi >> 8) & 0xFFu] ^
+            m_crc32c_table[1][(hi >> 16) & 0xFFu] ^ m_crc32c_table[0][hi >> 24];
+      data += 8u;
+      len -= 8u;
+   }
+   while (len > 0u)
+   {
+      reg = (reg >> 8) ^ m_crc32c_table[0][(reg ^ *data++) & 0xFFu];
+      len--;
+   }
+   return reg;
+}
+
+#ifdef CRC_X86_SSE42
+static uint32_t crc32c_shift(unsigned numLanes, uint32_t reg)
+{
+   const uint32_t (*table)[256] = m_crc32c_shift[numLanes - 1u];
+   return table[0][reg & 0xFFu] ^ table[1][(reg >> 8) & 0xFFu] ^ table[2][(reg >> 16) & 0xFFu] ^ table[3][reg >> 24];
+}
+
+/**
+ * The crc32 instruction has a latency of 3 cycles but a throughput of 1 per cycle, so large inputs are
+ * split into three lanes that are checksummed in parallel and then combined by shifting the first two
+ * lane registers over the bytes that follow them.
+ */
+__attribute__((target("sse4.2")))
+static uint32_t crc32c_sse42(uint32_t reg, const uint8_t *data, size_t len)
+{
+   uint64_t a = reg;
+   while (len >= 3u * LANE_SIZE)
+   {
+      size_t i;
+      uint64_t b = 0u;
+      uint64_t c = 0u;
+      for (i = 0u; i < LANE_SIZE; i += 8u)
+      {
+         uint64_t va, vb, vc;
+         memcpy(&va, data + i, 8u);
+         memcpy(&vb, data + LANE_SIZE + i, 8u);
+         memcpy(&vc, data + 2u * LANE_SIZE + i, 8u);
+         a = _mm_crc32_u64(a, va);
+         b = _mm_crc32_u64(b, vb);
+         c = _mm_crc32_u64(c, vc);
+      }
+      a = crc32c_shift(2u, (uint32_t) a) ^ crc32c_shift(1u, (uint32_t) b) ^ (uint32_t) c;
+      data += 3u * LANE_SIZE;
+      len -= 3u * LANE_SIZE;
+   }
+   while (len >= 8u)
+   {
+      uint64_t v;
+      memcpy(&v, data, 8u);
+      a = _mm_crc32_u64(a, v);
+      data += 8u;
+      len -= 8u;
+   }
+   reg = (uint32_t) a;
+   while (len > 0u)
+   {
+      reg = _mm_crc32_u8(reg, *data++);
+      len--;
+   }
+   return reg;
+}
+#endif
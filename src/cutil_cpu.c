@@ -0,0 +1,364 @@
+/*****************************************************************************
+* \file      cutil_cpu.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Runtime CPU feature detection and kernel dispatch
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "cutil_cpu.h"
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CUTIL_CPU_X86_GNUC
+#include <cpuid.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define CUTIL_CPU_X86_MSVC
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#if defined(__GNUC__) || defined(__clang__)
+#define ATOMIC_LOAD(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define ATOMIC_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+//plain accesses are ordered on the x86 targets supported by MSVC
+#define ATOMIC_LOAD(p) (*(p))
+#define ATOMIC_STORE(p, v) (*(p) = (v))
+#endif
+
+//XCR0 bits telling that the OS saves the corresponding register state
+#define XCR0_SSE_AVX       0x06u
+#define XCR0_AVX512        0xE0u
+
+typedef struct feature_name_tag
+{
+   const char *name;
+   uint32_t feature;
+} feature_name_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void init_features(void);
+static uint32_t lookup_feature(const char *name, size_t len);
+#if defined(CUTIL_CPU_X86_GNUC) || defined(CUTIL_CPU_X86_MSVC)
+static void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]);
+static uint64_t xgetbv0(void);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const feature_name_t m_feature_names[] =
+{
+   {"sse2", CUTIL_CPU_SSE2},
+   {"ssse3", CUTIL_CPU_SSSE3},
+   {"sse4.1", CUTIL_CPU_SSE41},
+   {"sse4.2", CUTIL_CPU_SSE42},
+   {"pclmul", CUTIL_CPU_PCLMUL},
+   {"popcnt", CUTIL_CPU_POPCNT},
+   {"avx", CUTIL_CPU_AVX},
+   {"avx2", CUTIL_CPU_AVX2},
+   {"bmi2", CUTIL_CPU_BMI2},
+   {"avx512f", CUTIL_CPU_AVX512F},
+   {"avx512bw", CUTIL_CPU_AVX512BW},
+   {"sha", CUTIL_CPU_SHA},
+};
+
+static uint32_t m_features = 0u;
+//0 until first initialization, then bumped on every override/reset to invalidate dispatch slots
+static uint32_t m_generation = 0u;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Returns the features supported by both the CPU and the operating system (ignores any override).
+ */
+uint32_t cutil_cpu_detect(void)
+{
+   uint32_t features = 0u;
+#if defined(CUTIL_CPU_X86_GNUC) || defined(CUTIL_CPU_X86_MSVC)
+   uint32_t regs[4];
+   uint32_t maxLeaf;
+   uint64_t xcr0 = 0u;
+   cpuid(0u, 0u, regs);
+   maxLeaf = regs[0];
+   if (maxLeaf < 1u)
+   {
+      return 0u;
+   }
+   cpuid(1u, 0u, regs);
+   if (regs[3] & (1u << 26)) features |= CUTIL_CPU_SSE2;
+   if (regs[2] & (1u << 9)) features |= CUTIL_CPU_SSSE3;
+   if (regs[2] & (1u << 19)) features |= CUTIL_CPU_SSE41;
+   if (regs[2] & (1u << 20)) features |= CUTIL_CPU_SSE42;
+   if (regs[2] & (1u << 1)) features |= CUTIL_CPU_PCLMUL;
+   if (regs[2] & (1u << 23)) features |= CUTIL_CPU_POPCNT;
+   if (regs[2] & (1u << 27)) //OSXSAVE
+   {
+      xcr0 = xgetbv0();
+   }
+   if ( (regs[2] & (1u << 28)) && ((xcr0 & XCR0_SSE_AVX) == XCR0_SSE_AVX) )
+   {
+      features |= CUTIL_CPU_AVX;
+   }
+   if (maxLeaf >= 7u)
+   {
+      cpuid(7u, 0u, regs);
+      if ( (features & CUTIL_CPU_AVX) && (regs[1] & (1u << 5)) ) features |= CUTIL_CPU_AVX2;
+      if (regs[1] & (1u << 8)) features |= CUTIL_CPU_BMI2;
+      if (regs[1] & (1u << 29)) features |= CUTIL_CPU_SHA;
+      if ( (features & CUTIL_CPU_AVX) && ((xcr0 & XCR0_AVX512) == XCR0_AVX512) )
+      {
+         if (regs[1] & (1u << 16)) features |= CUTIL_CPU_AVX512F;
+         if ( (features & CUTIL_CPU_AVX512F) && (regs[1] & (1u << 30)) ) features |= CUTIL_CPU_AVX512BW;
+      }
+   }
+#endif
+   return features;
+}
+
+/**
+ * Returns the features that kernels are allowed to use (detected features restricted by
+ * the CUTIL_CPU_FEATURES environment variable or by cutil_cpu_override).
+ */
+uint32_t cutil_cpu_features(void)
+{
+   if (ATOMIC_LOAD(&m_generation) == 0u)
+   {
+      init_features();
+   }
+   return ATOMIC_LOAD(&m_features);
+}
+
+bool cutil_cpu_has(uint32_t features)
+{
+   return (cutil_cpu_features() & features) == features;
+}
+
+/**
+ * Restricts the active features to the given set (intersected with what is detected).
+ * Meant for tests and benchmarks, must not race with running kernels.
+ */
+void cutil_cpu_override(uint32_t features)
+{
+   ATOMIC_STORE(&m_features, cutil_cpu_detect() & features);
+   ATOMIC_STORE(&m_generation, ATOMIC_LOAD(&m_generation) + 1u);
+}
+
+/**
+ * Undoes cutil_cpu_override (the environment variable is read again).
+ */
+void cutil_cpu_reset(void)
+{
+   init_features();
+}
+
+/**
+ * Parses a feature list as described for CUTIL_CPU_ENV_NAME.
+ * Returns the resulting subset of available.
+ */
+uint32_t cutil_cpu_parseFeatures(const char *str, uint32_t available)
+{
+   uint32_t added = 0u;
+   uint32_t removed = 0u;
+   bool hasPositive = false;
+   if (str == 0)
+   {
+      return available;
+   }
+   while (*str != '\0')
+   {
+      size_t len;
+      bool isNegative = false;
+      while ( (*str == ',') || (*str == ' ') )
+      {
+         str++;
+      }
+      if (*str == '-')
+      {
+         isNegative = true;
+         str++;
+      }
+      len = strcspn(str, ", ");
+      if (len > 0u)
+      {
+         uint32_t feature = lookup_feature(str, len);
+         if (isNegative)
+         {
+            removed |= feature;
+         }
+         else
+         {
+            added |= feature;
+            hasPositive = true; //"none" is a positive item which adds nothing
+         }
+      }
+      str += len;
+   }
+   return (hasPositive? (added & available) : available) & ~removed;
+}
+
+/**
+ * Writes a comma separated list of feature names into buf.
+ * Returns the length of the full string (which was truncated if it is not less than bufSize).
+ */
+size_t cutil_cpu_describe(uint32_t features, char *buf, size_t bufSize)
+{
+   size_t i;
+   size_t len = 0u;
+   if ( (buf != 0) && (bufSize > 0u) )
+   {
+      buf[0] = '\0';
+   }
+   for (i = 0u; i < sizeof(m_feature_names) / sizeof(m_feature_names[0]); i++)
+   {
+      if (features & m_feature_names[i].feature)
+      {
+         const char *name = m_feature_names[i].name;
+         size_t nameLen = strlen(name) + ((len > 0u)? 1u : 0u);
+         if ( (buf != 0) && (len + nameLen < bufSize) )
+         {
+            if (len > 0u)
+            {
+               buf[len] = ',';
+            }
+            strcpy(&buf[len + nameLen - strlen(name)], name);
+         }
+         len += nameLen;
+      }
+   }
+   return len;
+}
+
+/**
+ * Returns the first variant whose required features are all included in features.
+ */
+const cutil_cpu_variant_t *cutil_cpu_select(const cutil_cpu_variant_t *variants, size_t numVariants, uint32_t features)
+{
+   size_t i;
+   for (i = 0u; i < numVariants; i++)
+   {
+      if ( (variants[i].required & features) == variants[i].required)
+      {
+         return &variants[i];
+      }
+   }
+   return (numVariants > 0u)? &variants[numVariants - 1u] : (const cutil_cpu_variant_t*) 0;
+}
+
+/**
+ * Returns the selected function of the dispatch slot, selecting it first if needed.
+ * Concurrent first calls may both select, which is harmless since they select the same variant.
+ */
+cutil_cpu_func_t *cutil_cpu_resolve(cutil_cpu_dispatch_t *dispatch)
+{
+   const cutil_cpu_variant_t *selected = ATOMIC_LOAD(&dispatch->selected);
+   uint32_t generation = ATOMIC_LOAD(&m_generation);
+   if ( (selected == 0) || (generation == 0u) || (ATOMIC_LOAD(&dispatch->generation) != generation) )
+   {
+      uint32_t features = cutil_cpu_features();
+      generation = ATOMIC_LOAD(&m_generation);
+      selected = cutil_cpu_select(dispatch->variants, dispatch->numVariants, features);
+      ATOMIC_STORE(&dispatch->generation, generation);
+      ATOMIC_STORE(&dispatch->selected, selected);
+   }
+   return selected->func;
+}
+
+const char *cutil_cpu_resolvedName(cutil_cpu_dispatch_t *dispatch)
+{
+   (void) cutil_cpu_resolve(dispatch);
+   return dispatch->selected->name;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void init_features(void)
+{
+   uint32_t features = cutil_cpu_parseFeatures(getenv(CUTIL_CPU_ENV_NAME), cutil_cpu_detect());
+   ATOMIC_STORE(&m_features, features);
+   ATOMIC_STORE(&m_generation, ATOMIC_LOAD(&m_generation) + 1u);
+}
+
+static uint32_t lookup_feature(const char *name, size_t len)
+{
+   size_t i;
+   if ( (len == 3u) && (strncmp(name, "all", 3u) == 0) )
+   {
+      return CUTIL_CPU_ALL;
+   }
+   for (i = 0u; i < sizeof(m_feature_names) / sizeof(m_feature_names[0]); i++)
+   {
+      if ( (strlen(m_feature_names[i].name) == len) && (strncmp(m_feature_names[i].name, name, len) == 0) )
+      {
+         return m_feature_names[i].feature;
+      }
+   }
+   return 0u; //unknown names (and "none") select nothing
+}
+
+#if defined(CUTIL_CPU_X86_GNUC)
+static void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+{
+   unsigned int a, b, c, d;
+   __cpuid_count(leaf, subleaf, a, b, c, d);
+   regs[0] = a;
+   regs[1] = b;
+   regs[2] = c;
+   regs[3] = d;
+}
+
+static uint64_t xgetbv0(void)
+{
+   uint32_t eax, edx;
+   __asm__ volatile ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+   return ((uint64_t) edx << 32) | eax;
+}
+#elif defined(CUTIL_CPU_X86_MSVC)
+static void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
+{
+   int info[4];
+   __cpuidex(info, (int) leaf, (int) subleaf);
+   regs[0] = (uint32_t) info[0];
+   regs[1] = (uint32_t) info[1];
+   regs[2] = (uint32_t) info[2];
+   regs[3] = (uint32_t) info[3];
+}
+
+static uint64_t xgetbv0(void)
+{
+   return (uint64_t) _xgetbv(0);
+}
+#endif
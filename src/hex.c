@@ -0,0 +1,273 @@
+/*****************************************************************************
+* \file      hex.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Hexadecimal encoding and decoding
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include "hex.h"
+#include "cutil_cpu.h"
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define HEX_X86_SIMD
+#include <immintrin.h>
+#endif
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define INVALID 0xFFu
+
+typedef void (hex_encode_func_t)(char *dst, const uint8_t *src, size_t len, const char *digits);
+typedef bool (hex_decode_func_t)(uint8_t *dst, const char *src, size_t len);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void encode_scalar(char *dst, const uint8_t *src, size_t len, const char *digits);
+static bool decode_scalar(uint8_t *dst, const char *src, size_t len);
+#ifdef HEX_X86_SIMD
+static void encode_ssse3(char *dst, const uint8_t *src, size_t len, const char *digits);
+static void encode_avx2(char *dst, const uint8_t *src, size_t len, const char *digits);
+static __m128i nibbles_ssse3(__m128i chars, __m128i *invalid);
+static bool decode_ssse3(uint8_t *dst, const char *src, size_t len);
+static __m256i nibbles_avx2(__m256i chars, __m256i *invalid);
+static bool decode_avx2(uint8_t *dst, const char *src, size_t len);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const char m_lower_digits[16] = {'0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f'};
+static const char m_upper_digits[16] = {'0','1','2','3','4','5','6','7','8','9','A','B','C','D','E','F'};
+
+//character to digit value, INVALID for characters that are not hex digits
+static const uint8_t m_digit_values[256] =
+{
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+   0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+static const cutil_cpu_variant_t m_encode_variants[] =
+{
+#ifdef HEX_X86_SIMD
+   {"avx2", CUTIL_CPU_AVX2, (cutil_cpu_func_t*) encode_avx2},
+   {"ssse3", CUTIL_CPU_SSSE3, (cutil_cpu_func_t*) encode_ssse3},
+#endif
+   {"scalar", 0u, (cutil_cpu_func_t*) encode_scalar}
+};
+static const cutil_cpu_variant_t m_decode_variants[] =
+{
+#ifdef HEX_X86_SIMD
+   {"avx2", CUTIL_CPU_AVX2, (cutil_cpu_func_t*) decode_avx2},
+   {"ssse3", CUTIL_CPU_SSSE3, (cutil_cpu_func_t*) decode_ssse3},
+#endif
+   {"scalar", 0u, (cutil_cpu_func_t*) decode_scalar}
+};
+static cutil_cpu_dispatch_t m_encode_dispatch = CUTIL_CPU_DISPATCH_INIT(m_encode_variants);
+static cutil_cpu_dispatch_t m_decode_dispatch = CUTIL_CPU_DISPATCH_INIT(m_decode_variants);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+size_t hex_encode(char *dst, const uint8_t *src, size_t len)
+{
+   hex_encode_func_t *func = (hex_encode_func_t*) cutil_cpu_resolve(&m_encode_dispatch);
+   func(dst, src, len, m_lower_digits);
+   return HEX_ENCODED_SIZE(len);
+}
+
+size_t hex_encodeUpper(char *dst, const uint8_t *src, size_t len)
+{
+   hex_encode_func_t *func = (hex_encode_func_t*) cutil_cpu_resolve(&m_encode_dispatch);
+   func(dst, src, len, m_upper_digits);
+   return HEX_ENCODED_SIZE(len);
+}
+
+bool hex_decode(uint8_t *dst, const char *src, size_t len)
+{
+   hex_decode_func_t *func;
+   if ( (len % 2u) != 0u)
+   {
+      return false;
+   }
+   func = (hex_decode_func_t*) cutil_cpu_resolve(&m_decode_dispatch);
+   return func(dst, src, len);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void encode_scalar(char *dst, const uint8_t *src, size_t len, const char *digits)
+{
+   size_t i;
+   for (i = 0u; i < len; i++)
+   {
+      dst[i * 2u] = digits[src[i] >> 4];
+      dst[i * 2u + 1u] = digits[src[i] & 0x0Fu];
+   }
+}
+
+static bool decode_scalar(uint8_t *dst, const char *src, size_t len)
+{
+   size_t i;
+   unsigned invalid = 0u;
+   const unsigned char *s = (const unsigned char*) src;
+   for (i = 0u; i < len; i += 2u)
+   {
+      unsigned hi = m_digit_values[s[i]];
+      unsigned lo = m_digit_values[s[i + 1u]];
+      invalid |= hi | lo;
+      dst[i / 2u] = (uint8_t) ((hi << 4) | lo);
+   }
+   return (invalid & 0x80u) == 0u;
+}
+
+#ifdef HEX_X86_SIMD
+__attribute__((target("ssse3")))
+static void encode_ssse3(char *dst, const uint8_t *src, size_t len, const char *digits)
+{
+   size_t i = 0u;
+   const __m128i lut = _mm_loadu_si128((const __m128i*) digits);
+   const __m128i mask = _mm_set1_epi8(0x0F);
+   for (; i + 16u <= len; i += 16u)
+   {
+      __m128i bytes = _mm_loadu_si128((const __m128i*) &src[i]);
+      __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+      __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(bytes, mask));
+      _mm_storeu_si128((__m128i*) &dst[i * 2u], _mm_unpacklo_epi8(hi, lo));
+      _mm_storeu_si128((__m128i*) &dst[i * 2u + 16u], _mm_unpackhi_epi8(hi, lo));
+   }
+   encode_scalar(&dst[i * 2u], &src[i], len - i, digits);
+}
+
+__attribute__((target("avx2")))
+static void encode_avx2(char *dst, const uint8_t *src, size_t len, const char *digits)
+{
+   size_t i = 0u;
+   const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) digits));
+   const __m256i mask = _mm256_set1_epi8(0x0F);
+   for (; i + 32u <= len; i += 32u)
+   {
+      __m256i bytes = _mm256_loadu_si256((const __m256i*) &src[i]);
+      __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask));
+      __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(bytes, mask));
+      //unpack works within 128-bit lanes: a holds bytes 0-7 and 16-23, b holds bytes 8-15 and 24-31
+      __m256i a = _mm256_unpacklo_epi8(hi, lo);
+      __m256i b = _mm256_unpackhi_epi8(hi, lo);
+      _mm256_storeu_si256((__m256i*) &dst[i * 2u], _mm256_permute2x128_si256(a, b, 0x20));
+      _mm256_storeu_si256((__m256i*) &dst[i * 2u + 32u], _mm256_permute2x128_si256(a, b, 0x31));
+   }
+   //encode_ssse3 uses legacy SSE encoding and is reached by a sibcall that gcc does not precede with vzeroupper
+   _mm256_zeroupper();
+   encode_ssse3(&dst[i * 2u], &src[i], len - i, digits);
+}
+
+/**
+ * Converts 16 hex characters to 16 nibble values. Sets *invalid to non-zero for any non-hex character.
+ */
+__attribute__((target("ssse3")))
+static __m128i nibbles_ssse3(__m128i chars, __m128i *invalid)
+{
+   __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+   //signed compares also reject characters >= 0x80
+   __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+   __m128i isAlpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+   __m128i digitValue = _mm_and_si128(isDigit, _mm_sub_epi8(chars, _mm_set1_epi8('0')));
+   __m128i alphaValue = _mm_and_si128(isAlpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)));
+   *invalid = _mm_or_si128(*invalid, _mm_andnot_si128(_mm_or_si128(isDigit, isAlpha), _mm_set1_epi8(-1)));
+   return _mm_or_si128(digitValue, alphaValue);
+}
+
+__attribute__((target("ssse3")))
+static bool decode_ssse3(uint8_t *dst, const char *src, size_t len)
+{
+   size_t i = 0u;
+   __m128i invalid = _mm_setzero_si128();
+   //multiplies the first nibble of each pair by 16 and adds the second
+   const __m128i weights = _mm_set1_epi16(0x0110);
+   for (; i + 32u <= len; i += 32u)
+   {
+      __m128i a = nibbles_ssse3(_mm_loadu_si128((const __m128i*) &src[i]), &invalid);
+      __m128i b = nibbles_ssse3(_mm_loadu_si128((const __m128i*) &src[i + 16u]), &invalid);
+      a = _mm_maddubs_epi16(a, weights);
+      b = _mm_maddubs_epi16(b, weights);
+      _mm_storeu_si128((__m128i*) &dst[i / 2u], _mm_packus_epi16(a, b));
+   }
+   if (_mm_movemask_epi8(invalid) != 0)
+   {
+      return false;
+   }
+   return decode_scalar(&dst[i / 2u], &src[i], len - i);
+}
+
+__attribute__((target("avx2")))
+static __m256i nibbles_avx2(__m256i chars, __m256i *invalid)
+{
+   __m256i lower = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+   __m256i isDigit = _mm256_andnot_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('9')), _mm256_cmpgt_epi8(chars, _mm256_set1_epi8('0' - 1)));
+   __m256i isAlpha = _mm256_andnot_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('f')), _mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)));
+   __m256i digitValue = _mm256_and_si256(isDigit, _mm256_sub_epi8(chars, _mm256_set1_epi8('0')));
+   __m256i alphaValue = _mm256_and_si256(isAlpha, _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10)));
+   *invalid = _mm256_or_si256(*invalid, _mm256_andnot_si256(_mm256_or_si256(isDigit, isAlpha), _mm256_set1_epi8(-1)));
+   return _mm256_or_si256(digitValue, alphaValue);
+}
+
+__attribute__((target("avx2")))
+static bool decode_avx2(uint8_t *dst, const char *src, size_t len)
+{
+   size_t i = 0u;
+   bool isValid;
+   __m256i invalid = _mm256_setzero_si256();
+   const __m256i weights = _mm256_set1_epi16(0x0110);
+   for (; i + 64u <= len; i += 64u)
+   {
+      __m256i a = nibbles_avx2(_mm256_loadu_si256((const __m256i*) &src[i]), &invalid);
+      __m256i b = nibbles_avx2(_mm256_loadu_si256((const __m256i*) &src[i + 32u]), &invalid);
+      a = _mm256_maddubs_epi16(a, weights);
+      b = _mm256_maddubs_epi16(b, weights);
+      //packus interleaves the 128-bit lanes of a and b, the permute restores the order
+      _mm256_storeu_si256((__m256i*) &dst[i / 2u], _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+   }
+   isValid = (_mm256_movemask_epi8(invalid) == 0);
+   _mm256_zeroupper();
+   return isValid && decode_ssse3(&dst[i / 2u], &src[i], len - i);
+}
+#endif
@@ -0,0 +1,162 @@
+/*****************************************************************************
+* \file      hmac_sha256.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     HMAC-SHA256 with precomputed key state
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include "hmac_sha256.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define IPAD 0x36u
+#define OPAD 0x5Cu
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void pad_midstate(uint32_t state[8], const uint8_t block[SHA256_BLOCK_SIZE], uint8_t pad);
+static void secure_zero(void *ptr, size_t len);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Precomputes the inner and outer midstates (RFC 2104). Keys longer than the block size are
+ * hashed first. The key bytes are not kept, only the two chaining values.
+ */
+void hmac_sha256_key_init(hmac_sha256_key_t *key, const void *keyData, size_t keyLen)
+{
+   uint8_t block[SHA256_BLOCK_SIZE];
+   memset(block, 0, sizeof(block));
+   if (keyLen > SHA256_BLOCK_SIZE)
+   {
+      sha256_calc(block, keyData, keyLen);
+   }
+   else if (keyLen > 0u)
+   {
+      memcpy(block, keyData, keyLen);
+   }
+   pad_midstate(key->inner, block, IPAD);
+   pad_midstate(key->outer, block, OPAD);
+   secure_zero(block, sizeof(block));
+}
+
+void hmac_sha256_key_clear(hmac_sha256_key_t *key)
+{
+   secure_zero(key, sizeof(*key));
+}
+
+void hmac_sha256_calc(uint8_t mac[32], const hmac_sha256_key_t *key, const void *msg, size_t len)
+{
+   hmac_sha256_ctx_t ctx;
+   hmac_sha256_init(&ctx, key);
+   hmac_sha256_update(&ctx, msg, len);
+   hmac_sha256_final(&ctx, mac);
+}
+
+void hmac_sha256_init(hmac_sha256_ctx_t *ctx, const hmac_sha256_key_t *key)
+{
+   sha256_init_midstate(&ctx->inner, key->inner, SHA256_BLOCK_SIZE);
+   memcpy(ctx->outer, key->outer, sizeof(ctx->outer));
+}
+
+void hmac_sha256_update(hmac_sha256_ctx_t *ctx, const void *data, size_t len)
+{
+   sha256_update(&ctx->inner, data, len);
+}
+
+void hmac_sha256_final(hmac_sha256_ctx_t *ctx, uint8_t mac[32])
+{
+   uint8_t innerHash[SHA256_HASH_SIZE];
+   sha256_final(&ctx->inner, innerHash);
+   sha256_init_midstate(&ctx->inner, ctx->outer, SHA256_BLOCK_SIZE);
+   sha256_update(&ctx->inner, innerHash, sizeof(innerHash));
+   sha256_final(&ctx->inner, mac);
+}
+
+/**
+ * One-shot HMAC for a key that is only used once
+ */
+void hmac_sha256(uint8_t mac[32], const void *keyData, size_t keyLen, const void *msg, size_t len)
+{
+   hmac_sha256_key_t key;
+   hmac_sha256_key_init(&key, keyData, keyLen);
+   hmac_sha256_calc(mac, &key, msg, len);
+   hmac_sha256_key_clear(&key);
+}
+
+/**
+ * Compares the first macLen bytes (a truncated MAC, 1 to 32 bytes) in constant time.
+ */
+bool hmac_sha256_verify(const uint8_t expected[32], const uint8_t *mac, size_t macLen)
+{
+   uint8_t diff = 0u;
+   size_t i;
+   if ( (macLen == 0u) || (macLen > HMAC_SHA256_MAC_SIZE) )
+   {
+      return false;
+   }
+   for (i = 0u; i < macLen; i++)
+   {
+      diff |= (uint8_t) (expected[i] ^ mac[i]);
+   }
+   return diff == 0u;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+static void pad_midstate(uint32_t state[8], const uint8_t block[SHA256_BLOCK_SIZE], uint8_t pad)
+{
+   uint8_t padded[SHA256_BLOCK_SIZE];
+   sha256_ctx_t ctx;
+   size_t i;
+   for (i = 0u; i < SHA256_BLOCK_SIZE; i++)
+   {
+      padded[i] = (uint8_t) (block[i] ^ pad);
+   }
+   sha256_init(&ctx);
+   sha256_update(&ctx, padded, sizeof(padded));
+   memcpy(state, ctx.state, sizeof(ctx.state));
+   secure_zero(padded, sizeof(padded));
+   secure_zero(&ctx, sizeof(ctx));
+}
+
+//volatile writes so that the compiler cannot drop the wipe of a buffer that is about to go out of scope
+static void secure_zero(void *ptr, size_t len)
+{
+   volatile uint8_t *p = (volatile uint8_t*) ptr;
+   while (len-- > 0u)
+   {
+      *p++ = 0u;
+   }
+}
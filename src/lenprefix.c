@@ -0,0 +1,86 @@
+/*****************************************************************************
+* \file      lenprefix.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Length-prefix message headers (1 or 4 bytes)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include "lenprefix.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Finds the boundaries of up to maxMsgs complete messages (header plus payload) in buf.
+ * Returns the number of messages found. consumed (optional) is set to the number of bytes
+ * they occupy, which is where parsing should resume once more data has arrived.
+ */
+size_t lenprefix_scan(const uint8_t *buf, size_t len, lenprefix_msg_t *msgs, size_t maxMsgs, size_t *consumed)
+{
+   size_t numMsgs = 0u;
+   size_t pos = 0u;
+   if ( (buf != 0) && (msgs != 0) )
+   {
+      //while a 4-byte load is safe, both header forms are decoded without branching on the first byte
+      while ( (numMsgs < maxMsgs) && (len - pos >= LENPREFIX_MAX_HEADER_SIZE) )
+      {
+         const uint32_t word = unpack_u32be(&buf[pos]);
+         const uint32_t isLong = word >> 31;
+         const uint32_t mask = 0u - isLong;
+         const uint32_t length = (word & LENPREFIX_LONG_MAX & mask) | ((word >> 24) & ~mask);
+         const size_t headerSize = 1u + 3u * isLong;
+         if (length > len - pos - headerSize)
+         {
+            break;
+         }
+         msgs[numMsgs].offset = pos + headerSize;
+         msgs[numMsgs].length = length;
+         numMsgs++;
+         pos += headerSize + length;
+      }
+      //last few bytes of the buffer
+      while ( (numMsgs < maxMsgs) && (pos < len) && (len - pos < LENPREFIX_MAX_HEADER_SIZE) )
+      {
+         uint32_t length;
+         size_t headerSize = lenprefix_decode(&buf[pos], len - pos, &length);
+         if ( (headerSize == 0u) || (length > len - pos - headerSize) )
+         {
+            break;
+         }
+         msgs[numMsgs].offset = pos + headerSize;
+         msgs[numMsgs].length = length;
+         numMsgs++;
+         pos += headerSize + length;
+      }
+   }
+   if (consumed != 0)
+   {
+      *consumed = pos;
+   }
+   return numMsgs;
+}
@@ -0,0 +1,362 @@
+/*****************************************************************************
+* \file      pack_array.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Bulk array pack/unpack with byte order conversion
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdbool.h>
+#include <string.h>
+#include "pack.h"
+#include "pack_array.h"
+#include "cutil_cpu.h"
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PACK_ARRAY_X86_SIMD
+#include <immintrin.h>
+#endif
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+//Reverses byte order of n elements of given width (2, 4 or 8 bytes) from src into dst
+typedef void (swap_func_t)(void *dst, const void *src, size_t n, unsigned width);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void convert_le(void *dst, const void *src, size_t n, unsigned width, bool isPack);
+static void convert_be(void *dst, const void *src, size_t n, unsigned width, bool isPack);
+static void swap_array(void *dst, const void *src, size_t n, unsigned width);
+#ifdef _PACK_NATIVE_ORDER
+static void copy_array(void *dst, const void *src, size_t numBytes);
+#else
+static void convert_portable(void *dst, const void *src, size_t n, unsigned width, bool isPack, bool isBigEndian);
+#endif
+static void swap_scalar(void *dst, const void *src, size_t n, unsigned width);
+#ifdef PACK_ARRAY_X86_SIMD
+static const uint8_t *shuffle_mask(unsigned width);
+static void swap_ssse3(void *dst, const void *src, size_t n, unsigned width);
+static void swap_avx2(void *dst, const void *src, size_t n, unsigned width);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+#ifdef PACK_ARRAY_X86_SIMD
+//pshufb masks reversing the bytes of each 2, 4 and 8 byte element within a 16-byte lane
+static const uint8_t m_shuffle_masks[3][16] =
+{
+   {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+   {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+   {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8}
+};
+
+//best first, swap_scalar is the fallback
+static const cutil_cpu_variant_t m_swap_variants[] =
+{
+   {"avx2", CUTIL_CPU_AVX2, (cutil_cpu_func_t*) swap_avx2},
+   {"ssse3", CUTIL_CPU_SSSE3, (cutil_cpu_func_t*) swap_ssse3},
+   {"scalar", 0u, (cutil_cpu_func_t*) swap_scalar}
+};
+static cutil_cpu_dispatch_t m_swap_dispatch = CUTIL_CPU_DISPATCH_INIT(m_swap_variants);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+void packArrayU16LE(uint8_t *dst, const uint16_t *src, size_t n)
+{
+   convert_le(dst, src, n, 2u, true);
+}
+
+void packArrayU16BE(uint8_t *dst, const uint16_t *src, size_t n)
+{
+   convert_be(dst, src, n, 2u, true);
+}
+
+void packArrayU32LE(uint8_t *dst, const uint32_t *src, size_t n)
+{
+   convert_le(dst, src, n, 4u, true);
+}
+
+void packArrayU32BE(uint8_t *dst, const uint32_t *src, size_t n)
+{
+   convert_be(dst, src, n, 4u, true);
+}
+
+void packArrayU64LE(uint8_t *dst, const uint64_t *src, size_t n)
+{
+   convert_le(dst, src, n, 8u, true);
+}
+
+void packArrayU64BE(uint8_t *dst, const uint64_t *src, size_t n)
+{
+   convert_be(dst, src, n, 8u, true);
+}
+
+void unpackArrayU16LE(uint16_t *dst, const uint8_t *src, size_t n)
+{
+   convert_le(dst, src, n, 2u, false);
+}
+
+void unpackArrayU16BE(uint16_t *dst, const uint8_t *src, size_t n)
+{
+   convert_be(dst, src, n, 2u, false);
+}
+
+void unpackArrayU32LE(uint32_t *dst, const uint8_t *src, size_t n)
+{
+   convert_le(dst, src, n, 4u, false);
+}
+
+void unpackArrayU32BE(uint32_t *dst, const uint8_t *src, size_t n)
+{
+   convert_be(dst, src, n, 4u, false);
+}
+
+void unpackArrayU64LE(uint64_t *dst, const uint8_t *src, size_t n)
+{
+   convert_le(dst, src, n, 8u, false);
+}
+
+void unpackArrayU64BE(uint64_t *dst, const uint8_t *src, size_t n)
+{
+   convert_be(dst, src, n, 8u, false);
+}
+
+void swapArrayU16(uint16_t *data, size_t n)
+{
+   swap_array(data, data, n, 2u);
+}
+
+void swapArrayU32(uint32_t *data, size_t n)
+{
+   swap_array(data, data, n, 4u);
+}
+
+void swapArrayU64(uint64_t *data, size_t n)
+{
+   swap_array(data, data, n, 8u);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * When the byte order is known at compile time the conversion is either a plain copy or a
+ * (vectorized) byte swap, regardless of direction. Otherwise the bytes are shifted out one by one.
+ */
+static void convert_le(void *dst, const void *src, size_t n, unsigned width, bool isPack)
+{
+#if defined(_PACK_NATIVE_ORDER) && (_PACK_NATIVE_ORDER == PLATFORM_LITTLE_ENDIAN)
+   (void) isPack;
+   copy_array(dst, src, n * width);
+#elif defined(_PACK_NATIVE_ORDER)
+   (void) isPack;
+   swap_array(dst, src, n, width);
+#else
+   convert_portable(dst, src, n, width, isPack, false);
+#endif
+}
+
+static void convert_be(void *dst, const void *src, size_t n, unsigned width, bool isPack)
+{
+#if defined(_PACK_NATIVE_ORDER) && (_PACK_NATIVE_ORDER == PLATFORM_LITTLE_ENDIAN)
+   (void) isPack;
+   swap_array(dst, src, n, width);
+#elif defined(_PACK_NATIVE_ORDER)
+   (void) isPack;
+   copy_array(dst, src, n * width);
+#else
+   convert_portable(dst, src, n, width, isPack, true);
+#endif
+}
+
+static void swap_array(void *dst, const void *src, size_t n, unsigned width)
+{
+#ifdef PACK_ARRAY_X86_SIMD
+   swap_func_t *func = (swap_func_t*) cutil_cpu_resolve(&m_swap_dispatch);
+   func(dst, src, n, width);
+#else
+   swap_scalar(dst, src, n, width);
+#endif
+}
+
+#ifdef _PACK_NATIVE_ORDER
+static void copy_array(void *dst, const void *src, size_t numBytes)
+{
+   if ( (dst != src) && (numBytes > 0u) )
+   {
+      memcpy(dst, src, numBytes);
+   }
+}
+#else
+static void convert_portable(void *dst, const void *src, size_t n, unsigned width, bool isPack, bool isBigEndian)
+{
+   size_t i;
+   for (i = 0u; i < n; i++)
+   {
+      unsigned j;
+      uint64_t value = 0u;
+      if (isPack)
+      {
+         uint8_t *p = (uint8_t*) dst + i * width;
+         switch (width)
+         {
+         case 2u: value = ((const uint16_t*) src)[i]; break;
+         case 4u: value = ((const uint32_t*) src)[i]; break;
+         default: value = ((const uint64_t*) src)[i]; break;
+         }
+         for (j = 0u; j < width; j++)
+         {
+            p[isBigEndian? (width - 1u - j) : j] = (uint8_t) (value >> (j * 8u));
+         }
+      }
+      else
+      {
+         const uint8_t *p = (const uint8_t*) src + i * width;
+         for (j = 0u; j < width; j++)
+         {
+            value |= ((uint64_t) p[isBigEndian? (width - 1u - j) : j]) << (j * 8u);
+         }
+         switch (width)
+         {
+         case 2u: ((uint16_t*) dst)[i] = (uint16_t) value; break;
+         case 4u: ((uint32_t*) dst)[i] = (uint32_t) value; break;
+         default: ((uint64_t*) dst)[i] = value; break;
+         }
+      }
+   }
+}
+#endif
+
+static void swap_scalar(void *dst, const void *src, size_t n, unsigned width)
+{
+   size_t i;
+   uint8_t *d = (uint8_t*) dst;
+   const uint8_t *s = (const uint8_t*) src;
+   switch (width)
+   {
+   case 2u:
+      for (i = 0u; i < n; i++)
+      {
+         uint16_t value;
+         memcpy(&value, &s[i * 2u], 2u);
+         value = _PACK_BSWAP16(value);
+         memcpy(&d[i * 2u], &value, 2u);
+      }
+      break;
+   case 4u:
+      for (i = 0u; i < n; i++)
+      {
+         uint32_t value;
+         memcpy(&value, &s[i * 4u], 4u);
+         value = _PACK_BSWAP32(value);
+         memcpy(&d[i * 4u], &value, 4u);
+      }
+      break;
+   case 8u:
+      for (i = 0u; i < n; i++)
+      {
+         uint64_t value;
+         memcpy(&value, &s[i * 8u], 8u);
+         value = _PACK_BSWAP64(value);
+         memcpy(&d[i * 8u], &value, 8u);
+      }
+      break;
+   default:
+      break;
+   }
+}
+
+#ifdef PACK_ARRAY_X86_SIMD
+static const uint8_t *shuffle_mask(unsigned width)
+{
+   return m_shuffle_masks[(width == 2u)? 0 : (width == 4u)? 1 : 2];
+}
+
+__attribute__((target("ssse3")))
+static void swap_ssse3(void *dst, const void *src, size_t n, unsigned width)
+{
+   size_t i = 0u;
+   const size_t numBytes = n * width;
+   uint8_t *d = (uint8_t*) dst;
+   const uint8_t *s = (const uint8_t*) src;
+   const __m128i mask = _mm_loadu_si128((const __m128i*) shuffle_mask(width));
+   for (; i + 32u <= numBytes; i += 32u)
+   {
+      __m128i v0 = _mm_loadu_si128((const __m128i*) &s[i]);
+      __m128i v1 = _mm_loadu_si128((const __m128i*) &s[i + 16u]);
+      _mm_storeu_si128((__m128i*) &d[i], _mm_shuffle_epi8(v0, mask));
+      _mm_storeu_si128((__m128i*) &d[i + 16u], _mm_shuffle_epi8(v1, mask));
+   }
+   if (i + 16u <= numBytes)
+   {
+      __m128i v = _mm_loadu_si128((const __m128i*) &s[i]);
+      _mm_storeu_si128((__m128i*) &d[i], _mm_shuffle_epi8(v, mask));
+      i += 16u;
+   }
+   swap_scalar(&d[i], &s[i], (numBytes - i) / width, width);
+}
+
+__attribute__((target("avx2")))
+static void swap_avx2(void *dst, const void *src, size_t n, unsigned width)
+{
+   size_t i = 0u;
+   const size_t numBytes = n * width;
+   uint8_t *d = (uint8_t*) dst;
+   const uint8_t *s = (const uint8_t*) src;
+   const __m128i mask128 = _mm_loadu_si128((const __m128i*) shuffle_mask(width));
+   //vpshufb shuffles within each 128-bit lane so the same mask is used for both lanes
+   const __m256i mask = _mm256_broadcastsi128_si256(mask128);
+   for (; i + 64u <= numBytes; i += 64u)
+   {
+      __m256i v0 = _mm256_loadu_si256((const __m256i*) &s[i]);
+      __m256i v1 = _mm256_loadu_si256((const __m256i*) &s[i + 32u]);
+      _mm256_storeu_si256((__m256i*) &d[i], _mm256_shuffle_epi8(v0, mask));
+      _mm256_storeu_si256((__m256i*) &d[i + 32u], _mm256_shuffle_epi8(v1, mask));
+   }
+   if (i + 32u <= numBytes)
+   {
+      __m256i v = _mm256_loadu_si256((const __m256i*) &s[i]);
+      _mm256_storeu_si256((__m256i*) &d[i], _mm256_shuffle_epi8(v, mask));
+      i += 32u;
+   }
+   //gcc 12 emits no vzeroupper before the sibcall to swap_scalar, leaving dirty upper halves to the caller's SSE code
+   _mm256_zeroupper();
+   if (i + 16u <= numBytes)
+   {
+      __m128i v = _mm_loadu_si128((const __m128i*) &s[i]);
+      _mm_storeu_si128((__m128i*) &d[i], _mm_shuffle_epi8(v, mask128));
+      i += 16u;
+   }
+   swap_scalar(&d[i], &s[i], (numBytes - i) / width, width);
+}
+#endif
@@ -0,0 +1,142 @@
+/*****************************************************************************
+* \file      pack_cursor.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Bounds-checked writer and reader cursors for the pack routines
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include "pack_cursor.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define MIN_ARRAY_CAPACITY 64u
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void pack_writer_init(pack_writer_t *self, uint8_t *buf, size_t size)
+{
+   if (self != 0)
+   {
+      self->begin = buf;
+      self->pos = buf;
+      self->end = (buf != 0)? buf + size : buf;
+      self->array = (adt_bytearray_t*) 0;
+      self->error = false;
+   }
+}
+
+/**
+ * Writes are appended after the current content of array.
+ * The length of array is updated by pack_writer_finish (and whenever the array grows).
+ */
+void pack_writer_initArray(pack_writer_t *self, adt_bytearray_t *array)
+{
+   if ( (self != 0) && (array != 0) )
+   {
+      uint8_t *data = adt_bytearray_data(array);
+      uint32_t length = adt_bytearray_length(array);
+      self->begin = data;
+      self->pos = (data != 0)? data + length : data;
+      self->end = self->pos;
+      self->array = array;
+      self->error = false;
+   }
+}
+
+/**
+ * Slow path of pack_writer_reserve. The byte array capacity is at least doubled each time
+ * which keeps the amortized cost per written byte constant.
+ */
+bool pack_writer_reserveSlow(pack_writer_t *self, size_t size)
+{
+   if ( (self->error) || (self->array == 0) )
+   {
+      self->error = true;
+      return false;
+   }
+   else
+   {
+      size_t length = (size_t) (self->pos - self->begin);
+      size_t capacity = (size_t) (self->end - self->begin);
+      size_t newCapacity = (capacity < MIN_ARRAY_CAPACITY)? MIN_ARRAY_CAPACITY : capacity * 2u;
+      uint8_t *data;
+      if (newCapacity < length + size)
+      {
+         newCapacity = length + size;
+      }
+      if ( (length + size < length) || (newCapacity > UINT32_MAX) )
+      {
+         self->error = true;
+         return false;
+      }
+      //commit what has been written so far since reallocation only needs to preserve the current length
+      if ( (adt_bytearray_resize(self->array, (uint32_t) length) != ADT_NO_ERROR) ||
+           (adt_bytearray_reserve(self->array, (uint32_t) newCapacity) != ADT_NO_ERROR) )
+      {
+         self->error = true;
+         return false;
+      }
+      data = adt_bytearray_data(self->array);
+      self->begin = data;
+      self->pos = data + length;
+      self->end = data + newCapacity;
+      return true;
+   }
+}
+
+/**
+ * Sets the length of the byte array to cover everything written.
+ * Returns false if any reservation failed during writing.
+ */
+bool pack_writer_finish(pack_writer_t *self)
+{
+   if (self == 0)
+   {
+      return false;
+   }
+   if ( (self->array != 0) && (self->begin != 0) )
+   {
+      if (adt_bytearray_resize(self->array, (uint32_t) (self->pos - self->begin)) != ADT_NO_ERROR)
+      {
+         self->error = true;
+      }
+   }
+   return !self->error;
+}
+
+void pack_reader_init(pack_reader_t *self, const uint8_t *buf, size_t size)
+{
+   if (self != 0)
+   {
+      self->begin = buf;
+      self->pos = buf;
+      self->end = (buf != 0)? buf + size : buf;
+      self->error = false;
+   }
+}
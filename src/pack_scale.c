@@ -0,0 +1,658 @@
+/*****************************************************************************
+* \file      pack_scale.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Fixed-point scaling between raw signal values and physical values
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include "pack_scale.h"
+#include "cutil_cpu.h"
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PACK_SCALE_X86_SIMD
+#include <immintrin.h>
+#endif
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define RAW_S8  0u
+#define RAW_U8  1u
+#define RAW_S16 2u
+#define RAW_U16 3u
+#define RAW_S32 4u
+#define RAW_U32 5u
+#define NUM_RAW_TYPES 6u
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define ALWAYS_INLINE __forceinline
+#else
+#define ALWAYS_INLINE inline
+#endif
+
+//Calls impl with rawType as a compile-time constant, giving every raw type its own specialized loop
+#define SPECIALIZE_RAW_TYPE(rawType, impl, ...) \
+   switch (rawType) \
+   { \
+   case RAW_S8: impl(RAW_S8, __VA_ARGS__); break; \
+   case RAW_U8: impl(RAW_U8, __VA_ARGS__); break; \
+   case RAW_S16: impl(RAW_S16, __VA_ARGS__); break; \
+   case RAW_U16: impl(RAW_U16, __VA_ARGS__); break; \
+   case RAW_S32: impl(RAW_S32, __VA_ARGS__); break; \
+   default: impl(RAW_U32, __VA_ARGS__); break; \
+   }
+
+//the largest values below 2^23 and 2^52 are not guaranteed to be integers
+#define F32_ROUND_LIMIT 8388608.0f
+#define F64_ROUND_LIMIT 4503599627370496.0
+
+typedef void (to_f32_func_t)(float *dst, const void *src, size_t n, unsigned rawType, float scale, float offset);
+typedef void (to_f64_func_t)(double *dst, const void *src, size_t n, unsigned rawType, double scale, double offset);
+typedef void (from_f32_func_t)(void *dst, const float *src, size_t n, unsigned rawType, float scale, float offset);
+typedef void (from_f64_func_t)(void *dst, const double *src, size_t n, unsigned rawType, double scale, double offset);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void to_f32(float *dst, const void *src, size_t n, unsigned rawType, float scale, float offset);
+static void to_f64(double *dst, const void *src, size_t n, unsigned rawType, double scale, double offset);
+static void from_f32(void *dst, const float *src, size_t n, unsigned rawType, float scale, float offset);
+static void from_f64(void *dst, const double *src, size_t n, unsigned rawType, double scale, double offset);
+static ALWAYS_INLINE int64_t read_raw(unsigned rawType, const void *src, size_t i);
+static ALWAYS_INLINE void write_raw(unsigned rawType, void *dst, size_t i, int64_t value);
+static ALWAYS_INLINE int64_t saturate_f32(unsigned rawType, float x);
+static ALWAYS_INLINE int64_t saturate_f64(unsigned rawType, double x);
+static ALWAYS_INLINE void to_f32_scalar_impl(unsigned rawType, float *dst, const void *src, size_t i, size_t n, float scale, float offset);
+static ALWAYS_INLINE void to_f64_scalar_impl(unsigned rawType, double *dst, const void *src, size_t i, size_t n, double scale, double offset);
+static ALWAYS_INLINE void from_f32_scalar_impl(unsigned rawType, void *dst, const float *src, size_t i, size_t n, float scale, float offset);
+static ALWAYS_INLINE void from_f64_scalar_impl(unsigned rawType, void *dst, const double *src, size_t i, size_t n, double scale, double offset);
+static void to_f32_scalar(float *dst, const void *src, size_t n, unsigned rawType, float scale, float offset);
+static void to_f64_scalar(double *dst, const void *src, size_t n, unsigned rawType, double scale, double offset);
+static void from_f32_scalar(void *dst, const float *src, size_t n, unsigned rawType, float scale, float offset);
+static void from_f64_scalar(void *dst, const double *src, size_t n, unsigned rawType, double scale, double offset);
+#ifdef PACK_SCALE_X86_SIMD
+static ALWAYS_INLINE __m256i load8_avx2(unsigned rawType, const void *src, size_t i);
+static ALWAYS_INLINE void store8_avx2(unsigned rawType, void *dst, size_t i, __m256i v);
+static ALWAYS_INLINE __m256 convert8_ps_avx2(unsigned rawType, __m256i v);
+static ALWAYS_INLINE __m256d convert4_pd_avx2(unsigned rawType, __m128i v);
+static ALWAYS_INLINE __m256i saturate8_ps_avx2(unsigned rawType, __m256 x);
+static ALWAYS_INLINE __m128i saturate4_pd_avx2(unsigned rawType, __m256d x);
+static ALWAYS_INLINE void to_f32_avx2_impl(unsigned rawType, float *dst, const void *src, size_t n, float scale, float offset);
+static ALWAYS_INLINE void to_f64_avx2_impl(unsigned rawType, double *dst, const void *src, size_t n, double scale, double offset);
+static ALWAYS_INLINE void from_f32_avx2_impl(unsigned rawType, void *dst, const float *src, size_t n, float scale, float offset);
+static ALWAYS_INLINE void from_f64_avx2_impl(unsigned rawType, void *dst, const double *src, size_t n, double scale, double offset);
+static void to_f32_avx2(float *dst, const void *src, size_t n, unsigned rawType, float scale, float offset);
+static void to_f64_avx2(double *dst, const void *src, size_t n, unsigned rawType, double scale, double offset);
+static void from_f32_avx2(void *dst, const float *src, size_t n, unsigned rawType, float scale, float offset);
+static void from_f64_avx2(void *dst, const double *src, size_t n, unsigned rawType, double scale, double offset);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const int64_t m_raw_min[NUM_RAW_TYPES] = {INT8_MIN, 0, INT16_MIN, 0, INT32_MIN, 0};
+static const int64_t m_raw_max[NUM_RAW_TYPES] = {INT8_MAX, UINT8_MAX, INT16_MAX, UINT16_MAX, INT32_MAX, UINT32_MAX};
+//largest float not above m_raw_max (INT32_MAX and UINT32_MAX are not representable)
+static const float m_raw_max_f32[NUM_RAW_TYPES] = {127.0f, 255.0f, 32767.0f, 65535.0f, 2147483520.0f, 4294967040.0f};
+
+#ifdef PACK_SCALE_X86_SIMD
+//best first, the scalar variant is the fallback
+static const cutil_cpu_variant_t m_to_f32_variants[] =
+{
+   {"avx2", CUTIL_CPU_AVX2, (cutil_cpu_func_t*) to_f32_avx2},
+   {"scalar", 0u, (cutil_cpu_func_t*) to_f32_scalar}
+};
+static const cutil_cpu_variant_t m_to_f64_variants[] =
+{
+   {"avx2", CUTIL_CPU_AVX2, (cutil_cpu_func_t*) to_f64_avx2},
+   {"scalar", 0u, (cutil_cpu_func_t*) to_f64_scalar}
+};
+static const cutil_cpu_variant_t m_from_f32_variants[] =
+{
+   {"avx2", CUTIL_CPU_AVX2, (cutil_cpu_func_t*) from_f32_avx2},
+   {"scalar", 0u, (cutil_cpu_func_t*) from_f32_scalar}
+};
+static const cutil_cpu_variant_t m_from_f64_variants[] =
+{
+   {"avx2", CUTIL_CPU_AVX2, (cutil_cpu_func_t*) from_f64_avx2},
+   {"scalar", 0u, (cutil_cpu_func_t*) from_f64_scalar}
+};
+static cutil_cpu_dispatch_t m_to_f32_dispatch = CUTIL_CPU_DISPATCH_INIT(m_to_f32_variants);
+static cutil_cpu_dispatch_t m_to_f64_dispatch = CUTIL_CPU_DISPATCH_INIT(m_to_f64_variants);
+static cutil_cpu_dispatch_t m_from_f32_dispatch = CUTIL_CPU_DISPATCH_INIT(m_from_f32_variants);
+static cutil_cpu_dispatch_t m_from_f64_dispatch = CUTIL_CPU_DISPATCH_INIT(m_from_f64_variants);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void pack_scale_s8ToF32(float *dst, const int8_t *src, size_t n, float scale, float offset)
+{
+   to_f32(dst, src, n, RAW_S8, scale, offset);
+}
+
+void pack_scale_u8ToF32(float *dst, const uint8_t *src, size_t n, float scale, float offset)
+{
+   to_f32(dst, src, n, RAW_U8, scale, offset);
+}
+
+void pack_scale_s16ToF32(float *dst, const int16_t *src, size_t n, float scale, float offset)
+{
+   to_f32(dst, src, n, RAW_S16, scale, offset);
+}
+
+void pack_scale_u16ToF32(float *dst, const uint16_t *src, size_t n, float scale, float offset)
+{
+   to_f32(dst, src, n, RAW_U16, scale, offset);
+}
+
+void pack_scale_s32ToF32(float *dst, const int32_t *src, size_t n, float scale, float offset)
+{
+   to_f32(dst, src, n, RAW_S32, scale, offset);
+}
+
+void pack_scale_u32ToF32(float *dst, const uint32_t *src, size_t n, float scale, float offset)
+{
+   to_f32(dst, src, n, RAW_U32, scale, offset);
+}
+
+void pack_scale_s8ToF64(double *dst, const int8_t *src, size_t n, double scale, double offset)
+{
+   to_f64(dst, src, n, RAW_S8, scale, offset);
+}
+
+void pack_scale_u8ToF64(double *dst, const uint8_t *src, size_t n, double scale, double offset)
+{
+   to_f64(dst, src, n, RAW_U8, scale, offset);
+}
+
+void pack_scale_s16ToF64(double *dst, const int16_t *src, size_t n, double scale, double offset)
+{
+   to_f64(dst, src, n, RAW_S16, scale, offset);
+}
+
+void pack_scale_u16ToF64(double *dst, const uint16_t *src, size_t n, double scale, double offset)
+{
+   to_f64(dst, src, n, RAW_U16, scale, offset);
+}
+
+void pack_scale_s32ToF64(double *dst, const int32_t *src, size_t n, double scale, double offset)
+{
+   to_f64(dst, src, n, RAW_S32, scale, offset);
+}
+
+void pack_scale_u32ToF64(double *dst, const uint32_t *src, size_t n, double scale, double offset)
+{
+   to_f64(dst, src, n, RAW_U32, scale, offset);
+}
+
+void pack_scale_f32ToS8(int8_t *dst, const float *src, size_t n, float scale, float offset)
+{
+   from_f32(dst, src, n, RAW_S8, scale, offset);
+}
+
+void pack_scale_f32ToU8(uint8_t *dst, const float *src, size_t n, float scale, float offset)
+{
+   from_f32(dst, src, n, RAW_U8, scale, offset);
+}
+
+void pack_scale_f32ToS16(int16_t *dst, const float *src, size_t n, float scale, float offset)
+{
+   from_f32(dst, src, n, RAW_S16, scale, offset);
+}
+
+void pack_scale_f32ToU16(uint16_t *dst, const float *src, size_t n, float scale, float offset)
+{
+   from_f32(dst, src, n, RAW_U16, scale, offset);
+}
+
+void pack_scale_f32ToS32(int32_t *dst, const float *src, size_t n, float scale, float offset)
+{
+   from_f32(dst, src, n, RAW_S32, scale, offset);
+}
+
+void pack_scale_f32ToU32(uint32_t *dst, const float *src, size_t n, float scale, float offset)
+{
+   from_f32(dst, src, n, RAW_U32, scale, offset);
+}
+
+void pack_scale_f64ToS8(int8_t *dst, const double *src, size_t n, double scale, double offset)
+{
+   from_f64(dst, src, n, RAW_S8, scale, offset);
+}
+
+void pack_scale_f64ToU8(uint8_t *dst, const double *src, size_t n, double scale, double offset)
+{
+   from_f64(dst, src, n, RAW_U8, scale, offset);
+}
+
+void pack_scale_f64ToS16(int16_t *dst, const double *src, size_t n, double scale, double offset)
+{
+   from_f64(dst, src, n, RAW_S16, scale, offset);
+}
+
+void pack_scale_f64ToU16(uint16_t *dst, const double *src, size_t n, double scale, double offset)
+{
+   from_f64(dst, src, n, RAW_U16, scale, offset);
+}
+
+void pack_scale_f64ToS32(int32_t *dst, const double *src, size_t n, double scale, double offset)
+{
+   from_f64(dst, src, n, RAW_S32, scale, offset);
+}
+
+void pack_scale_f64ToU32(uint32_t *dst, const double *src, size_t n, double scale, double offset)
+{
+   from_f64(dst, src, n, RAW_U32, scale, offset);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void to_f32(float *dst, const void *src, size_t n, unsigned rawType, float scale, float offset)
+{
+#ifdef PACK_SCALE_X86_SIMD
+   to_f32_func_t *func = (to_f32_func_t*) cutil_cpu_resolve(&m_to_f32_dispatch);
+   func(dst, src, n, rawType, scale, offset);
+#else
+   to_f32_scalar(dst, src, n, rawType, scale, offset);
+#endif
+}
+
+static void to_f64(double *dst, const void *src, size_t n, unsigned rawType, double scale, double offset)
+{
+#ifdef PACK_SCALE_X86_SIMD
+   to_f64_func_t *func = (to_f64_func_t*) cutil_cpu_resolve(&m_to_f64_dispatch);
+   func(dst, src, n, rawType, scale, offset);
+#else
+   to_f64_scalar(dst, src, n, rawType, scale, offset);
+#endif
+}
+
+static void from_f32(void *dst, const float *src, size_t n, unsigned rawType, float scale, float offset)
+{
+#ifdef PACK_SCALE_X86_SIMD
+   from_f32_func_t *func = (from_f32_func_t*) cutil_cpu_resolve(&m_from_f32_dispatch);
+   func(dst, src, n, rawType, scale, offset);
+#else
+   from_f32_scalar(dst, src, n, rawType, scale, offset);
+#endif
+}
+
+static void from_f64(void *dst, const double *src, size_t n, unsigned rawType, double scale, double offset)
+{
+#ifdef PACK_SCALE_X86_SIMD
+   from_f64_func_t *func = (from_f64_func_t*) cutil_cpu_resolve(&m_from_f64_dispatch);
+   func(dst, src, n, rawType, scale, offset);
+#else
+   from_f64_scalar(dst, src, n, rawType, scale, offset);
+#endif
+}
+
+static ALWAYS_INLINE int64_t read_raw(unsigned rawType, const void *src, size_t i)
+{
+   switch (rawType)
+   {
+   case RAW_S8: return ((const int8_t*) src)[i];
+   case RAW_U8: return ((const uint8_t*) src)[i];
+   case RAW_S16: return ((const int16_t*) src)[i];
+   case RAW_U16: return ((const uint16_t*) src)[i];
+   case RAW_S32: return ((const int32_t*) src)[i];
+   default: return ((const uint32_t*) src)[i];
+   }
+}
+
+static ALWAYS_INLINE void write_raw(unsigned rawType, void *dst, size_t i, int64_t value)
+{
+   switch (rawType)
+   {
+   case RAW_S8: ((int8_t*) dst)[i] = (int8_t) value; break;
+   case RAW_U8: ((uint8_t*) dst)[i] = (uint8_t) value; break;
+   case RAW_S16: ((int16_t*) dst)[i] = (int16_t) value; break;
+   case RAW_U16: ((uint16_t*) dst)[i] = (uint16_t) value; break;
+   case RAW_S32: ((int32_t*) dst)[i] = (int32_t) value; break;
+   default: ((uint32_t*) dst)[i] = (uint32_t) value; break;
+   }
+}
+
+/**
+ * Rounds x to nearest (ties to even) and saturates it to the range of rawType. NaN becomes 0.
+ * Adding and subtracting 2^23 rounds away the fraction of all smaller magnitudes.
+ */
+static ALWAYS_INLINE int64_t saturate_f32(unsigned rawType, float x)
+{
+   if (x != x)
+   {
+      return 0;
+   }
+   if (x > m_raw_max_f32[rawType])
+   {
+      return m_raw_max[rawType];
+   }
+   if (x < (float) m_raw_min[rawType])
+   {
+      return m_raw_min[rawType];
+   }
+   if (x >= 0.0f)
+   {
+      x = (x < F32_ROUND_LIMIT)? (x + F32_ROUND_LIMIT) - F32_ROUND_LIMIT : x;
+   }
+   else
+   {
+      x = (x > -F32_ROUND_LIMIT)? (x - F32_ROUND_LIMIT) + F32_ROUND_LIMIT : x;
+   }
+   return (int64_t) x;
+}
+
+static ALWAYS_INLINE int64_t saturate_f64(unsigned rawType, double x)
+{
+   if (x != x)
+   {
+      return 0;
+   }
+   if (x > (double) m_raw_max[rawType])
+   {
+      return m_raw_max[rawType];
+   }
+   if (x < (double) m_raw_min[rawType])
+   {
+      return m_raw_min[rawType];
+   }
+   //|x| <= 2^32 here
+   x = (x >= 0.0)? (x + F64_ROUND_LIMIT) - F64_ROUND_LIMIT : (x - F64_ROUND_LIMIT) + F64_ROUND_LIMIT;
+   return (int64_t) x;
+}
+
+/**
+ * The scalar loops start at index i so that the vector kernels can use them for the tail
+ */
+static ALWAYS_INLINE void to_f32_scalar_impl(unsigned rawType, float *dst, const void *src, size_t i, size_t n, float scale, float offset)
+{
+   for (; i < n; i++)
+   {
+      dst[i] = (float) read_raw(rawType, src, i) * scale + offset;
+   }
+}
+
+static ALWAYS_INLINE void to_f64_scalar_impl(unsigned rawType, double *dst, const void *src, size_t i, size_t n, double scale, double offset)
+{
+   for (; i < n; i++)
+   {
+      dst[i] = (double) read_raw(rawType, src, i) * scale + offset;
+   }
+}
+
+static ALWAYS_INLINE void from_f32_scalar_impl(unsigned rawType, void *dst, const float *src, size_t i, size_t n, float scale, float offset)
+{
+   for (; i < n; i++)
+   {
+      write_raw(rawType, dst, i, saturate_f32(rawType, (src[i] - offset) / scale));
+   }
+}
+
+static ALWAYS_INLINE void from_f64_scalar_impl(unsigned rawType, void *dst, const double *src, size_t i, size_t n, double scale, double offset)
+{
+   for (; i < n; i++)
+   {
+      write_raw(rawType, dst, i, saturate_f64(rawType, (src[i] - offset) / scale));
+   }
+}
+
+static void to_f32_scalar(float *dst, const void *src, size_t n, unsigned rawType, float scale, float offset)
+{
+   SPECIALIZE_RAW_TYPE(rawType, to_f32_scalar_impl, dst, src, 0u, n, scale, offset);
+}
+
+static void to_f64_scalar(double *dst, const void *src, size_t n, unsigned rawType, double scale, double offset)
+{
+   SPECIALIZE_RAW_TYPE(rawType, to_f64_scalar_impl, dst, src, 0u, n, scale, offset);
+}
+
+static void from_f32_scalar(void *dst, const float *src, size_t n, unsigned rawType, float scale, float offset)
+{
+   SPECIALIZE_RAW_TYPE(rawType, from_f32_scalar_impl, dst, src, 0u, n, scale, offset);
+}
+
+static void from_f64_scalar(void *dst, const double *src, size_t n, unsigned rawType, double scale, double offset)
+{
+   SPECIALIZE_RAW_TYPE(rawType, from_f64_scalar_impl, dst, src, 0u, n, scale, offset);
+}
+
+#ifdef PACK_SCALE_X86_SIMD
+/**
+ * Loads 8 raw values widened to 32 bits (sign or zero extended)
+ */
+__attribute__((target("avx2")))
+static ALWAYS_INLINE __m256i load8_avx2(unsigned rawType, const void *src, size_t i)
+{
+   switch (rawType)
+   {
+   case RAW_S8: return _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*) &((const int8_t*) src)[i]));
+   case RAW_U8: return _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) &((const uint8_t*) src)[i]));
+   case RAW_S16: return _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*) &((const int16_t*) src)[i]));
+   case RAW_U16: return _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*) &((const uint16_t*) src)[i]));
+   case RAW_S32: return _mm256_loadu_si256((const __m256i*) &((const int32_t*) src)[i]);
+   default: return _mm256_loadu_si256((const __m256i*) &((const uint32_t*) src)[i]);
+   }
+}
+
+/**
+ * Stores 8 values that are already within the range of rawType. The packs work within 128-bit lanes,
+ * the permutes gather the results from both lanes.
+ */
+__attribute__((target("avx2")))
+static ALWAYS_INLINE void store8_avx2(unsigned rawType, void *dst, size_t i, __m256i v)
+{
+   __m256i p;
+   switch (rawType)
+   {
+   case RAW_S8:
+   case RAW_U8:
+      p = _mm256_packs_epi32(v, v);
+      p = (rawType == RAW_S8)? _mm256_packs_epi16(p, p) : _mm256_packus_epi16(p, p);
+      p = _mm256_permutevar8x32_epi32(p, _mm256_setr_epi32(0, 4, 0, 4, 0, 4, 0, 4));
+      _mm_storel_epi64((__m128i*) &((uint8_t*) dst)[i], _mm256_castsi256_si128(p));
+      break;
+   case RAW_S16:
+   case RAW_U16:
+      p = (rawType == RAW_S16)? _mm256_packs_epi32(v, v) : _mm256_packus_epi32(v, v);
+      p = _mm256_permute4x64_epi64(p, 0x08);
+      _mm_storeu_si128((__m128i*) &((uint16_t*) dst)[i], _mm256_castsi256_si128(p));
+      break;
+   default:
+      _mm256_storeu_si256((__m256i*) &((uint32_t*) dst)[i], v);
+      break;
+   }
+}
+
+/**
+ * Unsigned 32-bit values are split into 16-bit halves which convert exactly, so that the final
+ * addition is the only rounding step (as in the scalar conversion).
+ */
+__attribute__((target("avx2")))
+static ALWAYS_INLINE __m256 convert8_ps_avx2(unsigned rawType, __m256i v)
+{
+   if (rawType == RAW_U32)
+   {
+      __m256 hi = _mm256_cvtepi32_ps(_mm256_srli_epi32(v, 16));
+      __m256 lo = _mm256_cvtepi32_ps(_mm256_and_si256(v, _mm256_set1_epi32(0xFFFF)));
+      return _mm256_add_ps(_mm256_mul_ps(hi, _mm256_set1_ps(65536.0f)), lo);
+   }
+   return _mm256_cvtepi32_ps(v);
+}
+
+__attribute__((target("avx2")))
+static ALWAYS_INLINE __m256d convert4_pd_avx2(unsigned rawType, __m128i v)
+{
+   if (rawType == RAW_U32)
+   {
+      //bias into the signed range and back, both steps are exact in double precision
+      __m256d d = _mm256_cvtepi32_pd(_mm_xor_si128(v, _mm_set1_epi32(INT32_MIN)));
+      return _mm256_add_pd(d, _mm256_set1_pd(2147483648.0));
+   }
+   return _mm256_cvtepi32_pd(v);
+}
+
+/**
+ * Vector version of saturate_f32
+ */
+__attribute__((target("avx2")))
+static ALWAYS_INLINE __m256i saturate8_ps_avx2(unsigned rawType, __m256 x)
+{
+   const __m256 maxValue = _mm256_set1_ps(m_raw_max_f32[rawType]);
+   __m256 isAbove;
+   __m256i result;
+   x = _mm256_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+   x = _mm256_and_ps(x, _mm256_cmp_ps(x, x, _CMP_ORD_Q));
+   isAbove = _mm256_cmp_ps(x, maxValue, _CMP_GT_OQ);
+   x = _mm256_max_ps(x, _mm256_set1_ps((float) m_raw_min[rawType]));
+   x = _mm256_min_ps(x, maxValue);
+   if (rawType == RAW_U32)
+   {
+      //vcvtps2dq is signed only: convert values from 2^31 up with the top bit removed
+      const __m256 isHigh = _mm256_cmp_ps(x, _mm256_set1_ps(2147483648.0f), _CMP_GE_OQ);
+      x = _mm256_sub_ps(x, _mm256_and_ps(isHigh, _mm256_set1_ps(2147483648.0f)));
+      result = _mm256_cvtps_epi32(x);
+      result = _mm256_xor_si256(result, _mm256_and_si256(_mm256_castps_si256(isHigh), _mm256_set1_epi32(INT32_MIN)));
+      return _mm256_or_si256(result, _mm256_castps_si256(isAbove));
+   }
+   result = _mm256_cvtps_epi32(x);
+   if (rawType == RAW_S32)
+   {
+      result = _mm256_blendv_epi8(result, _mm256_set1_epi32(INT32_MAX), _mm256_castps_si256(isAbove));
+   }
+   return result;
+}
+
+/**
+ * Vector version of saturate_f64, all limits are exact in double precision
+ */
+__attribute__((target("avx2")))
+static ALWAYS_INLINE __m128i saturate4_pd_avx2(unsigned rawType, __m256d x)
+{
+   x = _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+   x = _mm256_and_pd(x, _mm256_cmp_pd(x, x, _CMP_ORD_Q));
+   x = _mm256_max_pd(x, _mm256_set1_pd((double) m_raw_min[rawType]));
+   x = _mm256_min_pd(x, _mm256_set1_pd((double) m_raw_max[rawType]));
+   if (rawType == RAW_U32)
+   {
+      x = _mm256_sub_pd(x, _mm256_set1_pd(2147483648.0));
+      return _mm_xor_si128(_mm256_cvtpd_epi32(x), _mm_set1_epi32(INT32_MIN));
+   }
+   return _mm256_cvtpd_epi32(x);
+}
+
+__attribute__((target("avx2")))
+static ALWAYS_INLINE void to_f32_avx2_impl(unsigned rawType, float *dst, const void *src, size_t n, float scale, float offset)
+{
+   size_t i = 0u;
+   const __m256 vScale = _mm256_set1_ps(scale);
+   const __m256 vOffset = _mm256_set1_ps(offset);
+   for (; i + 8u <= n; i += 8u)
+   {
+      __m256 x = convert8_ps_avx2(rawType, load8_avx2(rawType, src, i));
+      _mm256_storeu_ps(&dst[i], _mm256_add_ps(_mm256_mul_ps(x, vScale), vOffset));
+   }
+   _mm256_zeroupper();
+   to_f32_scalar_impl(rawType, dst, src, i, n, scale, offset);
+}
+
+__attribute__((target("avx2")))
+static ALWAYS_INLINE void to_f64_avx2_impl(unsigned rawType, double *dst, const void *src, size_t n, double scale, double offset)
+{
+   size_t i = 0u;
+   const __m256d vScale = _mm256_set1_pd(scale);
+   const __m256d vOffset = _mm256_set1_pd(offset);
+   for (; i + 8u <= n; i += 8u)
+   {
+      __m256i v = load8_avx2(rawType, src, i);
+      __m256d x0 = convert4_pd_avx2(rawType, _mm256_castsi256_si128(v));
+      __m256d x1 = convert4_pd_avx2(rawType, _mm256_extracti128_si256(v, 1));
+      _mm256_storeu_pd(&dst[i], _mm256_add_pd(_mm256_mul_pd(x0, vScale), vOffset));
+      _mm256_storeu_pd(&dst[i + 4u], _mm256_add_pd(_mm256_mul_pd(x1, vScale), vOffset));
+   }
+   _mm256_zeroupper();
+   to_f64_scalar_impl(rawType, dst, src, i, n, scale, offset);
+}
+
+__attribute__((target("avx2")))
+static ALWAYS_INLINE void from_f32_avx2_impl(unsigned rawType, void *dst, const float *src, size_t n, float scale, float offset)
+{
+   size_t i = 0u;
+   const __m256 vScale = _mm256_set1_ps(scale);
+   const __m256 vOffset = _mm256_set1_ps(offset);
+   for (; i + 8u <= n; i += 8u)
+   {
+      __m256 x = _mm256_div_ps(_mm256_sub_ps(_mm256_loadu_ps(&src[i]), vOffset), vScale);
+      store8_avx2(rawType, dst, i, saturate8_ps_avx2(rawType, x));
+   }
+   _mm256_zeroupper();
+   from_f32_scalar_impl(rawType, dst, src, i, n, scale, offset);
+}
+
+__attribute__((target("avx2")))
+static ALWAYS_INLINE void from_f64_avx2_impl(unsigned rawType, void *dst, const double *src, size_t n, double scale, double offset)
+{
+   size_t i = 0u;
+   const __m256d vScale = _mm256_set1_pd(scale);
+   const __m256d vOffset = _mm256_set1_pd(offset);
+   for (; i + 8u <= n; i += 8u)
+   {
+      __m256d x0 = _mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(&src[i]), vOffset), vScale);
+      __m256d x1 = _mm256_div_pd(_mm256_sub_pd(_mm256_loadu_pd(&src[i + 4u]), vOffset), vScale);
+      __m256i v = _mm256_setr_m128i(saturate4_pd_avx2(rawType, x0), saturate4_pd_avx2(rawType, x1));
+      store8_avx2(rawType, dst, i, v);
+   }
+   _mm256_zeroupper();
+   from_f64_scalar_impl(rawType, dst, src, i, n, scale, offset);
+}
+
+__attribute__((target("avx2")))
+static void to_f32_avx2(float *dst, const void *src, size_t n, unsigned rawType, float scale, float offset)
+{
+   SPECIALIZE_RAW_TYPE(rawType, to_f32_avx2_impl, dst, src, n, scale, offset);
+}
+
+__attribute__((target("avx2")))
+static void to_f64_avx2(double *dst, const void *src, size_t n, unsigned rawType, double scale, double offset)
+{
+   SPECIALIZE_RAW_TYPE(rawType, to_f64_avx2_impl, dst, src, n, scale, offset);
+}
+
+__attribute__((target("avx2")))
+static void from_f32_avx2(void *dst, const float *src, size_t n, unsigned rawType, float scale, float offset)
+{
+   SPECIALIZE_RAW_TYPE(rawType, from_f32_avx2_impl, dst, src, n, scale, offset);
+}
+
+__attribute__((target("avx2")))
+static void from_f64_avx2(void *dst, const double *src, size_t n, unsigned rawType, double scale, double offset)
+{
+   SPECIALIZE_RAW_TYPE(rawType, from_f64_avx2_impl, dst, src, n, scale, offset);
+}
+#endif
@@ -0,0 +1,267 @@
+/*****************************************************************************
+* \file      pack_signal.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Bit-level signal packing (Intel and Motorola bit order)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include "pack.h"
+#include "pack_signal.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+//A signal of up to 64 bits starting at any bit of a byte spans at most 9 bytes
+#define WINDOW_SIZE 9u
+#define BIT_MASK(len) (((len) >= 64u)? ~(uint64_t) 0u : (((uint64_t) 1u << (len)) - 1u))
+
+/**
+ * Location of a signal expressed as the first byte it touches and the bit offset of its first bit
+ * within a 64-bit word loaded from that byte (counted from the LSB for Intel and from the MSB for Motorola).
+ */
+typedef struct signal_location_tag
+{
+   size_t byteIndex;
+   unsigned shift;
+} signal_location_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static signal_location_t locate(const pack_signal_t *signal);
+static uint64_t get_bits(const uint8_t *w, unsigned shift, uint8_t len, bool isMotorola);
+static void set_bits(uint8_t *w, unsigned shift, uint8_t len, bool isMotorola, uint64_t value);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+bool pack_signal_isValid(const pack_signal_t *signal, size_t frameLen)
+{
+   if ( (signal == 0) || (signal->bitLength == 0u) || (signal->bitLength > 64u) )
+   {
+      return false;
+   }
+   else
+   {
+      signal_location_t loc = locate(signal);
+      return (loc.byteIndex * 8u + loc.shift + signal->bitLength) <= (frameLen * 8u);
+   }
+}
+
+uint64_t pack_signal_get(const pack_signal_t *signal, const uint8_t *frame, size_t frameLen)
+{
+   signal_location_t loc = locate(signal);
+   bool isMotorola = (signal->flags & PACK_SIGNAL_MOTOROLA) != 0u;
+   size_t avail;
+   uint8_t tmp[WINDOW_SIZE];
+   if (loc.byteIndex >= frameLen)
+   {
+      return 0u;
+   }
+   avail = frameLen - loc.byteIndex;
+   if ( (avail >= WINDOW_SIZE) || ((avail >= 8u) && (loc.shift + signal->bitLength <= 64u)) )
+   {
+      return get_bits(&frame[loc.byteIndex], loc.shift, signal->bitLength, isMotorola);
+   }
+   //near the end of the frame, missing bytes read as zero
+   memset(tmp, 0, sizeof(tmp));
+   memcpy(tmp, &frame[loc.byteIndex], avail);
+   return get_bits(tmp, loc.shift, signal->bitLength, isMotorola);
+}
+
+void pack_signal_set(const pack_signal_t *signal, uint8_t *frame, size_t frameLen, uint64_t value)
+{
+   signal_location_t loc = locate(signal);
+   bool isMotorola = (signal->flags & PACK_SIGNAL_MOTOROLA) != 0u;
+   size_t avail;
+   uint8_t tmp[WINDOW_SIZE];
+   if (loc.byteIndex >= frameLen)
+   {
+      return;
+   }
+   avail = frameLen - loc.byteIndex;
+   if ( (avail >= WINDOW_SIZE) || ((avail >= 8u) && (loc.shift + signal->bitLength <= 64u)) )
+   {
+      set_bits(&frame[loc.byteIndex], loc.shift, signal->bitLength, isMotorola, value);
+      return;
+   }
+   memset(tmp, 0, sizeof(tmp));
+   memcpy(tmp, &frame[loc.byteIndex], avail);
+   set_bits(tmp, loc.shift, signal->bitLength, isMotorola, value);
+   memcpy(&frame[loc.byteIndex], tmp, avail);
+}
+
+/**
+ * The frame is copied once into a zero-padded buffer which makes every signal a single unchecked
+ * 64-bit load plus shift and mask.
+ */
+void pack_signal_extract(const pack_signal_t *signals, size_t numSignals, const uint8_t *frame, size_t frameLen, uint64_t *values)
+{
+   size_t i;
+   uint8_t buf[PACK_SIGNAL_MAX_BULK_FRAME_SIZE + WINDOW_SIZE];
+   if ( (signals == 0) || (frame == 0) || (values == 0) )
+   {
+      return;
+   }
+   if (frameLen > PACK_SIGNAL_MAX_BULK_FRAME_SIZE)
+   {
+      for (i = 0u; i < numSignals; i++)
+      {
+         uint64_t value = pack_signal_get(&signals[i], frame, frameLen);
+         values[i] = (signals[i].flags & PACK_SIGNAL_SIGNED)? (uint64_t) pack_signal_signExtend(value, signals[i].bitLength) : value;
+      }
+      return;
+   }
+   memcpy(buf, frame, frameLen);
+   memset(&buf[frameLen], 0, sizeof(buf) - frameLen);
+   for (i = 0u; i < numSignals; i++)
+   {
+      const pack_signal_t *signal = &signals[i];
+      signal_location_t loc = locate(signal);
+      uint64_t value = 0u;
+      if (loc.byteIndex < frameLen)
+      {
+         value = get_bits(&buf[loc.byteIndex], loc.shift, signal->bitLength, (signal->flags & PACK_SIGNAL_MOTOROLA) != 0u);
+      }
+      values[i] = (signal->flags & PACK_SIGNAL_SIGNED)? (uint64_t) pack_signal_signExtend(value, signal->bitLength) : value;
+   }
+}
+
+void pack_signal_insert(const pack_signal_t *signals, size_t numSignals, uint8_t *frame, size_t frameLen, const uint64_t *values)
+{
+   size_t i;
+   uint8_t buf[PACK_SIGNAL_MAX_BULK_FRAME_SIZE + WINDOW_SIZE];
+   if ( (signals == 0) || (frame == 0) || (values == 0) )
+   {
+      return;
+   }
+   if (frameLen > PACK_SIGNAL_MAX_BULK_FRAME_SIZE)
+   {
+      for (i = 0u; i < numSignals; i++)
+      {
+         pack_signal_set(&signals[i], frame, frameLen, values[i]);
+      }
+      return;
+   }
+   memcpy(buf, frame, frameLen);
+   memset(&buf[frameLen], 0, sizeof(buf) - frameLen);
+   for (i = 0u; i < numSignals; i++)
+   {
+      const pack_signal_t *signal = &signals[i];
+      signal_location_t loc = locate(signal);
+      if (loc.byteIndex < frameLen)
+      {
+         set_bits(&buf[loc.byteIndex], loc.shift, signal->bitLength, (signal->flags & PACK_SIGNAL_MOTOROLA) != 0u, values[i]);
+      }
+   }
+   //bits that ended up in the padding are dropped here
+   memcpy(frame, buf, frameLen);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static signal_location_t locate(const pack_signal_t *signal)
+{
+   signal_location_t loc;
+   loc.byteIndex = signal->startBit / 8u;
+   if ( (signal->flags & PACK_SIGNAL_MOTOROLA) != 0u)
+   {
+      //MSB first: bit 7 of a byte comes first, so DBC bit n becomes offset 7 - (n % 8)
+      loc.shift = 7u - (signal->startBit % 8u);
+   }
+   else
+   {
+      loc.shift = signal->startBit % 8u;
+   }
+   return loc;
+}
+
+/**
+ * w must have 8 readable bytes, plus a 9th when shift + len > 64.
+ */
+static uint64_t get_bits(const uint8_t *w, unsigned shift, uint8_t len, bool isMotorola)
+{
+   const uint64_t mask = BIT_MASK(len);
+   if (isMotorola)
+   {
+      uint64_t word = unpack_u64be(w);
+      if (shift + len <= 64u)
+      {
+         return (word >> (64u - shift - len)) & mask;
+      }
+      else
+      {
+         unsigned rem = shift + len - 64u;
+         return ((word & BIT_MASK(64u - shift)) << rem) | (uint64_t) (w[8] >> (8u - rem));
+      }
+   }
+   else
+   {
+      uint64_t value = unpack_u64le(w) >> shift;
+      if (shift + len > 64u)
+      {
+         value |= (uint64_t) w[8] << (64u - shift);
+      }
+      return value & mask;
+   }
+}
+
+static void set_bits(uint8_t *w, unsigned shift, uint8_t len, bool isMotorola, uint64_t value)
+{
+   const uint64_t mask = BIT_MASK(len);
+   value &= mask;
+   if (isMotorola)
+   {
+      uint64_t word = unpack_u64be(w);
+      if (shift + len <= 64u)
+      {
+         unsigned pos = 64u - shift - len;
+         word = (word & ~(mask << pos)) | (value << pos);
+      }
+      else
+      {
+         unsigned rem = shift + len - 64u;
+         word = (word & ~BIT_MASK(64u - shift)) | (value >> rem);
+         w[8] = (uint8_t) ((w[8] & (0xFFu >> rem)) | ((value & BIT_MASK(rem)) << (8u - rem)));
+      }
+      pack_u64be(w, word);
+   }
+   else
+   {
+      uint64_t word = unpack_u64le(w);
+      word = (word & ~(mask << shift)) | (value << shift);
+      pack_u64le(w, word);
+      if (shift + len > 64u)
+      {
+         unsigned rem = shift + len - 64u;
+         w[8] = (uint8_t) ((w[8] & ~BIT_MASK(rem)) | (value >> (64u - shift)));
+      }
+   }
+}
@@ -0,0 +1,404 @@
+/*****************************************************************************
+* \file      pack_struct.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Table-driven serialization of C structs
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include "pack.h"
+#include "pack_struct.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define OP_COPY    0u
+#define OP_SWAP    1u
+#define OP_CONVERT 2u
+
+//number of structs processed per pass over the operations (keeps the block in L1 cache)
+#define BLOCK_SIZE 64u
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static bool is_valid_field(const pack_field_t *field);
+static uint8_t classify_field(const pack_field_t *field);
+static void run_op(const pack_op_t *op, uint8_t *dst, size_t dstStride, const uint8_t *src, size_t srcStride,
+                   size_t n, bool isPack);
+static void swap_elements(uint8_t *dst, size_t dstStride, const uint8_t *src, size_t srcStride, size_t n,
+                          uint32_t count, uint8_t width);
+static uint64_t load_member(const uint8_t *src, uint8_t size);
+static void store_member(uint8_t *dst, uint8_t size, uint64_t value);
+static void convert_pack(uint8_t *dst, const uint8_t *src, const pack_op_t *op);
+static void convert_unpack(uint8_t *dst, const uint8_t *src, const pack_op_t *op);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compiles the field table into a plan.
+ * Returns 0 on success, -1 on failure (errno is EINVAL for an invalid table and ENOMEM when out of memory).
+ */
+int pack_plan_create(pack_plan_t *self, const pack_field_t *fields, size_t numFields)
+{
+   size_t i;
+   uint32_t wireOffset = 0u;
+   if ( (self == 0) || (fields == 0) || (numFields == 0u) )
+   {
+      errno = EINVAL;
+      return -1;
+   }
+   for (i = 0u; i < numFields; i++)
+   {
+      if (!is_valid_field(&fields[i]))
+      {
+         errno = EINVAL;
+         return -1;
+      }
+   }
+   self->ops = (pack_op_t*) malloc(numFields * sizeof(pack_op_t));
+   if (self->ops == 0)
+   {
+      errno = ENOMEM;
+      return -1;
+   }
+   self->numOps = 0u;
+   for (i = 0u; i < numFields; i++)
+   {
+      const pack_field_t *field = &fields[i];
+      uint8_t type = classify_field(field);
+      pack_op_t *prev = (self->numOps > 0u)? &self->ops[self->numOps - 1u] : (pack_op_t*) 0;
+      if ( (prev != 0) && (prev->type == type) && (type == OP_COPY) &&
+           (prev->structOffset + prev->count == field->offset) )
+      {
+         prev->count += field->memberSize;
+      }
+      else if ( (prev != 0) && (prev->type == type) && (type == OP_SWAP) &&
+                (prev->memberSize == field->memberSize) &&
+                (prev->structOffset + prev->count * prev->memberSize == field->offset) )
+      {
+         prev->count++;
+      }
+      else
+      {
+         pack_op_t *op = &self->ops[self->numOps++];
+         op->type = type;
+         op->memberSize = field->memberSize;
+         op->wireSize = field->wireSize;
+         op->flags = field->flags;
+         op->count = (type == OP_COPY)? field->memberSize : 1u;
+         op->structOffset = field->offset;
+         op->wireOffset = wireOffset;
+      }
+      wireOffset += field->wireSize;
+   }
+   self->wireSize = wireOffset;
+   return 0;
+}
+
+void pack_plan_destroy(pack_plan_t *self)
+{
+   if (self != 0)
+   {
+      if (self->ops != 0)
+      {
+         free(self->ops);
+         self->ops = (pack_op_t*) 0;
+      }
+      self->numOps = 0u;
+      self->wireSize = 0u;
+   }
+}
+
+/**
+ * Serializes count structs located stride bytes apart into dst.
+ * Returns number of bytes written (count * wireSize).
+ */
+size_t pack_plan_pack(const pack_plan_t *self, uint8_t *dst, const void *src, size_t count, size_t stride)
+{
+   size_t i;
+   const uint8_t *structPtr = (const uint8_t*) src;
+   if ( (self == 0) || (dst == 0) || (src == 0) )
+   {
+      return 0u;
+   }
+   if ( (self->numOps == 1u) && (self->ops[0].type == OP_COPY) && (stride == self->wireSize) )
+   {
+      //wire format is identical to the memory layout of the array
+      memcpy(dst, structPtr + self->ops[0].structOffset, count * stride);
+      return count * stride;
+   }
+   for (i = 0u; i < count; i += BLOCK_SIZE)
+   {
+      size_t j;
+      size_t blockLen = (count - i < BLOCK_SIZE)? count - i : BLOCK_SIZE;
+      for (j = 0u; j < self->numOps; j++)
+      {
+         run_op(&self->ops[j], dst + self->ops[j].wireOffset, self->wireSize,
+                structPtr + self->ops[j].structOffset, stride, blockLen, true);
+      }
+      dst += blockLen * self->wireSize;
+      structPtr += blockLen * stride;
+   }
+   return count * self->wireSize;
+}
+
+/**
+ * Deserializes count structs from src into dst (structs located stride bytes apart).
+ * Struct bytes not covered by the field table are left untouched.
+ * Returns number of bytes read (count * wireSize).
+ */
+size_t pack_plan_unpack(const pack_plan_t *self, void *dst, size_t count, size_t stride, const uint8_t *src)
+{
+   size_t i;
+   uint8_t *structPtr = (uint8_t*) dst;
+   if ( (self == 0) || (dst == 0) || (src == 0) )
+   {
+      return 0u;
+   }
+   if ( (self->numOps == 1u) && (self->ops[0].type == OP_COPY) && (stride == self->wireSize) )
+   {
+      memcpy(structPtr + self->ops[0].structOffset, src, count * stride);
+      return count * stride;
+   }
+   for (i = 0u; i < count; i += BLOCK_SIZE)
+   {
+      size_t j;
+      size_t blockLen = (count - i < BLOCK_SIZE)? count - i : BLOCK_SIZE;
+      for (j = 0u; j < self->numOps; j++)
+      {
+         run_op(&self->ops[j], structPtr + self->ops[j].structOffset, stride,
+                src + self->ops[j].wireOffset, self->wireSize, blockLen, false);
+      }
+      src += blockLen * self->wireSize;
+      structPtr += blockLen * stride;
+   }
+   return count * self->wireSize;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static bool is_valid_field(const pack_field_t *field)
+{
+   uint8_t size = field->memberSize;
+   if ( (size != 1u) && (size != 2u) && (size != 4u) && (size != 8u) )
+   {
+      return false;
+   }
+   return (field->wireSize >= 1u) && (field->wireSize <= size);
+}
+
+static uint8_t classify_field(const pack_field_t *field)
+{
+   if (field->wireSize != field->memberSize)
+   {
+      return OP_CONVERT;
+   }
+   if (field->memberSize == 1u)
+   {
+      return OP_COPY;
+   }
+#if defined(_PACK_NATIVE_ORDER)
+   {
+      bool isBigEndian = (field->flags & PACK_FIELD_BIG_ENDIAN) != 0u;
+      bool isNativeBigEndian = (_PACK_NATIVE_ORDER == PLATFORM_BIG_ENDIAN);
+      return (isBigEndian == isNativeBigEndian)? OP_COPY : OP_SWAP;
+   }
+#else
+   return OP_CONVERT;
+#endif
+}
+
+/**
+ * Applies one operation to n consecutive structs. Running each operation over a block of
+ * structs (rather than all operations over one struct) keeps the inner loops free of dispatch.
+ */
+static void run_op(const pack_op_t *op, uint8_t *dst, size_t dstStride, const uint8_t *src, size_t srcStride,
+                   size_t n, bool isPack)
+{
+   size_t i;
+   switch (op->type)
+   {
+   case OP_COPY:
+      for (i = 0u; i < n; i++)
+      {
+         memcpy(&dst[i * dstStride], &src[i * srcStride], op->count);
+      }
+      break;
+   case OP_SWAP:
+      swap_elements(dst, dstStride, src, srcStride, n, op->count, op->memberSize);
+      break;
+   default:
+      for (i = 0u; i < n; i++)
+      {
+         if (isPack)
+         {
+            convert_pack(&dst[i * dstStride], &src[i * srcStride], op);
+         }
+         else
+         {
+            convert_unpack(&dst[i * dstStride], &src[i * srcStride], op);
+         }
+      }
+      break;
+   }
+}
+
+static void swap_elements(uint8_t *dst, size_t dstStride, const uint8_t *src, size_t srcStride, size_t n,
+                          uint32_t count, uint8_t width)
+{
+   size_t i;
+   uint32_t j;
+   switch (width)
+   {
+   case 2u:
+      for (i = 0u; i < n; i++)
+      {
+         for (j = 0u; j < count; j++)
+         {
+            uint16_t value;
+            memcpy(&value, &src[i * srcStride + j * 2u], 2u);
+            value = _PACK_BSWAP16(value);
+            memcpy(&dst[i * dstStride + j * 2u], &value, 2u);
+         }
+      }
+      break;
+   case 4u:
+      for (i = 0u; i < n; i++)
+      {
+         for (j = 0u; j < count; j++)
+         {
+            uint32_t value;
+            memcpy(&value, &src[i * srcStride + j * 4u], 4u);
+            value = _PACK_BSWAP32(value);
+            memcpy(&dst[i * dstStride + j * 4u], &value, 4u);
+         }
+      }
+      break;
+   default:
+      for (i = 0u; i < n; i++)
+      {
+         for (j = 0u; j < count; j++)
+         {
+            uint64_t value;
+            memcpy(&value, &src[i * srcStride + j * 8u], 8u);
+            value = _PACK_BSWAP64(value);
+            memcpy(&dst[i * dstStride + j * 8u], &value, 8u);
+         }
+      }
+      break;
+   }
+}
+
+static uint64_t load_member(const uint8_t *src, uint8_t size)
+{
+   switch (size)
+   {
+   case 1u:
+      return *src;
+   case 2u:
+   {
+      uint16_t value;
+      memcpy(&value, src, 2u);
+      return value;
+   }
+   case 4u:
+   {
+      uint32_t value;
+      memcpy(&value, src, 4u);
+      return value;
+   }
+   default:
+   {
+      uint64_t value;
+      memcpy(&value, src, 8u);
+      return value;
+   }
+   }
+}
+
+static void store_member(uint8_t *dst, uint8_t size, uint64_t value)
+{
+   switch (size)
+   {
+   case 1u:
+      *dst = (uint8_t) value;
+      break;
+   case 2u:
+   {
+      uint16_t tmp = (uint16_t) value;
+      memcpy(dst, &tmp, 2u);
+      break;
+   }
+   case 4u:
+   {
+      uint32_t tmp = (uint32_t) value;
+      memcpy(dst, &tmp, 4u);
+      break;
+   }
+   default:
+      memcpy(dst, &value, 8u);
+      break;
+   }
+}
+
+static void convert_pack(uint8_t *dst, const uint8_t *src, const pack_op_t *op)
+{
+   uint8_t i;
+   uint64_t value = load_member(src, op->memberSize);
+   bool isBigEndian = (op->flags & PACK_FIELD_BIG_ENDIAN) != 0u;
+   for (i = 0u; i < op->wireSize; i++)
+   {
+      dst[isBigEndian? (op->wireSize - 1u - i) : i] = (uint8_t) (value >> (i * 8u));
+   }
+}
+
+static void convert_unpack(uint8_t *dst, const uint8_t *src, const pack_op_t *op)
+{
+   uint8_t i;
+   uint64_t value = 0u;
+   bool isBigEndian = (op->flags & PACK_FIELD_BIG_ENDIAN) != 0u;
+   for (i = 0u; i < op->wireSize; i++)
+   {
+      value |= (uint64_t) src[isBigEndian? (op->wireSize - 1u - i) : i] << (i * 8u);
+   }
+   if ( ((op->flags & PACK_FIELD_SIGNED) != 0u) && (op->wireSize < 8u) )
+   {
+      uint64_t signBit = (uint64_t) 1u << (op->wireSize * 8u - 1u);
+      if ( (value & signBit) != 0u)
+      {
+         value |= ~((signBit << 1) - 1u);
+      }
+   }
+   store_member(dst, op->memberSize, value);
+}
@@ -0,0 +1,743 @@
+/*****************************************************************************
+* \file      pack_varint.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Variable-length integer encoding (LEB128, zigzag and stream-vbyte)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include "pack_varint.h"
+#include "cutil_cpu.h"
+#if defined(__SSE2__) || defined(_M_X64)
+#define PACK_VARINT_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PACK_VARINT_SSSE3
+#include <immintrin.h>
+#endif
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define CONTINUATION_BIT 0x80u
+#define PAYLOAD_MASK 0x7Fu
+
+//Decodes numGroups groups of four values, returns number of groups actually decoded
+typedef size_t (svb_decode_func_t)(uint32_t *dst, size_t numGroups, const uint8_t *ctrl,
+                                   const uint8_t **data, const uint8_t *end);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+#ifdef PACK_VARINT_SSE2
+static unsigned count_trailing_zeros(unsigned value);
+#endif
+static size_t svb_value_size(uint32_t value);
+static size_t svb_decode_scalar(uint32_t *dst, size_t numGroups, const uint8_t *ctrl,
+                                const uint8_t **data, const uint8_t *end);
+static size_t svb_decode_value(uint32_t *dst, uint8_t code, const uint8_t *data);
+#ifdef PACK_VARINT_SSSE3
+static size_t svb_decode_ssse3(uint32_t *dst, size_t numGroups, const uint8_t *ctrl,
+                               const uint8_t **data, const uint8_t *end);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+#ifdef PACK_VARINT_SSSE3
+//indexed by control byte: pshufb mask expanding the data bytes of four values to four uint32
+//(value i of the group takes ((key >> (2 * i)) & 3) + 1 bytes, 0x80 clears the unused bytes)
+static const uint8_t m_svb_shuffle[256][16] =
+{
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80, 0x09, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80, 0x09, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x08, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x09, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x0A, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80, 0x0A, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x08, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x09, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x0A, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80, 0x0B, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x80, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x80, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x08, 0x09, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x08, 0x09, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80, 0x09, 0x0A, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80, 0x09, 0x0A, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x09, 0x0A, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x0A, 0x0B, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0A, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0A, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80, 0x0A, 0x0B, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0A, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x0A, 0x0B, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80, 0x0B, 0x0C, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x80, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x80, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x08, 0x09, 0x0A, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x08, 0x09, 0x0A, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80, 0x09, 0x0A, 0x0B, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x0A, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x0A, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80, 0x09, 0x0A, 0x0B, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x0A, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x09, 0x0A, 0x0B, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x0A, 0x0B, 0x0C, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0A, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0A, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0A, 0x0B, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0A, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0A, 0x0B, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80, 0x0A, 0x0B, 0x0C, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0A, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0A, 0x0B, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x0A, 0x0B, 0x0C, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80, 0x0B, 0x0C, 0x0D, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x80},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x80},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x80},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x80},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0A},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0A},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80, 0x08, 0x09, 0x0A, 0x0B},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0A},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x08, 0x09, 0x0A, 0x0B},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80, 0x09, 0x0A, 0x0B, 0x0C},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0A},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0A},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x0A, 0x0B},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0A},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x0A, 0x0B},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x80, 0x80, 0x09, 0x0A, 0x0B, 0x0C},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x07, 0x08, 0x09, 0x0A},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x08, 0x09, 0x0A, 0x0B},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x09, 0x0A, 0x0B, 0x0C},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x0A, 0x0B, 0x0C, 0x0D},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x08},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x09},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0A},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0A, 0x0B},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x09},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0A},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0A, 0x0B},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0A, 0x0B, 0x0C},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0A},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0A, 0x0B},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0A, 0x0B, 0x0C},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x80, 0x0A, 0x0B, 0x0C, 0x0D},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x08, 0x09, 0x0A, 0x0B},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x09, 0x0A, 0x0B, 0x0C},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x0A, 0x0B, 0x0C, 0x0D},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x80, 0x0B, 0x0C, 0x0D, 0x0E},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E},
+   {0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C},
+   {0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D},
+   {0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E},
+   {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F}
+};
+//indexed by control byte: total number of data bytes for the group
+static const uint8_t m_svb_length[256] =
+{
+    4,  5,  6,  7,  5,  6,  7,  8,  6,  7,  8,  9,  7,  8,  9, 10,
+    5,  6,  7,  8,  6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,
+    6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12,
+    7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13,
+    5,  6,  7,  8,  6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,
+    6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12,
+    7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13,
+    8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14,
+    6,  7,  8,  9,  7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12,
+    7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13,
+    8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14,
+    9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14, 12, 13, 14, 15,
+    7,  8,  9, 10,  8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13,
+    8,  9, 10, 11,  9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14,
+    9, 10, 11, 12, 10, 11, 12, 13, 11, 12, 13, 14, 12, 13, 14, 15,
+   10, 11, 12, 13, 11, 12, 13, 14, 12, 13, 14, 15, 13, 14, 15, 16
+};
+static const cutil_cpu_variant_t m_svb_variants[] =
+{
+   {"ssse3", CUTIL_CPU_SSSE3, (cutil_cpu_func_t*) svb_decode_ssse3},
+   {"scalar", 0u, (cutil_cpu_func_t*) svb_decode_scalar}
+};
+static cutil_cpu_dispatch_t m_svb_dispatch = CUTIL_CPU_DISPATCH_INIT(m_svb_variants);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+size_t packVarintU32(uint8_t *dst, uint32_t value)
+{
+   size_t i = 0u;
+   while (value >= CONTINUATION_BIT)
+   {
+      dst[i++] = (uint8_t) (value | CONTINUATION_BIT);
+      value >>= 7;
+   }
+   dst[i++] = (uint8_t) value;
+   return i;
+}
+
+size_t packVarintU64(uint8_t *dst, uint64_t value)
+{
+   size_t i = 0u;
+   while (value >= CONTINUATION_BIT)
+   {
+      dst[i++] = (uint8_t) (value | CONTINUATION_BIT);
+      value >>= 7;
+   }
+   dst[i++] = (uint8_t) value;
+   return i;
+}
+
+size_t packVarintS32(uint8_t *dst, int32_t value)
+{
+   return packVarintU32(dst, zigzagEncode32(value));
+}
+
+size_t packVarintS64(uint8_t *dst, int64_t value)
+{
+   return packVarintU64(dst, zigzagEncode64(value));
+}
+
+size_t unpackVarintU32(const uint8_t *src, size_t len, uint32_t *value)
+{
+   size_t i;
+   uint32_t result = 0u;
+   for (i = 0u; (i < len) && (i < VARINT_MAX_SIZE_U32); i++)
+   {
+      uint8_t b = src[i];
+      if ( (i == (VARINT_MAX_SIZE_U32 - 1u)) && (b > 0x0Fu) )
+      {
+         return 0u; //more than 32 bits or too many bytes
+      }
+      result |= (uint32_t) (b & PAYLOAD_MASK) << (i * 7u);
+      if ( (b & CONTINUATION_BIT) == 0u)
+      {
+         *value = result;
+         return i + 1u;
+      }
+   }
+   return 0u;
+}
+
+size_t unpackVarintU64(const uint8_t *src, size_t len, uint64_t *value)
+{
+   size_t i;
+   uint64_t result = 0u;
+   for (i = 0u; (i < len) && (i < VARINT_MAX_SIZE_U64); i++)
+   {
+      uint8_t b = src[i];
+      if ( (i == (VARINT_MAX_SIZE_U64 - 1u)) && (b > 0x01u) )
+      {
+         return 0u;
+      }
+      result |= (uint64_t) (b & PAYLOAD_MASK) << (i * 7u);
+      if ( (b & CONTINUATION_BIT) == 0u)
+      {
+         *value = result;
+         return i + 1u;
+      }
+   }
+   return 0u;
+}
+
+size_t unpackVarintS32(const uint8_t *src, size_t len, int32_t *value)
+{
+   uint32_t tmp;
+   size_t result = unpackVarintU32(src, len, &tmp);
+   if (result > 0u)
+   {
+      *value = zigzagDecode32(tmp);
+   }
+   return result;
+}
+
+size_t unpackVarintS64(const uint8_t *src, size_t len, int64_t *value)
+{
+   uint64_t tmp;
+   size_t result = unpackVarintU64(src, len, &tmp);
+   if (result > 0u)
+   {
+      *value = zigzagDecode64(tmp);
+   }
+   return result;
+}
+
+size_t varintSizeU32(uint32_t value)
+{
+   size_t size = 1u;
+   while (value >= CONTINUATION_BIT)
+   {
+      value >>= 7;
+      size++;
+   }
+   return size;
+}
+
+size_t varintSizeU64(uint64_t value)
+{
+   size_t size = 1u;
+   while (value >= CONTINUATION_BIT)
+   {
+      value >>= 7;
+      size++;
+   }
+   return size;
+}
+
+size_t packVarintArrayU32(uint8_t *dst, const uint32_t *src, size_t n)
+{
+   size_t i;
+   size_t offset = 0u;
+   for (i = 0u; i < n; i++)
+   {
+      offset += packVarintU32(&dst[offset], src[i]);
+   }
+   return offset;
+}
+
+/**
+ * Loads 16 bytes at a time and uses the continuation bits to locate all values that end inside
+ * the window. A window of single-byte values (the common case) is widened in one go, other
+ * values are assembled directly from the known length. Anything not handled by the window
+ * (last bytes of input, values crossing the window end or invalid values) goes to the scalar decoder.
+ */
+size_t unpackVarintArrayU32(uint32_t *dst, size_t n, const uint8_t *src, size_t len)
+{
+   size_t i = 0u;
+   size_t offset = 0u;
+   while (i < n)
+   {
+      size_t size;
+#ifdef PACK_VARINT_SSE2
+      if (offset + 16u <= len)
+      {
+         __m128i bytes = _mm_loadu_si128((const __m128i*) &src[offset]);
+         unsigned terminators = ~(unsigned) _mm_movemask_epi8(bytes) & 0xFFFFu;
+         unsigned pos = 0u;
+         if ( (terminators == 0xFFFFu) && (i + 16u <= n) )
+         {
+            const __m128i zero = _mm_setzero_si128();
+            __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+            __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+            _mm_storeu_si128((__m128i*) &dst[i], _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128((__m128i*) &dst[i + 4u], _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128((__m128i*) &dst[i + 8u], _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128((__m128i*) &dst[i + 12u], _mm_unpackhi_epi16(hi, zero));
+            i += 16u;
+            offset += 16u;
+            continue;
+         }
+         while ( (terminators != 0u) && (i < n) )
+         {
+            const uint8_t *p = &src[offset + pos];
+            unsigned last = count_trailing_zeros(terminators);
+            uint32_t value = p[0] & PAYLOAD_MASK;
+            if ( ((last - pos) >= VARINT_MAX_SIZE_U32) ||
+                 (((last - pos) == (VARINT_MAX_SIZE_U32 - 1u)) && (p[4] > 0x0Fu)) )
+            {
+               break; //let the scalar decoder report the error
+            }
+            switch (last - pos)
+            {
+            case 0u:
+               break;
+            case 1u:
+               value |= (uint32_t) p[1] << 7;
+               break;
+            case 2u:
+               value |= ((uint32_t) (p[1] & PAYLOAD_MASK) << 7) | ((uint32_t) p[2] << 14);
+               break;
+            case 3u:
+               value |= ((uint32_t) (p[1] & PAYLOAD_MASK) << 7) | ((uint32_t) (p[2] & PAYLOAD_MASK) << 14) |
+                        ((uint32_t) p[3] << 21);
+               break;
+            default:
+               value |= ((uint32_t) (p[1] & PAYLOAD_MASK) << 7) | ((uint32_t) (p[2] & PAYLOAD_MASK) << 14) |
+                        ((uint32_t) (p[3] & PAYLOAD_MASK) << 21) | ((uint32_t) p[4] << 28);
+               break;
+            }
+            dst[i++] = value;
+            pos = last + 1u;
+            terminators &= terminators - 1u;
+         }
+         offset += pos;
+         if ( (pos > 0u) || (i == n) )
+         {
+            continue;
+         }
+      }
+#endif
+      size = unpackVarintU32(&src[offset], len - offset, &dst[i]);
+      if (size == 0u)
+      {
+         return 0u;
+      }
+      offset += size;
+      i++;
+   }
+   return offset;
+}
+
+size_t streamvbyteEncode(uint8_t *dst, const uint32_t *src, size_t n)
+{
+   size_t i;
+   uint8_t *ctrl = dst;
+   uint8_t *data = dst + (n + 3u) / 4u;
+   if (n > 0u)
+   {
+      memset(ctrl, 0, (n + 3u) / 4u);
+   }
+   for (i = 0u; i < n; i++)
+   {
+      uint32_t value = src[i];
+      size_t size = svb_value_size(value);
+      size_t j;
+      ctrl[i / 4u] |= (uint8_t) ((size - 1u) << ((i % 4u) * 2u));
+      for (j = 0u; j < size; j++)
+      {
+         *data++ = (uint8_t) (value >> (j * 8u));
+      }
+   }
+   return (size_t) (data - dst);
+}
+
+size_t streamvbyteDecode(uint32_t *dst, size_t n, const uint8_t *src, size_t len)
+{
+   size_t numGroups = n / 4u;
+   size_t numDecoded = 0u;
+   const size_t ctrlLen = (n + 3u) / 4u;
+   const uint8_t *end = src + len;
+   const uint8_t *data;
+   if (ctrlLen > len)
+   {
+      return 0u;
+   }
+   data = src + ctrlLen;
+#ifdef PACK_VARINT_SSSE3
+   {
+      svb_decode_func_t *func = (svb_decode_func_t*) cutil_cpu_resolve(&m_svb_dispatch);
+      numDecoded = func(dst, numGroups, src, &data, end);
+   }
+#endif
+   if (svb_decode_scalar(&dst[numDecoded * 4u], numGroups - numDecoded, &src[numDecoded], &data, end) != (numGroups - numDecoded))
+   {
+      return 0u;
+   }
+   if ( (n % 4u) != 0u)
+   {
+      //the last (partial) group
+      size_t i;
+      uint8_t key = src[numGroups];
+      for (i = numGroups * 4u; i < n; i++)
+      {
+         uint8_t code = key & 3u;
+         if ( (size_t) (end - data) < (size_t) (code + 1u))
+         {
+            return 0u;
+         }
+         data += svb_decode_value(&dst[i], code, data);
+         key >>= 2;
+      }
+   }
+   return (size_t) (data - src);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+#ifdef PACK_VARINT_SSE2
+static unsigned count_trailing_zeros(unsigned value)
+{
+#ifdef _MSC_VER
+   unsigned long index;
+   _BitScanForward(&index, value);
+   return (unsigned) index;
+#else
+   return (unsigned) __builtin_ctz(value);
+#endif
+}
+#endif
+
+static size_t svb_value_size(uint32_t value)
+{
+   if (value < (1u << 8))
+   {
+      return 1u;
+   }
+   if (value < (1u << 16))
+   {
+      return 2u;
+   }
+   if (value < (1u << 24))
+   {
+      return 3u;
+   }
+   return 4u;
+}
+
+static size_t svb_decode_value(uint32_t *dst, uint8_t code, const uint8_t *data)
+{
+   uint32_t value = data[0];
+   if (code >= 1u)
+   {
+      value |= (uint32_t) data[1] << 8;
+   }
+   if (code >= 2u)
+   {
+      value |= (uint32_t) data[2] << 16;
+   }
+   if (code >= 3u)
+   {
+      value |= (uint32_t) data[3] << 24;
+   }
+   *dst = value;
+   return (size_t) code + 1u;
+}
+
+static size_t svb_decode_scalar(uint32_t *dst, size_t numGroups, const uint8_t *ctrl,
+                                const uint8_t **data, const uint8_t *end)
+{
+   size_t g;
+   const uint8_t *p = *data;
+   for (g = 0u; g < numGroups; g++)
+   {
+      uint8_t key = ctrl[g];
+      size_t groupLen = (size_t) (key & 3u) + ((key >> 2) & 3u) + ((key >> 4) & 3u) + (key >> 6) + 4u;
+      size_t i;
+      if ( (size_t) (end - p) < groupLen)
+      {
+         break;
+      }
+      for (i = 0u; i < 4u; i++)
+      {
+         p += svb_decode_value(&dst[g * 4u + i], key & 3u, p);
+         key >>= 2;
+      }
+   }
+   *data = p;
+   return g;
+}
+
+#ifdef PACK_VARINT_SSSE3
+/**
+ * Decodes a group as long as a full 16-byte load from the data pointer stays within the input.
+ */
+__attribute__((target("ssse3")))
+static size_t svb_decode_ssse3(uint32_t *dst, size_t numGroups, const uint8_t *ctrl,
+                               const uint8_t **data, const uint8_t *end)
+{
+   size_t g;
+   const uint8_t *p = *data;
+   for (g = 0u; (g < numGroups) && ((size_t) (end - p) >= 16u); g++)
+   {
+      uint8_t key = ctrl[g];
+      __m128i bytes = _mm_loadu_si128((const __m128i*) p);
+      __m128i mask = _mm_loadu_si128((const __m128i*) m_svb_shuffle[key]);
+      _mm_storeu_si128((__m128i*) &dst[g * 4u], _mm_shuffle_epi8(bytes, mask));
+      p += m_svb_length[key];
+   }
+   *data = p;
+   return g;
+}
+#endif
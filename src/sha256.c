@@ -30,30 +30,71 @@
 //////////////////////////////////////////////////////////////////////////////
 // INCLUDES
 //////////////////////////////////////////////////////////////////////////////
+#include <stdbool.h>
 #include <string.h>
 #include "sha256.h"
+#include "pack.h"
+#include "crc.h"
+#include "cutil_cpu.h"
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SHA256_X86_SIMD
+#include <immintrin.h>
+#endif
 
 //////////////////////////////////////////////////////////////////////////////
 // PRIVATE CONSTANTS AND DATA TYPES
 //////////////////////////////////////////////////////////////////////////////
 
-#define CHUNK_SIZE 64
 #define TOTAL_LEN_LEN 8
+#define TOTAL_LEN_LEN512 16
 
-struct buffer_state {
-   const uint8_t * p;
-   size_t len;
-   size_t total_len;
-   int single_one_delivered;
-   int total_len_delivered;
-};
+#define MAX_LANES 16u
+
+//Compresses numBlocks consecutive 64-byte blocks into h
+typedef void (compress_func_t)(uint32_t h[8], const uint8_t *data, size_t numBlocks);
+
+//Compresses one block per lane, state is stored as [8][numLanes] and w (message words) as [16][numLanes]
+typedef void (compress_lanes_func_t)(uint32_t *state, const uint32_t *w);
+
+typedef void (calc_many_func_t)(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n);
+
+/**
+ * A message being hashed in one lane of sha256_calc_many. Full blocks are read from the caller's
+ * buffer, the final one or two blocks (remaining bytes, padding and length) are built in tail.
+ */
+typedef struct sha256_lane_tag
+{
+   const uint8_t *data;
+   size_t num_full;
+   size_t message;
+   uint8_t tail[2u * SHA256_BLOCK_SIZE];
+   unsigned num_tail;
+   unsigned tail_index;
+   bool is_active;
+} sha256_lane_t;
 
 //////////////////////////////////////////////////////////////////////////////
 // PRIVATE FUNCTION PROTOTYPES
 //////////////////////////////////////////////////////////////////////////////
 static inline uint32_t right_rot(uint32_t value, unsigned int count);
-static void init_buf_state(struct buffer_state * state, const void * input, size_t len);
-static int calc_chunk(uint8_t chunk[CHUNK_SIZE], struct buffer_state * state);
+static void compress_blocks(uint32_t h[8], const uint8_t *data, size_t numBlocks);
+static void compress_blocks_scalar(uint32_t h[8], const uint8_t *data, size_t numBlocks);
+static void sha512_start(sha512_ctx_t *ctx, const uint64_t initialState[8], size_t hashLen);
+static inline uint64_t right_rot64(uint64_t value, unsigned int count);
+static void compress_blocks512(uint64_t h[8], const uint8_t *data, size_t numBlocks);
+static void calc_many_scalar(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n);
+static void calc_many_lanes(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n,
+                            unsigned numLanes, compress_lanes_func_t *compress);
+static void start_lane(sha256_lane_t *lane, uint32_t *state, unsigned numLanes, unsigned laneIndex, size_t message, const void *input, size_t len);
+#ifdef SHA256_X86_SIMD
+static void compress_blocks_shani(uint32_t h[8], const uint8_t *data, size_t numBlocks);
+static void calc_many_sse2(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n);
+static void calc_many_avx2(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n);
+static void calc_many_avx512(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n);
+static void compress_lanes_sse2(uint32_t *state, const uint32_t *w);
+static void compress_lanes_avx2(uint32_t *state, const uint32_t *w);
+static void compress_lanes_avx512(uint32_t *state, const uint32_t *w);
+#endif
 
 //////////////////////////////////////////////////////////////////////////////
 // PRIVATE VARIABLES
@@ -68,31 +109,365 @@ static const uint32_t k[] = {
    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
 };
+
+static const uint32_t m_initial_state[8] = {
+   0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static const uint64_t k512[80] = {
+   0x428a2f98d728ae22ull, 0x7137449123ef65cdull, 0xb5c0fbcfec4d3b2full, 0xe9b5dba58189dbbcull,
+   0x3956c25bf348b538ull, 0x59f111f1b605d019ull, 0x923f82a4af194f9bull, 0xab1c5ed5da6d8118ull,
+   0xd807aa98a3030242ull, 0x12835b0145706fbeull, 0x243185be4ee4b28cull, 0x550c7dc3d5ffb4e2ull,
+   0x72be5d74f27b896full, 0x80deb1fe3b1696b1ull, 0x9bdc06a725c71235ull, 0xc19bf174cf692694ull,
+   0xe49b69c19ef14ad2ull, 0xefbe4786384f25e3ull, 0x0fc19dc68b8cd5b5ull, 0x240ca1cc77ac9c65ull,
+   0x2de92c6f592b0275ull, 0x4a7484aa6ea6e483ull, 0x5cb0a9dcbd41fbd4ull, 0x76f988da831153b5ull,
+   0x983e5152ee66dfabull, 0xa831c66d2db43210ull, 0xb00327c898fb213full, 0xbf597fc7beef0ee4ull,
+   0xc6e00bf33da88fc2ull, 0xd5a79147930aa725ull, 0x06ca6351e003826full, 0x142929670a0e6e70ull,
+   0x27b70a8546d22ffcull, 0x2e1b21385c26c926ull, 0x4d2c6dfc5ac42aedull, 0x53380d139d95b3dfull,
+   0x650a73548baf63deull, 0x766a0abb3c77b2a8ull, 0x81c2c92e47edaee6ull, 0x92722c851482353bull,
+   0xa2bfe8a14cf10364ull, 0xa81a664bbc423001ull, 0xc24b8b70d0f89791ull, 0xc76c51a30654be30ull,
+   0xd192e819d6ef5218ull, 0xd69906245565a910ull, 0xf40e35855771202aull, 0x106aa07032bbd1b8ull,
+   0x19a4c116b8d2d0c8ull, 0x1e376c085141ab53ull, 0x2748774cdf8eeb99ull, 0x34b0bcb5e19b48a8ull,
+   0x391c0cb3c5c95a63ull, 0x4ed8aa4ae3418acbull, 0x5b9cca4f7763e373ull, 0x682e6ff3d6b2b8a3ull,
+   0x748f82ee5defb2fcull, 0x78a5636f43172f60ull, 0x84c87814a1f0ab72ull, 0x8cc702081a6439ecull,
+   0x90befffa23631e28ull, 0xa4506cebde82bde9ull, 0xbef9a3f7b2c67915ull, 0xc67178f2e372532bull,
+   0xca273eceea26619cull, 0xd186b8c721c0c207ull, 0xeada7dd6cde0eb1eull, 0xf57d4f7fee6ed178ull,
+   0x06f067aa72176fbaull, 0x0a637dc5a2c898a6ull, 0x113f9804bef90daeull, 0x1b710b35131c471bull,
+   0x28db77f523047d84ull, 0x32caab7b40c72493ull, 0x3c9ebe0a15c9bebcull, 0x431d67c49c100d4cull,
+   0x4cc5d4becb3e42b6ull, 0x597f299cfc657e2aull, 0x5fcb6fab3ad6faecull, 0x6c44198c4a475817ull
+};
+
+static const uint64_t m_initial_state512[8] = {
+   0x6a09e667f3bcc908ull, 0xbb67ae8584caa73bull, 0x3c6ef372fe94f82bull, 0xa54ff53a5f1d36f1ull,
+   0x510e527fade682d1ull, 0x9b05688c2b3e6c1full, 0x1f83d9abfb41bd6bull, 0x5be0cd19137e2179ull
+};
+
+static const uint64_t m_initial_state384[8] = {
+   0xcbbb9d5dc1059ed8ull, 0x629a292a367cd507ull, 0x9159015a3070dd17ull, 0x152fecd8f70e5939ull,
+   0x67332667ffc00b31ull, 0x8eb44a8768581511ull, 0xdb0c2e0d64f98fa7ull, 0x47b5481dbefa4fa4ull
+};
+
+static const uint64_t m_initial_state512_256[8] = {
+   0x22312194fc2bf72cull, 0x9f555fa3c84c64c2ull, 0x2393b86b6f53b151ull, 0x963877195940eabdull,
+   0x96283ee2a88effe3ull, 0xbe5e1e2553863992ull, 0x2b0199fc2c85b8aaull, 0x0eb72ddc81c52ca2ull
+};
+
+#ifdef SHA256_X86_SIMD
+//best first, compress_blocks_scalar is the fallback
+static const cutil_cpu_variant_t m_compress_variants[] =
+{
+   {"sha", CUTIL_CPU_SHA | CUTIL_CPU_SSSE3 | CUTIL_CPU_SSE41, (cutil_cpu_func_t*) compress_blocks_shani},
+   {"scalar", 0u, (cutil_cpu_func_t*) compress_blocks_scalar}
+};
+static cutil_cpu_dispatch_t m_compress_dispatch = CUTIL_CPU_DISPATCH_INIT(m_compress_variants);
+
+static const cutil_cpu_variant_t m_calc_many_variants[] =
+{
+   {"avx512", CUTIL_CPU_AVX512F, (cutil_cpu_func_t*) calc_many_avx512},
+   //one message at a time with SHA-NI beats 8 AVX2 lanes
+   {"sha", CUTIL_CPU_SHA | CUTIL_CPU_SSSE3 | CUTIL_CPU_SSE41, (cutil_cpu_func_t*) calc_many_scalar},
+   {"avx2", CUTIL_CPU_AVX2, (cutil_cpu_func_t*) calc_many_avx2},
+   {"sse2", CUTIL_CPU_SSE2, (cutil_cpu_func_t*) calc_many_sse2},
+   {"scalar", 0u, (cutil_cpu_func_t*) calc_many_scalar}
+};
+static cutil_cpu_dispatch_t m_calc_many_dispatch = CUTIL_CPU_DISPATCH_INIT(m_calc_many_variants);
+#endif
+
+//read by lanes that have run out of messages
+static const uint8_t m_idle_block[SHA256_BLOCK_SIZE];
 //////////////////////////////////////////////////////////////////////////////
 // PUBLIC FUNCTIONS
 //////////////////////////////////////////////////////////////////////////////
 void sha256_calc(uint8_t hash[32], const void * input, size_t len)
 {
-   uint32_t h[] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
-   int i, j;
+   sha256_ctx_t ctx;
+   sha256_init(&ctx);
+   sha256_update(&ctx, input, len);
+   sha256_final(&ctx, hash);
+}
 
-   uint8_t chunk[64];
+void sha256_init(sha256_ctx_t *ctx)
+{
+   memcpy(ctx->state, m_initial_state, sizeof(ctx->state));
+   ctx->total_len = 0u;
+   ctx->buf_len = 0u;
+}
 
-   struct buffer_state state;
+/**
+ * Continues hashing from a chaining value taken after numBytes of input (a multiple of
+ * SHA256_BLOCK_SIZE), e.g. a precomputed HMAC key pad.
+ */
+void sha256_init_midstate(sha256_ctx_t *ctx, const uint32_t state[8], uint64_t numBytes)
+{
+   memcpy(ctx->state, state, sizeof(ctx->state));
+   ctx->total_len = numBytes;
+   ctx->buf_len = 0u;
+}
 
-   init_buf_state(&state, input, len);
+void sha256_update(sha256_ctx_t *ctx, const void *data, size_t len)
+{
+   const uint8_t *p = (const uint8_t*) data;
+   ctx->total_len += len;
+   if (ctx->buf_len > 0u)
+   {
+      size_t n = SHA256_BLOCK_SIZE - ctx->buf_len;
+      if (n > len)
+      {
+         n = len;
+      }
+      memcpy(&ctx->buf[ctx->buf_len], p, n);
+      ctx->buf_len += n;
+      p += n;
+      len -= n;
+      if (ctx->buf_len < SHA256_BLOCK_SIZE)
+      {
+         return;
+      }
+      compress_blocks(ctx->state, ctx->buf, 1u);
+      ctx->buf_len = 0u;
+   }
+   if (len >= SHA256_BLOCK_SIZE)
+   {
+      size_t numBlocks = len / SHA256_BLOCK_SIZE;
+      compress_blocks(ctx->state, p, numBlocks);
+      p += numBlocks * SHA256_BLOCK_SIZE;
+      len -= numBlocks * SHA256_BLOCK_SIZE;
+   }
+   if (len > 0u)
+   {
+      memcpy(ctx->buf, p, len);
+      ctx->buf_len = len;
+   }
+}
 
-   while (calc_chunk(chunk, &state)) {
-      uint32_t ah[8];
+/**
+ * Appends the padding and the message length in bits, then writes the hash.
+ * The context must be initialized again before it is reused.
+ */
+void sha256_final(sha256_ctx_t *ctx, uint8_t hash[32])
+{
+   int i;
+   ctx->buf[ctx->buf_len++] = 0x80;
+   if (ctx->buf_len > SHA256_BLOCK_SIZE - TOTAL_LEN_LEN)
+   {
+      memset(&ctx->buf[ctx->buf_len], 0x00, SHA256_BLOCK_SIZE - ctx->buf_len);
+      compress_blocks(ctx->state, ctx->buf, 1u);
+      ctx->buf_len = 0u;
+   }
+   memset(&ctx->buf[ctx->buf_len], 0x00, SHA256_BLOCK_SIZE - TOTAL_LEN_LEN - ctx->buf_len);
+   pack_u64be(&ctx->buf[SHA256_BLOCK_SIZE - TOTAL_LEN_LEN], ctx->total_len << 3);
+   compress_blocks(ctx->state, ctx->buf, 1u);
+   for (i = 0; i < 8; i++)
+   {
+      pack_u32be(&hash[i * 4], ctx->state[i]);
+   }
+}
 
+/**
+ * Writes the hash state to dst so that hashing can be resumed later (e.g. after a restart) with
+ * sha256_import, without reading the already hashed data again.
+ * Returns number of bytes written (SHA256_MIDSTATE_SIZE(ctx->buf_len)) or 0 if dstSize is too small.
+ */
+size_t sha256_export(const sha256_ctx_t *ctx, uint8_t *dst, size_t dstSize)
+{
+   const size_t size = SHA256_MIDSTATE_SIZE(ctx->buf_len);
+   int i;
+   if (dstSize < size)
+   {
+      return 0u;
+   }
+   dst[0] = SHA256_MIDSTATE_VERSION;
+   dst[1] = (uint8_t) ctx->buf_len;
+   pack_u64be(&dst[2], ctx->total_len);
+   for (i = 0; i < 8; i++)
+   {
+      pack_u32be(&dst[10 + i * 4], ctx->state[i]);
+   }
+   memcpy(&dst[SHA256_MIDSTATE_HEADER_SIZE], ctx->buf, ctx->buf_len);
+   pack_u32be(&dst[size - 4u], crc32c_calc(dst, size - 4u));
+   return size;
+}
+
+/**
+ * Restores a state written by sha256_export. len must be the exact size of the exported data.
+ * Returns false (leaving ctx untouched) if the data is truncated, corrupt or of another version.
+ */
+bool sha256_import(sha256_ctx_t *ctx, const uint8_t *src, size_t len)
+{
+   size_t numPending;
+   int i;
+   if ( (len < SHA256_MIDSTATE_SIZE(0u)) || (src[0] != SHA256_MIDSTATE_VERSION) )
+   {
+      return false;
+   }
+   numPending = src[1];
+   if ( (numPending >= SHA256_BLOCK_SIZE) || (len != SHA256_MIDSTATE_SIZE(numPending)) ||
+        (unpack_u32be(&src[len - 4u]) != crc32c_calc(src, len - 4u)) ||
+        ( (unpack_u64be(&src[2]) % SHA256_BLOCK_SIZE) != numPending) )
+   {
+      return false;
+   }
+   ctx->total_len = unpack_u64be(&src[2]);
+   for (i = 0; i < 8; i++)
+   {
+      ctx->state[i] = unpack_u32be(&src[10 + i * 4]);
+   }
+   memcpy(ctx->buf, &src[SHA256_MIDSTATE_HEADER_SIZE], numPending);
+   ctx->buf_len = numPending;
+   return true;
+}
+
+/**
+ * Hashes n independent messages, hashes[i] = SHA-256(inputs[i][0..lens[i])).
+ * Messages are interleaved across SIMD lanes (4, 8 or 16 depending on the CPU). A lane that finishes
+ * its message picks up the next one, so messages of different lengths can be mixed freely.
+ */
+void sha256_calc_many(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n)
+{
+#ifdef SHA256_X86_SIMD
+   calc_many_func_t *func = (calc_many_func_t*) cutil_cpu_resolve(&m_calc_many_dispatch);
+   func(hashes, inputs, lens, n);
+#else
+   calc_many_scalar(hashes, inputs, lens, n);
+#endif
+}
+
+void sha512_calc(uint8_t hash[64], const void *input, size_t len)
+{
+   sha512_ctx_t ctx;
+   sha512_init(&ctx);
+   sha512_update(&ctx, input, len);
+   sha512_final(&ctx, hash);
+}
+
+void sha384_calc(uint8_t hash[48], const void *input, size_t len)
+{
+   sha512_ctx_t ctx;
+   sha384_init(&ctx);
+   sha512_update(&ctx, input, len);
+   sha512_final(&ctx, hash);
+}
+
+/**
+ * SHA-512/256 (FIPS 180-4) has the same output size as SHA-256 but runs the 64-bit SHA-512 rounds,
+ * which process twice as much data per round. Without SHA-NI this is the faster choice on 64-bit CPUs.
+ */
+void sha512_256_calc(uint8_t hash[32], const void *input, size_t len)
+{
+   sha512_ctx_t ctx;
+   sha512_256_init(&ctx);
+   sha512_update(&ctx, input, len);
+   sha512_final(&ctx, hash);
+}
+
+void sha512_init(sha512_ctx_t *ctx)
+{
+   sha512_start(ctx, m_initial_state512, SHA512_HASH_SIZE);
+}
+
+void sha384_init(sha512_ctx_t *ctx)
+{
+   sha512_start(ctx, m_initial_state384, SHA384_HASH_SIZE);
+}
+
+void sha512_256_init(sha512_ctx_t *ctx)
+{
+   sha512_start(ctx, m_initial_state512_256, SHA512_256_HASH_SIZE);
+}
+
+void sha512_update(sha512_ctx_t *ctx, const void *data, size_t len)
+{
+   const uint8_t *p = (const uint8_t*) data;
+   ctx->total_len += len;
+   if (ctx->buf_len > 0u)
+   {
+      size_t n = SHA512_BLOCK_SIZE - ctx->buf_len;
+      if (n > len)
+      {
+         n = len;
+      }
+      memcpy(&ctx->buf[ctx->buf_len], p, n);
+      ctx->buf_len += n;
+      p += n;
+      len -= n;
+      if (ctx->buf_len < SHA512_BLOCK_SIZE)
+      {
+         return;
+      }
+      compress_blocks512(ctx->state, ctx->buf, 1u);
+      ctx->buf_len = 0u;
+   }
+   if (len >= SHA512_BLOCK_SIZE)
+   {
+      size_t numBlocks = len / SHA512_BLOCK_SIZE;
+      compress_blocks512(ctx->state, p, numBlocks);
+      p += numBlocks * SHA512_BLOCK_SIZE;
+      len -= numBlocks * SHA512_BLOCK_SIZE;
+   }
+   if (len > 0u)
+   {
+      memcpy(ctx->buf, p, len);
+      ctx->buf_len = len;
+   }
+}
+
+/**
+ * Writes ctx->hash_len bytes (64, 48 or 32 depending on which init function was used).
+ * The message length field is 128 bits, the upper half holds the bits shifted out of total_len.
+ */
+void sha512_final(sha512_ctx_t *ctx, uint8_t *hash)
+{
+   uint8_t digest[SHA512_HASH_SIZE];
+   size_t i;
+   ctx->buf[ctx->buf_len++] = 0x80;
+   if (ctx->buf_len > SHA512_BLOCK_SIZE - TOTAL_LEN_LEN512)
+   {
+      memset(&ctx->buf[ctx->buf_len], 0x00, SHA512_BLOCK_SIZE - ctx->buf_len);
+      compress_blocks512(ctx->state, ctx->buf, 1u);
+      ctx->buf_len = 0u;
+   }
+   memset(&ctx->buf[ctx->buf_len], 0x00, SHA512_BLOCK_SIZE - TOTAL_LEN_LEN512 - ctx->buf_len);
+   pack_u64be(&ctx->buf[SHA512_BLOCK_SIZE - TOTAL_LEN_LEN512], ctx->total_len >> 61);
+   pack_u64be(&ctx->buf[SHA512_BLOCK_SIZE - TOTAL_LEN_LEN], ctx->total_len << 3);
+   compress_blocks512(ctx->state, ctx->buf, 1u);
+   //the truncated variants only copy the first hash_len bytes
+   for (i = 0u; i < 8u; i++)
+   {
+      pack_u64be(&digest[i * 8u], ctx->state[i]);
+   }
+   memcpy(hash, digest, ctx->hash_len);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static inline uint32_t right_rot(uint32_t value, unsigned int count)
+{
+   return value >> count | value << (32 - count);
+}
+
+static void compress_blocks(uint32_t h[8], const uint8_t *data, size_t numBlocks)
+{
+#ifdef SHA256_X86_SIMD
+   compress_func_t *func = (compress_func_t*) cutil_cpu_resolve(&m_compress_dispatch);
+   func(h, data, numBlocks);
+#else
+   compress_blocks_scalar(h, data, numBlocks);
+#endif
+}
+
+/**
+ * Portable compression function, reads the message blocks directly from data
+ */
+static void compress_blocks_scalar(uint32_t h[8], const uint8_t *data, size_t numBlocks)
+{
+   int i;
+   for (; numBlocks > 0u; numBlocks--, data += SHA256_BLOCK_SIZE) {
+      uint32_t ah[8];
       uint32_t w[64];
-      const uint8_t *p = chunk;
 
-      memset(w, 0x00, sizeof w);
       for (i = 0; i < 16; i++) {
-         w[i] = (uint32_t) p[0] << 24 | (uint32_t) p[1] << 16 |
-            (uint32_t) p[2] << 8 | (uint32_t) p[3];
-         p += 4;
+         w[i] = unpack_u32be(&data[i * 4]);
       }
 
       for (i = 16; i < 64; i++) {
@@ -125,81 +500,442 @@ void sha256_calc(uint8_t hash[32], const void * input, size_t len)
       for (i = 0; i < 8; i++)
          h[i] += ah[i];
    }
+}
+
+static void sha512_start(sha512_ctx_t *ctx, const uint64_t initialState[8], size_t hashLen)
+{
+   memcpy(ctx->state, initialState, sizeof(ctx->state));
+   ctx->total_len = 0u;
+   ctx->buf_len = 0u;
+   ctx->hash_len = hashLen;
+}
 
-   for (i = 0, j = 0; i < 8; i++)
+static inline uint64_t right_rot64(uint64_t value, unsigned int count)
+{
+   return value >> count | value << (64 - count);
+}
+
+static void compress_blocks512(uint64_t h[8], const uint8_t *data, size_t numBlocks)
+{
+   uint64_t w[16];
+   size_t block;
+   int i;
+   for (block = 0u; block < numBlocks; block++)
    {
-      hash[j++] = (uint8_t) (h[i] >> 24);
-      hash[j++] = (uint8_t) (h[i] >> 16);
-      hash[j++] = (uint8_t) (h[i] >> 8);
-      hash[j++] = (uint8_t) h[i];
+      uint64_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4], f = h[5], g = h[6], hh = h[7];
+      for (i = 0; i < 80; i++)
+      {
+         uint64_t s0, s1, ch, maj, temp1, temp2;
+         if (i < 16)
+         {
+            w[i] = unpack_u64be(&data[i * 8]);
+         }
+         else
+         {
+            const uint64_t w15 = w[(i + 1) & 15];
+            const uint64_t w2 = w[(i + 14) & 15];
+            s0 = right_rot64(w15, 1) ^ right_rot64(w15, 8) ^ (w15 >> 7);
+            s1 = right_rot64(w2, 19) ^ right_rot64(w2, 61) ^ (w2 >> 6);
+            w[i & 15] += s0 + w[(i + 9) & 15] + s1;
+         }
+         s1 = right_rot64(e, 14) ^ right_rot64(e, 18) ^ right_rot64(e, 41);
+         ch = (e & f) ^ (~e & g);
+         temp1 = hh + s1 + ch + k512[i] + w[i & 15];
+         s0 = right_rot64(a, 28) ^ right_rot64(a, 34) ^ right_rot64(a, 39);
+         maj = (a & b) ^ (a & c) ^ (b & c);
+         temp2 = s0 + maj;
+         hh = g;
+         g = f;
+         f = e;
+         e = d + temp1;
+         d = c;
+         c = b;
+         b = a;
+         a = temp1 + temp2;
+      }
+      h[0] += a;
+      h[1] += b;
+      h[2] += c;
+      h[3] += d;
+      h[4] += e;
+      h[5] += f;
+      h[6] += g;
+      h[7] += hh;
+      data += SHA512_BLOCK_SIZE;
    }
 }
 
-//////////////////////////////////////////////////////////////////////////////
-// PRIVATE FUNCTIONS
-//////////////////////////////////////////////////////////////////////////////
-static inline uint32_t right_rot(uint32_t value, unsigned int count)
+static void calc_many_scalar(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n)
 {
-   return value >> count | value << (32 - count);
+   size_t i;
+   for (i = 0u; i < n; i++)
+   {
+      sha256_calc(hashes[i], inputs[i], lens[i]);
+   }
 }
 
-static void init_buf_state(struct buffer_state * state, const void * input, size_t len)
+static void calc_many_lanes(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n,
+                            unsigned numLanes, compress_lanes_func_t *compress)
 {
-   state->p = input;
-   state->len = len;
-   state->total_len = len;
-   state->single_one_delivered = 0;
-   state->total_len_delivered = 0;
+   sha256_lane_t lanes[MAX_LANES];
+   uint32_t state[8u * MAX_LANES];
+   uint32_t w[16u * MAX_LANES];
+   size_t next = 0u;
+   unsigned numActive = 0u;
+   unsigned l;
+   int i;
+   for (l = 0u; l < numLanes; l++)
+   {
+      lanes[l].is_active = false;
+      if (next < n)
+      {
+         start_lane(&lanes[l], state, numLanes, l, next, inputs[next], lens[next]);
+         next++;
+         numActive++;
+      }
+   }
+   while (numActive > 0u)
+   {
+      for (l = 0u; l < numLanes; l++)
+      {
+         const sha256_lane_t *lane = &lanes[l];
+         const uint8_t *block = !lane->is_active? m_idle_block :
+                                (lane->num_full > 0u)? lane->data : &lane->tail[lane->tail_index * SHA256_BLOCK_SIZE];
+         for (i = 0; i < 16; i++)
+         {
+            w[i * numLanes + l] = unpack_u32be(&block[i * 4]);
+         }
+      }
+      compress(state, w);
+      for (l = 0u; l < numLanes; l++)
+      {
+         sha256_lane_t *lane = &lanes[l];
+         if (!lane->is_active)
+         {
+            continue;
+         }
+         if (lane->num_full > 0u)
+         {
+            lane->num_full--;
+            lane->data += SHA256_BLOCK_SIZE;
+         }
+         else if (++lane->tail_index == lane->num_tail)
+         {
+            for (i = 0; i < 8; i++)
+            {
+               pack_u32be(&hashes[lane->message][i * 4], state[i * numLanes + l]);
+            }
+            if (next < n)
+            {
+               start_lane(lane, state, numLanes, l, next, inputs[next], lens[next]);
+               next++;
+            }
+            else
+            {
+               lane->is_active = false;
+               numActive--;
+            }
+         }
+      }
+   }
 }
 
+static void start_lane(sha256_lane_t *lane, uint32_t *state, unsigned numLanes, unsigned laneIndex, size_t message, const void *input, size_t len)
+{
+   const size_t remaining = len % SHA256_BLOCK_SIZE;
+   int i;
+   for (i = 0; i < 8; i++)
+   {
+      state[i * numLanes + laneIndex] = m_initial_state[i];
+   }
+   lane->data = (const uint8_t*) input;
+   lane->num_full = len / SHA256_BLOCK_SIZE;
+   lane->message = message;
+   lane->num_tail = (remaining < SHA256_BLOCK_SIZE - TOTAL_LEN_LEN)? 1u : 2u;
+   lane->tail_index = 0u;
+   lane->is_active = true;
+   memcpy(lane->tail, &lane->data[lane->num_full * SHA256_BLOCK_SIZE], remaining);
+   lane->tail[remaining] = 0x80;
+   memset(&lane->tail[remaining + 1u], 0x00, lane->num_tail * SHA256_BLOCK_SIZE - TOTAL_LEN_LEN - remaining - 1u);
+   pack_u64be(&lane->tail[lane->num_tail * SHA256_BLOCK_SIZE - TOTAL_LEN_LEN], (uint64_t) len << 3);
+}
+
+#ifdef SHA256_X86_SIMD
+//four rounds using message words msg (sha256rnds2 does two rounds with the low two words)
+#define SHANI_QUAD_ROUND(msg, group) \
+   tmp = _mm_add_epi32(msg, _mm_loadu_si128((const __m128i*) &k[(group) * 4])); \
+   state1 = _mm_sha256rnds2_epu32(state1, state0, tmp); \
+   state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(tmp, 0x0E))
+
+//completes the next four schedule words from the current and previous ones
+#define SHANI_SCHEDULE(next, cur, prev) \
+   next = _mm_sha256msg2_epu32(_mm_add_epi32(next, _mm_alignr_epi8(cur, prev, 4)), cur)
+
 /**
- * returns 1 on success
+ * SHA-NI compression function. The instructions keep the state as {A,B,E,F} and {C,D,G,H}.
+ * Message schedule words are kept in m0..m3, four words each, and are updated in rotation.
  */
-static int calc_chunk(uint8_t chunk[CHUNK_SIZE], struct buffer_state * state)
+__attribute__((target("sha,ssse3,sse4.1")))
+static void compress_blocks_shani(uint32_t h[8], const uint8_t *data, size_t numBlocks)
 {
-   size_t space_in_chunk;
+   const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+   __m128i state0, state1, tmp, m0, m1, m2, m3;
 
-   if (state->total_len_delivered) {
-      return 0;
-   }
+   tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &h[0]), 0xB1); //CDAB
+   state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) &h[4]), 0x1B); //EFGH
+   state0 = _mm_alignr_epi8(tmp, state1, 8); //ABEF
+   state1 = _mm_blend_epi16(state1, tmp, 0xF0); //CDGH
 
-   if (state->len >= CHUNK_SIZE) {
-      memcpy(chunk, state->p, CHUNK_SIZE);
-      state->p += CHUNK_SIZE;
-      state->len -= CHUNK_SIZE;
-      return 1;
-   }
+   for (; numBlocks > 0u; numBlocks--, data += SHA256_BLOCK_SIZE)
+   {
+      const __m128i abefSaved = state0;
+      const __m128i cdghSaved = state1;
+      m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) &data[0]), byteSwap);
+      m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) &data[16]), byteSwap);
+      m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) &data[32]), byteSwap);
+      m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) &data[48]), byteSwap);
 
-   memcpy(chunk, state->p, state->len);
-   chunk += state->len;
-   space_in_chunk = CHUNK_SIZE - state->len;
-   state->p += state->len;
-   state->len = 0;
+      SHANI_QUAD_ROUND(m0, 0);
+      SHANI_QUAD_ROUND(m1, 1);
+      m0 = _mm_sha256msg1_epu32(m0, m1);
+      SHANI_QUAD_ROUND(m2, 2);
+      m1 = _mm_sha256msg1_epu32(m1, m2);
+      SHANI_QUAD_ROUND(m3, 3);
+      SHANI_SCHEDULE(m0, m3, m2);
+      m2 = _mm_sha256msg1_epu32(m2, m3);
+      SHANI_QUAD_ROUND(m0, 4);
+      SHANI_SCHEDULE(m1, m0, m3);
+      m3 = _mm_sha256msg1_epu32(m3, m0);
+      SHANI_QUAD_ROUND(m1, 5);
+      SHANI_SCHEDULE(m2, m1, m0);
+      m0 = _mm_sha256msg1_epu32(m0, m1);
+      SHANI_QUAD_ROUND(m2, 6);
+      SHANI_SCHEDULE(m3, m2, m1);
+      m1 = _mm_sha256msg1_epu32(m1, m2);
+      SHANI_QUAD_ROUND(m3, 7);
+      SHANI_SCHEDULE(m0, m3, m2);
+      m2 = _mm_sha256msg1_epu32(m2, m3);
+      SHANI_QUAD_ROUND(m0, 8);
+      SHANI_SCHEDULE(m1, m0, m3);
+      m3 = _mm_sha256msg1_epu32(m3, m0);
+      SHANI_QUAD_ROUND(m1, 9);
+      SHANI_SCHEDULE(m2, m1, m0);
+      m0 = _mm_sha256msg1_epu32(m0, m1);
+      SHANI_QUAD_ROUND(m2, 10);
+      SHANI_SCHEDULE(m3, m2, m1);
+      m1 = _mm_sha256msg1_epu32(m1, m2);
+      SHANI_QUAD_ROUND(m3, 11);
+      SHANI_SCHEDULE(m0, m3, m2);
+      m2 = _mm_sha256msg1_epu32(m2, m3);
+      SHANI_QUAD_ROUND(m0, 12);
+      SHANI_SCHEDULE(m1, m0, m3);
+      m3 = _mm_sha256msg1_epu32(m3, m0);
+      SHANI_QUAD_ROUND(m1, 13);
+      SHANI_SCHEDULE(m2, m1, m0);
+      SHANI_QUAD_ROUND(m2, 14);
+      SHANI_SCHEDULE(m3, m2, m1);
+      SHANI_QUAD_ROUND(m3, 15);
 
-   if (!state->single_one_delivered) {
-      *chunk++ = 0x80;
-      space_in_chunk -= 1;
-      state->single_one_delivered = 1;
+      state0 = _mm_add_epi32(state0, abefSaved);
+      state1 = _mm_add_epi32(state1, cdghSaved);
    }
 
-   if (space_in_chunk >= TOTAL_LEN_LEN) {
-      const size_t left = space_in_chunk - TOTAL_LEN_LEN;
-      size_t len = state->total_len;
-      int i;
-      memset(chunk, 0x00, left);
-      chunk += left;
+   tmp = _mm_shuffle_epi32(state0, 0x1B); //FEBA
+   state1 = _mm_shuffle_epi32(state1, 0xB1); //DCHG
+   _mm_storeu_si128((__m128i*) &h[0], _mm_blend_epi16(tmp, state1, 0xF0)); //DCBA
+   _mm_storeu_si128((__m128i*) &h[4], _mm_alignr_epi8(state1, tmp, 8)); //HGFE
+}
 
-      chunk[7] = (uint8_t) (len << 3);
-      len >>= 5;
-      for (i = 6; i >= 0; i--) {
-         chunk[i] = (uint8_t) len;
-         len >>= 8;
+static void calc_many_sse2(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n)
+{
+   calc_many_lanes(hashes, inputs, lens, n, 4u, compress_lanes_sse2);
+}
+
+static void calc_many_avx2(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n)
+{
+   calc_many_lanes(hashes, inputs, lens, n, 8u, compress_lanes_avx2);
+}
+
+static void calc_many_avx512(uint8_t hashes[][32], const void *const *inputs, const size_t *lens, size_t n)
+{
+   calc_many_lanes(hashes, inputs, lens, n, 16u, compress_lanes_avx512);
+}
+
+/*
+ * The lane kernels run the portable round function on one 32-bit word per lane. The message schedule
+ * is expanded in a ring of 16 vectors: w[i] = w[i - 16] + s0(w[i - 15]) + w[i - 7] + s1(w[i - 2]).
+ */
+#define SSE2_ROTR(x, n) _mm_or_si128(_mm_srli_epi32(x, n), _mm_slli_epi32(x, 32 - (n)))
+
+__attribute__((target("sse2")))
+static void compress_lanes_sse2(uint32_t *state, const uint32_t *w)
+{
+   __m128i v[8], m[16];
+   int i;
+   for (i = 0; i < 8; i++)
+   {
+      v[i] = _mm_loadu_si128((const __m128i*) &state[i * 4]);
+   }
+   {
+      __m128i a = v[0], b = v[1], c = v[2], d = v[3], e = v[4], f = v[5], g = v[6], h = v[7];
+      for (i = 0; i < 64; i++)
+      {
+         __m128i t1, t2;
+         if (i < 16)
+         {
+            m[i] = _mm_loadu_si128((const __m128i*) &w[i * 4]);
+         }
+         else
+         {
+            const __m128i w15 = m[(i + 1) & 15];
+            const __m128i w2 = m[(i + 14) & 15];
+            const __m128i s0 = _mm_xor_si128(_mm_xor_si128(SSE2_ROTR(w15, 7), SSE2_ROTR(w15, 18)), _mm_srli_epi32(w15, 3));
+            const __m128i s1 = _mm_xor_si128(_mm_xor_si128(SSE2_ROTR(w2, 17), SSE2_ROTR(w2, 19)), _mm_srli_epi32(w2, 10));
+            m[i & 15] = _mm_add_epi32(_mm_add_epi32(m[i & 15], s0), _mm_add_epi32(m[(i + 9) & 15], s1));
+         }
+         t1 = _mm_xor_si128(_mm_xor_si128(SSE2_ROTR(e, 6), SSE2_ROTR(e, 11)), SSE2_ROTR(e, 25));
+         t1 = _mm_add_epi32(_mm_add_epi32(h, t1), _mm_xor_si128(_mm_and_si128(e, f), _mm_andnot_si128(e, g)));
+         t1 = _mm_add_epi32(t1, _mm_add_epi32(_mm_set1_epi32((int) k[i]), m[i & 15]));
+         t2 = _mm_xor_si128(_mm_xor_si128(SSE2_ROTR(a, 2), SSE2_ROTR(a, 13)), SSE2_ROTR(a, 22));
+         t2 = _mm_add_epi32(t2, _mm_or_si128(_mm_and_si128(a, b), _mm_and_si128(c, _mm_or_si128(a, b))));
+         h = g;
+         g = f;
+         f = e;
+         e = _mm_add_epi32(d, t1);
+         d = c;
+         c = b;
+         b = a;
+         a = _mm_add_epi32(t1, t2);
       }
-      state->total_len_delivered = 1;
-   } else {
-      memset(chunk, 0x00, space_in_chunk);
+      v[0] = _mm_add_epi32(v[0], a);
+      v[1] = _mm_add_epi32(v[1], b);
+      v[2] = _mm_add_epi32(v[2], c);
+      v[3] = _mm_add_epi32(v[3], d);
+      v[4] = _mm_add_epi32(v[4], e);
+      v[5] = _mm_add_epi32(v[5], f);
+      v[6] = _mm_add_epi32(v[6], g);
+      v[7] = _mm_add_epi32(v[7], h);
+   }
+   for (i = 0; i < 8; i++)
+   {
+      _mm_storeu_si128((__m128i*) &state[i * 4], v[i]);
    }
+}
+
+#define AVX2_ROTR(x, n) _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - (n)))
 
-   return 1;
+__attribute__((target("avx2")))
+static void compress_lanes_avx2(uint32_t *state, const uint32_t *w)
+{
+   __m256i v[8], m[16];
+   int i;
+   for (i = 0; i < 8; i++)
+   {
+      v[i] = _mm256_loadu_si256((const __m256i*) &state[i * 8]);
+   }
+   {
+      __m256i a = v[0], b = v[1], c = v[2], d = v[3], e = v[4], f = v[5], g = v[6], h = v[7];
+      for (i = 0; i < 64; i++)
+      {
+         __m256i t1, t2;
+         if (i < 16)
+         {
+            m[i] = _mm256_loadu_si256((const __m256i*) &w[i * 8]);
+         }
+         else
+         {
+            const __m256i w15 = m[(i + 1) & 15];
+            const __m256i w2 = m[(i + 14) & 15];
+            const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(AVX2_ROTR(w15, 7), AVX2_ROTR(w15, 18)), _mm256_srli_epi32(w15, 3));
+            const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(AVX2_ROTR(w2, 17), AVX2_ROTR(w2, 19)), _mm256_srli_epi32(w2, 10));
+            m[i & 15] = _mm256_add_epi32(_mm256_add_epi32(m[i & 15], s0), _mm256_add_epi32(m[(i + 9) & 15], s1));
+         }
+         t1 = _mm256_xor_si256(_mm256_xor_si256(AVX2_ROTR(e, 6), AVX2_ROTR(e, 11)), AVX2_ROTR(e, 25));
+         t1 = _mm256_add_epi32(_mm256_add_epi32(h, t1), _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g)));
+         t1 = _mm256_add_epi32(t1, _mm256_add_epi32(_mm256_set1_epi32((int) k[i]), m[i & 15]));
+         t2 = _mm256_xor_si256(_mm256_xor_si256(AVX2_ROTR(a, 2), AVX2_ROTR(a, 13)), AVX2_ROTR(a, 22));
+         t2 = _mm256_add_epi32(t2, _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b))));
+         h = g;
+         g = f;
+         f = e;
+         e = _mm256_add_epi32(d, t1);
+         d = c;
+         c = b;
+         b = a;
+         a = _mm256_add_epi32(t1, t2);
+      }
+      v[0] = _mm256_add_epi32(v[0], a);
+      v[1] = _mm256_add_epi32(v[1], b);
+      v[2] = _mm256_add_epi32(v[2], c);
+      v[3] = _mm256_add_epi32(v[3], d);
+      v[4] = _mm256_add_epi32(v[4], e);
+      v[5] = _mm256_add_epi32(v[5], f);
+      v[6] = _mm256_add_epi32(v[6], g);
+      v[7] = _mm256_add_epi32(v[7], h);
+   }
+   for (i = 0; i < 8; i++)
+   {
+      _mm256_storeu_si256((__m256i*) &state[i * 8], v[i]);
+   }
+   _mm256_zeroupper();
 }
 
+/**
+ * AVX-512 has a rotate instruction and vpternlogd evaluates ch (0xCA) and maj (0xE8) in one step
+ */
+__attribute__((target("avx512f")))
+static void compress_lanes_avx512(uint32_t *state, const uint32_t *w)
+{
+   __m512i v[8], m[16];
+   int i;
+   for (i = 0; i < 8; i++)
+   {
+      v[i] = _mm512_loadu_si512((const void*) &state[i * 16]);
+   }
+   {
+      __m512i a = v[0], b = v[1], c = v[2], d = v[3], e = v[4], f = v[5], g = v[6], h = v[7];
+      for (i = 0; i < 64; i++)
+      {
+         __m512i t1, t2;
+         if (i < 16)
+         {
+            m[i] = _mm512_loadu_si512((const void*) &w[i * 16]);
+         }
+         else
+         {
+            const __m512i w15 = m[(i + 1) & 15];
+            const __m512i w2 = m[(i + 14) & 15];
+            const __m512i s0 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(w15, 7), _mm512_ror_epi32(w15, 18), _mm512_srli_epi32(w15, 3), 0x96);
+            const __m512i s1 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(w2, 17), _mm512_ror_epi32(w2, 19), _mm512_srli_epi32(w2, 10), 0x96);
+            m[i & 15] = _mm512_add_epi32(_mm512_add_epi32(m[i & 15], s0), _mm512_add_epi32(m[(i + 9) & 15], s1));
+         }
+         t1 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(e, 6), _mm512_ror_epi32(e, 11), _mm512_ror_epi32(e, 25), 0x96);
+         t1 = _mm512_add_epi32(_mm512_add_epi32(h, t1), _mm512_ternarylogic_epi32(e, f, g, 0xCA));
+         t1 = _mm512_add_epi32(t1, _mm512_add_epi32(_mm512_set1_epi32((int) k[i]), m[i & 15]));
+         t2 = _mm512_ternarylogic_epi32(_mm512_ror_epi32(a, 2), _mm512_ror_epi32(a, 13), _mm512_ror_epi32(a, 22), 0x96);
+         t2 = _mm512_add_epi32(t2, _mm512_ternarylogic_epi32(a, b, c, 0xE8));
+         h = g;
+         g = f;
+         f = e;
+         e = _mm512_add_epi32(d, t1);
+         d = c;
+         c = b;
+         b = a;
+         a = _mm512_add_epi32(t1, t2);
+      }
+      v[0] = _mm512_add_epi32(v[0], a);
+      v[1] = _mm512_add_epi32(v[1], b);
+      v[2] = _mm512_add_epi32(v[2], c);
+      v[3] = _mm512_add_epi32(v[3], d);
+      v[4] = _mm512_add_epi32(v[4], e);
+      v[5] = _mm512_add_epi32(v[5], f);
+      v[6] = _mm512_add_epi32(v[6], g);
+      v[7] = _mm512_add_epi32(v[7], h);
+   }
+   for (i = 0; i < 8; i++)
+   {
+      _mm512_storeu_si512((void*) &state[i * 16], v[i]);
+   }
+   _mm256_zeroupper();
+}
+#endif
@@ -0,0 +1,267 @@
+/*****************************************************************************
+* \file      sha256_tree.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Merkle tree hashing of large inputs on top of SHA-256
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sha256_tree.h"
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+//each worker hashes a contiguous range of leaves
+typedef struct leaf_job_tag
+{
+   uint8_t (*leafHashes)[32];
+   const uint8_t *data;
+   size_t len;
+   size_t leafSize;
+   size_t first;
+   size_t last; //exclusive
+} leaf_job_t;
+
+#ifdef _WIN32
+#define THREAD_T HANDLE
+#define THREAD_RESULT_T DWORD WINAPI
+#else
+#define THREAD_T pthread_t
+#define THREAD_RESULT_T void*
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static unsigned online_cpu_count(void);
+static void hash_leaves(const leaf_job_t *job);
+static THREAD_RESULT_T leaf_worker(void *arg);
+static void combine(uint8_t hash[32], const uint8_t left[32], const uint8_t right[32]);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+size_t sha256_tree_num_leaves(size_t len, size_t leafSize)
+{
+   if ( (leafSize == 0u) || (len == 0u) )
+   {
+      return 1u;
+   }
+   return (len / leafSize) + ( (len % leafSize) != 0u? 1u : 0u);
+}
+
+/**
+ * Calculates the root hash of data, hashing the leaves in parallel on numThreads threads
+ * (0 selects the number of online CPUs). When leafHashes is not NULL it must have room for
+ * sha256_tree_num_leaves(len, leafSize) hashes and receives the hash of every leaf, which allows
+ * a changed range to be verified later by rehashing only the affected leaves (see sha256_tree_leaf
+ * and sha256_tree_root).
+ * Returns 0 on success, -1 on failure (errno is EINVAL for invalid arguments and ENOMEM when out of memory).
+ */
+int sha256_tree_calc(uint8_t root[32], uint8_t (*leafHashes)[32], const void *data, size_t len, size_t leafSize, unsigned numThreads)
+{
+   leaf_job_t jobs[SHA256_TREE_MAX_THREADS];
+   THREAD_T threads[SHA256_TREE_MAX_THREADS];
+   uint8_t (*hashes)[32] = leafHashes;
+   size_t numLeaves;
+   unsigned numStarted = 0u;
+   unsigned i;
+   if ( (root == 0) || (leafSize == 0u) || ( (data == 0) && (len > 0u) ) )
+   {
+      errno = EINVAL;
+      return -1;
+   }
+   if (len == 0u)
+   {
+      data = "";
+   }
+   numLeaves = sha256_tree_num_leaves(len, leafSize);
+   if (hashes == 0)
+   {
+      hashes = (uint8_t(*)[32]) malloc(numLeaves * SHA256_HASH_SIZE);
+      if (hashes == 0)
+      {
+         errno = ENOMEM;
+         return -1;
+      }
+   }
+   if (numThreads == 0u)
+   {
+      numThreads = online_cpu_count();
+   }
+   if (numThreads > SHA256_TREE_MAX_THREADS)
+   {
+      numThreads = SHA256_TREE_MAX_THREADS;
+   }
+   if (numThreads > numLeaves)
+   {
+      numThreads = (unsigned) numLeaves;
+   }
+   for (i = 0u; i < numThreads; i++)
+   {
+      jobs[i].leafHashes = hashes;
+      jobs[i].data = (const uint8_t*) data;
+      jobs[i].len = len;
+      jobs[i].leafSize = leafSize;
+      jobs[i].first = (numLeaves * i) / numThreads;
+      jobs[i].last = (numLeaves * (i + 1u)) / numThreads;
+   }
+   //job 0 runs on the calling thread, a worker that fails to start has its job run there as well
+   for (i = 1u; i < numThreads; i++)
+   {
+#ifdef _WIN32
+      threads[numStarted] = CreateThread(NULL, 0, leaf_worker, &jobs[i], 0, NULL);
+      if (threads[numStarted] == NULL)
+#else
+      if (pthread_create(&threads[numStarted], NULL, leaf_worker, &jobs[i]) != 0)
+#endif
+      {
+         break;
+      }
+      numStarted++;
+   }
+   hash_leaves(&jobs[0]);
+   for (i = numStarted + 1u; i < numThreads; i++)
+   {
+      hash_leaves(&jobs[i]);
+   }
+   for (i = 0u; i < numStarted; i++)
+   {
+#ifdef _WIN32
+      WaitForSingleObject(threads[i], INFINITE);
+      CloseHandle(threads[i]);
+#else
+      pthread_join(threads[i], NULL);
+#endif
+   }
+   sha256_tree_root(root, (const uint8_t(*)[32]) hashes, numLeaves);
+   if (hashes != leafHashes)
+   {
+      free(hashes);
+   }
+   return 0;
+}
+
+void sha256_tree_leaf(uint8_t hash[32], const void *data, size_t len)
+{
+   static const uint8_t prefix = SHA256_TREE_LEAF_PREFIX;
+   sha256_ctx_t ctx;
+   sha256_init(&ctx);
+   sha256_update(&ctx, &prefix, 1u);
+   sha256_update(&ctx, data, len);
+   sha256_final(&ctx, hash);
+}
+
+/**
+ * Combines the leaf hashes into the root hash. Needs no memory beyond the stack since only
+ * the spine of the left-leaning tree has to be kept (one hash per level).
+ */
+void sha256_tree_root(uint8_t root[32], const uint8_t (*leafHashes)[32], size_t numLeaves)
+{
+   //stack[i] holds the root of a complete subtree of 2^levels[i] leaves
+   uint8_t stack[sizeof(size_t) * 8u + 1u][32];
+   unsigned levels[sizeof(size_t) * 8u + 1u];
+   unsigned top = 0u;
+   size_t i;
+   if (numLeaves == 0u)
+   {
+      sha256_tree_leaf(root, "", 0u);
+      return;
+   }
+   for (i = 0u; i < numLeaves; i++)
+   {
+      memcpy(stack[top], leafHashes[i], SHA256_HASH_SIZE);
+      levels[top++] = 0u;
+      while ( (top >= 2u) && (levels[top - 2u] == levels[top - 1u]) )
+      {
+         combine(stack[top - 2u], stack[top - 2u], stack[top - 1u]);
+         levels[top - 2u]++;
+         top--;
+      }
+   }
+   //incomplete subtrees on the right are combined from the right, smallest first
+   while (top >= 2u)
+   {
+      combine(stack[top - 2u], stack[top - 2u], stack[top - 1u]);
+      top--;
+   }
+   memcpy(root, stack[0], SHA256_HASH_SIZE);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+static unsigned online_cpu_count(void)
+{
+#ifdef _WIN32
+   SYSTEM_INFO info;
+   GetSystemInfo(&info);
+   return (info.dwNumberOfProcessors > 0)? (unsigned) info.dwNumberOfProcessors : 1u;
+#else
+   long count = sysconf(_SC_NPROCESSORS_ONLN);
+   return (count > 0)? (unsigned) count : 1u;
+#endif
+}
+
+static void hash_leaves(const leaf_job_t *job)
+{
+   size_t i;
+   for (i = job->first; i < job->last; i++)
+   {
+      const size_t offset = i * job->leafSize;
+      const size_t remaining = job->len - offset;
+      sha256_tree_leaf(job->leafHashes[i], &job->data[offset], (remaining < job->leafSize)? remaining : job->leafSize);
+   }
+}
+
+static THREAD_RESULT_T leaf_worker(void *arg)
+{
+   hash_leaves((const leaf_job_t*) arg);
+   return 0;
+}
+
+static void combine(uint8_t hash[32], const uint8_t left[32], const uint8_t right[32])
+{
+   static const uint8_t prefix = SHA256_TREE_NODE_PREFIX;
+   sha256_ctx_t ctx;
+   sha256_init(&ctx);
+   sha256_update(&ctx, &prefix, 1u);
+   sha256_update(&ctx, left, SHA256_HASH_SIZE);
+   sha256_update(&ctx, right, SHA256_HASH_SIZE);
+   sha256_final(&ctx, hash);
+}
@@ -25,7 +25,9 @@
 */
 void soa_init( soa_t *allocator )
 {
-  memset(allocator->fsa,0,sizeof(soa_fsa_t*)*SOA_SMALL_OBJECT_MAX_SIZE);
+  memset(allocator->fsa,0,sizeof(soa_fsa_t*)*SOA_NUM_SIZE_CLASSES);
+  allocator->memoryHandler = 0;
+  soa_budget_init(&allocator->budget);
 }
 
 /**
@@ -34,7 +36,7 @@ void soa_init( soa_t *allocator )
 void soa_destroy( soa_t *allocator )
 {
   size_t i;
-  for(i=0;i<SOA_SMALL_OBJECT_MAX_SIZE;i++)
+  for(i=0;i<SOA_NUM_SIZE_CLASSES;i++)
   {
     if(allocator->fsa[i]!=0)
     {
@@ -46,37 +48,58 @@ void soa_destroy( soa_t *allocator )
 
 /**
 * Initializes a fixed size allocator (a substructure to SmallObjAllocator) that will handle
-* Alloc/Free of memory blocks of blockSize bytes
-* 
+* Alloc/Free of memory blocks of blockSize bytes.
+* The block size is rounded up to the size class it belongs to.
 */
 void soa_initFSA( soa_t *allocator, size_t blockSize, unsigned char numBlocks )
 {
+  size_t sizeClass;
   assert((blockSize<=SOA_SMALL_OBJECT_MAX_SIZE) && (blockSize>0)) ;
-  if(allocator->fsa[blockSize-1] == 0)
+  sizeClass = SOA_SIZE_CLASS(blockSize);
+  if(allocator->fsa[sizeClass] == 0)
   {
     soa_fsa_t *ptr = (soa_fsa_t*) malloc(sizeof(soa_fsa_t));
     if(ptr!=0)
     {
-      soa_fsa_init(ptr,blockSize,numBlocks);
-      allocator->fsa[blockSize-1] = ptr;
+      soa_fsa_init(ptr,(sizeClass+1)*SOA_OBJECT_ALIGN_SIZE,numBlocks);
+      soa_fsa_setMemoryHandler(ptr,allocator->memoryHandler);
+      soa_fsa_setBudget(ptr,&allocator->budget);
+      allocator->fsa[sizeClass] = ptr;
     }    
   }
 }
 /**
-* Allocates a block of memory of size bytes from the small object allocator
+* Allocates a block of memory of size bytes from the small object allocator.
+* Objects larger than SOA_SMALL_OBJECT_MAX_SIZE are allocated using malloc.
 */
 void * soa_alloc( soa_t *allocator, size_t size )
 {
-  assert((size<=SOA_SMALL_OBJECT_MAX_SIZE) && (size>0)) ;
+  size_t sizeClass;
+  assert(size>0);
+  if(size>SOA_SMALL_OBJECT_MAX_SIZE)
+  {
+    void *ptr;
+    if(!soa_budget_charge(&allocator->budget,size))
+    {
+      return (void*) 0;
+    }
+    ptr = malloc(size);
+    if(ptr == 0)
+    {
+      soa_budget_release(&allocator->budget,size);
+    }
+    return ptr;
+  }
+  sizeClass = SOA_SIZE_CLASS(size);
 #if(AUTO_INITIALIZE_FSA)
-  if(allocator->fsa[size-1] == 0)
+  if(allocator->fsa[sizeClass] == 0)
   {
     soa_initFSA(allocator,size,DEFAULT_NUM_BLOCKS);
   }
 #endif
   
-  assert(allocator->fsa[size-1]);
-  return soa_fsa_alloc(allocator->fsa[size-1]);
+  assert(allocator->fsa[sizeClass]);
+  return soa_fsa_alloc(allocator->fsa[sizeClass]);
 }
 
 /**
@@ -84,7 +107,124 @@ void * soa_alloc( soa_t *allocator, size_t size )
 */
 void soa_free( soa_t *allocator, void* ptr, size_t size )
 {
-  assert((size<=SOA_SMALL_OBJECT_MAX_SIZE) && (size>0)) ;
-  assert(allocator->fsa[size-1]);
-  soa_fsa_free(allocator->fsa[size-1],ptr);
+  assert(size>0);
+  if(size>SOA_SMALL_OBJECT_MAX_SIZE)
+  {
+    free(ptr);
+    soa_budget_release(&allocator->budget,size);
+    return;
+  }
+  assert(allocator->fsa[SOA_SIZE_CLASS(size)]);
+  soa_fsa_free(allocator->fsa[SOA_SIZE_CLASS(size)],ptr);
+}
+
+/**
+* Changes the size of a block previously allocated with soa_alloc.
+* Returns ptr unchanged when both sizes map to the same size class, otherwise the contents are moved
+* to a new block. Returns NULL (and leaves ptr untouched) when out of memory.
+*/
+void *soa_realloc( soa_t *allocator, void *ptr, size_t oldSize, size_t newSize )
+{
+  void *newPtr;
+  if(ptr == 0)
+  {
+    return soa_alloc(allocator,newSize);
+  }
+  if(newSize == 0)
+  {
+    soa_free(allocator,ptr,oldSize);
+    return (void*) 0;
+  }
+  if(oldSize>SOA_SMALL_OBJECT_MAX_SIZE)
+  {
+    if(newSize>SOA_SMALL_OBJECT_MAX_SIZE)
+    {
+      //large-object path all the way
+      if( (newSize>oldSize) && (!soa_budget_charge(&allocator->budget,newSize-oldSize)) )
+      {
+        return (void*) 0;
+      }
+      newPtr = realloc(ptr,newSize);
+      if(newPtr == 0)
+      {
+        if(newSize>oldSize)
+        {
+          soa_budget_release(&allocator->budget,newSize-oldSize);
+        }
+      }
+      else if(newSize<oldSize)
+      {
+        soa_budget_release(&allocator->budget,oldSize-newSize);
+      }
+      return newPtr;
+    }
+  }
+  else if( (newSize<=SOA_SMALL_OBJECT_MAX_SIZE) && (SOA_SIZE_CLASS(oldSize) == SOA_SIZE_CLASS(newSize)) )
+  {
+    return ptr; //block is already large enough
+  }
+  newPtr = soa_alloc(allocator,newSize);
+  if(newPtr != 0)
+  {
+    memcpy(newPtr,ptr,(oldSize<newSize)? oldSize : newSize);
+    soa_free(allocator,ptr,oldSize);
+  }
+  return newPtr;
+}
+
+/**
+* Sets the provider of chunk memory for all fixed size allocators. Must be called before the first allocation is made.
+*/
+void soa_setMemoryHandler( soa_t *allocator, const soa_memory_handler_t *handler )
+{
+  size_t i;
+  allocator->memoryHandler = handler;
+  for(i=0;i<SOA_NUM_SIZE_CLASSES;i++)
+  {
+    if(allocator->fsa[i]!=0)
+    {
+      soa_fsa_setMemoryHandler(allocator->fsa[i],handler);
+    }
+  }
+}
+
+/**
+* Sets the memory budget of the allocator (SOA_BUDGET_UNLIMITED disables a limit).
+* When growing beyond the soft limit the pressure handler is called. When the hard limit would be exceeded soa_alloc returns NULL.
+*/
+void soa_setLimits( soa_t *allocator, size_t softLimit, size_t hardLimit )
+{
+  allocator->budget.soft_limit = softLimit;
+  allocator->budget.hard_limit = hardLimit;
+}
+
+void soa_setPressureHandler( soa_t *allocator, soa_pressure_handler_t *handler, void *arg )
+{
+  allocator->budget.handler = handler;
+  allocator->budget.arg = arg;
+}
+
+/**
+* Returns number of bytes currently held by the allocator (chunks and large objects)
+*/
+size_t soa_bytesUsed( const soa_t *allocator )
+{
+  return allocator->budget.used;
+}
+
+/**
+* Releases all chunks without any allocated blocks. Returns number of bytes released.
+*/
+size_t soa_trim( soa_t *allocator )
+{
+  size_t i;
+  size_t before = allocator->budget.used;
+  for(i=0;i<SOA_NUM_SIZE_CLASSES;i++)
+  {
+    if(allocator->fsa[i]!=0)
+    {
+      soa_fsa_trim(allocator->fsa[i]);
+    }
+  }
+  return before - allocator->budget.used;
 }
@@ -0,0 +1,84 @@
+/*****************************************************************************
+* \file      soa_budget.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Memory budget for the small object allocator
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+#include "soa_budget.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void soa_budget_init(soa_budget_t *budget)
+{
+   if (budget != 0)
+   {
+      budget->used = 0u;
+      budget->soft_limit = SOA_BUDGET_UNLIMITED;
+      budget->hard_limit = SOA_BUDGET_UNLIMITED;
+      budget->handler = (soa_pressure_handler_t*) 0;
+      budget->arg = (void*) 0;
+      budget->in_handler = false;
+   }
+}
+
+/**
+ * Accounts numBytes of new memory to the budget.
+ * Invokes the pressure handler when the soft limit would be exceeded.
+ * Returns false (without charging anything) when the hard limit would be exceeded.
+ */
+bool soa_budget_charge(soa_budget_t *budget, size_t numBytes)
+{
+   if (budget == 0)
+   {
+      return true;
+   }
+   if ( (budget->soft_limit != SOA_BUDGET_UNLIMITED) && (budget->used + numBytes > budget->soft_limit) &&
+        (budget->handler != 0) && (!budget->in_handler) )
+   {
+      budget->in_handler = true;
+      budget->handler(budget->arg, budget->used, numBytes);
+      budget->in_handler = false;
+   }
+   if ( (budget->hard_limit != SOA_BUDGET_UNLIMITED) && (budget->used + numBytes > budget->hard_limit) )
+   {
+      return false;
+   }
+   budget->used += numBytes;
+   return true;
+}
+
+void soa_budget_release(soa_budget_t *budget, size_t numBytes)
+{
+   if (budget != 0)
+   {
+      assert(budget->used >= numBytes);
+      budget->used -= numBytes;
+   }
+}
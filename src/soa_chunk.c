@@ -16,11 +16,33 @@
 
 
 void soa_chunk_init( soa_chunk_t *chunk, size_t blockSize, unsigned char numBlocks )
+{
+  soa_chunk_initHandler(chunk, blockSize, numBlocks, 0);
+}
+
+void soa_chunk_destroy( soa_chunk_t *chunk )
+{
+  free(chunk->blockData);
+}
+
+void soa_chunk_initHandler( soa_chunk_t *chunk, size_t blockSize, unsigned char numBlocks, const soa_memory_handler_t *handler )
 {
   unsigned char i;
   unsigned char *p;
-  chunk->blockData = (unsigned char*) malloc(blockSize * numBlocks);
-  if(chunk->blockData == 0) return;
+  if(handler != 0)
+  {
+    chunk->blockData = (unsigned char*) handler->alloc(handler->arg, blockSize * numBlocks);
+  }
+  else
+  {
+    chunk->blockData = (unsigned char*) malloc(blockSize * numBlocks);
+  }
+  if(chunk->blockData == 0)
+  {
+    chunk->firstBlock = 0;
+    chunk->freeBlocks = 0;
+    return;
+  }
   chunk->firstBlock = 0;
   chunk->freeBlocks = numBlocks;
   for(i=0, p=chunk->blockData; i<numBlocks; p+=blockSize)
@@ -30,9 +52,19 @@ void soa_chunk_init( soa_chunk_t *chunk, size_t blockSize, unsigned char numBloc
   assert(p==chunk->blockData+(blockSize * numBlocks));
 }
 
-void soa_chunk_destroy( soa_chunk_t *chunk )
+void soa_chunk_destroyHandler( soa_chunk_t *chunk, size_t blockSize, unsigned char numBlocks, const soa_memory_handler_t *handler )
 {
-  free(chunk->blockData);
+  if(handler != 0)
+  {
+    if(chunk->blockData != 0)
+    {
+      handler->free(handler->arg, chunk->blockData, blockSize * numBlocks);
+    }
+  }
+  else
+  {
+    free(chunk->blockData);
+  }
 }
 
 void *soa_chunk_alloc( soa_chunk_t *chunk,size_t blockSize )
@@ -23,6 +23,8 @@ void soa_fsa_init( soa_fsa_t *allocator,size_t blockSize, unsigned char numBlock
   allocator->deallocChunk = 0;
   allocator->chunks_len = 0;
   allocator->chunks = 0;
+  allocator->memoryHandler = 0;
+  allocator->budget = 0;
 }
 
 void soa_fsa_destroy( soa_fsa_t *allocator )
@@ -33,8 +35,9 @@ void soa_fsa_destroy( soa_fsa_t *allocator )
   {
     for(i=0,p=allocator->chunks;i<allocator->chunks_len;i++,p++)
     {
-      soa_chunk_destroy(p);
+      soa_chunk_destroyHandler(p,allocator->blockSize,allocator->numBlocks,allocator->memoryHandler);
     }
+    soa_budget_release(allocator->budget,allocator->chunks_len*allocator->blockSize*allocator->numBlocks);
     free(allocator->chunks);
   }
 }
@@ -58,6 +61,11 @@ void * soa_fsa_alloc( soa_fsa_t *allocator )
     if(allocator->allocChunk == 0) //We still have not found a chunk with a free block?
     {
       soa_chunk_t *ptr;
+      const size_t chunkSizeBytes = allocator->blockSize*allocator->numBlocks;
+      if(!soa_budget_charge(allocator->budget,chunkSizeBytes))
+      {
+        return (void*) 0; //hard limit reached
+      }
       //grow chunk array by one
       allocator->chunks_len++;
       if (allocator->chunks == 0)
@@ -79,11 +87,19 @@ void * soa_fsa_alloc( soa_fsa_t *allocator )
         }
         allocator->chunks = ptr;
         chunk = allocator->chunks+allocator->chunks_len-1; //pointer to last chunk
-        soa_chunk_init(chunk,allocator->blockSize,allocator->numBlocks); //call constructor on newly created chunk
+        soa_chunk_initHandler(chunk,allocator->blockSize,allocator->numBlocks,allocator->memoryHandler); //call constructor on newly created chunk
+        if(chunk->blockData == 0)
+        {
+          allocator->chunks_len--; //out of memory, forget about the new chunk
+          soa_budget_release(allocator->budget,chunkSizeBytes);
+          return (void*) 0;
+        }
         allocator->allocChunk = chunk;
       }
       else
       {
+        allocator->chunks_len--;
+        soa_budget_release(allocator->budget,chunkSizeBytes);
         return (void*) 0;
       }
     }
@@ -96,14 +112,14 @@ void * soa_fsa_alloc( soa_fsa_t *allocator )
 void soa_fsa_free( soa_fsa_t *allocator, void* ptr )
 {
   size_t chunkSizeBytes = allocator->blockSize*allocator->numBlocks;
-  unsigned char *a, *b; //[a..b] is a (memory) range, where a is the first byte, and b is the last byte (in the range)
+  unsigned char *a, *b; //[a..b) is a (memory) range, where a is the first byte, and b is one past the last byte
   unsigned char *p = (unsigned char*) ptr;
   
   if(allocator->deallocChunk) //Is this deallocation in the same chunk as last time?
   {
     a = allocator->deallocChunk->blockData;
     b = allocator->deallocChunk->blockData+chunkSizeBytes;
-    if( (a <= p) && (p<=b)) //Does p fall in the range [a..b]?
+    if( (a <= p) && (p<b)) //Does p fall in the range [a..b)?
     {
       //Do nothing (deallocChunk is valid)
     }
@@ -121,7 +137,7 @@ void soa_fsa_free( soa_fsa_t *allocator, void* ptr )
     {
       a = chunk->blockData;
       b = chunk->blockData+chunkSizeBytes;
-      if( (a <= p) && (p<=b)) //Does p fall in the range [a..b]?
+      if( (a <= p) && (p<b)) //Does p fall in the range [a..b)?
       {
         //Found it!
         allocator->deallocChunk = chunk;
@@ -132,3 +148,69 @@ void soa_fsa_free( soa_fsa_t *allocator, void* ptr )
   assert(allocator->deallocChunk); //If this fails it means that ptr did not originate from this allocator
   soa_chunk_free(allocator->deallocChunk,ptr,allocator->blockSize);
 }
+
+/**
+* Releases all chunks that have no allocated blocks. Returns the number of chunks released.
+*/
+size_t soa_fsa_trim( soa_fsa_t *allocator )
+{
+  size_t i = 0;
+  size_t numReleased = 0;
+  while(i<allocator->chunks_len)
+  {
+    soa_chunk_t *chunk = allocator->chunks+i;
+    if(chunk->freeBlocks == allocator->numBlocks)
+    {
+      soa_chunk_destroyHandler(chunk,allocator->blockSize,allocator->numBlocks,allocator->memoryHandler);
+      allocator->chunks_len--;
+      if(i<allocator->chunks_len)
+      {
+        *chunk = allocator->chunks[allocator->chunks_len]; //move last chunk into the hole
+      }
+      numReleased++;
+    }
+    else
+    {
+      i++;
+    }
+  }
+  if(numReleased > 0)
+  {
+    soa_budget_release(allocator->budget,numReleased*allocator->blockSize*allocator->numBlocks);
+    //chunks have moved, all pointers into allocator->chunks must be invalidated
+    allocator->allocChunk = 0;
+    allocator->deallocChunk = 0;
+    if(allocator->chunks_len == 0)
+    {
+      free(allocator->chunks);
+      allocator->chunks = 0;
+    }
+    else
+    {
+      soa_chunk_t *ptr = (soa_chunk_t*) realloc(allocator->chunks,allocator->chunks_len * sizeof(soa_chunk_t));
+      if(ptr)
+      {
+        allocator->chunks = ptr;
+      }
+    }
+  }
+  return numReleased;
+}
+
+/**
+* Sets the provider of chunk memory. Must be called before the first allocation is made.
+*/
+void soa_fsa_setMemoryHandler( soa_fsa_t *allocator, const soa_memory_handler_t *handler )
+{
+  assert(allocator->chunks_len == 0);
+  allocator->memoryHandler = handler;
+}
+
+/**
+* Sets the budget that chunk memory is charged to. Must be called before the first allocation is made.
+*/
+void soa_fsa_setBudget( soa_fsa_t *allocator, soa_budget_t *budget )
+{
+  assert(allocator->chunks_len == 0);
+  allocator->budget = budget;
+}
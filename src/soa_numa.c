@@ -0,0 +1,406 @@
+/*****************************************************************************
+* \file      soa_numa.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     NUMA-aware small object allocator (one arena per memory node)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <assert.h>
+#include "soa_numa.h"
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#define SOA_NUMA_LINUX 1
+#endif
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+//Values from linux/mempolicy.h. Defined here to avoid a dependency on libnuma headers.
+#define NUMA_MPOL_BIND 2
+#define NUMA_MPOL_F_NODE (1 << 0)
+#define NUMA_MPOL_F_ADDR (1 << 1)
+#define NUMA_MPOL_F_MEMS_ALLOWED (1 << 2)
+
+#define NODE_MASK_BITS 1024u //must be at least as large as the kernel's MAX_NUMNODES
+#define BITS_PER_WORD (sizeof(unsigned long) * 8u)
+#define NODE_MASK_WORDS (NODE_MASK_BITS / BITS_PER_WORD)
+#define NODE_REFRESH_INTERVAL 1024u //number of calls between getcpu syscalls on the same thread
+#define REGION_ALIGN 64u
+
+#ifdef _WIN32
+#define MUTEX_INIT(m) InitializeCriticalSection(m)
+#define MUTEX_DESTROY(m) DeleteCriticalSection(m)
+#define MUTEX_LOCK(m) EnterCriticalSection(m)
+#define MUTEX_UNLOCK(m) LeaveCriticalSection(m)
+#else
+#define MUTEX_INIT(m) pthread_mutex_init(m, NULL)
+#define MUTEX_DESTROY(m) pthread_mutex_destroy(m)
+#define MUTEX_LOCK(m) pthread_mutex_lock(m)
+#define MUTEX_UNLOCK(m) pthread_mutex_unlock(m)
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void arena_create(soa_numa_arena_t *arena, int node);
+static void arena_destroy(soa_numa_arena_t *arena);
+#ifdef SOA_NUMA_LINUX
+static bool region_create(soa_numa_region_t *region, int node, bool *isBound);
+static void region_destroy(soa_numa_region_t *region);
+static void *region_alloc(void *arg, size_t size);
+static void region_free(void *arg, void *ptr, size_t size);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+#ifdef SOA_NUMA_LINUX
+static __thread int m_current_node;
+static __thread unsigned int m_node_countdown;
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Returns the highest memory node id available to this process (0 when unknown), capped at
+ * SOA_NUMA_MAX_NODES - 1. Arenas are indexed by node id, so soa_numa_init creates
+ * soa_numa_max_node() + 1 arenas. On sparse topologies (e.g. nodes 0 and 2) this is more
+ * than the number of nodes.
+ */
+int soa_numa_max_node(void)
+{
+#ifdef SOA_NUMA_LINUX
+   unsigned long mask[NODE_MASK_WORDS];
+   int maxNode = 0;
+   unsigned int i;
+   memset(mask, 0, sizeof(mask));
+   if (syscall(SYS_get_mempolicy, NULL, mask, (unsigned long) NODE_MASK_BITS, NULL, NUMA_MPOL_F_MEMS_ALLOWED) != 0)
+   {
+      return 0;
+   }
+   for (i = 0u; i < NODE_MASK_BITS; i++)
+   {
+      if ( (mask[i / BITS_PER_WORD] >> (i % BITS_PER_WORD)) & 1u )
+      {
+         maxNode = (int) i;
+      }
+   }
+   return (maxNode < SOA_NUMA_MAX_NODES)? maxNode : SOA_NUMA_MAX_NODES - 1;
+#else
+   return 0;
+#endif
+}
+
+/**
+ * Returns the node of the CPU the calling thread runs on.
+ * The value is cached per thread and refreshed every NODE_REFRESH_INTERVAL calls.
+ */
+int soa_numa_current_node(void)
+{
+#ifdef SOA_NUMA_LINUX
+   if (m_node_countdown == 0u)
+   {
+      unsigned int cpu = 0u;
+      unsigned int node = 0u;
+      m_current_node = (syscall(SYS_getcpu, &cpu, &node, NULL) == 0)? (int) node : 0;
+      m_node_countdown = NODE_REFRESH_INTERVAL;
+   }
+   m_node_countdown--;
+   return m_current_node;
+#else
+   return 0;
+#endif
+}
+
+/**
+ * Returns the node where the page containing ptr is located or -1 if unknown.
+ */
+int soa_numa_node_of(const void *ptr)
+{
+#ifdef SOA_NUMA_LINUX
+   int node = -1;
+   if (syscall(SYS_get_mempolicy, &node, NULL, 0ul, ptr, NUMA_MPOL_F_NODE | NUMA_MPOL_F_ADDR) == 0)
+   {
+      return node;
+   }
+#else
+   (void) ptr;
+#endif
+   return -1;
+}
+
+void soa_numa_init(soa_numa_t *self)
+{
+   soa_numa_init_nodes(self, soa_numa_max_node() + 1);
+}
+
+/**
+ * Creates one arena per node. With a single node this is just a locked soa_t.
+ * On Linux each arena reserves an address range which is bound to its node using mbind.
+ * When that fails (no NUMA support or node does not exist) the range is still used but left unbound.
+ * The object must not be moved in memory after this call.
+ */
+void soa_numa_init_nodes(soa_numa_t *self, int numNodes)
+{
+   if (self != 0)
+   {
+      int i;
+#ifdef SOA_NUMA_LINUX
+      if (numNodes > SOA_NUMA_MAX_NODES)
+      {
+         numNodes = SOA_NUMA_MAX_NODES;
+      }
+#else
+      numNodes = 1;
+#endif
+      if (numNodes < 1)
+      {
+         numNodes = 1;
+      }
+      memset(self, 0, sizeof(soa_numa_t));
+      self->num_arenas = numNodes;
+      for (i = 0; i < numNodes; i++)
+      {
+         arena_create(&self->arenas[i], i);
+      }
+#ifdef SOA_NUMA_LINUX
+      if (numNodes > 1)
+      {
+         for (i = 0; i < numNodes; i++)
+         {
+            soa_numa_arena_t *arena = &self->arenas[i];
+            if (!region_create(&arena->region, i, &arena->is_bound))
+            {
+               break;
+            }
+            arena->memoryHandler.arg = &arena->region;
+            arena->memoryHandler.alloc = region_alloc;
+            arena->memoryHandler.free = region_free;
+            soa_setMemoryHandler(&arena->soa, &arena->memoryHandler);
+         }
+         if (i < numNodes)
+         {
+            //Out of address space, fall back to a single arena
+            soa_numa_destroy(self);
+            soa_numa_init_nodes(self, 1);
+         }
+      }
+#endif
+   }
+}
+
+void soa_numa_destroy(soa_numa_t *self)
+{
+   if (self != 0)
+   {
+      int i;
+      for (i = 0; i < self->num_arenas; i++)
+      {
+         arena_destroy(&self->arenas[i]);
+      }
+      self->num_arenas = 0;
+   }
+}
+
+/**
+ * Allocates from the arena of the node the calling thread currently runs on.
+ */
+void *soa_numa_alloc(soa_numa_t *self, size_t size)
+{
+   if (self != 0)
+   {
+      int node = (self->num_arenas > 1)? soa_numa_current_node() : 0;
+      return soa_numa_alloc_on_node(self, node, size);
+   }
+   return (void*) 0;
+}
+
+void *soa_numa_alloc_on_node(soa_numa_t *self, int node, size_t size)
+{
+   void *ptr = (void*) 0;
+   if ( (self != 0) && (self->num_arenas > 0) && (node >= 0) )
+   {
+      //large objects are not kept in the arenas, they are all accounted for in the first one
+      soa_numa_arena_t *arena = (size > SOA_SMALL_OBJECT_MAX_SIZE)? &self->arenas[0] : &self->arenas[node % self->num_arenas];
+      MUTEX_LOCK(&arena->lock);
+      ptr = soa_alloc(&arena->soa, size);
+      if (ptr != 0)
+      {
+         arena->num_alloc++;
+      }
+      MUTEX_UNLOCK(&arena->lock);
+   }
+   return ptr;
+}
+
+/**
+ * Returns the object to the arena it was allocated from (which is not necessarily the local one).
+ */
+void soa_numa_free(soa_numa_t *self, void *ptr, size_t size)
+{
+   if ( (self != 0) && (ptr != 0) )
+   {
+      int index;
+      index = (size > SOA_SMALL_OBJECT_MAX_SIZE)? 0 : soa_numa_arena_of(self, ptr);
+      assert(index >= 0); //If this fails it means that ptr did not originate from this allocator
+      if (index >= 0)
+      {
+         soa_numa_arena_t *arena = &self->arenas[index];
+         MUTEX_LOCK(&arena->lock);
+         soa_free(&arena->soa, ptr, size);
+         arena->num_free++;
+         MUTEX_UNLOCK(&arena->lock);
+      }
+   }
+}
+
+/**
+ * Returns index of the arena owning ptr or -1 if ptr is not from any of the arenas.
+ */
+int soa_numa_arena_of(const soa_numa_t *self, const void *ptr)
+{
+   if (self != 0)
+   {
+      int i;
+      const uint8_t *p = (const uint8_t*) ptr;
+      if (self->num_arenas == 1)
+      {
+         return 0;
+      }
+      for (i = 0; i < self->num_arenas; i++)
+      {
+         const soa_numa_region_t *region = &self->arenas[i].region;
+         if ( (p >= region->base) && (p < region->base + region->size) )
+         {
+            return i;
+         }
+      }
+   }
+   return -1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+static void arena_create(soa_numa_arena_t *arena, int node)
+{
+   soa_init(&arena->soa);
+   memset(&arena->region, 0, sizeof(soa_numa_region_t));
+   memset(&arena->memoryHandler, 0, sizeof(soa_memory_handler_t));
+   MUTEX_INIT(&arena->lock);
+   arena->node = node;
+   arena->is_bound = false;
+   arena->num_alloc = 0u;
+   arena->num_free = 0u;
+}
+
+static void arena_destroy(soa_numa_arena_t *arena)
+{
+   soa_destroy(&arena->soa);
+#ifdef SOA_NUMA_LINUX
+   region_destroy(&arena->region);
+#endif
+   MUTEX_DESTROY(&arena->lock);
+}
+
+#ifdef SOA_NUMA_LINUX
+static bool region_create(soa_numa_region_t *region, int node, bool *isBound)
+{
+   unsigned long mask[NODE_MASK_WORDS];
+   void *base = mmap(NULL, SOA_NUMA_REGION_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+   if (base == MAP_FAILED)
+   {
+      return false;
+   }
+   memset(region, 0, sizeof(soa_numa_region_t));
+   region->base = (uint8_t*) base;
+   region->size = SOA_NUMA_REGION_SIZE;
+   //No pages have been touched yet so the policy applies to every page of the region
+   memset(mask, 0, sizeof(mask));
+   mask[(unsigned int) node / BITS_PER_WORD] = 1ul << ((unsigned int) node % BITS_PER_WORD);
+   *isBound = (syscall(SYS_mbind, base, (unsigned long) SOA_NUMA_REGION_SIZE, NUMA_MPOL_BIND, mask, (unsigned long) NODE_MASK_BITS, 0u) == 0);
+   return true;
+}
+
+static void region_destroy(soa_numa_region_t *region)
+{
+   if (region->base != 0)
+   {
+      munmap(region->base, region->size);
+      memset(region, 0, sizeof(soa_numa_region_t));
+   }
+}
+
+static void *region_alloc(void *arg, size_t size)
+{
+   soa_numa_region_t *region = (soa_numa_region_t*) arg;
+   uint8_t *p;
+   int i;
+   size = (size + REGION_ALIGN - 1u) & ~((size_t) REGION_ALIGN - 1u);
+   for (i = 0; i < SOA_NUMA_NUM_FREE_LISTS; i++)
+   {
+      if ( (region->free_size[i] == size) && (region->free_head[i] != 0) )
+      {
+         p = (uint8_t*) region->free_head[i];
+         memcpy(&region->free_head[i], p, sizeof(void*));
+         return p;
+      }
+   }
+   if (region->size - region->used < size)
+   {
+      return (void*) 0;
+   }
+   p = region->base + region->used;
+   region->used += size;
+   return p;
+}
+
+static void region_free(void *arg, void *ptr, size_t size)
+{
+   soa_numa_region_t *region = (soa_numa_region_t*) arg;
+   int i;
+   size = (size + REGION_ALIGN - 1u) & ~((size_t) REGION_ALIGN - 1u);
+   for (i = 0; i < SOA_NUMA_NUM_FREE_LISTS; i++)
+   {
+      if ( (region->free_size[i] == size) || (region->free_size[i] == 0u) )
+      {
+         region->free_size[i] = size;
+         memcpy(ptr, &region->free_head[i], sizeof(void*));
+         region->free_head[i] = ptr;
+         return;
+      }
+   }
+   //All free lists are taken by other sizes, memory is reclaimed when the region is destroyed
+}
+#endif
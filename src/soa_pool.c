@@ -0,0 +1,299 @@
+/*****************************************************************************
+* \file      soa_pool.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Handle-based object pool on top of the fixed size allocator
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "soa_pool.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NO_FREE_SLOT 0xFFFFFFFFu
+#define MIN_SLOTS_CAP 16u
+#define HANDLE_INDEX(h) ((h) & SOA_HANDLE_INDEX_MASK)
+#define HANDLE_GENERATION(h) ((h) >> SOA_HANDLE_INDEX_BITS)
+#define MAKE_HANDLE(index, generation) (((generation) << SOA_HANDLE_INDEX_BITS) | (index))
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static uint32_t take_slot(soa_pool_t *pool);
+static bool chunk_contains(const soa_chunk_t *chunk, size_t chunkSizeBytes, const void *ptr);
+static soa_chunk_t *find_evacuation_chunk(soa_pool_t *pool);
+static soa_chunk_t *find_target_chunk(soa_pool_t *pool, const soa_chunk_t *exclude);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void soa_pool_init(soa_pool_t *pool, size_t blockSize, unsigned char numBlocks)
+{
+   if (pool != 0)
+   {
+      soa_fsa_init(&pool->fsa, blockSize, numBlocks);
+      pool->slots = (soa_pool_slot_t*) 0;
+      pool->slots_len = 0u;
+      pool->slots_cap = 0u;
+      pool->free_slot = NO_FREE_SLOT;
+      pool->num_live = 0u;
+   }
+}
+
+void soa_pool_destroy(soa_pool_t *pool)
+{
+   if (pool != 0)
+   {
+      soa_fsa_destroy(&pool->fsa);
+      if (pool->slots != 0)
+      {
+         free(pool->slots);
+         pool->slots = (soa_pool_slot_t*) 0;
+      }
+      pool->slots_len = 0u;
+      pool->slots_cap = 0u;
+      pool->free_slot = NO_FREE_SLOT;
+      pool->num_live = 0u;
+   }
+}
+
+/**
+ * Allocates a new object from the pool and returns its handle.
+ * Returns SOA_HANDLE_INVALID when out of memory or when all slot indices are taken.
+ */
+soa_handle_t soa_pool_alloc(soa_pool_t *pool)
+{
+   if (pool != 0)
+   {
+      uint32_t index;
+      void *ptr = soa_fsa_alloc(&pool->fsa);
+      if (ptr == 0)
+      {
+         return SOA_HANDLE_INVALID;
+      }
+      index = take_slot(pool);
+      if (index == NO_FREE_SLOT)
+      {
+         soa_fsa_free(&pool->fsa, ptr);
+         return SOA_HANDLE_INVALID;
+      }
+      pool->slots[index].ptr = ptr;
+      pool->num_live++;
+      return MAKE_HANDLE(index, pool->slots[index].generation);
+   }
+   return SOA_HANDLE_INVALID;
+}
+
+/**
+ * Returns the object back to the pool. Stale or invalid handles are ignored.
+ */
+void soa_pool_free(soa_pool_t *pool, soa_handle_t handle)
+{
+   if (soa_pool_is_valid(pool, handle))
+   {
+      soa_pool_slot_t *slot = &pool->slots[HANDLE_INDEX(handle)];
+      soa_fsa_free(&pool->fsa, slot->ptr);
+      slot->ptr = (void*) 0;
+      //bumping the generation is what makes all outstanding copies of handle stale
+      slot->generation = (slot->generation < SOA_HANDLE_GENERATION_MAX)? slot->generation + 1u : 1u;
+      slot->next_free = pool->free_slot;
+      pool->free_slot = HANDLE_INDEX(handle);
+      pool->num_live--;
+   }
+}
+
+/**
+ * Returns current address of the object or NULL if the handle is stale.
+ * The address is only valid until the next call to soa_pool_compact.
+ */
+void *soa_pool_get(const soa_pool_t *pool, soa_handle_t handle)
+{
+   if (pool != 0)
+   {
+      uint32_t index = HANDLE_INDEX(handle);
+      if (index < pool->slots_len)
+      {
+         const soa_pool_slot_t *slot = &pool->slots[index];
+         if (slot->generation == HANDLE_GENERATION(handle))
+         {
+            return slot->ptr;
+         }
+      }
+   }
+   return (void*) 0;
+}
+
+bool soa_pool_is_valid(const soa_pool_t *pool, soa_handle_t handle)
+{
+   return soa_pool_get(pool, handle) != 0;
+}
+
+/**
+ * Incremental compaction step.
+ * Moves at most maxMoves live objects out of the most sparsely populated chunk into the
+ * fullest chunks that still have space. Chunks that become empty are released.
+ * Returns the number of objects moved.
+ */
+size_t soa_pool_compact(soa_pool_t *pool, size_t maxMoves)
+{
+   size_t numMoved = 0u;
+   if ( (pool != 0) && (maxMoves > 0u) )
+   {
+      soa_chunk_t *source;
+      soa_fsa_trim(&pool->fsa);
+      source = find_evacuation_chunk(pool);
+      if (source != 0)
+      {
+         uint32_t i;
+         const size_t blockSize = pool->fsa.blockSize;
+         const size_t chunkSizeBytes = blockSize * pool->fsa.numBlocks;
+         for (i = 0u; (i < pool->slots_len) && (numMoved < maxMoves); i++)
+         {
+            soa_pool_slot_t *slot = &pool->slots[i];
+            if ( (slot->ptr != 0) && chunk_contains(source, chunkSizeBytes, slot->ptr) )
+            {
+               void *newPtr;
+               soa_chunk_t *target = find_target_chunk(pool, source);
+               if (target == 0)
+               {
+                  break;
+               }
+               newPtr = soa_chunk_alloc(target, blockSize);
+               assert(newPtr != 0);
+               memcpy(newPtr, slot->ptr, blockSize);
+               soa_chunk_free(source, slot->ptr, blockSize);
+               slot->ptr = newPtr;
+               numMoved++;
+            }
+         }
+         if (source->freeBlocks == pool->fsa.numBlocks)
+         {
+            soa_fsa_trim(&pool->fsa);
+         }
+      }
+   }
+   return numMoved;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+static uint32_t take_slot(soa_pool_t *pool)
+{
+   uint32_t index;
+   if (pool->free_slot != NO_FREE_SLOT)
+   {
+      index = pool->free_slot;
+      pool->free_slot = pool->slots[index].next_free;
+      return index;
+   }
+   if (pool->slots_len > SOA_HANDLE_INDEX_MASK)
+   {
+      return NO_FREE_SLOT;
+   }
+   if (pool->slots_len == pool->slots_cap)
+   {
+      soa_pool_slot_t *slots;
+      uint32_t newCap = (pool->slots_cap == 0u)? MIN_SLOTS_CAP : pool->slots_cap * 2u;
+      if (newCap > SOA_HANDLE_INDEX_MASK + 1u)
+      {
+         newCap = SOA_HANDLE_INDEX_MASK + 1u;
+      }
+      slots = (soa_pool_slot_t*) realloc(pool->slots, newCap * sizeof(soa_pool_slot_t));
+      if (slots == 0)
+      {
+         return NO_FREE_SLOT;
+      }
+      pool->slots = slots;
+      pool->slots_cap = newCap;
+   }
+   index = pool->slots_len++;
+   pool->slots[index].ptr = (void*) 0;
+   pool->slots[index].next_free = NO_FREE_SLOT;
+   pool->slots[index].generation = 1u;
+   return index;
+}
+
+static bool chunk_contains(const soa_chunk_t *chunk, size_t chunkSizeBytes, const void *ptr)
+{
+   const unsigned char *p = (const unsigned char*) ptr;
+   return (p >= chunk->blockData) && (p < chunk->blockData + chunkSizeBytes);
+}
+
+/**
+ * Selects the partially used chunk with the fewest live objects, provided that the
+ * other chunks have enough free blocks to take over all of its objects.
+ */
+static soa_chunk_t *find_evacuation_chunk(soa_pool_t *pool)
+{
+   size_t i;
+   size_t totalFree = 0u;
+   soa_chunk_t *best = (soa_chunk_t*) 0;
+   for (i = 0u; i < pool->fsa.chunks_len; i++)
+   {
+      soa_chunk_t *chunk = &pool->fsa.chunks[i];
+      totalFree += chunk->freeBlocks;
+      if ( (best == 0) || (chunk->freeBlocks > best->freeBlocks) )
+      {
+         best = chunk;
+      }
+   }
+   if ( (best != 0) && (best->freeBlocks > 0u) )
+   {
+      size_t numLive = pool->fsa.numBlocks - best->freeBlocks;
+      if ( (totalFree - best->freeBlocks) >= numLive)
+      {
+         return best;
+      }
+   }
+   return (soa_chunk_t*) 0;
+}
+
+/**
+ * Selects the fullest chunk that still has at least one free block.
+ */
+static soa_chunk_t *find_target_chunk(soa_pool_t *pool, const soa_chunk_t *exclude)
+{
+   size_t i;
+   soa_chunk_t *best = (soa_chunk_t*) 0;
+   for (i = 0u; i < pool->fsa.chunks_len; i++)
+   {
+      soa_chunk_t *chunk = &pool->fsa.chunks[i];
+      if ( (chunk != exclude) && (chunk->freeBlocks > 0u) )
+      {
+         if ( (best == 0) || (chunk->freeBlocks < best->freeBlocks) )
+         {
+            best = chunk;
+         }
+      }
+   }
+   return best;
+}
@@ -0,0 +1,727 @@
+/*****************************************************************************
+* \file      xxh3.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     XXH3 64-bit and 128-bit non-cryptographic hash
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include "xxh3.h"
+#include "pack.h"
+#include "cutil_cpu.h"
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define XXH3_X86_SIMD
+#include <immintrin.h>
+#endif
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define PRIME32_1 0x9E3779B1u
+#define PRIME32_2 0x85EBCA77u
+#define PRIME32_3 0xC2B2AE3Du
+#define PRIME64_1 0x9E3779B185EBCA87ull
+#define PRIME64_2 0xC2B2AE3D27D4EB4Full
+#define PRIME64_3 0x165667B19E3779F9ull
+#define PRIME64_4 0x85EBCA77C2B2AE63ull
+#define PRIME64_5 0x27D4EB2F165667C5ull
+#define PRIME_MX1 0x165667919E3779F9ull
+#define PRIME_MX2 0x9FB21C651E98DF25ull
+
+#define STRIPE_LEN 64u
+#define SECRET_CONSUME_RATE 8u
+#define STRIPES_PER_BLOCK ((XXH3_SECRET_SIZE - STRIPE_LEN) / SECRET_CONSUME_RATE)
+#define BLOCK_LEN (STRIPE_LEN * STRIPES_PER_BLOCK)
+#define MIDSIZE_MAX 240u
+#define MIDSIZE_START_OFFSET 3u
+#define MIDSIZE_LAST_OFFSET 17u
+#define SECRET_SIZE_MIN 136u
+#define SECRET_LASTACC_START 7u
+#define SECRET_MERGEACCS_START 11u
+
+//Accumulates nbStripes consecutive 64-byte stripes, stripe n uses the secret at offset n * 8
+typedef void (accumulate_func_t)(uint64_t acc[8], const uint8_t *input, const uint8_t *secret, size_t nbStripes);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static inline uint64_t mul128_fold64(uint64_t a, uint64_t b);
+static inline xxh3_128_t mul64to128(uint64_t a, uint64_t b);
+static inline uint64_t rotl64(uint64_t value, unsigned count);
+static inline uint32_t swap32(uint32_t value);
+static inline uint64_t swap64(uint64_t value);
+static uint64_t xxh64_avalanche(uint64_t h);
+static uint64_t avalanche(uint64_t h);
+static uint64_t rrmxmx(uint64_t h, uint64_t len);
+static inline uint64_t mix16(const uint8_t *input, const uint8_t *secret, uint64_t seed);
+static inline void mix32(xxh3_128_t *acc, const uint8_t *input1, const uint8_t *input2, const uint8_t *secret, uint64_t seed);
+static uint64_t hash64_short(const uint8_t *input, size_t len, uint64_t seed);
+static xxh3_128_t hash128_short(const uint8_t *input, size_t len, uint64_t seed);
+static void init_secret(uint8_t secret[XXH3_SECRET_SIZE], uint64_t seed);
+static void init_acc(uint64_t acc[8]);
+static void accumulate(uint64_t acc[8], const uint8_t *input, const uint8_t *secret, size_t nbStripes);
+static void hash_long(uint64_t acc[8], const uint8_t *input, size_t len, const uint8_t *secret);
+static void scramble(uint64_t acc[8], const uint8_t *secret);
+static uint64_t merge_accs(const uint64_t acc[8], const uint8_t *secret, uint64_t start);
+static void consume_stripes(uint64_t acc[8], size_t *stripesInBlock, const uint8_t *input, size_t nbStripes, const uint8_t *secret);
+static void digest_long(const xxh3_state_t *state, uint64_t acc[8]);
+static void accumulate_scalar(uint64_t acc[8], const uint8_t *input, const uint8_t *secret, size_t nbStripes);
+#ifdef XXH3_X86_SIMD
+static void accumulate_sse2(uint64_t acc[8], const uint8_t *input, const uint8_t *secret, size_t nbStripes);
+static void accumulate_avx2(uint64_t acc[8], const uint8_t *input, const uint8_t *secret, size_t nbStripes);
+static void accumulate_avx512(uint64_t acc[8], const uint8_t *input, const uint8_t *secret, size_t nbStripes);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const uint8_t m_default_secret[XXH3_SECRET_SIZE] = {
+   0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+   0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+   0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+   0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+   0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+   0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+   0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+   0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+   0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+   0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+   0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+   0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+};
+
+#ifdef XXH3_X86_SIMD
+//best first, accumulate_scalar is the fallback
+static const cutil_cpu_variant_t m_accumulate_variants[] =
+{
+   {"avx512", CUTIL_CPU_AVX512F, (cutil_cpu_func_t*) accumulate_avx512},
+   {"avx2", CUTIL_CPU_AVX2, (cutil_cpu_func_t*) accumulate_avx2},
+   {"sse2", CUTIL_CPU_SSE2, (cutil_cpu_func_t*) accumulate_sse2},
+   {"scalar", 0u, (cutil_cpu_func_t*) accumulate_scalar}
+};
+static cutil_cpu_dispatch_t m_accumulate_dispatch = CUTIL_CPU_DISPATCH_INIT(m_accumulate_variants);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Inputs up to 240 bytes take a short path without accumulator setup; longer inputs are
+ * processed in 64-byte stripes by the widest SIMD kernel available.
+ */
+uint64_t xxh3_64(const void *data, size_t len, uint64_t seed)
+{
+   const uint8_t *input = (const uint8_t*) data;
+   if (len <= MIDSIZE_MAX)
+   {
+      return hash64_short(input, len, seed);
+   }
+   else
+   {
+      uint8_t customSecret[XXH3_SECRET_SIZE];
+      const uint8_t *secret = m_default_secret;
+      uint64_t acc[8];
+      if (seed != 0u)
+      {
+         init_secret(customSecret, seed);
+         secret = customSecret;
+      }
+      hash_long(acc, input, len, secret);
+      return merge_accs(acc, secret + SECRET_MERGEACCS_START, (uint64_t) len * PRIME64_1);
+   }
+}
+
+xxh3_128_t xxh3_128(const void *data, size_t len, uint64_t seed)
+{
+   const uint8_t *input = (const uint8_t*) data;
+   if (len <= MIDSIZE_MAX)
+   {
+      return hash128_short(input, len, seed);
+   }
+   else
+   {
+      uint8_t customSecret[XXH3_SECRET_SIZE];
+      const uint8_t *secret = m_default_secret;
+      uint64_t acc[8];
+      xxh3_128_t result;
+      if (seed != 0u)
+      {
+         init_secret(customSecret, seed);
+         secret = customSecret;
+      }
+      hash_long(acc, input, len, secret);
+      result.lo = merge_accs(acc, secret + SECRET_MERGEACCS_START, (uint64_t) len * PRIME64_1);
+      result.hi = merge_accs(acc, secret + XXH3_SECRET_SIZE - STRIPE_LEN - SECRET_MERGEACCS_START, ~((uint64_t) len * PRIME64_2));
+      return result;
+   }
+}
+
+void xxh3_init(xxh3_state_t *state, uint64_t seed)
+{
+   init_acc(state->acc);
+   init_secret(state->secret, seed);
+   state->buffered = 0u;
+   state->stripes_in_block = 0u;
+   state->total_len = 0u;
+   state->seed = seed;
+}
+
+/**
+ * Data is only consumed once it is known not to be the end of the input, the final stripe
+ * is processed by the digest functions.
+ */
+void xxh3_update(xxh3_state_t *state, const void *data, size_t len)
+{
+   const uint8_t *input = (const uint8_t*) data;
+   state->total_len += len;
+   if (len <= XXH3_BUFFER_SIZE - state->buffered)
+   {
+      if (len > 0u)
+      {
+         memcpy(&state->buffer[state->buffered], input, len);
+         state->buffered += len;
+      }
+      return;
+   }
+   if (state->buffered > 0u)
+   {
+      const size_t fill = XXH3_BUFFER_SIZE - state->buffered;
+      memcpy(&state->buffer[state->buffered], input, fill);
+      input += fill;
+      len -= fill;
+      consume_stripes(state->acc, &state->stripes_in_block, state->buffer, XXH3_BUFFER_SIZE / STRIPE_LEN, state->secret);
+      state->buffered = 0u;
+   }
+   if (len > XXH3_BUFFER_SIZE)
+   {
+      const size_t nbStripes = (len - 1u) / STRIPE_LEN;
+      consume_stripes(state->acc, &state->stripes_in_block, input, nbStripes, state->secret);
+      input += nbStripes * STRIPE_LEN;
+      len -= nbStripes * STRIPE_LEN;
+      memcpy(&state->buffer[XXH3_BUFFER_SIZE - STRIPE_LEN], input - STRIPE_LEN, STRIPE_LEN);
+   }
+   memcpy(state->buffer, input, len);
+   state->buffered = len;
+}
+
+uint64_t xxh3_digest64(const xxh3_state_t *state)
+{
+   if (state->total_len > MIDSIZE_MAX)
+   {
+      uint64_t acc[8];
+      digest_long(state, acc);
+      return merge_accs(acc, state->secret + SECRET_MERGEACCS_START, state->total_len * PRIME64_1);
+   }
+   //the whole input is still in the buffer
+   return hash64_short(state->buffer, (size_t) state->total_len, state->seed);
+}
+
+xxh3_128_t xxh3_digest128(const xxh3_state_t *state)
+{
+   if (state->total_len > MIDSIZE_MAX)
+   {
+      uint64_t acc[8];
+      xxh3_128_t result;
+      digest_long(state, acc);
+      result.lo = merge_accs(acc, state->secret + SECRET_MERGEACCS_START, state->total_len * PRIME64_1);
+      result.hi = merge_accs(acc, state->secret + XXH3_SECRET_SIZE - STRIPE_LEN - SECRET_MERGEACCS_START, ~(state->total_len * PRIME64_2));
+      return result;
+   }
+   return hash128_short(state->buffer, (size_t) state->total_len, state->seed);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static inline uint64_t mul128_fold64(uint64_t a, uint64_t b)
+{
+   xxh3_128_t product = mul64to128(a, b);
+   return product.lo ^ product.hi;
+}
+
+static inline xxh3_128_t mul64to128(uint64_t a, uint64_t b)
+{
+   xxh3_128_t result;
+#ifdef __SIZEOF_INT128__
+   unsigned __int128 product = (unsigned __int128) a * b;
+   result.lo = (uint64_t) product;
+   result.hi = (uint64_t) (product >> 64);
+#else
+   const uint64_t loLo = (a & 0xFFFFFFFFu) * (b & 0xFFFFFFFFu);
+   const uint64_t hiLo = (a >> 32) * (b & 0xFFFFFFFFu);
+   const uint64_t loHi = (a & 0xFFFFFFFFu) * (b >> 32);
+   const uint64_t hiHi = (a >> 32) * (b >> 32);
+   const uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFFu) + loHi;
+   result.hi = (hiLo >> 32) + (cross >> 32) + hiHi;
+   result.lo = (cross << 32) | (loLo & 0xFFFFFFFFu);
+#endif
+   return result;
+}
+
+static inline uint64_t rotl64(uint64_t value, unsigned count)
+{
+   return (value << count) | (value >> (64u - count));
+}
+
+static inline uint32_t swap32(uint32_t value)
+{
+   return ((value << 24) & 0xFF000000u) | ((value << 8) & 0x00FF0000u) |
+          ((value >> 8) & 0x0000FF00u) | ((value >> 24) & 0x000000FFu);
+}
+
+static inline uint64_t swap64(uint64_t value)
+{
+   return ((uint64_t) swap32((uint32_t) value) << 32) | swap32((uint32_t) (value >> 32));
+}
+
+static uint64_t xxh64_avalanche(uint64_t h)
+{
+   h ^= h >> 33;
+   h *= PRIME64_2;
+   h ^= h >> 29;
+   h *= PRIME64_3;
+   h ^= h >> 32;
+   return h;
+}
+
+static uint64_t avalanche(uint64_t h)
+{
+   h ^= h >> 37;
+   h *= PRIME_MX1;
+   h ^= h >> 32;
+   return h;
+}
+
+static uint64_t rrmxmx(uint64_t h, uint64_t len)
+{
+   h ^= rotl64(h, 49) ^ rotl64(h, 24);
+   h *= PRIME_MX2;
+   h ^= (h >> 35) + len;
+   h *= PRIME_MX2;
+   h ^= h >> 28;
+   return h;
+}
+
+static inline uint64_t mix16(const uint8_t *input, const uint8_t *secret, uint64_t seed)
+{
+   return mul128_fold64(unpack_u64le(input) ^ (unpack_u64le(secret) + seed),
+                        unpack_u64le(input + 8) ^ (unpack_u64le(secret + 8) - seed));
+}
+
+static inline void mix32(xxh3_128_t *acc, const uint8_t *input1, const uint8_t *input2, const uint8_t *secret, uint64_t seed)
+{
+   acc->lo += mix16(input1, secret, seed);
+   acc->lo ^= unpack_u64le(input2) + unpack_u64le(input2 + 8);
+   acc->hi += mix16(input2, secret + 16, seed);
+   acc->hi ^= unpack_u64le(input1) + unpack_u64le(input1 + 8);
+}
+
+static uint64_t hash64_short(const uint8_t *input, size_t len, uint64_t seed)
+{
+   const uint8_t *secret = m_default_secret;
+   if (len <= 16u)
+   {
+      if (len > 8u)
+      {
+         const uint64_t bitflip1 = (unpack_u64le(secret + 24) ^ unpack_u64le(secret + 32)) + seed;
+         const uint64_t bitflip2 = (unpack_u64le(secret + 40) ^ unpack_u64le(secret + 48)) - seed;
+         const uint64_t inputLo = unpack_u64le(input) ^ bitflip1;
+         const uint64_t inputHi = unpack_u64le(input + len - 8u) ^ bitflip2;
+         const uint64_t acc = len + swap64(inputLo) + inputHi + mul128_fold64(inputLo, inputHi);
+         return avalanche(acc);
+      }
+      else if (len >= 4u)
+      {
+         uint64_t bitflip, input64;
+         seed ^= (uint64_t) swap32((uint32_t) seed) << 32;
+         bitflip = (unpack_u64le(secret + 8) ^ unpack_u64le(secret + 16)) - seed;
+         input64 = unpack_u32le(input + len - 4u) + ((uint64_t) unpack_u32le(input) << 32);
+         return rrmxmx(input64 ^ bitflip, len);
+      }
+      else if (len > 0u)
+      {
+         const uint32_t combined = ((uint32_t) input[0] << 16) | ((uint32_t) input[len >> 1] << 24) |
+                                   (uint32_t) input[len - 1u] | ((uint32_t) len << 8);
+         const uint64_t bitflip = (unpack_u32le(secret) ^ unpack_u32le(secret + 4)) + seed;
+         return xxh64_avalanche((uint64_t) combined ^ bitflip);
+      }
+      return xxh64_avalanche(seed ^ (unpack_u64le(secret + 56) ^ unpack_u64le(secret + 64)));
+   }
+   else if (len <= 128u)
+   {
+      uint64_t acc = len * PRIME64_1;
+      if (len > 32u)
+      {
+         if (len > 64u)
+         {
+            if (len > 96u)
+            {
+               acc += mix16(input + 48, secret + 96, seed);
+               acc += mix16(input + len - 64u, secret + 112, seed);
+            }
+            acc += mix16(input + 32, secret + 64, seed);
+            acc += mix16(input + len - 48u, secret + 80, seed);
+         }
+         acc += mix16(input + 16, secret + 32, seed);
+         acc += mix16(input + len - 32u, secret + 48, seed);
+      }
+      acc += mix16(input, secret, seed);
+      acc += mix16(input + len - 16u, secret + 16, seed);
+      return avalanche(acc);
+   }
+   else
+   {
+      const size_t nbRounds = len / 16u;
+      uint64_t acc = len * PRIME64_1;
+      size_t i;
+      for (i = 0u; i < 8u; i++)
+      {
+         acc += mix16(input + 16u * i, secret + 16u * i, seed);
+      }
+      acc = avalanche(acc);
+      for (i = 8u; i < nbRounds; i++)
+      {
+         acc += mix16(input + 16u * i, secret + 16u * (i - 8u) + MIDSIZE_START_OFFSET, seed);
+      }
+      acc += mix16(input + len - 16u, secret + SECRET_SIZE_MIN - MIDSIZE_LAST_OFFSET, seed);
+      return avalanche(acc);
+   }
+}
+
+static xxh3_128_t hash128_short(const uint8_t *input, size_t len, uint64_t seed)
+{
+   const uint8_t *secret = m_default_secret;
+   xxh3_128_t result;
+   if (len <= 16u)
+   {
+      if (len > 8u)
+      {
+         const uint64_t bitflipLo = (unpack_u64le(secret + 32) ^ unpack_u64le(secret + 40)) - seed;
+         const uint64_t bitflipHi = (unpack_u64le(secret + 48) ^ unpack_u64le(secret + 56)) + seed;
+         const uint64_t inputLo = unpack_u64le(input);
+         uint64_t inputHi = unpack_u64le(input + len - 8u);
+         xxh3_128_t m = mul64to128(inputLo ^ inputHi ^ bitflipLo, PRIME64_1);
+         m.lo += (uint64_t) (len - 1u) << 54;
+         inputHi ^= bitflipHi;
+         m.hi += inputHi + (uint64_t) (uint32_t) inputHi * (PRIME32_2 - 1u);
+         m.lo ^= swap64(m.hi);
+         result = mul64to128(m.lo, PRIME64_2);
+         result.hi += m.hi * PRIME64_2;
+         result.lo = avalanche(result.lo);
+         result.hi = avalanche(result.hi);
+      }
+      else if (len >= 4u)
+      {
+         uint64_t bitflip, input64;
+         seed ^= (uint64_t) swap32((uint32_t) seed) << 32;
+         input64 = unpack_u32le(input) + ((uint64_t) unpack_u32le(input + len - 4u) << 32);
+         bitflip = (unpack_u64le(secret + 16) ^ unpack_u64le(secret + 24)) + seed;
+         result = mul64to128(input64 ^ bitflip, PRIME64_1 + (len << 2));
+         result.hi += result.lo << 1;
+         result.lo ^= result.hi >> 3;
+         result.lo ^= result.lo >> 35;
+         result.lo *= PRIME_MX2;
+         result.lo ^= result.lo >> 28;
+         result.hi = avalanche(result.hi);
+      }
+      else if (len > 0u)
+      {
+         const uint32_t combinedLo = ((uint32_t) input[0] << 16) | ((uint32_t) input[len >> 1] << 24) |
+                                     (uint32_t) input[len - 1u] | ((uint32_t) len << 8);
+         const uint32_t swapped = swap32(combinedLo);
+         const uint32_t combinedHi = (swapped << 13) | (swapped >> 19);
+         const uint64_t bitflipLo = (unpack_u32le(secret) ^ unpack_u32le(secret + 4)) + seed;
+         const uint64_t bitflipHi = (unpack_u32le(secret + 8) ^ unpack_u32le(secret + 12)) - seed;
+         result.lo = xxh64_avalanche((uint64_t) combinedLo ^ bitflipLo);
+         result.hi = xxh64_avalanche((uint64_t) combinedHi ^ bitflipHi);
+      }
+      else
+      {
+         result.lo = xxh64_avalanche(seed ^ unpack_u64le(secret + 64) ^ unpack_u64le(secret + 72));
+         result.hi = xxh64_avalanche(seed ^ unpack_u64le(secret + 80) ^ unpack_u64le(secret + 88));
+      }
+      return result;
+   }
+   else
+   {
+      xxh3_128_t acc;
+      acc.lo = len * PRIME64_1;
+      acc.hi = 0u;
+      if (len <= 128u)
+      {
+         if (len > 32u)
+         {
+            if (len > 64u)
+            {
+               if (len > 96u)
+               {
+                  mix32(&acc, input + 48, input + len - 64u, secret + 96, seed);
+               }
+               mix32(&acc, input + 32, input + len - 48u, secret + 64, seed);
+            }
+            mix32(&acc, input + 16, input + len - 32u, secret + 32, seed);
+         }
+         mix32(&acc, input, input + len - 16u, secret, seed);
+      }
+      else
+      {
+         size_t i;
+         for (i = 32u; i < 160u; i += 32u)
+         {
+            mix32(&acc, input + i - 32u, input + i - 16u, secret + i - 32u, seed);
+         }
+         acc.lo = avalanche(acc.lo);
+         acc.hi = avalanche(acc.hi);
+         for (i = 160u; i <= len; i += 32u)
+         {
+            mix32(&acc, input + i - 32u, input + i - 16u, secret + MIDSIZE_START_OFFSET + i - 160u, seed);
+         }
+         mix32(&acc, input + len - 16u, input + len - 32u, secret + SECRET_SIZE_MIN - MIDSIZE_LAST_OFFSET - 16u, 0u - seed);
+      }
+      result.lo = acc.lo + acc.hi;
+      result.hi = acc.lo * PRIME64_1 + acc.hi * PRIME64_4 + (len - seed) * PRIME64_2;
+      result.lo = avalanche(result.lo);
+      result.hi = 0u - avalanche(result.hi);
+      return result;
+   }
+}
+
+/**
+ * Seeded long hashes use a secret derived from the default one, short hashes mix the seed directly.
+ */
+static void init_secret(uint8_t secret[XXH3_SECRET_SIZE], uint64_t seed)
+{
+   size_t i;
+   for (i = 0u; i < XXH3_SECRET_SIZE; i += 16u)
+   {
+      pack_u64le(&secret[i], unpack_u64le(&m_default_secret[i]) + seed);
+      pack_u64le(&secret[i + 8u], unpack_u64le(&m_default_secret[i + 8u]) - seed);
+   }
+}
+
+static void init_acc(uint64_t acc[8])
+{
+   acc[0] = PRIME32_3;
+   acc[1] = PRIME64_1;
+   acc[2] = PRIME64_2;
+   acc[3] = PRIME64_3;
+   acc[4] = PRIME64_4;
+   acc[5] = PRIME32_2;
+   acc[6] = PRIME64_5;
+   acc[7] = PRIME32_1;
+}
+
+static void accumulate(uint64_t acc[8], const uint8_t *input, const uint8_t *secret, size_t nbStripes)
+{
+#ifdef XXH3_X86_SIMD
+   accumulate_func_t *func = (accumulate_func_t*) cutil_cpu_resolve(&m_accumulate_dispatch);
+   func(acc, input, secret, nbStripes);
+#else
+   accumulate_scalar(acc, input, secret, nbStripes);
+#endif
+}
+
+/**
+ * len > 240. Full blocks of 16 stripes are each followed by a scramble, then the remaining
+ * stripes except the last one and finally the last 64 bytes of input (which may overlap).
+ */
+static void hash_long(uint64_t acc[8], const uint8_t *input, size_t len, const uint8_t *secret)
+{
+   const size_t nbBlocks = (len - 1u) / BLOCK_LEN;
+   size_t n;
+   init_acc(acc);
+   for (n = 0u; n < nbBlocks; n++)
+   {
+      accumulate(acc, input + n * BLOCK_LEN, secret, STRIPES_PER_BLOCK);
+      scramble(acc, secret + XXH3_SECRET_SIZE - STRIPE_LEN);
+   }
+   accumulate(acc, input + nbBlocks * BLOCK_LEN, secret, ((len - 1u) - nbBlocks * BLOCK_LEN) / STRIPE_LEN);
+   accumulate(acc, input + len - STRIPE_LEN, secret + XXH3_SECRET_SIZE - STRIPE_LEN - SECRET_LASTACC_START, 1u);
+}
+
+static void scramble(uint64_t acc[8], const uint8_t *secret)
+{
+   size_t i;
+   for (i = 0u; i < XXH3_NUM_ACC; i++)
+   {
+      uint64_t value = acc[i];
+      value ^= value >> 47;
+      value ^= unpack_u64le(secret + 8u * i);
+      acc[i] = value * PRIME32_1;
+   }
+}
+
+static uint64_t merge_accs(const uint64_t acc[8], const uint8_t *secret, uint64_t start)
+{
+   uint64_t result = start;
+   size_t i;
+   for (i = 0u; i < 4u; i++)
+   {
+      result += mul128_fold64(acc[2u * i] ^ unpack_u64le(secret + 16u * i), acc[2u * i + 1u] ^ unpack_u64le(secret + 16u * i + 8u));
+   }
+   return avalanche(result);
+}
+
+static void consume_stripes(uint64_t acc[8], size_t *stripesInBlock, const uint8_t *input, size_t nbStripes, const uint8_t *secret)
+{
+   while (nbStripes > 0u)
+   {
+      size_t n = STRIPES_PER_BLOCK - *stripesInBlock;
+      if (n > nbStripes)
+      {
+         n = nbStripes;
+      }
+      accumulate(acc, input, secret + *stripesInBlock * SECRET_CONSUME_RATE, n);
+      *stripesInBlock += n;
+      input += n * STRIPE_LEN;
+      nbStripes -= n;
+      if (*stripesInBlock == STRIPES_PER_BLOCK)
+      {
+         scramble(acc, secret + XXH3_SECRET_SIZE - STRIPE_LEN);
+         *stripesInBlock = 0u;
+      }
+   }
+}
+
+/**
+ * Finishes a copy of the accumulators with the buffered data, the state itself is not modified
+ * so that more data can be added after a digest.
+ */
+static void digest_long(const xxh3_state_t *state, uint64_t acc[8])
+{
+   const uint8_t *lastStripe;
+   uint8_t lastStripeCopy[STRIPE_LEN];
+   memcpy(acc, state->acc, sizeof(state->acc));
+   if (state->buffered >= STRIPE_LEN)
+   {
+      size_t stripesInBlock = state->stripes_in_block;
+      consume_stripes(acc, &stripesInBlock, state->buffer, (state->buffered - 1u) / STRIPE_LEN, state->secret);
+      lastStripe = &state->buffer[state->buffered - STRIPE_LEN];
+   }
+   else
+   {
+      const size_t catchUp = STRIPE_LEN - state->buffered;
+      memcpy(lastStripeCopy, &state->buffer[XXH3_BUFFER_SIZE - catchUp], catchUp);
+      memcpy(&lastStripeCopy[catchUp], state->buffer, state->buffered);
+      lastStripe = lastStripeCopy;
+   }
+   accumulate(acc, lastStripe, state->secret + XXH3_SECRET_SIZE - STRIPE_LEN - SECRET_LASTACC_START, 1u);
+}
+
+static void accumulate_scalar(uint64_t acc[8], const uint8_t *input, const uint8_t *secret, size_t nbStripes)
+{
+   size_t n, i;
+   for (n = 0u; n < nbStripes; n++)
+   {
+      for (i = 0u; i < XXH3_NUM_ACC; i++)
+      {
+         const uint64_t value = unpack_u64le(input + 8u * i);
+         const uint64_t key = value ^ unpack_u64le(secret + 8u * i);
+         acc[i ^ 1u] += value;
+         acc[i] += (uint64_t) (uint32_t) key * (key >> 32);
+      }
+      input += STRIPE_LEN;
+      secret += SECRET_CONSUME_RATE;
+   }
+}
+
+#ifdef XXH3_X86_SIMD
+/*
+ * The SIMD kernels follow accumulate_scalar: each 64-bit lane adds the neighbouring input word
+ * (swap of 64-bit halves) and the 32x32-bit product of the low and high half of input ^ secret.
+ */
+__attribute__((target("sse2")))
+static void accumulate_sse2(uint64_t acc[8], const uint8_t *input, const uint8_t *secret, size_t nbStripes)
+{
+   __m128i a[4];
+   size_t n;
+   int i;
+   for (i = 0; i < 4; i++)
+   {
+      a[i] = _mm_loadu_si128((const __m128i*) &acc[i * 2]);
+   }
+   for (n = 0u; n < nbStripes; n++)
+   {
+      for (i = 0; i < 4; i++)
+      {
+         const __m128i value = _mm_loadu_si128((const __m128i*) (input + i * 16));
+         const __m128i key = _mm_xor_si128(value, _mm_loadu_si128((const __m128i*) (secret + i * 16)));
+         const __m128i product = _mm_mul_epu32(key, _mm_srli_epi64(key, 32));
+         a[i] = _mm_add_epi64(a[i], _mm_add_epi64(product, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2))));
+      }
+      input += STRIPE_LEN;
+      secret += SECRET_CONSUME_RATE;
+   }
+   for (i = 0; i < 4; i++)
+   {
+      _mm_storeu_si128((__m128i*) &acc[i * 2], a[i]);
+   }
+}
+
+__attribute__((target("avx2")))
+static void accumulate_avx2(uint64_t acc[8], const uint8_t *input, const uint8_t *secret, size_t nbStripes)
+{
+   __m256i a0 = _mm256_loadu_si256((const __m256i*) &acc[0]);
+   __m256i a1 = _mm256_loadu_si256((const __m256i*) &acc[4]);
+   size_t n;
+   for (n = 0u; n < nbStripes; n++)
+   {
+      const __m256i value0 = _mm256_loadu_si256((const __m256i*) input);
+      const __m256i value1 = _mm256_loadu_si256((const __m256i*) (input + 32));
+      const __m256i key0 = _mm256_xor_si256(value0, _mm256_loadu_si256((const __m256i*) secret));
+      const __m256i key1 = _mm256_xor_si256(value1, _mm256_loadu_si256((const __m256i*) (secret + 32)));
+      a0 = _mm256_add_epi64(a0, _mm256_add_epi64(_mm256_mul_epu32(key0, _mm256_srli_epi64(key0, 32)),
+                                                 _mm256_shuffle_epi32(value0, _MM_SHUFFLE(1, 0, 3, 2))));
+      a1 = _mm256_add_epi64(a1, _mm256_add_epi64(_mm256_mul_epu32(key1, _mm256_srli_epi64(key1, 32)),
+                                                 _mm256_shuffle_epi32(value1, _MM_SHUFFLE(1, 0, 3, 2))));
+      input += STRIPE_LEN;
+      secret += SECRET_CONSUME_RATE;
+   }
+   _mm256_storeu_si256((__m256i*) &acc[0], a0);
+   _mm256_storeu_si256((__m256i*) &acc[4], a1);
+   _mm256_zeroupper();
+}
+
+__attribute__((target("avx512f")))
+static void accumulate_avx512(uint64_t acc[8], const uint8_t *input, const uint8_t *secret, size_t nbStripes)
+{
+   __m512i a = _mm512_loadu_si512((const void*) acc);
+   size_t n;
+   for (n = 0u; n < nbStripes; n++)
+   {
+      const __m512i value = _mm512_loadu_si512((const void*) input);
+      const __m512i key = _mm512_xor_si512(value, _mm512_loadu_si512((const void*) secret));
+      a = _mm512_add_epi64(a, _mm512_add_epi64(_mm512_mul_epu32(key, _mm512_srli_epi64(key, 32)),
+                                               _mm512_shuffle_epi32(value, (_MM_PERM_ENUM) _MM_SHUFFLE(1, 0, 3, 2))));
+      input += STRIPE_LEN;
+      secret += SECRET_CONSUME_RATE;
+   }
+   _mm512_storeu_si512((void*) acc, a);
+   _mm256_zeroupper();
+}
+#endif
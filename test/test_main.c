@@ -6,9 +6,28 @@
 #endif
 
 
+CuSuite* testsuite_base64(void);
+CuSuite* testsuite_crc(void);
+CuSuite* testsuite_cutil_cpu(void);
+CuSuite* testsuite_hex(void);
+CuSuite* testsuite_lenprefix(void);
+CuSuite* testsuite_numconv(void);
 CuSuite* testsuite_pack(void);
+CuSuite* testsuite_pack_array(void);
+CuSuite* testsuite_pack_cursor(void);
+CuSuite* testsuite_pack_scale(void);
+CuSuite* testsuite_pack_signal(void);
+CuSuite* testsuite_pack_struct(void);
+CuSuite* testsuite_pack_varint(void);
+CuSuite* testsuite_soa(void);
 CuSuite* testsuite_soa_fsa(void);
+CuSuite* testsuite_soa_pool(void);
+CuSuite* testsuite_soa_numa(void);
 CuSuite* testsuite_sha256(void);
+CuSuite* testsuite_hmac_sha256(void);
+CuSuite* testsuite_xxh3(void);
+CuSuite* testsuite_cdc(void);
+CuSuite* testsuite_sha256_tree(void);
 CuSuite* testsuite_argparse(void);
 
 void RunAllTests(void)
@@ -16,9 +35,28 @@ void RunAllTests(void)
    CuString *output = CuStringNew();
    CuSuite* suite = CuSuiteNew();
 
+   CuSuiteAddSuite(suite, testsuite_base64());
+   CuSuiteAddSuite(suite, testsuite_crc());
+   CuSuiteAddSuite(suite, testsuite_cutil_cpu());
+   CuSuiteAddSuite(suite, testsuite_hex());
+   CuSuiteAddSuite(suite, testsuite_lenprefix());
+   CuSuiteAddSuite(suite, testsuite_numconv());
    CuSuiteAddSuite(suite, testsuite_pack());
+   CuSuiteAddSuite(suite, testsuite_pack_array());
+   CuSuiteAddSuite(suite, testsuite_pack_cursor());
+   CuSuiteAddSuite(suite, testsuite_pack_scale());
+   CuSuiteAddSuite(suite, testsuite_pack_signal());
+   CuSuiteAddSuite(suite, testsuite_pack_struct());
+   CuSuiteAddSuite(suite, testsuite_pack_varint());
+   CuSuiteAddSuite(suite, testsuite_soa());
    CuSuiteAddSuite(suite, testsuite_soa_fsa());
+   CuSuiteAddSuite(suite, testsuite_soa_pool());
+   CuSuiteAddSuite(suite, testsuite_soa_numa());
    CuSuiteAddSuite(suite, testsuite_sha256());
+   CuSuiteAddSuite(suite, testsuite_hmac_sha256());
+   CuSuiteAddSuite(suite, testsuite_xxh3());
+   CuSuiteAddSuite(suite, testsuite_cdc());
+   CuSuiteAddSuite(suite, testsuite_sha256_tree());
    CuSuiteAddSuite(suite, testsuite_argparse());
 
    CuSuiteRun(suite);
@@ -0,0 +1,179 @@
+/*****************************************************************************
+* \file      testsuite_base64.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for base64
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdint.h>
+#include "CuTest.h"
+#include "base64.h"
+#include "cutil_cpu.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define MAX_BYTES 200u
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_base64_rfc4648_vectors(CuTest* tc);
+static void test_base64_invalid(CuTest* tc);
+static void test_base64_invalid_in_block(CuTest* tc);
+static void test_base64_all_kernels(CuTest* tc);
+static void check_decode_fails(CuTest* tc, const char *text);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const uint32_t m_kernel_features[] = {CUTIL_CPU_ALL, CUTIL_CPU_SSE2 | CUTIL_CPU_SSSE3, 0u};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_base64(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_base64_rfc4648_vectors);
+   SUITE_ADD_TEST(suite, test_base64_invalid);
+   SUITE_ADD_TEST(suite, test_base64_invalid_in_block);
+   SUITE_ADD_TEST(suite, test_base64_all_kernels);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_base64_rfc4648_vectors(CuTest* tc)
+{
+   static const char *vectors[7][2] =
+   {
+      {"", ""},
+      {"f", "Zg=="},
+      {"fo", "Zm8="},
+      {"foo", "Zm9v"},
+      {"foob", "Zm9vYg=="},
+      {"fooba", "Zm9vYmE="},
+      {"foobar", "Zm9vYmFy"}
+   };
+   size_t i;
+   for (i = 0u; i < 7u; i++)
+   {
+      char text[16];
+      uint8_t decoded[16];
+      size_t len = strlen(vectors[i][0]);
+      size_t decodedLen = 99u;
+      text[base64_encode(text, (const uint8_t*) vectors[i][0], len)] = '\0';
+      CuAssertStrEquals(tc, vectors[i][1], text);
+      CuAssertTrue(tc, base64_decode(decoded, text, strlen(text), &decodedLen));
+      CuAssertUIntEquals(tc, len, decodedLen);
+      CuAssertIntEquals(tc, 0, memcmp(decoded, vectors[i][0], len));
+   }
+}
+
+static void test_base64_invalid(CuTest* tc)
+{
+   check_decode_fails(tc, "Zm9");        //length not a multiple of 4
+   check_decode_fails(tc, "Zm9v\n");
+   check_decode_fails(tc, "Zm 9");       //whitespace
+   check_decode_fails(tc, "Zm9-");       //URL-safe alphabet
+   check_decode_fails(tc, "Z===");       //too much padding
+   check_decode_fails(tc, "====");
+   check_decode_fails(tc, "Zg=a");       //padding before data
+   check_decode_fails(tc, "Zg==Zm9v");   //padding in the middle
+   check_decode_fails(tc, "Zh==");       //non-zero trailing bits
+   check_decode_fails(tc, "Zm9=");
+}
+
+static void test_base64_invalid_in_block(CuTest* tc)
+{
+   char text[BASE64_ENCODED_SIZE(MAX_BYTES)];
+   uint8_t decoded[BASE64_DECODED_MAX_SIZE(sizeof(text))];
+   static const char invalid[] = {'-', '_', '=', ' ', '.', '@', '[', '`', '{', '\0', (char) 0x80, (char) 0xAF};
+   size_t k, i, j;
+   for (k = 0u; k < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); k++)
+   {
+      cutil_cpu_override(m_kernel_features[k]);
+      for (i = 0u; i < sizeof(text); i += 7u)
+      {
+         memset(text, 'A', sizeof(text));
+         for (j = 0u; j < sizeof(invalid); j++)
+         {
+            text[i] = invalid[j];
+            CuAssertTrue(tc, !base64_decode(decoded, text, sizeof(text), (size_t*) 0));
+         }
+      }
+   }
+   cutil_cpu_reset();
+}
+
+static void test_base64_all_kernels(CuTest* tc)
+{
+   uint8_t data[MAX_BYTES];
+   uint8_t decoded[MAX_BYTES + 1u];
+   char text[BASE64_ENCODED_SIZE(MAX_BYTES)];
+   char expected[BASE64_ENCODED_SIZE(MAX_BYTES)];
+   size_t i, k, len;
+   for (i = 0u; i < MAX_BYTES; i++)
+   {
+      data[i] = (uint8_t) (i * 151u + 7u);
+   }
+   for (len = 0u; len <= MAX_BYTES; len++)
+   {
+      for (k = 0u; k < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); k++)
+      {
+         size_t decodedLen = 0u;
+         cutil_cpu_override(m_kernel_features[k]);
+         CuAssertUIntEquals(tc, BASE64_ENCODED_SIZE(len), base64_encode(text, data, len));
+         if (k == 0u)
+         {
+            memcpy(expected, text, BASE64_ENCODED_SIZE(len));
+         }
+         else
+         {
+            CuAssertIntEquals(tc, 0, memcmp(text, expected, BASE64_ENCODED_SIZE(len)));
+         }
+         //decoding writes nothing past the decoded size
+         memset(decoded, 0xAA, sizeof(decoded));
+         CuAssertTrue(tc, base64_decode(decoded, text, BASE64_ENCODED_SIZE(len), &decodedLen));
+         CuAssertUIntEquals(tc, len, decodedLen);
+         CuAssertIntEquals(tc, 0, memcmp(decoded, data, len));
+         CuAssertUIntEquals(tc, 0xAAu, decoded[len]);
+      }
+   }
+   cutil_cpu_reset();
+}
+
+static void check_decode_fails(CuTest* tc, const char *text)
+{
+   uint8_t decoded[16];
+   CuAssertTrue(tc, !base64_decode(decoded, text, strlen(text), (size_t*) 0));
+}
@@ -0,0 +1,296 @@
+/*****************************************************************************
+* \file      testsuite_cdc.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for cdc_chunker_t
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include "CuTest.h"
+#include "cdc.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define DATA_SIZE 400000u
+#define INSERT_SIZE 100u
+#define INSERT_POS 5000u
+#define MAX_CHUNKS 1024u
+#define MIN_SIZE 1024u
+#define AVG_SIZE 4096u
+#define MAX_SIZE 16384u
+
+typedef struct chunk_list_tag
+{
+   size_t num_chunks;
+   cdc_chunk_t chunks[MAX_CHUNKS];
+} chunk_list_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_cdc_chunks_cover_input(CuTest* tc);
+static void test_cdc_write_split_invariant(CuTest* tc);
+static void test_cdc_insertion_is_local(CuTest* tc);
+static void test_cdc_ifstream_handler(CuTest* tc);
+static void test_cdc_invalid_sizes(CuTest* tc);
+static void on_chunk(void *arg, const cdc_chunk_t *chunk);
+static void chunk_data(chunk_list_t *list, const uint8_t *data, size_t len, size_t writeSize);
+static bool same_chunks(const chunk_list_t *a, const chunk_list_t *b);
+static bool contains_hash(const chunk_list_t *list, const uint8_t *hash);
+static void fill_data(uint8_t *data, size_t len, uint32_t seed);
+
+//////////////////////////////////////////////////////////////////////////////
+// GLOBAL FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+CuSuite* testsuite_cdc(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_cdc_chunks_cover_input);
+   SUITE_ADD_TEST(suite, test_cdc_write_split_invariant);
+   SUITE_ADD_TEST(suite, test_cdc_insertion_is_local);
+   SUITE_ADD_TEST(suite, test_cdc_ifstream_handler);
+   SUITE_ADD_TEST(suite, test_cdc_invalid_sizes);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Chunks are contiguous, respect the size limits (except the last one), carry the SHA-256 of
+ * their bytes and have an average size in the neighbourhood of AVG_SIZE.
+ */
+static void test_cdc_chunks_cover_input(CuTest* tc)
+{
+   uint8_t *data = (uint8_t*) malloc(DATA_SIZE);
+   chunk_list_t *list = (chunk_list_t*) malloc(sizeof(chunk_list_t));
+   uint64_t offset = 0u;
+   size_t i;
+   CuAssertPtrNotNull(tc, data);
+   CuAssertPtrNotNull(tc, list);
+   fill_data(data, DATA_SIZE, 1u);
+   chunk_data(list, data, DATA_SIZE, DATA_SIZE);
+   CuAssertTrue(tc, list->num_chunks > 1u);
+   for (i = 0u; i < list->num_chunks; i++)
+   {
+      uint8_t hash[SHA256_HASH_SIZE];
+      const cdc_chunk_t *chunk = &list->chunks[i];
+      CuAssertTrue(tc, chunk->offset == offset);
+      CuAssertTrue(tc, chunk->length <= MAX_SIZE);
+      if (i + 1u < list->num_chunks)
+      {
+         CuAssertTrue(tc, chunk->length >= MIN_SIZE);
+      }
+      sha256_calc(hash, &data[chunk->offset], chunk->length);
+      CuAssertTrue(tc, memcmp(hash, chunk->hash, SHA256_HASH_SIZE) == 0);
+      offset += chunk->length;
+   }
+   CuAssertTrue(tc, offset == DATA_SIZE);
+   CuAssertTrue(tc, DATA_SIZE / list->num_chunks > AVG_SIZE / 2u);
+   CuAssertTrue(tc, DATA_SIZE / list->num_chunks < AVG_SIZE * 2u);
+   free(list);
+   free(data);
+}
+
+static void test_cdc_write_split_invariant(CuTest* tc)
+{
+   static const size_t writeSizes[] = {1u, 63u, 1000u, 4096u, 65537u};
+   uint8_t *data = (uint8_t*) malloc(DATA_SIZE);
+   chunk_list_t *expected = (chunk_list_t*) malloc(sizeof(chunk_list_t));
+   chunk_list_t *list = (chunk_list_t*) malloc(sizeof(chunk_list_t));
+   size_t i;
+   CuAssertPtrNotNull(tc, data);
+   CuAssertPtrNotNull(tc, expected);
+   CuAssertPtrNotNull(tc, list);
+   fill_data(data, DATA_SIZE, 2u);
+   chunk_data(expected, data, DATA_SIZE, DATA_SIZE);
+   for (i = 0u; i < sizeof(writeSizes) / sizeof(writeSizes[0]); i++)
+   {
+      chunk_data(list, data, DATA_SIZE, writeSizes[i]);
+      CuAssertTrue(tc, same_chunks(list, expected));
+   }
+   free(list);
+   free(expected);
+   free(data);
+}
+
+/**
+ * Inserting bytes near the start of the stream only changes the chunks around the insertion,
+ * the boundaries resynchronize and the remaining chunk hashes are reused.
+ */
+static void test_cdc_insertion_is_local(CuTest* tc)
+{
+   uint8_t *data = (uint8_t*) malloc(DATA_SIZE + INSERT_SIZE);
+   uint8_t *modified = (uint8_t*) malloc(DATA_SIZE + INSERT_SIZE);
+   chunk_list_t *original = (chunk_list_t*) malloc(sizeof(chunk_list_t));
+   chunk_list_t *list = (chunk_list_t*) malloc(sizeof(chunk_list_t));
+   size_t i, numChanged = 0u;
+   CuAssertPtrNotNull(tc, data);
+   CuAssertPtrNotNull(tc, modified);
+   CuAssertPtrNotNull(tc, original);
+   CuAssertPtrNotNull(tc, list);
+   fill_data(data, DATA_SIZE + INSERT_SIZE, 3u);
+   memcpy(modified, data, INSERT_POS);
+   memcpy(&modified[INSERT_POS], &data[DATA_SIZE], INSERT_SIZE);
+   memcpy(&modified[INSERT_POS + INSERT_SIZE], &data[INSERT_POS], DATA_SIZE - INSERT_POS);
+   chunk_data(original, data, DATA_SIZE, DATA_SIZE);
+   chunk_data(list, modified, DATA_SIZE + INSERT_SIZE, DATA_SIZE + INSERT_SIZE);
+   for (i = 0u; i < list->num_chunks; i++)
+   {
+      if (!contains_hash(original, list->chunks[i].hash))
+      {
+         numChanged++;
+      }
+   }
+   CuAssertTrue(tc, numChanged >= 1u);
+   CuAssertTrue(tc, numChanged <= 3u);
+   free(list);
+   free(original);
+   free(modified);
+   free(data);
+}
+
+static void test_cdc_ifstream_handler(CuTest* tc)
+{
+   uint8_t *data = (uint8_t*) malloc(DATA_SIZE);
+   chunk_list_t *expected = (chunk_list_t*) malloc(sizeof(chunk_list_t));
+   chunk_list_t *list = (chunk_list_t*) malloc(sizeof(chunk_list_t));
+   cdc_chunker_t chunker;
+   ifstream_handler_t handler;
+   ifstream_t stream;
+   size_t offset;
+   CuAssertPtrNotNull(tc, data);
+   CuAssertPtrNotNull(tc, expected);
+   CuAssertPtrNotNull(tc, list);
+   fill_data(data, DATA_SIZE, 4u);
+   chunk_data(expected, data, DATA_SIZE, DATA_SIZE);
+   list->num_chunks = 0u;
+   CuAssertIntEquals(tc, 0, cdc_chunker_create(&chunker, MIN_SIZE, AVG_SIZE, MAX_SIZE, on_chunk, list));
+   cdc_chunker_handler(&chunker, &handler);
+   ifstream_create(&stream, &handler);
+   ifstream_open(&stream);
+   for (offset = 0u; offset < DATA_SIZE; offset += 3000u)
+   {
+      size_t len = (DATA_SIZE - offset < 3000u)? DATA_SIZE - offset : 3000u;
+      ifstream_write(&stream, &data[offset], (uint32_t) len);
+   }
+   ifstream_close(&stream);
+   ifstream_destroy(&stream);
+   CuAssertTrue(tc, same_chunks(list, expected));
+   free(list);
+   free(expected);
+   free(data);
+}
+
+static void test_cdc_invalid_sizes(CuTest* tc)
+{
+   cdc_chunker_t chunker;
+   chunk_list_t list;
+   errno = 0;
+   CuAssertIntEquals(tc, -1, cdc_chunker_create(&chunker, 0u, AVG_SIZE, MAX_SIZE, on_chunk, &list));
+   CuAssertIntEquals(tc, EINVAL, errno);
+   CuAssertIntEquals(tc, -1, cdc_chunker_create(&chunker, MIN_SIZE, 5000u, MAX_SIZE, on_chunk, &list));
+   CuAssertIntEquals(tc, -1, cdc_chunker_create(&chunker, AVG_SIZE * 2u, AVG_SIZE, MAX_SIZE, on_chunk, &list));
+   CuAssertIntEquals(tc, -1, cdc_chunker_create(&chunker, MIN_SIZE, AVG_SIZE, AVG_SIZE / 2u, on_chunk, &list));
+   CuAssertIntEquals(tc, -1, cdc_chunker_create(&chunker, 16u, 128u, MAX_SIZE, on_chunk, &list));
+   CuAssertIntEquals(tc, -1, cdc_chunker_create(&chunker, MIN_SIZE, AVG_SIZE, MAX_SIZE, (cdc_chunk_func_t*) 0, &list));
+   CuAssertIntEquals(tc, 0, cdc_chunker_create(&chunker, CDC_MIN_SIZE_DEFAULT, CDC_AVG_SIZE_DEFAULT, CDC_MAX_SIZE_DEFAULT, on_chunk, &list));
+}
+
+static void on_chunk(void *arg, const cdc_chunk_t *chunk)
+{
+   chunk_list_t *list = (chunk_list_t*) arg;
+   if (list->num_chunks < MAX_CHUNKS)
+   {
+      list->chunks[list->num_chunks++] = *chunk;
+   }
+}
+
+static void chunk_data(chunk_list_t *list, const uint8_t *data, size_t len, size_t writeSize)
+{
+   cdc_chunker_t chunker;
+   size_t offset;
+   list->num_chunks = 0u;
+   (void) cdc_chunker_create(&chunker, MIN_SIZE, AVG_SIZE, MAX_SIZE, on_chunk, list);
+   for (offset = 0u; offset < len; offset += writeSize)
+   {
+      cdc_chunker_write(&chunker, &data[offset], (len - offset < writeSize)? len - offset : writeSize);
+   }
+   cdc_chunker_finish(&chunker);
+}
+
+static bool same_chunks(const chunk_list_t *a, const chunk_list_t *b)
+{
+   size_t i;
+   if (a->num_chunks != b->num_chunks)
+   {
+      return false;
+   }
+   for (i = 0u; i < a->num_chunks; i++)
+   {
+      const cdc_chunk_t *x = &a->chunks[i];
+      const cdc_chunk_t *y = &b->chunks[i];
+      if ( (x->offset != y->offset) || (x->length != y->length) || (memcmp(x->hash, y->hash, SHA256_HASH_SIZE) != 0) )
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+static bool contains_hash(const chunk_list_t *list, const uint8_t *hash)
+{
+   size_t i;
+   for (i = 0u; i < list->num_chunks; i++)
+   {
+      if (memcmp(list->chunks[i].hash, hash, SHA256_HASH_SIZE) == 0)
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+static void fill_data(uint8_t *data, size_t len, uint32_t seed)
+{
+   uint32_t x = 0x9E3779B9u ^ seed;
+   size_t i;
+   for (i = 0u; i < len; i++)
+   {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      data[i] = (uint8_t) (x >> 24);
+   }
+}
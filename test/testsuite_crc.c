@@ -0,0 +1,179 @@
+/*****************************************************************************
+* \file      testsuite_crc.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for crc
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdint.h>
+#include "CuTest.h"
+#include "crc.h"
+#include "cutil_cpu.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define LARGE_SIZE 5000u //covers several rounds of the interleaved kernel plus a tail
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_crc32c_check_value(CuTest* tc);
+static void test_crc32c_incremental(CuTest* tc);
+static void test_crc32c_all_kernels(CuTest* tc);
+static void test_crc16_check_values(CuTest* tc);
+static void test_crc16_incremental(CuTest* tc);
+static uint32_t crc32c_bitwise(const uint8_t *data, size_t len);
+static void fill_pattern(uint8_t *data, size_t len);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const uint8_t m_check_input[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+static uint8_t m_large[LARGE_SIZE];
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_crc(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_crc32c_check_value);
+   SUITE_ADD_TEST(suite, test_crc32c_incremental);
+   SUITE_ADD_TEST(suite, test_crc32c_all_kernels);
+   SUITE_ADD_TEST(suite, test_crc16_check_values);
+   SUITE_ADD_TEST(suite, test_crc16_incremental);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_crc32c_check_value(CuTest* tc)
+{
+   const uint8_t zeros[32] = {0};
+   CuAssertUIntEquals(tc, 0xE3069283u, crc32c_calc(m_check_input, sizeof(m_check_input)));
+   CuAssertUIntEquals(tc, 0u, crc32c_calc(m_check_input, 0u));
+   //RFC 3720 (iSCSI) test vector
+   CuAssertUIntEquals(tc, 0x8A9136AAu, crc32c_calc(zeros, sizeof(zeros)));
+}
+
+static void test_crc32c_incremental(CuTest* tc)
+{
+   size_t split;
+   uint32_t expected;
+   fill_pattern(m_large, LARGE_SIZE);
+   expected = crc32c_calc(m_large, LARGE_SIZE);
+   CuAssertUIntEquals(tc, crc32c_bitwise(m_large, LARGE_SIZE), expected);
+   for (split = 0u; split <= LARGE_SIZE; split += 97u)
+   {
+      uint32_t crc = crc32c_update(0u, m_large, split);
+      crc = crc32c_update(crc, &m_large[split], LARGE_SIZE - split);
+      CuAssertUIntEquals(tc, expected, crc);
+   }
+}
+
+static void test_crc32c_all_kernels(CuTest* tc)
+{
+   static const uint32_t features[] = {CUTIL_CPU_ALL, 0u};
+   size_t i;
+   fill_pattern(m_large, LARGE_SIZE);
+   for (i = 0u; i < sizeof(features) / sizeof(features[0]); i++)
+   {
+      size_t len;
+      cutil_cpu_override(features[i]);
+      CuAssertUIntEquals(tc, 0xE3069283u, crc32c_calc(m_check_input, sizeof(m_check_input)));
+      for (len = 0u; len <= LARGE_SIZE; len += (len < 64u)? 1u : 251u)
+      {
+         //odd offset makes every load unaligned
+         CuAssertUIntEquals(tc, crc32c_bitwise(&m_large[1], len - ((len > 0u)? 1u : 0u)),
+                            crc32c_calc(&m_large[1], len - ((len > 0u)? 1u : 0u)));
+      }
+   }
+   cutil_cpu_reset();
+}
+
+static void test_crc16_check_values(CuTest* tc)
+{
+   const size_t len = sizeof(m_check_input);
+   CuAssertUIntEquals(tc, 0x29B1u, crc16_calc(CRC16_CCITT_FALSE, m_check_input, len));
+   CuAssertUIntEquals(tc, 0x31C3u, crc16_calc(CRC16_XMODEM, m_check_input, len));
+   CuAssertUIntEquals(tc, 0x2189u, crc16_calc(CRC16_KERMIT, m_check_input, len));
+   CuAssertUIntEquals(tc, 0x906Eu, crc16_calc(CRC16_X25, m_check_input, len));
+   CuAssertUIntEquals(tc, 0x4B37u, crc16_calc(CRC16_MODBUS, m_check_input, len));
+   CuAssertUIntEquals(tc, 0xBB3Du, crc16_calc(CRC16_ARC, m_check_input, len));
+   CuAssertUIntEquals(tc, 0xFFFFu, crc16_init(CRC16_CCITT_FALSE));
+   CuAssertUIntEquals(tc, 0x0000u, crc16_init(CRC16_X25));
+   CuAssertUIntEquals(tc, 0xFFFFu, crc16_calc(CRC16_CCITT_FALSE, m_check_input, 0u));
+}
+
+static void test_crc16_incremental(CuTest* tc)
+{
+   unsigned variant;
+   fill_pattern(m_large, 300u);
+   for (variant = 0u; variant < (unsigned) CRC16_NUM_VARIANTS; variant++)
+   {
+      size_t split;
+      uint16_t expected = crc16_calc((crc16_variant_t) variant, m_large, 300u);
+      for (split = 0u; split <= 300u; split += 7u)
+      {
+         uint16_t crc = crc16_update((crc16_variant_t) variant, crc16_init((crc16_variant_t) variant), m_large, split);
+         crc = crc16_update((crc16_variant_t) variant, crc, &m_large[split], 300u - split);
+         CuAssertUIntEquals(tc, expected, crc);
+      }
+   }
+}
+
+static uint32_t crc32c_bitwise(const uint8_t *data, size_t len)
+{
+   size_t i;
+   uint32_t crc = 0xFFFFFFFFu;
+   for (i = 0u; i < len; i++)
+   {
+      unsigned k;
+      crc ^= data[i];
+      for (k = 0u; k < 8u; k++)
+      {
+         crc = (crc >> 1) ^ ((crc & 1u)? 0x82F63B78u : 0u);
+      }
+   }
+   return ~crc;
+}
+
+static void fill_pattern(uint8_t *data, size_t len)
+{
+   size_t i;
+   uint32_t x = 0x12345678u;
+   for (i = 0u; i < len; i++)
+   {
+      x = x * 1103515245u + 12345u;
+      data[i] = (uint8_t) (x >> 16);
+   }
+}
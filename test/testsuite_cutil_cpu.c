@@ -0,0 +1,212 @@
+/*****************************************************************************
+* \file      testsuite_cutil_cpu.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for cutil_cpu
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "CuTest.h"
+#include "cutil_cpu.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_cpu_detect(CuTest* tc);
+static void test_cpu_parse_features(CuTest* tc);
+static void test_cpu_describe(CuTest* tc);
+static void test_cpu_override(CuTest* tc);
+static void test_cpu_select(CuTest* tc);
+static void test_cpu_resolve_follows_override(CuTest* tc);
+static void test_cpu_environment(CuTest* tc);
+static void kernel_a(void);
+static void kernel_b(void);
+static void kernel_c(void);
+static void set_environment(const char *value);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const cutil_cpu_variant_t m_variants[] =
+{
+   {"avx2", CUTIL_CPU_AVX | CUTIL_CPU_AVX2, kernel_a},
+   {"sse2", CUTIL_CPU_SSE2, kernel_b},
+   {"scalar", 0u, kernel_c}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_cutil_cpu(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_cpu_detect);
+   SUITE_ADD_TEST(suite, test_cpu_parse_features);
+   SUITE_ADD_TEST(suite, test_cpu_describe);
+   SUITE_ADD_TEST(suite, test_cpu_override);
+   SUITE_ADD_TEST(suite, test_cpu_select);
+   SUITE_ADD_TEST(suite, test_cpu_resolve_follows_override);
+   SUITE_ADD_TEST(suite, test_cpu_environment);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_cpu_detect(CuTest* tc)
+{
+   uint32_t features = cutil_cpu_detect();
+   CuAssertUIntEquals(tc, 0u, features & ~CUTIL_CPU_ALL);
+#if defined(__x86_64__) || defined(_M_X64)
+   CuAssertTrue(tc, (features & CUTIL_CPU_SSE2) != 0u);
+#endif
+   //dependent features are never reported without their base feature
+   if (features & CUTIL_CPU_AVX2)
+   {
+      CuAssertTrue(tc, (features & CUTIL_CPU_AVX) != 0u);
+   }
+   if (features & CUTIL_CPU_AVX512BW)
+   {
+      CuAssertTrue(tc, (features & CUTIL_CPU_AVX512F) != 0u);
+   }
+   CuAssertUIntEquals(tc, 0u, cutil_cpu_features() & ~features);
+}
+
+static void test_cpu_parse_features(CuTest* tc)
+{
+   const uint32_t all = CUTIL_CPU_ALL;
+   CuAssertUIntEquals(tc, all, cutil_cpu_parseFeatures((const char*) 0, all));
+   CuAssertUIntEquals(tc, all, cutil_cpu_parseFeatures("", all));
+   CuAssertUIntEquals(tc, CUTIL_CPU_SSE2 | CUTIL_CPU_AVX2, cutil_cpu_parseFeatures("sse2,avx2", all));
+   CuAssertUIntEquals(tc, CUTIL_CPU_SSE41 | CUTIL_CPU_SSE42, cutil_cpu_parseFeatures(" sse4.1 , sse4.2 ", all));
+   CuAssertUIntEquals(tc, all & ~(CUTIL_CPU_AVX2 | CUTIL_CPU_AVX512F), cutil_cpu_parseFeatures("-avx2,-avx512f", all));
+   CuAssertUIntEquals(tc, CUTIL_CPU_SSE2, cutil_cpu_parseFeatures("sse2,ssse3,-ssse3", all));
+   CuAssertUIntEquals(tc, 0u, cutil_cpu_parseFeatures("none", all));
+   CuAssertUIntEquals(tc, all & ~CUTIL_CPU_SHA, cutil_cpu_parseFeatures("all,-sha", all));
+   //unknown names select nothing and unavailable features are never enabled
+   CuAssertUIntEquals(tc, 0u, cutil_cpu_parseFeatures("sse5", all));
+   CuAssertUIntEquals(tc, CUTIL_CPU_SSE2, cutil_cpu_parseFeatures("sse2,avx2", CUTIL_CPU_SSE2));
+}
+
+static void test_cpu_describe(CuTest* tc)
+{
+   char buf[128];
+   CuAssertUIntEquals(tc, 9u, cutil_cpu_describe(CUTIL_CPU_AVX2 | CUTIL_CPU_SSE2, buf, sizeof(buf)));
+   CuAssertStrEquals(tc, "sse2,avx2", buf);
+   CuAssertUIntEquals(tc, 0u, cutil_cpu_describe(0u, buf, sizeof(buf)));
+   CuAssertStrEquals(tc, "", buf);
+   //truncation keeps whole names only
+   CuAssertUIntEquals(tc, 9u, cutil_cpu_describe(CUTIL_CPU_AVX2 | CUTIL_CPU_SSE2, buf, 5u));
+   CuAssertStrEquals(tc, "sse2", buf);
+   CuAssertUIntEquals(tc, 9u, cutil_cpu_describe(CUTIL_CPU_AVX2 | CUTIL_CPU_SSE2, (char*) 0, 0u));
+   //round trip
+   cutil_cpu_describe(CUTIL_CPU_ALL, buf, sizeof(buf));
+   CuAssertUIntEquals(tc, CUTIL_CPU_ALL, cutil_cpu_parseFeatures(buf, CUTIL_CPU_ALL));
+}
+
+static void test_cpu_override(CuTest* tc)
+{
+   const uint32_t detected = cutil_cpu_detect();
+   cutil_cpu_override(0u);
+   CuAssertUIntEquals(tc, 0u, cutil_cpu_features());
+   CuAssertTrue(tc, cutil_cpu_has(0u));
+   CuAssertTrue(tc, !cutil_cpu_has(CUTIL_CPU_SSE2));
+   cutil_cpu_override(CUTIL_CPU_ALL);
+   CuAssertUIntEquals(tc, detected, cutil_cpu_features());
+   cutil_cpu_override(CUTIL_CPU_SSE2);
+   CuAssertUIntEquals(tc, detected & CUTIL_CPU_SSE2, cutil_cpu_features());
+   cutil_cpu_reset();
+}
+
+static void test_cpu_select(CuTest* tc)
+{
+   const size_t numVariants = sizeof(m_variants) / sizeof(m_variants[0]);
+   CuAssertPtrEquals(tc, (void*) &m_variants[0], (void*) cutil_cpu_select(m_variants, numVariants, CUTIL_CPU_ALL));
+   CuAssertPtrEquals(tc, (void*) &m_variants[1], (void*) cutil_cpu_select(m_variants, numVariants, CUTIL_CPU_SSE2 | CUTIL_CPU_AVX2));
+   CuAssertPtrEquals(tc, (void*) &m_variants[2], (void*) cutil_cpu_select(m_variants, numVariants, CUTIL_CPU_AVX));
+   CuAssertPtrEquals(tc, (void*) &m_variants[2], (void*) cutil_cpu_select(m_variants, numVariants, 0u));
+   CuAssertPtrEquals(tc, (void*) 0, (void*) cutil_cpu_select(m_variants, 0u, CUTIL_CPU_ALL));
+}
+
+static void test_cpu_resolve_follows_override(CuTest* tc)
+{
+   cutil_cpu_dispatch_t dispatch = CUTIL_CPU_DISPATCH_INIT(m_variants);
+   const uint32_t detected = cutil_cpu_detect();
+   cutil_cpu_override(0u);
+   CuAssertTrue(tc, cutil_cpu_resolve(&dispatch) == kernel_c);
+   CuAssertStrEquals(tc, "scalar", cutil_cpu_resolvedName(&dispatch));
+   cutil_cpu_override(CUTIL_CPU_SSE2);
+   CuAssertStrEquals(tc, (detected & CUTIL_CPU_SSE2)? "sse2" : "scalar", cutil_cpu_resolvedName(&dispatch));
+   cutil_cpu_reset();
+   CuAssertTrue(tc, cutil_cpu_resolve(&dispatch) == cutil_cpu_select(m_variants, 3u, cutil_cpu_features())->func);
+}
+
+static void test_cpu_environment(CuTest* tc)
+{
+   const uint32_t detected = cutil_cpu_detect();
+   set_environment("none");
+   cutil_cpu_reset();
+   CuAssertUIntEquals(tc, 0u, cutil_cpu_features());
+   set_environment("-sse2");
+   cutil_cpu_reset();
+   CuAssertUIntEquals(tc, detected & ~CUTIL_CPU_SSE2, cutil_cpu_features());
+   set_environment((const char*) 0);
+   cutil_cpu_reset();
+   CuAssertUIntEquals(tc, detected, cutil_cpu_features());
+}
+
+static void kernel_a(void)
+{
+}
+
+static void kernel_b(void)
+{
+}
+
+static void kernel_c(void)
+{
+}
+
+static void set_environment(const char *value)
+{
+#ifdef _WIN32
+   _putenv_s(CUTIL_CPU_ENV_NAME, (value != 0)? value : "");
+#else
+   if (value != 0)
+   {
+      setenv(CUTIL_CPU_ENV_NAME, value, 1);
+   }
+   else
+   {
+      unsetenv(CUTIL_CPU_ENV_NAME);
+   }
+#endif
+}
@@ -0,0 +1,152 @@
+/*****************************************************************************
+* \file      testsuite_hex.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for hex
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdint.h>
+#include "CuTest.h"
+#include "hex.h"
+#include "cutil_cpu.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define MAX_BYTES 200u
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_hex_encode(CuTest* tc);
+static void test_hex_decode(CuTest* tc);
+static void test_hex_invalid(CuTest* tc);
+static void test_hex_all_kernels(CuTest* tc);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+//forces each kernel variant in turn
+static const uint32_t m_kernel_features[] = {CUTIL_CPU_ALL, CUTIL_CPU_SSE2 | CUTIL_CPU_SSSE3, 0u};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_hex(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_hex_encode);
+   SUITE_ADD_TEST(suite, test_hex_decode);
+   SUITE_ADD_TEST(suite, test_hex_invalid);
+   SUITE_ADD_TEST(suite, test_hex_all_kernels);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_hex_encode(CuTest* tc)
+{
+   const uint8_t data[] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF};
+   char buf[HEX_ENCODED_SIZE(sizeof(data)) + 1u];
+   buf[hex_encode(buf, data, sizeof(data))] = '\0';
+   CuAssertStrEquals(tc, "0123456789abcdef", buf);
+   buf[hex_encodeUpper(buf, data, sizeof(data))] = '\0';
+   CuAssertStrEquals(tc, "0123456789ABCDEF", buf);
+   CuAssertUIntEquals(tc, 0u, hex_encode(buf, data, 0u));
+}
+
+static void test_hex_decode(CuTest* tc)
+{
+   const uint8_t expected[] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xAB, 0xCD, 0xEF};
+   uint8_t buf[sizeof(expected)];
+   CuAssertTrue(tc, hex_decode(buf, "0123456789abcdefABCDEF", 22u));
+   CuAssertIntEquals(tc, 0, memcmp(buf, expected, sizeof(expected)));
+   CuAssertTrue(tc, hex_decode(buf, "", 0u));
+}
+
+static void test_hex_invalid(CuTest* tc)
+{
+   char text[HEX_ENCODED_SIZE(MAX_BYTES)];
+   uint8_t buf[MAX_BYTES];
+   size_t i, k;
+   static const char invalid[] = {'g', 'G', '/', ':', '@', '`', ' ', '\0', (char) 0x80, (char) 0xB0};
+   CuAssertTrue(tc, !hex_decode(buf, "012", 3u));
+   for (k = 0u; k < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); k++)
+   {
+      cutil_cpu_override(m_kernel_features[k]);
+      //an invalid character anywhere, including inside vector blocks, is detected
+      for (i = 0u; i < sizeof(text); i += 13u)
+      {
+         size_t j;
+         memset(text, 'a', sizeof(text));
+         for (j = 0u; j < sizeof(invalid); j++)
+         {
+            text[i] = invalid[j];
+            CuAssertTrue(tc, !hex_decode(buf, text, sizeof(text)));
+         }
+      }
+   }
+   cutil_cpu_reset();
+}
+
+static void test_hex_all_kernels(CuTest* tc)
+{
+   uint8_t data[MAX_BYTES];
+   uint8_t decoded[MAX_BYTES];
+   char text[HEX_ENCODED_SIZE(MAX_BYTES)];
+   char upper[HEX_ENCODED_SIZE(MAX_BYTES)];
+   char expected[HEX_ENCODED_SIZE(MAX_BYTES)];
+   static const char digits[] = "0123456789abcdef";
+   size_t i, k, len;
+   for (i = 0u; i < MAX_BYTES; i++)
+   {
+      data[i] = (uint8_t) (i * 37u + 11u);
+      expected[i * 2u] = digits[data[i] >> 4];
+      expected[i * 2u + 1u] = digits[data[i] & 0x0Fu];
+   }
+   for (k = 0u; k < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); k++)
+   {
+      cutil_cpu_override(m_kernel_features[k]);
+      for (len = 0u; len <= MAX_BYTES; len++)
+      {
+         CuAssertUIntEquals(tc, len * 2u, hex_encode(text, data, len));
+         CuAssertIntEquals(tc, 0, memcmp(text, expected, len * 2u));
+         memset(decoded, 0, sizeof(decoded));
+         CuAssertTrue(tc, hex_decode(decoded, text, len * 2u));
+         CuAssertIntEquals(tc, 0, memcmp(decoded, data, len));
+         hex_encodeUpper(upper, data, len);
+         memset(decoded, 0, sizeof(decoded));
+         CuAssertTrue(tc, hex_decode(decoded, upper, len * 2u));
+         CuAssertIntEquals(tc, 0, memcmp(decoded, data, len));
+      }
+   }
+   cutil_cpu_reset();
+}
@@ -0,0 +1,211 @@
+/*****************************************************************************
+* \file      testsuite_hmac_sha256.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for HMAC-SHA256
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include "CuTest.h"
+#include "hmac_sha256.h"
+#include "hex.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+typedef struct rfc4231_case_tag
+{
+   uint8_t key_byte;   //key is key_len times key_byte (except for test case 2 and 4)
+   size_t key_len;
+   const char *data;   //NULL means data_len times data_byte
+   uint8_t data_byte;
+   size_t data_len;
+   const char *mac;    //hex, may be truncated
+} rfc4231_case_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_hmac_sha256_rfc4231(CuTest* tc);
+static void test_hmac_sha256_key_reuse(CuTest* tc);
+static void test_hmac_sha256_streaming(CuTest* tc);
+static void test_hmac_sha256_verify(CuTest* tc);
+static void check_mac(CuTest* tc, const char *expected, const uint8_t mac[32]);
+
+//////////////////////////////////////////////////////////////////////////////
+// LOCAL VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const rfc4231_case_t m_rfc4231_cases[] =
+{
+   {0x0b, 20u, "Hi There", 0u, 0u, "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7"},
+   {0x00, 0u, "what do ya want for nothing?", 0u, 0u, "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"},
+   {0xaa, 20u, NULL, 0xdd, 50u, "773ea91e36800e46854db8ebd09181a72959098b3ef8c122d9635514ced565fe"},
+   {0x00, 25u, NULL, 0xcd, 50u, "82558a389a443c0ea4cc819899f2083a85f0faa3e578f8077a2e3ff46729665b"},
+   {0x0c, 20u, "Test With Truncation", 0u, 0u, "a3b6167473100ee06e0c796c2955552b"},
+   {0xaa, 131u, "Test Using Larger Than Block-Size Key - Hash Key First", 0u, 0u,
+    "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54"},
+   {0xaa, 131u, "This is a test using a larger than block-size key and a larger than block-size data. "
+                "The key needs to be hashed before being used by the HMAC algorithm.", 0u, 0u,
+    "9b09ffa71b942fcb27635fbcd5b0e944bfdc63644f0713938a7f51535c3a35e2"}
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// GLOBAL FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+CuSuite* testsuite_hmac_sha256(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_hmac_sha256_rfc4231);
+   SUITE_ADD_TEST(suite, test_hmac_sha256_key_reuse);
+   SUITE_ADD_TEST(suite, test_hmac_sha256_streaming);
+   SUITE_ADD_TEST(suite, test_hmac_sha256_verify);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Test cases 1-7 from RFC 4231 section 4
+ */
+static void test_hmac_sha256_rfc4231(CuTest* tc)
+{
+   size_t i;
+   for (i = 0u; i < sizeof(m_rfc4231_cases) / sizeof(m_rfc4231_cases[0]); i++)
+   {
+      const rfc4231_case_t *test = &m_rfc4231_cases[i];
+      uint8_t key[131];
+      uint8_t data[50];
+      const uint8_t *msg = (const uint8_t*) test->data;
+      size_t keyLen = test->key_len;
+      size_t msgLen = (test->data != NULL)? strlen(test->data) : test->data_len;
+      uint8_t mac[32];
+      char text[HEX_ENCODED_SIZE(32u) + 1u];
+      if (i == 1u)
+      {
+         memcpy(key, "Jefe", 4u);
+         keyLen = 4u;
+      }
+      else if (i == 3u)
+      {
+         size_t j;
+         for (j = 0u; j < keyLen; j++)
+         {
+            key[j] = (uint8_t) (j + 1u);
+         }
+      }
+      else
+      {
+         memset(key, test->key_byte, keyLen);
+      }
+      if (msg == NULL)
+      {
+         memset(data, test->data_byte, msgLen);
+         msg = data;
+      }
+      hmac_sha256(mac, key, keyLen, msg, msgLen);
+      text[hex_encode(text, mac, strlen(test->mac) / 2u)] = '\0';
+      CuAssertStrEquals(tc, test->mac, text);
+   }
+}
+
+/**
+ * One precomputed key gives the same MACs as the one-shot function for any number of messages
+ */
+static void test_hmac_sha256_key_reuse(CuTest* tc)
+{
+   hmac_sha256_key_t key;
+   uint8_t data[200];
+   uint8_t expected[32];
+   uint8_t mac[32];
+   size_t len;
+   memset(data, 0xdd, sizeof(data));
+   hmac_sha256_key_init(&key, "Jefe", 4u);
+   hmac_sha256_calc(mac, &key, "what do ya want for nothing?", 28u);
+   check_mac(tc, "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843", mac);
+   for (len = 0u; len < sizeof(data); len++)
+   {
+      hmac_sha256(expected, "Jefe", 4u, data, len);
+      hmac_sha256_calc(mac, &key, data, len);
+      CuAssertIntEquals(tc, 0, memcmp(mac, expected, sizeof(mac)));
+   }
+   hmac_sha256_key_clear(&key);
+   CuAssertUIntEquals(tc, 0u, key.inner[0]);
+   CuAssertUIntEquals(tc, 0u, key.outer[7]);
+}
+
+static void test_hmac_sha256_streaming(CuTest* tc)
+{
+   hmac_sha256_key_t key;
+   hmac_sha256_ctx_t ctx;
+   uint8_t data[300];
+   uint8_t expected[32];
+   uint8_t mac[32];
+   size_t i, step;
+   for (i = 0u; i < sizeof(data); i++)
+   {
+      data[i] = (uint8_t) (i * 131u + 7u);
+   }
+   hmac_sha256_key_init(&key, data, 100u);
+   hmac_sha256_calc(expected, &key, data, sizeof(data));
+   for (step = 1u; step <= 130u; step += 3u)
+   {
+      hmac_sha256_init(&ctx, &key);
+      for (i = 0u; i < sizeof(data); i += step)
+      {
+         hmac_sha256_update(&ctx, &data[i], (sizeof(data) - i < step)? sizeof(data) - i : step);
+      }
+      hmac_sha256_final(&ctx, mac);
+      CuAssertIntEquals(tc, 0, memcmp(mac, expected, sizeof(mac)));
+   }
+}
+
+static void test_hmac_sha256_verify(CuTest* tc)
+{
+   uint8_t mac[32];
+   uint8_t other[32];
+   hmac_sha256(mac, "key", 3u, "message", 7u);
+   memcpy(other, mac, sizeof(other));
+   CuAssertTrue(tc, hmac_sha256_verify(mac, other, 32u));
+   CuAssertTrue(tc, hmac_sha256_verify(mac, other, 16u));
+   other[31] ^= 0x01;
+   CuAssertTrue(tc, !hmac_sha256_verify(mac, other, 32u));
+   CuAssertTrue(tc, hmac_sha256_verify(mac, other, 31u));
+   CuAssertTrue(tc, !hmac_sha256_verify(mac, other, 0u));
+   CuAssertTrue(tc, !hmac_sha256_verify(mac, other, 33u));
+}
+
+static void check_mac(CuTest* tc, const char *expected, const uint8_t mac[32])
+{
+   char text[HEX_ENCODED_SIZE(32u) + 1u];
+   text[hex_encode(text, mac, 32u)] = '\0';
+   CuAssertStrEquals(tc, expected, text);
+}
@@ -0,0 +1,204 @@
+/*****************************************************************************
+* \file      testsuite_lenprefix.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for lenprefix
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdint.h>
+#include "CuTest.h"
+#include "lenprefix.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_MESSAGES 40u
+#define STREAM_SIZE 4096u
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_lenprefix_encode(CuTest* tc);
+static void test_lenprefix_decode(CuTest* tc);
+static void test_lenprefix_scan(CuTest* tc);
+static void test_lenprefix_scan_truncated(CuTest* tc);
+static void test_lenprefix_scan_limit(CuTest* tc);
+static size_t build_stream(uint8_t *buf, size_t *offsets, uint32_t *lengths);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+//mixes empty, short and long payloads, with several empty ones at the end
+static const uint32_t m_lengths[NUM_MESSAGES] =
+{
+   0u, 1u, 127u, 128u, 5u, 300u, 2u, 0u, 126u, 129u,
+   3u, 3u, 3u, 200u, 1u, 64u, 0u, 0u, 255u, 7u,
+   1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u,
+   130u, 0u, 1u, 0u, 2u, 0u, 0u, 0u, 0u, 0u
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_lenprefix(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_lenprefix_encode);
+   SUITE_ADD_TEST(suite, test_lenprefix_decode);
+   SUITE_ADD_TEST(suite, test_lenprefix_scan);
+   SUITE_ADD_TEST(suite, test_lenprefix_scan_truncated);
+   SUITE_ADD_TEST(suite, test_lenprefix_scan_limit);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_lenprefix_encode(CuTest* tc)
+{
+   uint8_t buf[LENPREFIX_MAX_HEADER_SIZE];
+   const uint8_t expected128[4] = {0x80, 0x00, 0x00, 0x80};
+   const uint8_t expectedMax[4] = {0xFF, 0xFF, 0xFF, 0xFF};
+   CuAssertUIntEquals(tc, 1u, lenprefix_encode(buf, 0u));
+   CuAssertUIntEquals(tc, 0x00u, buf[0]);
+   CuAssertUIntEquals(tc, 1u, lenprefix_encode(buf, 127u));
+   CuAssertUIntEquals(tc, 0x7Fu, buf[0]);
+   CuAssertUIntEquals(tc, 4u, lenprefix_encode(buf, 128u));
+   CuAssertIntEquals(tc, 0, memcmp(buf, expected128, 4u));
+   CuAssertUIntEquals(tc, 4u, lenprefix_encode(buf, LENPREFIX_LONG_MAX));
+   CuAssertIntEquals(tc, 0, memcmp(buf, expectedMax, 4u));
+   CuAssertUIntEquals(tc, 0u, lenprefix_encode(buf, LENPREFIX_LONG_MAX + 1u));
+   CuAssertUIntEquals(tc, 1u, lenprefix_headerSize(127u));
+   CuAssertUIntEquals(tc, 4u, lenprefix_headerSize(128u));
+   CuAssertUIntEquals(tc, 0u, lenprefix_headerSize(0xFFFFFFFFu));
+}
+
+static void test_lenprefix_decode(CuTest* tc)
+{
+   uint32_t length = 0u;
+   const uint8_t shortHeader[1] = {0x55};
+   const uint8_t longHeader[4] = {0x80, 0x01, 0x02, 0x03};
+   CuAssertUIntEquals(tc, 1u, lenprefix_decode(shortHeader, 1u, &length));
+   CuAssertUIntEquals(tc, 0x55u, length);
+   CuAssertUIntEquals(tc, 4u, lenprefix_decode(longHeader, 4u, &length));
+   CuAssertUIntEquals(tc, 0x010203u, length);
+   //incomplete headers
+   CuAssertUIntEquals(tc, 0u, lenprefix_decode(shortHeader, 0u, &length));
+   CuAssertUIntEquals(tc, 0u, lenprefix_decode(longHeader, 1u, &length));
+   CuAssertUIntEquals(tc, 0u, lenprefix_decode(longHeader, 3u, &length));
+}
+
+static void test_lenprefix_scan(CuTest* tc)
+{
+   uint8_t buf[STREAM_SIZE];
+   size_t offsets[NUM_MESSAGES];
+   uint32_t lengths[NUM_MESSAGES];
+   lenprefix_msg_t msgs[NUM_MESSAGES + 1u];
+   size_t i;
+   size_t consumed = 0u;
+   size_t size = build_stream(buf, offsets, lengths);
+   CuAssertUIntEquals(tc, NUM_MESSAGES, lenprefix_scan(buf, size, msgs, NUM_MESSAGES + 1u, &consumed));
+   CuAssertUIntEquals(tc, size, consumed);
+   for (i = 0u; i < NUM_MESSAGES; i++)
+   {
+      CuAssertUIntEquals(tc, offsets[i], msgs[i].offset);
+      CuAssertUIntEquals(tc, lengths[i], msgs[i].length);
+      if (lengths[i] > 0u)
+      {
+         CuAssertUIntEquals(tc, (uint8_t) i, buf[msgs[i].offset]);
+      }
+   }
+   CuAssertUIntEquals(tc, 0u, lenprefix_scan(buf, 0u, msgs, NUM_MESSAGES, &consumed));
+   CuAssertUIntEquals(tc, 0u, consumed);
+}
+
+static void test_lenprefix_scan_truncated(CuTest* tc)
+{
+   uint8_t buf[STREAM_SIZE];
+   size_t offsets[NUM_MESSAGES];
+   uint32_t lengths[NUM_MESSAGES];
+   lenprefix_msg_t msgs[NUM_MESSAGES];
+   size_t cut;
+   size_t size = build_stream(buf, offsets, lengths);
+   for (cut = 0u; cut <= size; cut++)
+   {
+      size_t consumed = 0u;
+      size_t expected = 0u;
+      size_t expectedConsumed = 0u;
+      while ( (expected < NUM_MESSAGES) && (offsets[expected] + lengths[expected] <= cut) )
+      {
+         expectedConsumed = offsets[expected] + lengths[expected];
+         expected++;
+      }
+      CuAssertUIntEquals(tc, expected, lenprefix_scan(buf, cut, msgs, NUM_MESSAGES, &consumed));
+      CuAssertUIntEquals(tc, expectedConsumed, consumed);
+   }
+}
+
+static void test_lenprefix_scan_limit(CuTest* tc)
+{
+   uint8_t buf[STREAM_SIZE];
+   size_t offsets[NUM_MESSAGES];
+   uint32_t lengths[NUM_MESSAGES];
+   lenprefix_msg_t msgs[NUM_MESSAGES];
+   size_t consumed = 0u;
+   size_t total = 0u;
+   size_t size = build_stream(buf, offsets, lengths);
+   //resuming from consumed in batches of 7 finds every message exactly once
+   while (total < NUM_MESSAGES)
+   {
+      size_t start = consumed;
+      size_t i;
+      size_t n = lenprefix_scan(&buf[start], size - start, msgs, 7u, &consumed);
+      CuAssertTrue(tc, (n == 7u) || (total + n == NUM_MESSAGES));
+      for (i = 0u; i < n; i++)
+      {
+         CuAssertUIntEquals(tc, offsets[total + i], start + msgs[i].offset);
+      }
+      total += n;
+      consumed += start;
+   }
+   CuAssertUIntEquals(tc, size, consumed);
+}
+
+static size_t build_stream(uint8_t *buf, size_t *offsets, uint32_t *lengths)
+{
+   size_t i;
+   size_t pos = 0u;
+   for (i = 0u; i < NUM_MESSAGES; i++)
+   {
+      lengths[i] = m_lengths[i];
+      pos += lenprefix_encode(&buf[pos], m_lengths[i]);
+      offsets[i] = pos;
+      memset(&buf[pos], (int) i, m_lengths[i]);
+      pos += m_lengths[i];
+   }
+   return pos;
+}
@@ -0,0 +1,421 @@
+/*****************************************************************************
+* \file      testsuite_numconv.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for numconv
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <inttypes.h>
+#include <math.h>
+#include <float.h>
+#include "CuTest.h"
+#include "numconv.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+//numconv_formatU32 is checked for every value below EXHAUSTIVE_LIMIT. The default run stops at 2^20 to keep
+//the unit tests fast (larger values are covered by digit count boundaries and random values).
+//Define NUMCONV_TEST_FULL_RANGE to check the entire 32-bit range (takes about five minutes).
+#ifdef NUMCONV_TEST_FULL_RANGE
+#define EXHAUSTIVE_LIMIT ((uint64_t) 1u << 32)
+#else
+#define EXHAUSTIVE_LIMIT ((uint64_t) 1u << 20)
+#endif
+#define NUM_RANDOM_INTEGERS 100000u
+#define NUM_RANDOM_DOUBLES 100000u
+#define TEXT_SIZE 64u
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_numconv_format_integers(CuTest* tc);
+static void test_numconv_parse_integers(CuTest* tc);
+static void test_numconv_format_double(CuTest* tc);
+static void test_numconv_parse_double(CuTest* tc);
+static void test_numconv_double_round_trip(CuTest* tc);
+static uint64_t next_random(uint64_t *state);
+static double double_from_bits(uint64_t bits);
+static void check_u64(CuTest* tc, uint64_t value);
+static void check_s64(CuTest* tc, int64_t value);
+static void check_double(CuTest* tc, double value);
+static void check_parse_double(CuTest* tc, const char *text);
+static const char *format_double(char *buf, double value);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_numconv(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_numconv_format_integers);
+   SUITE_ADD_TEST(suite, test_numconv_parse_integers);
+   SUITE_ADD_TEST(suite, test_numconv_format_double);
+   SUITE_ADD_TEST(suite, test_numconv_parse_double);
+   SUITE_ADD_TEST(suite, test_numconv_double_round_trip);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_numconv_format_integers(CuTest* tc)
+{
+   char buf[TEXT_SIZE];
+   char expected[TEXT_SIZE];
+   uint64_t state = 1u;
+   uint64_t p;
+   uint64_t i;
+   unsigned k;
+   for (i = 0u; i < EXHAUSTIVE_LIMIT; i++)
+   {
+      size_t len = numconv_formatU32(buf, (uint32_t) i);
+      sprintf(expected, "%" PRIu32, (uint32_t) i);
+      if ( (len != strlen(expected)) || (memcmp(buf, expected, len) != 0) )
+      {
+         CuFail(tc, expected);
+      }
+   }
+   //digit count boundaries
+   for (k = 0u, p = 1u; k < 20u; k++, p *= 10u)
+   {
+      check_u64(tc, p - 1u);
+      check_u64(tc, p);
+      check_u64(tc, p + 1u);
+      check_s64(tc, (int64_t) (p - 1u));
+      check_s64(tc, -(int64_t) (p - 1u));
+   }
+   for (k = 0u; k < 64u; k++)
+   {
+      p = (uint64_t) 1u << k;
+      check_u64(tc, p - 1u);
+      check_u64(tc, p);
+      check_u64(tc, p + 1u);
+      check_s64(tc, -(int64_t) (p - 1u));
+   }
+   check_u64(tc, UINT64_MAX);
+   check_s64(tc, INT64_MAX);
+   check_s64(tc, INT64_MIN);
+   buf[numconv_formatU32(buf, UINT32_MAX)] = '\0';
+   CuAssertStrEquals(tc, "4294967295", buf);
+   buf[numconv_formatS32(buf, INT32_MIN)] = '\0';
+   CuAssertStrEquals(tc, "-2147483648", buf);
+   buf[numconv_formatS32(buf, -7)] = '\0';
+   CuAssertStrEquals(tc, "-7", buf);
+   for (i = 0u; i < NUM_RANDOM_INTEGERS; i++)
+   {
+      uint64_t value = next_random(&state) >> (i & 63u);
+      check_u64(tc, value);
+      check_s64(tc, (int64_t) value);
+   }
+}
+
+static void test_numconv_parse_integers(CuTest* tc)
+{
+   uint64_t u = 0u;
+   int64_t s = 0;
+   CuAssertUIntEquals(tc, 1u, numconv_parseU64("0", 1u, &u));
+   CuAssertTrue(tc, u == 0u);
+   CuAssertUIntEquals(tc, 3u, numconv_parseU64("000", 3u, &u));
+   CuAssertTrue(tc, u == 0u);
+   CuAssertUIntEquals(tc, 5u, numconv_parseU64("12345abc", 8u, &u));
+   CuAssertTrue(tc, u == 12345u);
+   CuAssertUIntEquals(tc, 3u, numconv_parseU64("12345678", 3u, &u));
+   CuAssertTrue(tc, u == 123u);
+   CuAssertUIntEquals(tc, 20u, numconv_parseU64("18446744073709551615", 20u, &u));
+   CuAssertTrue(tc, u == UINT64_MAX);
+   CuAssertUIntEquals(tc, 25u, numconv_parseU64("0000018446744073709551615", 25u, &u));
+   CuAssertTrue(tc, u == UINT64_MAX);
+   CuAssertUIntEquals(tc, 0u, numconv_parseU64("18446744073709551616", 20u, &u));
+   CuAssertUIntEquals(tc, 0u, numconv_parseU64("100000000000000000000", 21u, &u));
+   CuAssertUIntEquals(tc, 0u, numconv_parseU64("", 0u, &u));
+   CuAssertUIntEquals(tc, 0u, numconv_parseU64("-1", 2u, &u));
+   CuAssertUIntEquals(tc, 0u, numconv_parseU64("+1", 2u, &u));
+   CuAssertUIntEquals(tc, 0u, numconv_parseU64(" 1", 2u, &u));
+
+   CuAssertUIntEquals(tc, 20u, numconv_parseS64("-9223372036854775808", 20u, &s));
+   CuAssertTrue(tc, s == INT64_MIN);
+   CuAssertUIntEquals(tc, 19u, numconv_parseS64("9223372036854775807", 19u, &s));
+   CuAssertTrue(tc, s == INT64_MAX);
+   CuAssertUIntEquals(tc, 0u, numconv_parseS64("9223372036854775808", 19u, &s));
+   CuAssertUIntEquals(tc, 0u, numconv_parseS64("-9223372036854775809", 20u, &s));
+   CuAssertUIntEquals(tc, 0u, numconv_parseS64("-", 1u, &s));
+   CuAssertUIntEquals(tc, 2u, numconv_parseS64("-0", 2u, &s));
+   CuAssertTrue(tc, s == 0);
+   CuAssertUIntEquals(tc, 3u, numconv_parseS64("-42,", 4u, &s));
+   CuAssertTrue(tc, s == -42);
+}
+
+static void test_numconv_format_double(CuTest* tc)
+{
+   char buf[TEXT_SIZE];
+   CuAssertStrEquals(tc, "0", format_double(buf, 0.0));
+   CuAssertStrEquals(tc, "-0", format_double(buf, -0.0));
+   CuAssertStrEquals(tc, "NaN", format_double(buf, NAN));
+   CuAssertStrEquals(tc, "Infinity", format_double(buf, INFINITY));
+   CuAssertStrEquals(tc, "-Infinity", format_double(buf, -INFINITY));
+   CuAssertStrEquals(tc, "1", format_double(buf, 1.0));
+   CuAssertStrEquals(tc, "-1.5", format_double(buf, -1.5));
+   CuAssertStrEquals(tc, "0.1", format_double(buf, 0.1));
+   CuAssertStrEquals(tc, "0.30000000000000004", format_double(buf, 0.1 + 0.2));
+   CuAssertStrEquals(tc, "123.456", format_double(buf, 123.456));
+   CuAssertStrEquals(tc, "100", format_double(buf, 100.0));
+   CuAssertStrEquals(tc, "100000000000000000000", format_double(buf, 1e20));
+   CuAssertStrEquals(tc, "1e+21", format_double(buf, 1e21));
+   CuAssertStrEquals(tc, "1.5e+300", format_double(buf, 1.5e300));
+   CuAssertStrEquals(tc, "0.000001", format_double(buf, 1e-6));
+   CuAssertStrEquals(tc, "1e-7", format_double(buf, 1e-7));
+   CuAssertStrEquals(tc, "1.2345e-7", format_double(buf, 1.2345e-7));
+   CuAssertStrEquals(tc, "9007199254740992", format_double(buf, 9007199254740992.0));
+   CuAssertStrEquals(tc, "1.7976931348623157e+308", format_double(buf, DBL_MAX));
+   CuAssertStrEquals(tc, "2.2250738585072014e-308", format_double(buf, DBL_MIN));
+   CuAssertStrEquals(tc, "5e-324", format_double(buf, 4.9406564584124654e-324));
+   CuAssertStrEquals(tc, "1e-323", format_double(buf, 9.8813129168249309e-324));
+   CuAssertStrEquals(tc, "1.5e-323", format_double(buf, 1.4821969375237396e-323));
+   CuAssertStrEquals(tc, "-1.7976931348623157e+308", format_double(buf, -DBL_MAX));
+   CuAssertStrEquals(tc, "-1.2345678901234568e-300", format_double(buf, -1.2345678901234568e-300));
+}
+
+static void test_numconv_parse_double(CuTest* tc)
+{
+   double value = 0.0;
+   CuAssertUIntEquals(tc, 1u, numconv_parseDouble("0", 1u, &value));
+   CuAssertUIntEquals(tc, 2u, numconv_parseDouble("-0", 2u, &value));
+   CuAssertTrue(tc, (value == 0.0) && signbit(value));
+   CuAssertUIntEquals(tc, 4u, numconv_parseDouble("1.25", 4u, &value));
+   CuAssertTrue(tc, value == 1.25);
+   CuAssertUIntEquals(tc, 1u, numconv_parseDouble("1.", 2u, &value));
+   CuAssertTrue(tc, value == 1.0);
+   CuAssertUIntEquals(tc, 1u, numconv_parseDouble("1e", 2u, &value));
+   CuAssertUIntEquals(tc, 1u, numconv_parseDouble("1e+", 3u, &value));
+   CuAssertUIntEquals(tc, 4u, numconv_parseDouble("1E-2]", 5u, &value));
+   CuAssertTrue(tc, value == 0.01);
+   CuAssertUIntEquals(tc, 3u, numconv_parseDouble("1.5", 3u, &value));
+   CuAssertUIntEquals(tc, 1u, numconv_parseDouble("1.5", 1u, &value));
+   CuAssertTrue(tc, value == 1.0);
+   CuAssertUIntEquals(tc, 0u, numconv_parseDouble("", 0u, &value));
+   CuAssertUIntEquals(tc, 0u, numconv_parseDouble("-", 1u, &value));
+   CuAssertUIntEquals(tc, 0u, numconv_parseDouble(".5", 2u, &value));
+   CuAssertUIntEquals(tc, 0u, numconv_parseDouble("+1", 2u, &value));
+   CuAssertUIntEquals(tc, 6u, numconv_parseDouble("1e9999", 6u, &value));
+   CuAssertTrue(tc, value == INFINITY);
+   CuAssertUIntEquals(tc, 7u, numconv_parseDouble("-1e9999", 7u, &value));
+   CuAssertTrue(tc, value == -INFINITY);
+   CuAssertUIntEquals(tc, 7u, numconv_parseDouble("1e-9999", 7u, &value));
+   CuAssertTrue(tc, value == 0.0);
+   //fast path, extended fast path, truncated mantissa and denormals
+   check_parse_double(tc, "9007199254740993");
+   check_parse_double(tc, "1e22");
+   check_parse_double(tc, "1e23");
+   check_parse_double(tc, "123456789e30");
+   check_parse_double(tc, "-0.000123456789012345678");
+   check_parse_double(tc, "3.14159265358979323846264338327950288");
+   check_parse_double(tc, "2.4703282292062327e-324");
+   check_parse_double(tc, "2.4703282292062328e-324");
+   check_parse_double(tc, "1.7976931348623158e308");
+   check_parse_double(tc, "0.00000000000000000000000000000000000000000000000000000001");
+   check_parse_double(tc, "100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000001");
+}
+
+/**
+ * Checks that formatting round trips and that no shorter decimal would.
+ */
+static void test_numconv_double_round_trip(CuTest* tc)
+{
+   uint64_t state = 7u;
+   uint32_t i;
+   int e;
+   for (i = 0u; i < NUM_RANDOM_DOUBLES; i++)
+   {
+      double value = double_from_bits(next_random(&state));
+      if (isfinite(value))
+      {
+         check_double(tc, value);
+      }
+   }
+   //powers of two (where the rounding interval is asymmetric) and their predecessors
+   for (e = 1; e < 2047; e++)
+   {
+      check_double(tc, double_from_bits((uint64_t) e << 52));
+      check_double(tc, double_from_bits(((uint64_t) e << 52) - 1u));
+   }
+   for (e = 0; e < 52; e++)
+   {
+      check_double(tc, double_from_bits((uint64_t) 1u << e));
+   }
+   for (i = 0u; i < 10000u; i++)
+   {
+      check_double(tc, (double) i / 1000.0);
+      check_double(tc, (double) next_random(&state) / 1e10);
+   }
+}
+
+static uint64_t next_random(uint64_t *state)
+{
+   uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+   z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+   z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+   return z ^ (z >> 31);
+}
+
+static double double_from_bits(uint64_t bits)
+{
+   double value;
+   memcpy(&value, &bits, sizeof(value));
+   return value;
+}
+
+static void check_u64(CuTest* tc, uint64_t value)
+{
+   char buf[TEXT_SIZE];
+   char expected[TEXT_SIZE];
+   uint64_t parsed = 0u;
+   size_t len = numconv_formatU64(buf, value);
+   buf[len] = '\0';
+   sprintf(expected, "%" PRIu64, value);
+   CuAssertStrEquals(tc, expected, buf);
+   CuAssertUIntEquals(tc, len, numconv_parseU64(buf, len, &parsed));
+   CuAssertTrue(tc, parsed == value);
+   if (value <= UINT32_MAX)
+   {
+      len = numconv_formatU32(buf, (uint32_t) value);
+      buf[len] = '\0';
+      CuAssertStrEquals(tc, expected, buf);
+   }
+}
+
+static void check_s64(CuTest* tc, int64_t value)
+{
+   char buf[TEXT_SIZE];
+   char expected[TEXT_SIZE];
+   int64_t parsed = 0;
+   size_t len = numconv_formatS64(buf, value);
+   buf[len] = '\0';
+   sprintf(expected, "%" PRId64, value);
+   CuAssertStrEquals(tc, expected, buf);
+   CuAssertUIntEquals(tc, len, numconv_parseS64(buf, len, &parsed));
+   CuAssertTrue(tc, parsed == value);
+   if ( (value >= INT32_MIN) && (value <= INT32_MAX) )
+   {
+      len = numconv_formatS32(buf, (int32_t) value);
+      buf[len] = '\0';
+      CuAssertStrEquals(tc, expected, buf);
+   }
+}
+
+static void check_double(CuTest* tc, double value)
+{
+   char buf[TEXT_SIZE];
+   char shorter[TEXT_SIZE];
+   double parsed = 0.0;
+   uint64_t significand = 0u;
+   unsigned numDigits = 0u;
+   unsigned numZeros = 0u;
+   int exponent = 0;
+   size_t len = numconv_formatDouble(buf, value);
+   size_t i;
+   bool isFraction = false;
+   CuAssertTrue(tc, len <= NUMCONV_DOUBLE_MAX_SIZE);
+   buf[len] = '\0';
+   CuAssertUIntEquals(tc, len, numconv_parseDouble(buf, len, &parsed));
+   if (memcmp(&parsed, &value, sizeof(value)) != 0)
+   {
+      CuFail(tc, buf);
+   }
+   CuAssertTrue(tc, strtod(buf, (char**) 0) == value);
+   //split into significant digits and exponent, leaving out trailing zeros
+   for (i = 0u; (i < len) && (buf[i] != 'e'); i++)
+   {
+      if (buf[i] == '.')
+      {
+         isFraction = true;
+      }
+      else if ( (buf[i] >= '0') && (buf[i] <= '9') )
+      {
+         if (buf[i] == '0')
+         {
+            numZeros++;
+         }
+         else
+         {
+            if (numDigits > 0u)
+            {
+               for (; numZeros > 0u; numZeros--)
+               {
+                  significand *= 10u;
+                  numDigits++;
+               }
+            }
+            numZeros = 0u;
+            significand = significand * 10u + (uint64_t) (buf[i] - '0');
+            numDigits++;
+         }
+         exponent -= isFraction? 1 : 0;
+      }
+   }
+   exponent += (int) numZeros;
+   if (i < len)
+   {
+      exponent += atoi(&buf[i + 1u]);
+   }
+   CuAssertTrue(tc, numDigits <= 17u);
+   //neither neighbour with one digit less may round trip
+   if (numDigits > 1u)
+   {
+      sprintf(shorter, "%" PRIu64 "e%d", significand / 10u, exponent + 1);
+      if (fabs(strtod(shorter, (char**) 0)) == fabs(value))
+      {
+         CuFail(tc, buf);
+      }
+      sprintf(shorter, "%" PRIu64 "e%d", significand / 10u + 1u, exponent + 1);
+      if (fabs(strtod(shorter, (char**) 0)) == fabs(value))
+      {
+         CuFail(tc, buf);
+      }
+   }
+}
+
+static void check_parse_double(CuTest* tc, const char *text)
+{
+   double value = 0.0;
+   size_t len = strlen(text);
+   CuAssertUIntEquals(tc, len, numconv_parseDouble(text, len, &value));
+   CuAssertTrue(tc, value == strtod(text, (char**) 0));
+}
+
+static const char *format_double(char *buf, double value)
+{
+   buf[numconv_formatDouble(buf, value)] = '\0';
+   return buf;
+}
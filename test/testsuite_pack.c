@@ -25,6 +25,9 @@
 //////////////////////////////////////////////////////////////////////////////
 static void test_pack_unpack_LE64(CuTest* tc);
 static void test_unpack_little_endian_using_macros(CuTest* tc);
+static void test_inline_pack_unsigned(CuTest* tc);
+static void test_inline_pack_signed(CuTest* tc);
+static void test_inline_pack_float(CuTest* tc);
 
 //////////////////////////////////////////////////////////////////////////////
 // GLOBAL VARIABLES
@@ -46,6 +49,9 @@ CuSuite* testsuite_pack(void)
 
    SUITE_ADD_TEST(suite, test_pack_unpack_LE64);
    SUITE_ADD_TEST(suite, test_unpack_little_endian_using_macros);
+   SUITE_ADD_TEST(suite, test_inline_pack_unsigned);
+   SUITE_ADD_TEST(suite, test_inline_pack_signed);
+   SUITE_ADD_TEST(suite, test_inline_pack_float);
 
    return suite;
 }
@@ -130,3 +136,87 @@ static void test_unpack_little_endian_using_macros(CuTest* tc)
    CuAssertConstPtrEquals(tc, pBegin+4, p);
    CuAssertUIntEquals(tc, 1*256u+2*65536u+3*16777216u, u32Value);
 }
+
+static void test_inline_pack_unsigned(CuTest* tc)
+{
+   uint8_t buf[8];
+   static const uint8_t le64[8] = {0xEF, 0xCD, 0xAB, 0x89, 0x67, 0x45, 0x23, 0x01};
+   static const uint8_t be64[8] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF};
+
+   pack_u8(buf, 0xA5u);
+   CuAssertUIntEquals(tc, 0xA5u, buf[0]);
+   CuAssertUIntEquals(tc, 0xA5u, unpack_u8(buf));
+
+   pack_u16le(buf, 0x1234u);
+   CuAssertUIntEquals(tc, 0x34u, buf[0]);
+   CuAssertUIntEquals(tc, 0x12u, buf[1]);
+   CuAssertUIntEquals(tc, 0x1234u, unpack_u16le(buf));
+   pack_u16be(buf, 0x1234u);
+   CuAssertUIntEquals(tc, 0x12u, buf[0]);
+   CuAssertUIntEquals(tc, 0x34u, buf[1]);
+   CuAssertUIntEquals(tc, 0x1234u, unpack_u16be(buf));
+
+   pack_u32le(buf, 0x01234567u);
+   CuAssertIntEquals(tc, 0, memcmp(buf, &le64[4], 4));
+   CuAssertUIntEquals(tc, 0x01234567u, unpack_u32le(buf));
+   pack_u32be(buf, 0x89ABCDEFu);
+   CuAssertIntEquals(tc, 0, memcmp(buf, &be64[4], 4));
+   CuAssertUIntEquals(tc, 0x89ABCDEFu, unpack_u32be(buf));
+
+   pack_u64le(buf, 0x0123456789ABCDEFull);
+   CuAssertIntEquals(tc, 0, memcmp(buf, le64, 8));
+   CuAssertULIntEquals(tc, 0x0123456789ABCDEFull, unpack_u64le(buf));
+   pack_u64be(buf, 0x0123456789ABCDEFull);
+   CuAssertIntEquals(tc, 0, memcmp(buf, be64, 8));
+   CuAssertULIntEquals(tc, 0x0123456789ABCDEFull, unpack_u64be(buf));
+
+   //must agree with the original functions
+   CuAssertUIntEquals(tc, unpackLE(le64, 4), unpack_u32le(le64));
+   CuAssertUIntEquals(tc, unpackBE(be64, 2), unpack_u16be(be64));
+   CuAssertULIntEquals(tc, unpackLE64(le64, 8), unpack_u64le(le64));
+}
+
+static void test_inline_pack_signed(CuTest* tc)
+{
+   uint8_t buf[8];
+   pack_s8(buf, -2);
+   CuAssertUIntEquals(tc, 0xFEu, buf[0]);
+   CuAssertIntEquals(tc, -2, unpack_s8(buf));
+   pack_s16le(buf, -2);
+   CuAssertUIntEquals(tc, 0xFEu, buf[0]);
+   CuAssertUIntEquals(tc, 0xFFu, buf[1]);
+   CuAssertIntEquals(tc, -2, unpack_s16le(buf));
+   pack_s16be(buf, -32768);
+   CuAssertUIntEquals(tc, 0x80u, buf[0]);
+   CuAssertUIntEquals(tc, 0x00u, buf[1]);
+   CuAssertIntEquals(tc, -32768, unpack_s16be(buf));
+   pack_s32le(buf, -100000);
+   CuAssertIntEquals(tc, -100000, unpack_s32le(buf));
+   pack_s32be(buf, -100000);
+   CuAssertUIntEquals(tc, 0xFFu, buf[0]);
+   CuAssertIntEquals(tc, -100000, unpack_s32be(buf));
+   pack_s64le(buf, -1234567890123ll);
+   CuAssertTrue(tc, unpack_s64le(buf) == -1234567890123ll);
+   pack_s64be(buf, INT64_MIN);
+   CuAssertUIntEquals(tc, 0x80u, buf[0]);
+   CuAssertTrue(tc, unpack_s64be(buf) == INT64_MIN);
+}
+
+static void test_inline_pack_float(CuTest* tc)
+{
+   uint8_t buf[8];
+   static const uint8_t one_f32_be[4] = {0x3F, 0x80, 0x00, 0x00};
+   static const uint8_t one_f64_be[8] = {0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+   pack_f32be(buf, 1.0f);
+   CuAssertIntEquals(tc, 0, memcmp(buf, one_f32_be, 4));
+   CuAssertDblEquals(tc, 1.0, unpack_f32be(buf), 0.0);
+   pack_f32le(buf, -0.15625f);
+   CuAssertUIntEquals(tc, 0xBEu, buf[3]);
+   CuAssertDblEquals(tc, -0.15625, unpack_f32le(buf), 0.0);
+   pack_f64be(buf, 1.0);
+   CuAssertIntEquals(tc, 0, memcmp(buf, one_f64_be, 8));
+   CuAssertDblEquals(tc, 1.0, unpack_f64be(buf), 0.0);
+   pack_f64le(buf, 3.141592653589793);
+   CuAssertUIntEquals(tc, 0x40u, buf[7]);
+   CuAssertDblEquals(tc, 3.141592653589793, unpack_f64le(buf), 0.0);
+}
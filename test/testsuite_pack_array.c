@@ -0,0 +1,261 @@
+/*****************************************************************************
+* \file      testsuite_pack_array.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for bulk array pack/unpack
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdint.h>
+#include "CuTest.h"
+#include "pack.h"
+#include "pack_array.h"
+#include "cutil_cpu.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define MAX_ELEMENTS 100u
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_pack_array_u16(CuTest* tc);
+static void test_pack_array_u32(CuTest* tc);
+static void test_pack_array_u64(CuTest* tc);
+static void test_pack_array_in_place(CuTest* tc);
+static void test_swap_array(CuTest* tc);
+static void test_pack_array_all_kernels(CuTest* tc);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//covers empty arrays, scalar tails and every vector block size
+static const size_t m_lengths[] = {0u, 1u, 3u, 7u, 8u, 9u, 16u, 17u, 31u, 33u, 64u, 65u, MAX_ELEMENTS};
+#define NUM_LENGTHS (sizeof(m_lengths) / sizeof(m_lengths[0]))
+
+//forces each kernel variant in turn (on CPUs lacking a feature the next one down is tested twice)
+static const uint32_t m_kernel_features[] = {CUTIL_CPU_ALL, CUTIL_CPU_SSE2 | CUTIL_CPU_SSSE3, 0u};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_pack_array(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_pack_array_u16);
+   SUITE_ADD_TEST(suite, test_pack_array_u32);
+   SUITE_ADD_TEST(suite, test_pack_array_u64);
+   SUITE_ADD_TEST(suite, test_pack_array_in_place);
+   SUITE_ADD_TEST(suite, test_swap_array);
+   SUITE_ADD_TEST(suite, test_pack_array_all_kernels);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_pack_array_u16(CuTest* tc)
+{
+   size_t i, k;
+   uint16_t src[MAX_ELEMENTS];
+   uint16_t dst[MAX_ELEMENTS];
+   uint8_t buf[MAX_ELEMENTS * 2u + 1u];
+   for (i = 0u; i < MAX_ELEMENTS; i++)
+   {
+      src[i] = (uint16_t) (0x0102u * (i + 1u));
+   }
+   for (k = 0u; k < NUM_LENGTHS; k++)
+   {
+      const size_t n = m_lengths[k];
+      uint8_t *p = &buf[1]; //deliberately unaligned
+      memset(buf, 0xAA, sizeof(buf));
+      packArrayU16BE(p, src, n);
+      for (i = 0u; i < n; i++)
+      {
+         CuAssertUIntEquals(tc, src[i], unpack_u16be(&p[i * 2u]));
+      }
+      if (n < MAX_ELEMENTS)
+      {
+         CuAssertUIntEquals(tc, 0xAAu, p[n * 2u]);
+      }
+      memset(dst, 0, sizeof(dst));
+      unpackArrayU16BE(dst, p, n);
+      CuAssertIntEquals(tc, 0, memcmp(dst, src, n * sizeof(uint16_t)));
+
+      packArrayU16LE(p, src, n);
+      for (i = 0u; i < n; i++)
+      {
+         CuAssertUIntEquals(tc, src[i], unpack_u16le(&p[i * 2u]));
+      }
+      memset(dst, 0, sizeof(dst));
+      unpackArrayU16LE(dst, p, n);
+      CuAssertIntEquals(tc, 0, memcmp(dst, src, n * sizeof(uint16_t)));
+   }
+}
+
+static void test_pack_array_u32(CuTest* tc)
+{
+   size_t i, k;
+   uint32_t src[MAX_ELEMENTS];
+   uint32_t dst[MAX_ELEMENTS];
+   uint8_t buf[MAX_ELEMENTS * 4u + 1u];
+   for (i = 0u; i < MAX_ELEMENTS; i++)
+   {
+      src[i] = (uint32_t) (0x01020304u * (i + 1u));
+   }
+   for (k = 0u; k < NUM_LENGTHS; k++)
+   {
+      const size_t n = m_lengths[k];
+      uint8_t *p = &buf[1];
+      memset(buf, 0xAA, sizeof(buf));
+      packArrayU32BE(p, src, n);
+      for (i = 0u; i < n; i++)
+      {
+         CuAssertUIntEquals(tc, src[i], unpack_u32be(&p[i * 4u]));
+      }
+      if (n < MAX_ELEMENTS)
+      {
+         CuAssertUIntEquals(tc, 0xAAu, p[n * 4u]);
+      }
+      memset(dst, 0, sizeof(dst));
+      unpackArrayU32BE(dst, p, n);
+      CuAssertIntEquals(tc, 0, memcmp(dst, src, n * sizeof(uint32_t)));
+
+      packArrayU32LE(p, src, n);
+      for (i = 0u; i < n; i++)
+      {
+         CuAssertUIntEquals(tc, src[i], unpack_u32le(&p[i * 4u]));
+      }
+      memset(dst, 0, sizeof(dst));
+      unpackArrayU32LE(dst, p, n);
+      CuAssertIntEquals(tc, 0, memcmp(dst, src, n * sizeof(uint32_t)));
+   }
+}
+
+static void test_pack_array_u64(CuTest* tc)
+{
+   size_t i, k;
+   uint64_t src[MAX_ELEMENTS];
+   uint64_t dst[MAX_ELEMENTS];
+   uint8_t buf[MAX_ELEMENTS * 8u + 1u];
+   for (i = 0u; i < MAX_ELEMENTS; i++)
+   {
+      src[i] = (uint64_t) (0x0102030405060708ull * (i + 1u));
+   }
+   for (k = 0u; k < NUM_LENGTHS; k++)
+   {
+      const size_t n = m_lengths[k];
+      uint8_t *p = &buf[1];
+      memset(buf, 0xAA, sizeof(buf));
+      packArrayU64BE(p, src, n);
+      for (i = 0u; i < n; i++)
+      {
+         CuAssertTrue(tc, src[i] == unpack_u64be(&p[i * 8u]));
+      }
+      if (n < MAX_ELEMENTS)
+      {
+         CuAssertUIntEquals(tc, 0xAAu, p[n * 8u]);
+      }
+      memset(dst, 0, sizeof(dst));
+      unpackArrayU64BE(dst, p, n);
+      CuAssertIntEquals(tc, 0, memcmp(dst, src, n * sizeof(uint64_t)));
+
+      packArrayU64LE(p, src, n);
+      for (i = 0u; i < n; i++)
+      {
+         CuAssertTrue(tc, src[i] == unpack_u64le(&p[i * 8u]));
+      }
+      memset(dst, 0, sizeof(dst));
+      unpackArrayU64LE(dst, p, n);
+      CuAssertIntEquals(tc, 0, memcmp(dst, src, n * sizeof(uint64_t)));
+   }
+}
+
+static void test_pack_array_in_place(CuTest* tc)
+{
+   size_t i;
+   uint32_t data[MAX_ELEMENTS];
+   for (i = 0u; i < MAX_ELEMENTS; i++)
+   {
+      data[i] = (uint32_t) (0xA0B0C0D0u + i);
+   }
+   packArrayU32BE((uint8_t*) data, data, MAX_ELEMENTS);
+   for (i = 0u; i < MAX_ELEMENTS; i++)
+   {
+      CuAssertUIntEquals(tc, 0xA0B0C0D0u + i, unpack_u32be((const uint8_t*) &data[i]));
+   }
+   unpackArrayU32BE(data, (const uint8_t*) data, MAX_ELEMENTS);
+   for (i = 0u; i < MAX_ELEMENTS; i++)
+   {
+      CuAssertUIntEquals(tc, 0xA0B0C0D0u + i, data[i]);
+   }
+}
+
+static void test_swap_array(CuTest* tc)
+{
+   size_t i;
+   uint16_t a16[MAX_ELEMENTS];
+   uint32_t a32[MAX_ELEMENTS];
+   uint64_t a64[MAX_ELEMENTS];
+   for (i = 0u; i < MAX_ELEMENTS; i++)
+   {
+      a16[i] = (uint16_t) (0x1100u + i);
+      a32[i] = (uint32_t) (0x11223300u + i);
+      a64[i] = 0x1122334455667700ull + i;
+   }
+   swapArrayU16(a16, MAX_ELEMENTS - 1u);
+   swapArrayU32(a32, MAX_ELEMENTS - 1u);
+   swapArrayU64(a64, MAX_ELEMENTS - 1u);
+   for (i = 0u; i < MAX_ELEMENTS - 1u; i++)
+   {
+      CuAssertUIntEquals(tc, (uint16_t) ((i << 8) | 0x11u), a16[i]);
+      CuAssertUIntEquals(tc, (uint32_t) ((i << 24) | 0x00332211u), a32[i]);
+      CuAssertTrue(tc, a64[i] == (((uint64_t) i << 56) | 0x0077665544332211ull));
+   }
+   //last element is untouched
+   CuAssertUIntEquals(tc, 0x1100u + MAX_ELEMENTS - 1u, a16[MAX_ELEMENTS - 1u]);
+   CuAssertUIntEquals(tc, 0x11223300u + MAX_ELEMENTS - 1u, a32[MAX_ELEMENTS - 1u]);
+}
+
+static void test_pack_array_all_kernels(CuTest* tc)
+{
+   size_t i;
+   for (i = 0u; i < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); i++)
+   {
+      cutil_cpu_override(m_kernel_features[i]);
+      test_pack_array_u16(tc);
+      test_pack_array_u32(tc);
+      test_pack_array_u64(tc);
+      test_pack_array_in_place(tc);
+      test_swap_array(tc);
+   }
+   cutil_cpu_reset();
+}
@@ -0,0 +1,168 @@
+/*****************************************************************************
+* \file      testsuite_pack_cursor.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for pack_writer_t and pack_reader_t
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdint.h>
+#include "CuTest.h"
+#include "pack_cursor.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_writer_fixed_buffer(CuTest* tc);
+static void test_writer_overrun_is_sticky(CuTest* tc);
+static void test_writer_grows_byte_array(CuTest* tc);
+static void test_reader(CuTest* tc);
+static void test_reader_underrun_is_sticky(CuTest* tc);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_pack_cursor(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_writer_fixed_buffer);
+   SUITE_ADD_TEST(suite, test_writer_overrun_is_sticky);
+   SUITE_ADD_TEST(suite, test_writer_grows_byte_array);
+   SUITE_ADD_TEST(suite, test_reader);
+   SUITE_ADD_TEST(suite, test_reader_underrun_is_sticky);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_writer_fixed_buffer(CuTest* tc)
+{
+   uint8_t buf[16];
+   pack_writer_t writer;
+   static const uint8_t expected[15] = {0x01, 0x12, 0x34, 0x78, 0x56, 0x34, 0x12, 0xFF, 0xFE,
+                                        0x3F, 0x80, 0x00, 0x00, 'h', 'i'};
+   pack_writer_init(&writer, buf, sizeof(buf));
+   CuAssertTrue(tc, pack_writer_reserve(&writer, sizeof(expected)));
+   pack_writer_putU8(&writer, 0x01u);
+   pack_writer_putU16BE(&writer, 0x1234u);
+   pack_writer_putU32LE(&writer, 0x12345678u);
+   pack_writer_putS16BE(&writer, -2);
+   pack_writer_putF32BE(&writer, 1.0f);
+   pack_writer_putBytes(&writer, "hi", 2u);
+   CuAssertUIntEquals(tc, sizeof(expected), pack_writer_length(&writer));
+   CuAssertIntEquals(tc, 0, memcmp(buf, expected, sizeof(expected)));
+   CuAssertTrue(tc, pack_writer_writeU8(&writer, 0xAAu));
+   CuAssertTrue(tc, pack_writer_finish(&writer));
+   CuAssertUIntEquals(tc, 16u, pack_writer_length(&writer));
+}
+
+static void test_writer_overrun_is_sticky(CuTest* tc)
+{
+   uint8_t buf[6];
+   pack_writer_t writer;
+   memset(buf, 0, sizeof(buf));
+   pack_writer_init(&writer, buf, sizeof(buf));
+   CuAssertTrue(tc, pack_writer_writeU32BE(&writer, 0x01020304u));
+   CuAssertTrue(tc, !pack_writer_error(&writer));
+   CuAssertTrue(tc, !pack_writer_writeU32BE(&writer, 0x05060708u));
+   CuAssertTrue(tc, pack_writer_error(&writer));
+   CuAssertUIntEquals(tc, 4u, pack_writer_length(&writer));
+   CuAssertUIntEquals(tc, 0u, buf[4]);
+   //the remaining two bytes would fit but the error is sticky
+   CuAssertTrue(tc, !pack_writer_writeU16BE(&writer, 0xFFFFu));
+   CuAssertTrue(tc, !pack_writer_reserve(&writer, 0u));
+   CuAssertUIntEquals(tc, 4u, pack_writer_length(&writer));
+   CuAssertTrue(tc, !pack_writer_finish(&writer));
+}
+
+static void test_writer_grows_byte_array(CuTest* tc)
+{
+   adt_bytearray_t array;
+   pack_writer_t writer;
+   uint32_t i;
+   const uint8_t *data;
+   adt_bytearray_create(&array, ADT_BYTE_ARRAY_DEFAULT_GROW_SIZE);
+   adt_bytearray_append(&array, (const uint8_t*) "AB", 2u);
+   pack_writer_initArray(&writer, &array);
+   for (i = 0u; i < 1000u; i++)
+   {
+      CuAssertTrue(tc, pack_writer_writeU32LE(&writer, i));
+   }
+   CuAssertTrue(tc, pack_writer_reserve(&writer, 3u * sizeof(uint64_t)));
+   pack_writer_putU64BE(&writer, 1u);
+   pack_writer_putS64LE(&writer, -1);
+   pack_writer_putF64LE(&writer, 0.5);
+   CuAssertTrue(tc, pack_writer_finish(&writer));
+   CuAssertUIntEquals(tc, 2u + 4000u + 24u, adt_bytearray_length(&array));
+   data = adt_bytearray_data(&array);
+   CuAssertIntEquals(tc, 0, memcmp(data, "AB", 2u));
+   for (i = 0u; i < 1000u; i++)
+   {
+      CuAssertUIntEquals(tc, i, unpack_u32le(&data[2u + i * 4u]));
+   }
+   CuAssertTrue(tc, unpack_u64be(&data[4002u]) == 1u);
+   CuAssertTrue(tc, unpack_s64le(&data[4010u]) == -1);
+   CuAssertDblEquals(tc, 0.5, unpack_f64le(&data[4018u]), 0.0);
+   adt_bytearray_destroy(&array);
+}
+
+static void test_reader(CuTest* tc)
+{
+   pack_reader_t reader;
+   uint8_t bytes[3];
+   static const uint8_t data[] = {0x01, 0x12, 0x34, 0x78, 0x56, 0x34, 0x12, 0xFF, 0xFE,
+                                  0xBF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 'a', 'b', 'c', 0x80};
+   pack_reader_init(&reader, data, sizeof(data));
+   CuAssertTrue(tc, pack_reader_require(&reader, 9u));
+   CuAssertUIntEquals(tc, 0x01u, pack_reader_getU8(&reader));
+   CuAssertUIntEquals(tc, 0x1234u, pack_reader_getU16BE(&reader));
+   CuAssertUIntEquals(tc, 0x12345678u, pack_reader_getU32LE(&reader));
+   CuAssertIntEquals(tc, -2, pack_reader_getS16BE(&reader));
+   CuAssertDblEquals(tc, -1.0, pack_reader_readF64BE(&reader), 0.0);
+   CuAssertTrue(tc, pack_reader_readBytes(&reader, bytes, sizeof(bytes)));
+   CuAssertIntEquals(tc, 0, memcmp(bytes, "abc", 3u));
+   CuAssertIntEquals(tc, -128, pack_reader_readS8(&reader));
+   CuAssertUIntEquals(tc, 0u, pack_reader_remaining(&reader));
+   CuAssertTrue(tc, !pack_reader_error(&reader));
+}
+
+static void test_reader_underrun_is_sticky(CuTest* tc)
+{
+   pack_reader_t reader;
+   static const uint8_t data[] = {0x01, 0x02, 0x03};
+   pack_reader_init(&reader, data, sizeof(data));
+   CuAssertUIntEquals(tc, 0u, pack_reader_readU32BE(&reader));
+   CuAssertTrue(tc, pack_reader_error(&reader));
+   CuAssertUIntEquals(tc, 3u, pack_reader_remaining(&reader));
+   //enough bytes remain for these but the error is sticky
+   CuAssertUIntEquals(tc, 0u, pack_reader_readU16LE(&reader));
+   CuAssertTrue(tc, !pack_reader_skip(&reader, 1u));
+   CuAssertUIntEquals(tc, 3u, pack_reader_remaining(&reader));
+}
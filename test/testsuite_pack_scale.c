@@ -0,0 +1,402 @@
+/*****************************************************************************
+* \file      testsuite_pack_scale.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for pack_scale
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "CuTest.h"
+#include "pack_scale.h"
+#include "cutil_cpu.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define MAX_ELEMENTS 100u
+#define NUM_RAW_TYPES 6u //s8, u8, s16, u16, s32, u32
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_pack_scale_to_physical(CuTest* tc);
+static void test_pack_scale_from_physical(CuTest* tc);
+static void test_pack_scale_32bit_limits(CuTest* tc);
+static void test_pack_scale_round_trip(CuTest* tc);
+static void test_pack_scale_all_kernels(CuTest* tc);
+static void to_f32(unsigned rawType, float *dst, const void *src, size_t n, float scale, float offset);
+static void to_f64(unsigned rawType, double *dst, const void *src, size_t n, double scale, double offset);
+static void from_f32(unsigned rawType, void *dst, const float *src, size_t n, float scale, float offset);
+static void from_f64(unsigned rawType, void *dst, const double *src, size_t n, double scale, double offset);
+static int64_t get_raw(unsigned rawType, const void *src, size_t i);
+static int64_t round_half_even(double x);
+static uint32_t next_random(uint32_t *state);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//covers empty arrays, scalar tails and every vector block size
+static const size_t m_lengths[] = {0u, 1u, 3u, 7u, 8u, 9u, 16u, 17u, 31u, 33u, 64u, 65u, MAX_ELEMENTS};
+#define NUM_LENGTHS (sizeof(m_lengths) / sizeof(m_lengths[0]))
+
+//forces each kernel variant in turn
+static const uint32_t m_kernel_features[] = {CUTIL_CPU_ALL, 0u};
+
+static const int64_t m_raw_min[NUM_RAW_TYPES] = {INT8_MIN, 0, INT16_MIN, 0, INT32_MIN, 0};
+static const int64_t m_raw_max[NUM_RAW_TYPES] = {INT8_MAX, UINT8_MAX, INT16_MAX, UINT16_MAX, INT32_MAX, UINT32_MAX};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_pack_scale(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_pack_scale_to_physical);
+   SUITE_ADD_TEST(suite, test_pack_scale_from_physical);
+   SUITE_ADD_TEST(suite, test_pack_scale_32bit_limits);
+   SUITE_ADD_TEST(suite, test_pack_scale_round_trip);
+   SUITE_ADD_TEST(suite, test_pack_scale_all_kernels);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * With a power of two scale both directions are exact, which makes the expected values easy to compute.
+ */
+static void test_pack_scale_to_physical(CuTest* tc)
+{
+   uint32_t raw[MAX_ELEMENTS];
+   float f32[MAX_ELEMENTS];
+   double f64[MAX_ELEMENTS];
+   size_t i, j, k;
+   unsigned rawType;
+   uint32_t state = 1u;
+   for (k = 0u; k < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); k++)
+   {
+      cutil_cpu_override(m_kernel_features[k]);
+      for (rawType = 0u; rawType < NUM_RAW_TYPES; rawType++)
+      {
+         for (j = 0u; j < NUM_LENGTHS; j++)
+         {
+            const size_t n = m_lengths[j];
+            for (i = 0u; i < MAX_ELEMENTS; i++)
+            {
+               raw[i] = next_random(&state);
+            }
+            //include the extremes of each type
+            if (n >= 2u)
+            {
+               memset(raw, 0x00, 4u);
+               memset(&raw[1], 0xFF, 4u);
+            }
+            to_f32(rawType, f32, raw, n, 0.25f, -40.0f);
+            to_f64(rawType, f64, raw, n, 0.25, -40.0);
+            for (i = 0u; i < n; i++)
+            {
+               int64_t value = get_raw(rawType, raw, i);
+               CuAssertTrue(tc, f32[i] == (float) value * 0.25f - 40.0f);
+               CuAssertTrue(tc, f64[i] == (double) value * 0.25 - 40.0);
+            }
+         }
+      }
+   }
+   cutil_cpu_reset();
+}
+
+static void test_pack_scale_from_physical(CuTest* tc)
+{
+   static const double input[16] = {0.0, 0.49, 0.5, 1.5, 2.5, -0.5, -1.5, 126.5, 127.5, 254.5, 255.5, -128.5, -129.0, 1e30, -1e30, 0.0};
+   static const int8_t expectedS8[16] = {0, 0, 0, 2, 2, 0, -2, 126, 127, 127, 127, -128, -128, 127, -128, 0};
+   static const uint8_t expectedU8[16] = {0, 0, 0, 2, 2, 0, 0, 126, 128, 254, 255, 0, 0, 255, 0, 0};
+   float f32[16];
+   double f64[16];
+   int8_t s8[16];
+   uint8_t u8[16];
+   uint16_t u16[16];
+   size_t i, k;
+   for (i = 0u; i < 16u; i++)
+   {
+      f32[i] = (float) input[i];
+      f64[i] = input[i];
+   }
+   f32[15] = NAN;
+   f64[15] = NAN;
+   for (k = 0u; k < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); k++)
+   {
+      cutil_cpu_override(m_kernel_features[k]);
+      pack_scale_f32ToS8(s8, f32, 16u, 1.0f, 0.0f);
+      CuAssertIntEquals(tc, 0, memcmp(s8, expectedS8, sizeof(s8)));
+      pack_scale_f32ToU8(u8, f32, 16u, 1.0f, 0.0f);
+      CuAssertIntEquals(tc, 0, memcmp(u8, expectedU8, sizeof(u8)));
+      pack_scale_f64ToS8(s8, f64, 16u, 1.0, 0.0);
+      CuAssertIntEquals(tc, 0, memcmp(s8, expectedS8, sizeof(s8)));
+      pack_scale_f64ToU8(u8, f64, 16u, 1.0, 0.0);
+      CuAssertIntEquals(tc, 0, memcmp(u8, expectedU8, sizeof(u8)));
+      //physical = raw * 0.1 - 40
+      pack_scale_f64ToU16(u16, f64, 16u, 0.1, -40.0);
+      CuAssertUIntEquals(tc, 400u, u16[0]);
+      CuAssertUIntEquals(tc, 405u, u16[1]);
+      CuAssertUIntEquals(tc, 65535u, u16[13]);
+      CuAssertUIntEquals(tc, 0u, u16[14]);
+   }
+   cutil_cpu_reset();
+}
+
+static void test_pack_scale_32bit_limits(CuTest* tc)
+{
+   static const float inputF32[8] = {2147483520.0f, 2147483648.0f, -2147483648.0f, -3e9f, 4294967040.0f, 4294967296.0f, 3e9f, INFINITY};
+   static const double inputF64[8] = {2147483647.4, 2147483647.5, -2147483648.5, -3e9, 4294967295.4, 4294967295.5, 3e9, INFINITY};
+   static const int32_t expectedS32[8] = {2147483520, INT32_MAX, INT32_MIN, INT32_MIN, INT32_MAX, INT32_MAX, INT32_MAX, INT32_MAX};
+   static const uint32_t expectedU32[8] = {2147483520u, 2147483648u, 0u, 0u, 4294967040u, UINT32_MAX, 3000000000u, UINT32_MAX};
+   static const int32_t expectedS32F64[8] = {INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN, INT32_MAX, INT32_MAX, INT32_MAX, INT32_MAX};
+   static const uint32_t expectedU32F64[8] = {2147483647u, 2147483648u, 0u, 0u, UINT32_MAX, UINT32_MAX, 3000000000u, UINT32_MAX};
+   int32_t s32[8];
+   uint32_t u32[8];
+   size_t k;
+   for (k = 0u; k < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); k++)
+   {
+      cutil_cpu_override(m_kernel_features[k]);
+      pack_scale_f32ToS32(s32, inputF32, 8u, 1.0f, 0.0f);
+      CuAssertIntEquals(tc, 0, memcmp(s32, expectedS32, sizeof(s32)));
+      pack_scale_f32ToU32(u32, inputF32, 8u, 1.0f, 0.0f);
+      CuAssertIntEquals(tc, 0, memcmp(u32, expectedU32, sizeof(u32)));
+      pack_scale_f64ToS32(s32, inputF64, 8u, 1.0, 0.0);
+      CuAssertIntEquals(tc, 0, memcmp(s32, expectedS32F64, sizeof(s32)));
+      pack_scale_f64ToU32(u32, inputF64, 8u, 1.0, 0.0);
+      CuAssertIntEquals(tc, 0, memcmp(u32, expectedU32F64, sizeof(u32)));
+   }
+   cutil_cpu_reset();
+}
+
+/**
+ * A typical DBC signal scaling (factor 0.1, offset -40) must reproduce every raw value.
+ */
+static void test_pack_scale_round_trip(CuTest* tc)
+{
+   uint32_t raw[MAX_ELEMENTS];
+   uint32_t result[MAX_ELEMENTS];
+   float f32[MAX_ELEMENTS];
+   double f64[MAX_ELEMENTS];
+   size_t i, k;
+   unsigned rawType;
+   uint32_t state = 2u;
+   for (k = 0u; k < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); k++)
+   {
+      cutil_cpu_override(m_kernel_features[k]);
+      for (rawType = 0u; rawType < NUM_RAW_TYPES; rawType++)
+      {
+         for (i = 0u; i < MAX_ELEMENTS; i++)
+         {
+            raw[i] = next_random(&state);
+         }
+         memset(result, 0, sizeof(result));
+         to_f64(rawType, f64, raw, MAX_ELEMENTS, 0.1, -40.0);
+         from_f64(rawType, result, f64, MAX_ELEMENTS, 0.1, -40.0);
+         for (i = 0u; i < MAX_ELEMENTS; i++)
+         {
+            CuAssertTrue(tc, get_raw(rawType, result, i) == get_raw(rawType, raw, i));
+         }
+         if (rawType < 4u)
+         {
+            //float has enough precision for 8 and 16-bit signals
+            memset(result, 0, sizeof(result));
+            to_f32(rawType, f32, raw, MAX_ELEMENTS, 0.1f, -40.0f);
+            from_f32(rawType, result, f32, MAX_ELEMENTS, 0.1f, -40.0f);
+            for (i = 0u; i < MAX_ELEMENTS; i++)
+            {
+               CuAssertTrue(tc, get_raw(rawType, result, i) == get_raw(rawType, raw, i));
+            }
+         }
+      }
+   }
+   cutil_cpu_reset();
+}
+
+/**
+ * Compares every kernel with the scalar one using physical values in and beyond each raw range.
+ */
+static void test_pack_scale_all_kernels(CuTest* tc)
+{
+   uint32_t raw[MAX_ELEMENTS];
+   uint32_t rawExpected[MAX_ELEMENTS];
+   uint32_t rawResult[MAX_ELEMENTS];
+   float f32[MAX_ELEMENTS];
+   float f32Expected[MAX_ELEMENTS];
+   double f64[MAX_ELEMENTS];
+   double f64Expected[MAX_ELEMENTS];
+   size_t i, j, k;
+   unsigned rawType;
+   uint32_t state = 3u;
+   for (rawType = 0u; rawType < NUM_RAW_TYPES; rawType++)
+   {
+      const double range = (double) m_raw_max[rawType] - (double) m_raw_min[rawType];
+      for (j = 0u; j < NUM_LENGTHS; j++)
+      {
+         const size_t n = m_lengths[j];
+         for (i = 0u; i < MAX_ELEMENTS; i++)
+         {
+            //up to 25% outside of the raw range on both sides, in steps of 1/16
+            double x = (double) m_raw_min[rawType] - range / 4.0 + range * 1.5 * (double) next_random(&state) / 4294967296.0;
+            raw[i] = next_random(&state);
+            f64[i] = (double) (int64_t) (x * 16.0) / 16.0 * 0.37 + 3.0;
+            f32[i] = (float) f64[i];
+         }
+         if (n > 0u)
+         {
+            f32[n - 1u] = NAN;
+            f64[n - 1u] = NAN;
+         }
+         cutil_cpu_override(0u);
+         to_f32(rawType, f32Expected, raw, n, 0.37f, 3.0f);
+         to_f64(rawType, f64Expected, raw, n, 0.37, 3.0);
+         from_f32(rawType, rawExpected, f32, n, 0.37f, 3.0f);
+         for (k = 0u; k < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); k++)
+         {
+            float f32Result[MAX_ELEMENTS];
+            double f64Result[MAX_ELEMENTS];
+            cutil_cpu_override(m_kernel_features[k]);
+            to_f32(rawType, f32Result, raw, n, 0.37f, 3.0f);
+            CuAssertIntEquals(tc, 0, memcmp(f32Result, f32Expected, n * sizeof(float)));
+            to_f64(rawType, f64Result, raw, n, 0.37, 3.0);
+            CuAssertIntEquals(tc, 0, memcmp(f64Result, f64Expected, n * sizeof(double)));
+            memset(rawResult, 0, sizeof(rawResult));
+            from_f32(rawType, rawResult, f32, n, 0.37f, 3.0f);
+            for (i = 0u; i < n; i++)
+            {
+               CuAssertTrue(tc, get_raw(rawType, rawResult, i) == get_raw(rawType, rawExpected, i));
+            }
+            //the f64 path is checked against the definition directly
+            memset(rawResult, 0, sizeof(rawResult));
+            from_f64(rawType, rawResult, f64, n, 0.37, 3.0);
+            for (i = 0u; i < n; i++)
+            {
+               double x = (f64[i] - 3.0) / 0.37;
+               int64_t expected = (x != x)? 0 : (x >= (double) m_raw_max[rawType])? m_raw_max[rawType] :
+                                  (x <= (double) m_raw_min[rawType])? m_raw_min[rawType] : round_half_even(x);
+               CuAssertTrue(tc, get_raw(rawType, rawResult, i) == expected);
+            }
+         }
+      }
+   }
+   cutil_cpu_reset();
+}
+
+static void to_f32(unsigned rawType, float *dst, const void *src, size_t n, float scale, float offset)
+{
+   switch (rawType)
+   {
+   case 0: pack_scale_s8ToF32(dst, (const int8_t*) src, n, scale, offset); break;
+   case 1: pack_scale_u8ToF32(dst, (const uint8_t*) src, n, scale, offset); break;
+   case 2: pack_scale_s16ToF32(dst, (const int16_t*) src, n, scale, offset); break;
+   case 3: pack_scale_u16ToF32(dst, (const uint16_t*) src, n, scale, offset); break;
+   case 4: pack_scale_s32ToF32(dst, (const int32_t*) src, n, scale, offset); break;
+   default: pack_scale_u32ToF32(dst, (const uint32_t*) src, n, scale, offset); break;
+   }
+}
+
+static void to_f64(unsigned rawType, double *dst, const void *src, size_t n, double scale, double offset)
+{
+   switch (rawType)
+   {
+   case 0: pack_scale_s8ToF64(dst, (const int8_t*) src, n, scale, offset); break;
+   case 1: pack_scale_u8ToF64(dst, (const uint8_t*) src, n, scale, offset); break;
+   case 2: pack_scale_s16ToF64(dst, (const int16_t*) src, n, scale, offset); break;
+   case 3: pack_scale_u16ToF64(dst, (const uint16_t*) src, n, scale, offset); break;
+   case 4: pack_scale_s32ToF64(dst, (const int32_t*) src, n, scale, offset); break;
+   default: pack_scale_u32ToF64(dst, (const uint32_t*) src, n, scale, offset); break;
+   }
+}
+
+static void from_f32(unsigned rawType, void *dst, const float *src, size_t n, float scale, float offset)
+{
+   switch (rawType)
+   {
+   case 0: pack_scale_f32ToS8((int8_t*) dst, src, n, scale, offset); break;
+   case 1: pack_scale_f32ToU8((uint8_t*) dst, src, n, scale, offset); break;
+   case 2: pack_scale_f32ToS16((int16_t*) dst, src, n, scale, offset); break;
+   case 3: pack_scale_f32ToU16((uint16_t*) dst, src, n, scale, offset); break;
+   case 4: pack_scale_f32ToS32((int32_t*) dst, src, n, scale, offset); break;
+   default: pack_scale_f32ToU32((uint32_t*) dst, src, n, scale, offset); break;
+   }
+}
+
+static void from_f64(unsigned rawType, void *dst, const double *src, size_t n, double scale, double offset)
+{
+   switch (rawType)
+   {
+   case 0: pack_scale_f64ToS8((int8_t*) dst, src, n, scale, offset); break;
+   case 1: pack_scale_f64ToU8((uint8_t*) dst, src, n, scale, offset); break;
+   case 2: pack_scale_f64ToS16((int16_t*) dst, src, n, scale, offset); break;
+   case 3: pack_scale_f64ToU16((uint16_t*) dst, src, n, scale, offset); break;
+   case 4: pack_scale_f64ToS32((int32_t*) dst, src, n, scale, offset); break;
+   default: pack_scale_f64ToU32((uint32_t*) dst, src, n, scale, offset); break;
+   }
+}
+
+static int64_t get_raw(unsigned rawType, const void *src, size_t i)
+{
+   switch (rawType)
+   {
+   case 0: return ((const int8_t*) src)[i];
+   case 1: return ((const uint8_t*) src)[i];
+   case 2: return ((const int16_t*) src)[i];
+   case 3: return ((const uint16_t*) src)[i];
+   case 4: return ((const int32_t*) src)[i];
+   default: return ((const uint32_t*) src)[i];
+   }
+}
+
+static int64_t round_half_even(double x)
+{
+   int64_t result = (int64_t) x;
+   double fraction = x - (double) result; //exact for the magnitudes used here
+   if ( (fraction > 0.5) || ((fraction == 0.5) && (result & 1)) )
+   {
+      result++;
+   }
+   else if ( (fraction < -0.5) || ((fraction == -0.5) && (result & 1)) )
+   {
+      result--;
+   }
+   return result;
+}
+
+static uint32_t next_random(uint32_t *state)
+{
+   *state ^= *state << 13;
+   *state ^= *state >> 17;
+   *state ^= *state << 5;
+   return *state;
+}
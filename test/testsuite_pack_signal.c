@@ -0,0 +1,267 @@
+/*****************************************************************************
+* \file      testsuite_pack_signal.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for bit-level signal packing
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdint.h>
+#include "CuTest.h"
+#include "pack_signal.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define FRAME_SIZE 12u
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_intel_signals(CuTest* tc);
+static void test_motorola_signals(CuTest* tc);
+static void test_signed_signals(CuTest* tc);
+static void test_set_preserves_other_bits(CuTest* tc);
+static void test_against_bitwise_reference(CuTest* tc);
+static void test_bulk_extract_and_insert(CuTest* tc);
+static void test_signal_validity(CuTest* tc);
+static uint64_t reference_get(const pack_signal_t *signal, const uint8_t *frame);
+static uint32_t next_random(uint32_t *state);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const uint8_t m_frame[8] = {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_pack_signal(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_intel_signals);
+   SUITE_ADD_TEST(suite, test_motorola_signals);
+   SUITE_ADD_TEST(suite, test_signed_signals);
+   SUITE_ADD_TEST(suite, test_set_preserves_other_bits);
+   SUITE_ADD_TEST(suite, test_against_bitwise_reference);
+   SUITE_ADD_TEST(suite, test_bulk_extract_and_insert);
+   SUITE_ADD_TEST(suite, test_signal_validity);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_intel_signals(CuTest* tc)
+{
+   pack_signal_t s12 = {4u, 12u, PACK_SIGNAL_INTEL};
+   pack_signal_t s3 = {9u, 3u, PACK_SIGNAL_INTEL};
+   pack_signal_t s20 = {20u, 20u, PACK_SIGNAL_INTEL};
+   pack_signal_t s64 = {0u, 64u, PACK_SIGNAL_INTEL};
+   CuAssertUIntEquals(tc, 0x341u, (uint32_t) pack_signal_get(&s12, m_frame, sizeof(m_frame)));
+   CuAssertUIntEquals(tc, 0x2u, (uint32_t) pack_signal_get(&s3, m_frame, sizeof(m_frame)));
+   CuAssertUIntEquals(tc, 0x9A785u, (uint32_t) pack_signal_get(&s20, m_frame, sizeof(m_frame)));
+   CuAssertTrue(tc, pack_signal_get(&s64, m_frame, sizeof(m_frame)) == 0xF0DEBC9A78563412ull);
+}
+
+static void test_motorola_signals(CuTest* tc)
+{
+   pack_signal_t s16 = {7u, 16u, PACK_SIGNAL_MOTOROLA};
+   pack_signal_t s12 = {3u, 12u, PACK_SIGNAL_MOTOROLA};
+   pack_signal_t s3 = {20u, 3u, PACK_SIGNAL_MOTOROLA};
+   pack_signal_t s64 = {7u, 64u, PACK_SIGNAL_MOTOROLA};
+   CuAssertUIntEquals(tc, 0x1234u, (uint32_t) pack_signal_get(&s16, m_frame, sizeof(m_frame)));
+   CuAssertUIntEquals(tc, 0x234u, (uint32_t) pack_signal_get(&s12, m_frame, sizeof(m_frame)));
+   //0x56 = 0101 0110, bits 4..2
+   CuAssertUIntEquals(tc, 0x5u, (uint32_t) pack_signal_get(&s3, m_frame, sizeof(m_frame)));
+   CuAssertTrue(tc, pack_signal_get(&s64, m_frame, sizeof(m_frame)) == 0x123456789ABCDEF0ull);
+}
+
+static void test_signed_signals(CuTest* tc)
+{
+   uint8_t frame[8];
+   pack_signal_t s12 = {4u, 12u, PACK_SIGNAL_INTEL | PACK_SIGNAL_SIGNED};
+   pack_signal_t m10 = {21u, 10u, PACK_SIGNAL_MOTOROLA | PACK_SIGNAL_SIGNED};
+   memset(frame, 0, sizeof(frame));
+   pack_signal_set(&s12, frame, sizeof(frame), (uint64_t) -100);
+   pack_signal_set(&m10, frame, sizeof(frame), (uint64_t) -512);
+   CuAssertIntEquals(tc, -100, (int) pack_signal_getSigned(&s12, frame, sizeof(frame)));
+   CuAssertIntEquals(tc, -512, (int) pack_signal_getSigned(&m10, frame, sizeof(frame)));
+   CuAssertUIntEquals(tc, 0xF9Cu, (uint32_t) pack_signal_get(&s12, frame, sizeof(frame)));
+   pack_signal_set(&m10, frame, sizeof(frame), 511u);
+   CuAssertIntEquals(tc, 511, (int) pack_signal_getSigned(&m10, frame, sizeof(frame)));
+}
+
+static void test_set_preserves_other_bits(CuTest* tc)
+{
+   uint8_t frame[FRAME_SIZE];
+   pack_signal_t intel = {13u, 7u, PACK_SIGNAL_INTEL};
+   pack_signal_t motorola = {37u, 11u, PACK_SIGNAL_MOTOROLA};
+   memset(frame, 0xFF, sizeof(frame));
+   pack_signal_set(&intel, frame, sizeof(frame), 0u);
+   CuAssertUIntEquals(tc, 0x1Fu, frame[1]);
+   CuAssertUIntEquals(tc, 0xF0u, frame[2]);
+   CuAssertUIntEquals(tc, 0xFFu, frame[0]);
+   CuAssertUIntEquals(tc, 0xFFu, frame[3]);
+   pack_signal_set(&motorola, frame, sizeof(frame), 0u);
+   //bits 5..0 of byte 4, then bits 7..3 of byte 5
+   CuAssertUIntEquals(tc, 0xC0u, frame[4]);
+   CuAssertUIntEquals(tc, 0x07u, frame[5]);
+   CuAssertUIntEquals(tc, 0xFFu, frame[6]);
+   //values wider than the signal are truncated
+   pack_signal_set(&intel, frame, sizeof(frame), 0xFFFFu);
+   CuAssertUIntEquals(tc, 0xFFu, frame[1]);
+   CuAssertUIntEquals(tc, 0xFFu, frame[2]);
+}
+
+/**
+ * Compares against a bit-by-bit implementation for random signals at every position,
+ * including signals ending on the last bit of the frame.
+ */
+static void test_against_bitwise_reference(CuTest* tc)
+{
+   uint32_t state = 0xC0FFEEu;
+   int i;
+   for (i = 0; i < 5000; i++)
+   {
+      uint8_t frame[FRAME_SIZE];
+      uint8_t copy[FRAME_SIZE];
+      pack_signal_t signal;
+      uint64_t value;
+      size_t j;
+      for (j = 0u; j < FRAME_SIZE; j++)
+      {
+         frame[j] = (uint8_t) next_random(&state);
+      }
+      signal.bitLength = (uint8_t) (1u + next_random(&state) % 64u);
+      signal.startBit = (uint16_t) (next_random(&state) % (FRAME_SIZE * 8u));
+      signal.flags = (next_random(&state) & 1u)? PACK_SIGNAL_MOTOROLA : PACK_SIGNAL_INTEL;
+      if (!pack_signal_isValid(&signal, FRAME_SIZE))
+      {
+         continue;
+      }
+      CuAssertTrue(tc, reference_get(&signal, frame) == pack_signal_get(&signal, frame, FRAME_SIZE));
+      value = ((uint64_t) next_random(&state) << 32) | next_random(&state);
+      memcpy(copy, frame, sizeof(frame));
+      pack_signal_set(&signal, frame, FRAME_SIZE, value);
+      CuAssertTrue(tc, reference_get(&signal, frame) == (value & ((signal.bitLength == 64u)? ~0ull : ((1ull << signal.bitLength) - 1u))));
+      //writing back the old value restores the frame exactly
+      pack_signal_set(&signal, frame, FRAME_SIZE, reference_get(&signal, copy));
+      CuAssertIntEquals(tc, 0, memcmp(frame, copy, sizeof(frame)));
+   }
+}
+
+static void test_bulk_extract_and_insert(CuTest* tc)
+{
+   static const pack_signal_t signals[5] =
+   {
+      {0u, 3u, PACK_SIGNAL_INTEL},
+      {3u, 12u, PACK_SIGNAL_INTEL | PACK_SIGNAL_SIGNED},
+      {23u, 20u, PACK_SIGNAL_MOTOROLA},
+      {44u, 4u, PACK_SIGNAL_INTEL},
+      {48u, 16u, PACK_SIGNAL_INTEL}
+   };
+   static const uint64_t values[5] = {5u, (uint64_t) -7, 0xABCDEu, 0x9u, 0xBEEFu};
+   uint64_t extracted[5];
+   uint8_t frame[8];
+   size_t i;
+   memset(frame, 0, sizeof(frame));
+   pack_signal_insert(signals, 5u, frame, sizeof(frame), values);
+   pack_signal_extract(signals, 5u, frame, sizeof(frame), extracted);
+   for (i = 0u; i < 5u; i++)
+   {
+      CuAssertTrue(tc, values[i] == extracted[i]);
+      if ( (signals[i].flags & PACK_SIGNAL_SIGNED) == 0u)
+      {
+         CuAssertTrue(tc, values[i] == pack_signal_get(&signals[i], frame, sizeof(frame)));
+      }
+   }
+   CuAssertUIntEquals(tc, 0xEFu, frame[6]);
+   CuAssertUIntEquals(tc, 0xBEu, frame[7]);
+}
+
+static void test_signal_validity(CuTest* tc)
+{
+   pack_signal_t signal = {56u, 8u, PACK_SIGNAL_INTEL};
+   uint8_t frame[8];
+   CuAssertTrue(tc, pack_signal_isValid(&signal, 8u));
+   signal.bitLength = 9u;
+   CuAssertTrue(tc, !pack_signal_isValid(&signal, 8u));
+   signal.bitLength = 0u;
+   CuAssertTrue(tc, !pack_signal_isValid(&signal, 8u));
+   signal.startBit = 63u;
+   signal.bitLength = 64u;
+   signal.flags = PACK_SIGNAL_MOTOROLA;
+   CuAssertTrue(tc, !pack_signal_isValid(&signal, 8u));
+   signal.startBit = 7u;
+   CuAssertTrue(tc, pack_signal_isValid(&signal, 8u));
+   //partially outside: only the bits inside the frame are touched
+   memset(frame, 0, sizeof(frame));
+   signal.startBit = 60u;
+   signal.bitLength = 8u;
+   signal.flags = PACK_SIGNAL_INTEL;
+   pack_signal_set(&signal, frame, sizeof(frame), 0xFFu);
+   CuAssertUIntEquals(tc, 0xF0u, frame[7]);
+   CuAssertUIntEquals(tc, 0x0Fu, (uint32_t) pack_signal_get(&signal, frame, sizeof(frame)));
+   signal.startBit = 64u;
+   CuAssertUIntEquals(tc, 0u, (uint32_t) pack_signal_get(&signal, frame, sizeof(frame)));
+}
+
+static uint64_t reference_get(const pack_signal_t *signal, const uint8_t *frame)
+{
+   uint64_t value = 0u;
+   unsigned i;
+   unsigned bit = signal->startBit;
+   if ( (signal->flags & PACK_SIGNAL_MOTOROLA) != 0u)
+   {
+      for (i = 0u; i < signal->bitLength; i++)
+      {
+         value = (value << 1) | ((frame[bit / 8u] >> (bit % 8u)) & 1u);
+         bit = ((bit % 8u) == 0u)? bit + 15u : bit - 1u;
+      }
+   }
+   else
+   {
+      for (i = 0u; i < signal->bitLength; i++, bit++)
+      {
+         value |= (uint64_t) ((frame[bit / 8u] >> (bit % 8u)) & 1u) << i;
+      }
+   }
+   return value;
+}
+
+static uint32_t next_random(uint32_t *state)
+{
+   uint32_t x = *state;
+   x ^= x << 13;
+   x ^= x >> 17;
+   x ^= x << 5;
+   *state = x;
+   return x;
+}
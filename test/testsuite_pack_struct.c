@@ -0,0 +1,224 @@
+/*****************************************************************************
+* \file      testsuite_pack_struct.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for pack_plan_t
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include "CuTest.h"
+#include "pack.h"
+#include "pack_struct.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_RECORDS 5u
+
+typedef struct record_tag
+{
+   uint32_t id;
+   uint16_t a;
+   uint16_t b;
+   int32_t c;
+   uint8_t flag;
+   uint64_t timestamp;
+} record_t;
+
+typedef struct sample_tag
+{
+   uint16_t x;
+   uint16_t y;
+   uint32_t z;
+} sample_t;
+
+typedef struct narrow_tag
+{
+   int32_t temperature;
+   uint32_t counter;
+   int16_t offset;
+} narrow_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_big_endian_record_array(CuTest* tc);
+static void test_native_layout_is_single_copy(CuTest* tc);
+static void test_narrow_fields(CuTest* tc);
+static void test_invalid_fields(CuTest* tc);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const pack_field_t m_record_fields[] =
+{
+   PACK_FIELD(record_t, id, PACK_FIELD_BIG_ENDIAN),
+   PACK_FIELD(record_t, a, PACK_FIELD_BIG_ENDIAN),
+   PACK_FIELD(record_t, b, PACK_FIELD_BIG_ENDIAN),
+   PACK_FIELD(record_t, c, PACK_FIELD_BIG_ENDIAN | PACK_FIELD_SIGNED),
+   PACK_FIELD(record_t, flag, PACK_FIELD_UNSIGNED),
+   PACK_FIELD(record_t, timestamp, PACK_FIELD_BIG_ENDIAN)
+};
+
+static const pack_field_t m_sample_fields[] =
+{
+   PACK_FIELD(sample_t, x, PACK_FIELD_LITTLE_ENDIAN),
+   PACK_FIELD(sample_t, y, PACK_FIELD_LITTLE_ENDIAN),
+   PACK_FIELD(sample_t, z, PACK_FIELD_LITTLE_ENDIAN)
+};
+
+static const pack_field_t m_narrow_fields[] =
+{
+   PACK_FIELD_NARROW(narrow_t, temperature, 3u, PACK_FIELD_BIG_ENDIAN | PACK_FIELD_SIGNED),
+   PACK_FIELD_NARROW(narrow_t, counter, 3u, PACK_FIELD_LITTLE_ENDIAN),
+   PACK_FIELD_NARROW(narrow_t, offset, 1u, PACK_FIELD_SIGNED)
+};
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_pack_struct(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_big_endian_record_array);
+   SUITE_ADD_TEST(suite, test_native_layout_is_single_copy);
+   SUITE_ADD_TEST(suite, test_narrow_fields);
+   SUITE_ADD_TEST(suite, test_invalid_fields);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_big_endian_record_array(CuTest* tc)
+{
+   pack_plan_t plan;
+   record_t records[NUM_RECORDS];
+   record_t decoded[NUM_RECORDS];
+   uint8_t buf[NUM_RECORDS * 21u];
+   uint32_t i;
+   CuAssertIntEquals(tc, 0, pack_plan_create(&plan, m_record_fields, sizeof(m_record_fields) / sizeof(m_record_fields[0])));
+   CuAssertUIntEquals(tc, 21u, plan.wireSize);
+#if defined(_PACK_NATIVE_ORDER)
+   //a and b are merged into a single swap of two elements
+   CuAssertUIntEquals(tc, 5u, plan.numOps);
+#endif
+   memset(records, 0, sizeof(records));
+   for (i = 0u; i < NUM_RECORDS; i++)
+   {
+      records[i].id = 0x01020304u + i;
+      records[i].a = (uint16_t) (0x1000u + i);
+      records[i].b = (uint16_t) (0x2000u + i);
+      records[i].c = -1000 - (int32_t) i;
+      records[i].flag = (uint8_t) i;
+      records[i].timestamp = 0x1122334455667788ull + i;
+   }
+   CuAssertUIntEquals(tc, sizeof(buf), pack_plan_pack(&plan, buf, records, NUM_RECORDS, sizeof(record_t)));
+   for (i = 0u; i < NUM_RECORDS; i++)
+   {
+      const uint8_t *p = &buf[i * 21u];
+      CuAssertUIntEquals(tc, records[i].id, unpack_u32be(&p[0]));
+      CuAssertUIntEquals(tc, records[i].a, unpack_u16be(&p[4]));
+      CuAssertUIntEquals(tc, records[i].b, unpack_u16be(&p[6]));
+      CuAssertIntEquals(tc, records[i].c, unpack_s32be(&p[8]));
+      CuAssertUIntEquals(tc, records[i].flag, p[12]);
+      CuAssertTrue(tc, records[i].timestamp == unpack_u64be(&p[13]));
+   }
+   memset(decoded, 0, sizeof(decoded));
+   CuAssertUIntEquals(tc, sizeof(buf), pack_plan_unpack(&plan, decoded, NUM_RECORDS, sizeof(record_t), buf));
+   CuAssertIntEquals(tc, 0, memcmp(records, decoded, sizeof(records)));
+   pack_plan_destroy(&plan);
+}
+
+static void test_native_layout_is_single_copy(CuTest* tc)
+{
+   pack_plan_t plan;
+   sample_t samples[NUM_RECORDS];
+   sample_t decoded[NUM_RECORDS];
+   uint8_t buf[NUM_RECORDS * sizeof(sample_t)];
+   uint32_t i;
+   CuAssertIntEquals(tc, 0, pack_plan_create(&plan, m_sample_fields, sizeof(m_sample_fields) / sizeof(m_sample_fields[0])));
+#if defined(_PACK_NATIVE_ORDER) && (_PACK_NATIVE_ORDER == PLATFORM_LITTLE_ENDIAN)
+   CuAssertUIntEquals(tc, 1u, plan.numOps);
+#endif
+   for (i = 0u; i < NUM_RECORDS; i++)
+   {
+      samples[i].x = (uint16_t) i;
+      samples[i].y = (uint16_t) (i * 3u);
+      samples[i].z = 0xABCD0000u + i;
+   }
+   CuAssertUIntEquals(tc, sizeof(buf), pack_plan_pack(&plan, buf, samples, NUM_RECORDS, sizeof(sample_t)));
+   for (i = 0u; i < NUM_RECORDS; i++)
+   {
+      CuAssertUIntEquals(tc, samples[i].y, unpack_u16le(&buf[i * 8u + 2u]));
+      CuAssertUIntEquals(tc, samples[i].z, unpack_u32le(&buf[i * 8u + 4u]));
+   }
+   CuAssertUIntEquals(tc, sizeof(buf), pack_plan_unpack(&plan, decoded, NUM_RECORDS, sizeof(sample_t), buf));
+   CuAssertIntEquals(tc, 0, memcmp(samples, decoded, sizeof(samples)));
+   pack_plan_destroy(&plan);
+}
+
+static void test_narrow_fields(CuTest* tc)
+{
+   pack_plan_t plan;
+   narrow_t value;
+   narrow_t decoded;
+   uint8_t buf[7];
+   static const uint8_t expected[7] = {0xFF, 0xFF, 0xFB, 0x56, 0x34, 0x12, 0x80};
+   CuAssertIntEquals(tc, 0, pack_plan_create(&plan, m_narrow_fields, sizeof(m_narrow_fields) / sizeof(m_narrow_fields[0])));
+   CuAssertUIntEquals(tc, 7u, plan.wireSize);
+   value.temperature = -5;
+   value.counter = 0x123456u;
+   value.offset = -128;
+   CuAssertUIntEquals(tc, 7u, pack_plan_pack(&plan, buf, &value, 1u, sizeof(value)));
+   CuAssertIntEquals(tc, 0, memcmp(buf, expected, sizeof(expected)));
+   memset(&decoded, 0, sizeof(decoded));
+   CuAssertUIntEquals(tc, 7u, pack_plan_unpack(&plan, &decoded, 1u, sizeof(decoded), buf));
+   CuAssertIntEquals(tc, -5, decoded.temperature);
+   CuAssertUIntEquals(tc, 0x123456u, decoded.counter);
+   CuAssertIntEquals(tc, -128, decoded.offset);
+   pack_plan_destroy(&plan);
+}
+
+static void test_invalid_fields(CuTest* tc)
+{
+   pack_plan_t plan;
+   pack_field_t fields[1] = {{0u, 3u, 3u, 0u}};
+   errno = 0;
+   CuAssertIntEquals(tc, -1, pack_plan_create(&plan, fields, 1u));
+   CuAssertIntEquals(tc, EINVAL, errno);
+   fields[0].memberSize = 2u;
+   fields[0].wireSize = 4u;
+   CuAssertIntEquals(tc, -1, pack_plan_create(&plan, fields, 1u));
+   fields[0].wireSize = 0u;
+   CuAssertIntEquals(tc, -1, pack_plan_create(&plan, fields, 1u));
+   CuAssertIntEquals(tc, -1, pack_plan_create(&plan, fields, 0u));
+}
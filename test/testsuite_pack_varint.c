@@ -0,0 +1,270 @@
+/*****************************************************************************
+* \file      testsuite_pack_varint.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for varint, zigzag and stream-vbyte encoding
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdint.h>
+#include "CuTest.h"
+#include "pack_varint.h"
+#include "cutil_cpu.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_VALUES 203u
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_varint_u32_encoding(CuTest* tc);
+static void test_varint_u64_encoding(CuTest* tc);
+static void test_varint_invalid_input(CuTest* tc);
+static void test_zigzag(CuTest* tc);
+static void test_varint_array(CuTest* tc);
+static void test_streamvbyte_encoding(CuTest* tc);
+static void test_streamvbyte_roundtrip(CuTest* tc);
+static void test_streamvbyte_all_kernels(CuTest* tc);
+static void fill_values(uint32_t *values, size_t n);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_pack_varint(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_varint_u32_encoding);
+   SUITE_ADD_TEST(suite, test_varint_u64_encoding);
+   SUITE_ADD_TEST(suite, test_varint_invalid_input);
+   SUITE_ADD_TEST(suite, test_zigzag);
+   SUITE_ADD_TEST(suite, test_varint_array);
+   SUITE_ADD_TEST(suite, test_streamvbyte_encoding);
+   SUITE_ADD_TEST(suite, test_streamvbyte_roundtrip);
+   SUITE_ADD_TEST(suite, test_streamvbyte_all_kernels);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_varint_u32_encoding(CuTest* tc)
+{
+   uint8_t buf[VARINT_MAX_SIZE_U32];
+   uint32_t value = 0u;
+   static const uint8_t max_u32[5] = {0xFF, 0xFF, 0xFF, 0xFF, 0x0F};
+
+   CuAssertUIntEquals(tc, 1u, packVarintU32(buf, 0u));
+   CuAssertUIntEquals(tc, 0x00u, buf[0]);
+   CuAssertUIntEquals(tc, 1u, packVarintU32(buf, 127u));
+   CuAssertUIntEquals(tc, 0x7Fu, buf[0]);
+   CuAssertUIntEquals(tc, 2u, packVarintU32(buf, 128u));
+   CuAssertUIntEquals(tc, 0x80u, buf[0]);
+   CuAssertUIntEquals(tc, 0x01u, buf[1]);
+   CuAssertUIntEquals(tc, 2u, packVarintU32(buf, 300u));
+   CuAssertUIntEquals(tc, 0xACu, buf[0]);
+   CuAssertUIntEquals(tc, 0x02u, buf[1]);
+   CuAssertUIntEquals(tc, 2u, unpackVarintU32(buf, sizeof(buf), &value));
+   CuAssertUIntEquals(tc, 300u, value);
+
+   CuAssertUIntEquals(tc, 5u, packVarintU32(buf, UINT32_MAX));
+   CuAssertIntEquals(tc, 0, memcmp(buf, max_u32, 5));
+   CuAssertUIntEquals(tc, 5u, unpackVarintU32(buf, sizeof(buf), &value));
+   CuAssertUIntEquals(tc, UINT32_MAX, value);
+
+   CuAssertUIntEquals(tc, 1u, varintSizeU32(127u));
+   CuAssertUIntEquals(tc, 2u, varintSizeU32(16383u));
+   CuAssertUIntEquals(tc, 3u, varintSizeU32(16384u));
+   CuAssertUIntEquals(tc, 5u, varintSizeU32(UINT32_MAX));
+}
+
+static void test_varint_u64_encoding(CuTest* tc)
+{
+   uint8_t buf[VARINT_MAX_SIZE_U64];
+   uint64_t value = 0u;
+   size_t i;
+   static const uint64_t values[] = {0u, 1u, 0x7Fu, 0x80u, 0xFFFFFFFFull, 0x100000000ull,
+                                     0x123456789ABCDEFull, UINT64_MAX};
+
+   CuAssertUIntEquals(tc, 10u, packVarintU64(buf, UINT64_MAX));
+   for (i = 0u; i < 9u; i++)
+   {
+      CuAssertUIntEquals(tc, 0xFFu, buf[i]);
+   }
+   CuAssertUIntEquals(tc, 0x01u, buf[9]);
+   for (i = 0u; i < sizeof(values) / sizeof(values[0]); i++)
+   {
+      size_t size = packVarintU64(buf, values[i]);
+      CuAssertUIntEquals(tc, varintSizeU64(values[i]), size);
+      CuAssertUIntEquals(tc, size, unpackVarintU64(buf, size, &value));
+      CuAssertTrue(tc, value == values[i]);
+   }
+}
+
+static void test_varint_invalid_input(CuTest* tc)
+{
+   uint32_t value32 = 0u;
+   uint64_t value64 = 0u;
+   static const uint8_t truncated[2] = {0x80, 0x80};
+   static const uint8_t too_large_u32[5] = {0xFF, 0xFF, 0xFF, 0xFF, 0x1F};
+   static const uint8_t too_long_u32[6] = {0x80, 0x80, 0x80, 0x80, 0x80, 0x00};
+   static const uint8_t too_large_u64[10] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02};
+
+   CuAssertUIntEquals(tc, 0u, unpackVarintU32(truncated, 0u, &value32));
+   CuAssertUIntEquals(tc, 0u, unpackVarintU32(truncated, sizeof(truncated), &value32));
+   CuAssertUIntEquals(tc, 0u, unpackVarintU32(too_large_u32, sizeof(too_large_u32), &value32));
+   CuAssertUIntEquals(tc, 0u, unpackVarintU32(too_long_u32, sizeof(too_long_u32), &value32));
+   CuAssertUIntEquals(tc, 0u, unpackVarintU64(truncated, sizeof(truncated), &value64));
+   CuAssertUIntEquals(tc, 0u, unpackVarintU64(too_large_u64, sizeof(too_large_u64), &value64));
+}
+
+static void test_zigzag(CuTest* tc)
+{
+   uint8_t buf[VARINT_MAX_SIZE_U64];
+   int32_t s32 = 0;
+   int64_t s64 = 0;
+
+   CuAssertUIntEquals(tc, 0u, zigzagEncode32(0));
+   CuAssertUIntEquals(tc, 1u, zigzagEncode32(-1));
+   CuAssertUIntEquals(tc, 2u, zigzagEncode32(1));
+   CuAssertUIntEquals(tc, 3u, zigzagEncode32(-2));
+   CuAssertUIntEquals(tc, 0xFFFFFFFEu, zigzagEncode32(INT32_MAX));
+   CuAssertUIntEquals(tc, 0xFFFFFFFFu, zigzagEncode32(INT32_MIN));
+   CuAssertIntEquals(tc, INT32_MIN, zigzagDecode32(0xFFFFFFFFu));
+   CuAssertIntEquals(tc, -2, zigzagDecode32(3u));
+   CuAssertTrue(tc, zigzagEncode64(INT64_MIN) == UINT64_MAX);
+   CuAssertTrue(tc, zigzagDecode64(UINT64_MAX - 1u) == INT64_MAX);
+
+   CuAssertUIntEquals(tc, 1u, packVarintS32(buf, -64));
+   CuAssertUIntEquals(tc, 1u, unpackVarintS32(buf, sizeof(buf), &s32));
+   CuAssertIntEquals(tc, -64, s32);
+   CuAssertUIntEquals(tc, 2u, packVarintS32(buf, 64));
+   CuAssertUIntEquals(tc, 10u, packVarintS64(buf, INT64_MIN));
+   CuAssertUIntEquals(tc, 10u, unpackVarintS64(buf, sizeof(buf), &s64));
+   CuAssertTrue(tc, s64 == INT64_MIN);
+}
+
+static void test_varint_array(CuTest* tc)
+{
+   uint32_t values[NUM_VALUES];
+   uint32_t decoded[NUM_VALUES];
+   uint8_t buf[NUM_VALUES * VARINT_MAX_SIZE_U32];
+   size_t size;
+   fill_values(values, NUM_VALUES);
+   size = packVarintArrayU32(buf, values, NUM_VALUES);
+   CuAssertUIntEquals(tc, size, unpackVarintArrayU32(decoded, NUM_VALUES, buf, size));
+   CuAssertIntEquals(tc, 0, memcmp(values, decoded, sizeof(values)));
+   //last value is multi-byte and cut short
+   CuAssertUIntEquals(tc, 0u, unpackVarintArrayU32(decoded, NUM_VALUES, buf, size - 1u));
+   //value too large for 32 bits followed by enough bytes to be inspected by the vectorized path
+   memset(buf, 0, 32u);
+   memset(buf, 0xFF, 4u);
+   buf[4] = 0x1F;
+   CuAssertUIntEquals(tc, 0u, unpackVarintArrayU32(decoded, 2u, buf, 32u));
+   buf[4] = 0x0F;
+   CuAssertUIntEquals(tc, 6u, unpackVarintArrayU32(decoded, 2u, buf, 32u));
+   CuAssertUIntEquals(tc, UINT32_MAX, decoded[0]);
+   CuAssertUIntEquals(tc, 0u, decoded[1]);
+   size = packVarintArrayU32(buf, values, NUM_VALUES);
+   //fewer values than available is fine
+   CuAssertUIntEquals(tc, packVarintArrayU32(buf, values, 40u), unpackVarintArrayU32(decoded, 40u, buf, size));
+   CuAssertIntEquals(tc, 0, memcmp(values, decoded, 40u * sizeof(uint32_t)));
+}
+
+static void test_streamvbyte_encoding(CuTest* tc)
+{
+   uint8_t buf[STREAMVBYTE_MAX_SIZE(5u)];
+   uint32_t decoded[5];
+   static const uint32_t values[5] = {0x01u, 0x0203u, 0x040506u, 0x0708090Au, 0x0Bu};
+   static const uint8_t expected[] = {0xE4, 0x00, 0x01, 0x03, 0x02, 0x06, 0x05, 0x04,
+                                      0x0A, 0x09, 0x08, 0x07, 0x0B};
+   CuAssertUIntEquals(tc, sizeof(expected), streamvbyteEncode(buf, values, 5u));
+   CuAssertIntEquals(tc, 0, memcmp(buf, expected, sizeof(expected)));
+   CuAssertUIntEquals(tc, sizeof(expected), streamvbyteDecode(decoded, 5u, buf, sizeof(expected)));
+   CuAssertIntEquals(tc, 0, memcmp(values, decoded, sizeof(values)));
+   CuAssertUIntEquals(tc, 0u, streamvbyteEncode(buf, values, 0u));
+   CuAssertUIntEquals(tc, 0u, streamvbyteDecode(decoded, 0u, buf, 0u));
+}
+
+static void test_streamvbyte_roundtrip(CuTest* tc)
+{
+   static const size_t lengths[] = {1u, 4u, 7u, 16u, 17u, 64u, NUM_VALUES};
+   uint32_t values[NUM_VALUES];
+   uint32_t decoded[NUM_VALUES];
+   uint8_t buf[STREAMVBYTE_MAX_SIZE(NUM_VALUES)];
+   size_t k;
+   fill_values(values, NUM_VALUES);
+   for (k = 0u; k < sizeof(lengths) / sizeof(lengths[0]); k++)
+   {
+      size_t cut;
+      const size_t n = lengths[k];
+      size_t size = streamvbyteEncode(buf, values, n);
+      CuAssertTrue(tc, size <= STREAMVBYTE_MAX_SIZE(n));
+      memset(decoded, 0, sizeof(decoded));
+      CuAssertUIntEquals(tc, size, streamvbyteDecode(decoded, n, buf, size));
+      CuAssertIntEquals(tc, 0, memcmp(values, decoded, n * sizeof(uint32_t)));
+      for (cut = 0u; cut < size; cut++)
+      {
+         CuAssertUIntEquals(tc, 0u, streamvbyteDecode(decoded, n, buf, cut));
+      }
+   }
+}
+
+//runs of small values mixed with values of every encoded size
+static void fill_values(uint32_t *values, size_t n)
+{
+   size_t i;
+   uint32_t x = 0x12345678u;
+   for (i = 0u; i < n; i++)
+   {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      if ( (i % 50u) < 20u)
+      {
+         values[i] = x & 0x7Fu;
+      }
+      else
+      {
+         values[i] = x >> ((i % 4u) * 8u);
+      }
+   }
+   values[n - 1u] = UINT32_MAX;
+}
+
+static void test_streamvbyte_all_kernels(CuTest* tc)
+{
+   cutil_cpu_override(0u); //scalar decoder only
+   test_streamvbyte_encoding(tc);
+   test_streamvbyte_roundtrip(tc);
+   cutil_cpu_override(CUTIL_CPU_ALL);
+   test_streamvbyte_roundtrip(tc);
+   cutil_cpu_reset();
+}
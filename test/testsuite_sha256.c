@@ -28,10 +28,13 @@
 //////////////////////////////////////////////////////////////////////////////
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include "CuTest.h"
 #include "filestream.h"
 #include "adt_bytearray.h"
 #include "sha256.h"
+#include "hex.h"
+#include "cutil_cpu.h"
 #ifdef MEM_LEAK_CHECK
 #include "CMemLeak.h"
 #endif
@@ -40,11 +43,24 @@
 //////////////////////////////////////////////////////////////////////////////
 // CONSTANTS AND DATA TYPES
 //////////////////////////////////////////////////////////////////////////////
+#define RANDOM_DATA_SIZE 20000u
+#define NUM_RANDOM_MESSAGES 300u
 
 //////////////////////////////////////////////////////////////////////////////
 // LOCAL FUNCTION PROTOTYPES
 //////////////////////////////////////////////////////////////////////////////
 static void test_calc_test1(CuTest* tc);
+static void test_sha256_nist_vectors(CuTest* tc);
+static void test_sha256_streaming(CuTest* tc);
+static void test_sha256_all_kernels(CuTest* tc);
+static void test_sha256_calc_many(CuTest* tc);
+static void test_sha256_export_import(CuTest* tc);
+static void test_sha256_import_invalid(CuTest* tc);
+static void test_sha512_family_vectors(CuTest* tc);
+static void test_sha512_streaming(CuTest* tc);
+static void check_hash(CuTest* tc, const char *expected, const uint8_t hash[32]);
+static void check_digest(CuTest* tc, const char *expected, const uint8_t *digest, size_t len);
+static uint32_t next_random(uint32_t *state);
 
 //////////////////////////////////////////////////////////////////////////////
 // LOCAL VARIABLES
@@ -57,6 +73,9 @@ static const char *m_definition1 =
 "P\"VehicleMode\"C(0,15)\n"
 "R\"GearSelectionMode\"C(0,7)\n\n";
 
+//forces each kernel variant in turn
+static const uint32_t m_kernel_features[] = {CUTIL_CPU_ALL, CUTIL_CPU_AVX2 | CUTIL_CPU_SSE2, CUTIL_CPU_SSE2, 0u};
+
 //////////////////////////////////////////////////////////////////////////////
 // GLOBAL FUNCTIONS
 //////////////////////////////////////////////////////////////////////////////
@@ -67,6 +86,14 @@ CuSuite* testsuite_sha256(void)
    CuSuite* suite = CuSuiteNew();
 
    SUITE_ADD_TEST(suite, test_calc_test1);
+   SUITE_ADD_TEST(suite, test_sha256_nist_vectors);
+   SUITE_ADD_TEST(suite, test_sha256_streaming);
+   SUITE_ADD_TEST(suite, test_sha256_all_kernels);
+   SUITE_ADD_TEST(suite, test_sha256_calc_many);
+   SUITE_ADD_TEST(suite, test_sha256_export_import);
+   SUITE_ADD_TEST(suite, test_sha256_import_invalid);
+   SUITE_ADD_TEST(suite, test_sha512_family_vectors);
+   SUITE_ADD_TEST(suite, test_sha512_streaming);
 
    return suite;
 }
@@ -115,3 +142,331 @@ static void test_calc_test1(CuTest* tc)
    CuAssertUIntEquals(tc, 0xa7, hash[31]);
 }
 
+static void test_sha256_nist_vectors(CuTest* tc)
+{
+   uint8_t hash[32];
+   uint8_t block[1000];
+   sha256_ctx_t ctx;
+   int i;
+   const char *msg448 = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+   const char *msg896 = "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+   sha256_calc(hash, "", 0u);
+   check_hash(tc, "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", hash);
+   sha256_calc(hash, "abc", 3u);
+   check_hash(tc, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", hash);
+   sha256_calc(hash, msg448, strlen(msg448));
+   check_hash(tc, "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1", hash);
+   sha256_calc(hash, msg896, strlen(msg896));
+   check_hash(tc, "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1", hash);
+   //one million times 'a'
+   memset(block, 'a', sizeof(block));
+   sha256_init(&ctx);
+   for (i = 0; i < 1000; i++)
+   {
+      sha256_update(&ctx, block, sizeof(block));
+   }
+   sha256_final(&ctx, hash);
+   check_hash(tc, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0", hash);
+}
+
+/**
+ * Any way of splitting the input across sha256_update calls gives the one-shot hash,
+ * including lengths around the padding boundaries (55, 56 and 64 bytes).
+ */
+static void test_sha256_streaming(CuTest* tc)
+{
+   uint8_t data[300];
+   uint8_t expected[32];
+   uint8_t hash[32];
+   sha256_ctx_t ctx;
+   size_t i, len, step;
+   for (i = 0u; i < sizeof(data); i++)
+   {
+      data[i] = (uint8_t) (i * 131u + 7u);
+   }
+   for (len = 0u; len <= 200u; len++)
+   {
+      sha256_calc(expected, data, len);
+      for (step = 1u; step <= 130u; step += (step < 70u)? 1u : 13u)
+      {
+         sha256_init(&ctx);
+         for (i = 0u; i < len; i += step)
+         {
+            sha256_update(&ctx, &data[i], (len - i < step)? len - i : step);
+         }
+         sha256_final(&ctx, hash);
+         CuAssertIntEquals(tc, 0, memcmp(hash, expected, sizeof(hash)));
+      }
+   }
+   //an empty update changes nothing
+   sha256_init(&ctx);
+   sha256_update(&ctx, data, 10u);
+   sha256_update(&ctx, data, 0u);
+   sha256_update(&ctx, &data[10], sizeof(data) - 10u);
+   sha256_final(&ctx, hash);
+   sha256_calc(expected, data, sizeof(data));
+   CuAssertIntEquals(tc, 0, memcmp(hash, expected, sizeof(hash)));
+}
+
+/**
+ * Runs the known answer tests with every kernel and cross-checks them on random messages.
+ */
+static void test_sha256_all_kernels(CuTest* tc)
+{
+   uint8_t *data = (uint8_t*) malloc(RANDOM_DATA_SIZE);
+   uint8_t (*expected)[32] = (uint8_t(*)[32]) malloc(NUM_RANDOM_MESSAGES * 32u);
+   size_t offsets[NUM_RANDOM_MESSAGES];
+   size_t lengths[NUM_RANDOM_MESSAGES];
+   uint32_t state = 1u;
+   size_t i, k;
+   CuAssertPtrNotNull(tc, data);
+   CuAssertPtrNotNull(tc, expected);
+   for (i = 0u; i < RANDOM_DATA_SIZE; i++)
+   {
+      data[i] = (uint8_t) next_random(&state);
+   }
+   for (i = 0u; i < NUM_RANDOM_MESSAGES; i++)
+   {
+      lengths[i] = (i < 130u)? i : next_random(&state) % (RANDOM_DATA_SIZE / 2u);
+      offsets[i] = next_random(&state) % (RANDOM_DATA_SIZE - lengths[i]);
+   }
+   cutil_cpu_override(0u);
+   for (i = 0u; i < NUM_RANDOM_MESSAGES; i++)
+   {
+      sha256_calc(expected[i], &data[offsets[i]], lengths[i]);
+   }
+   for (k = 0u; k < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); k++)
+   {
+      cutil_cpu_override(m_kernel_features[k]);
+      test_calc_test1(tc);
+      test_sha256_nist_vectors(tc);
+      for (i = 0u; i < NUM_RANDOM_MESSAGES; i++)
+      {
+         uint8_t hash[32];
+         sha256_calc(hash, &data[offsets[i]], lengths[i]);
+         CuAssertIntEquals(tc, 0, memcmp(hash, expected[i], sizeof(hash)));
+      }
+   }
+   cutil_cpu_reset();
+   free(data);
+   free(expected);
+}
+
+/**
+ * sha256_calc_many gives the same hashes as sha256_calc for every lane count, including batches
+ * that do not fill all lanes and messages of very different lengths sharing the lanes.
+ */
+static void test_sha256_calc_many(CuTest* tc)
+{
+   static const size_t batch_sizes[] = {0u, 1u, 3u, 5u, 17u, NUM_RANDOM_MESSAGES};
+   uint8_t *data = (uint8_t*) malloc(RANDOM_DATA_SIZE);
+   uint8_t (*expected)[32] = (uint8_t(*)[32]) malloc(NUM_RANDOM_MESSAGES * 32u);
+   uint8_t (*hashes)[32] = (uint8_t(*)[32]) malloc(NUM_RANDOM_MESSAGES * 32u);
+   const void *inputs[NUM_RANDOM_MESSAGES];
+   size_t lengths[NUM_RANDOM_MESSAGES];
+   uint32_t state = 7u;
+   size_t i, j, k;
+   CuAssertPtrNotNull(tc, data);
+   CuAssertPtrNotNull(tc, expected);
+   CuAssertPtrNotNull(tc, hashes);
+   for (i = 0u; i < RANDOM_DATA_SIZE; i++)
+   {
+      data[i] = (uint8_t) next_random(&state);
+   }
+   for (i = 0u; i < NUM_RANDOM_MESSAGES; i++)
+   {
+      lengths[i] = (i < 130u)? i : next_random(&state) % 1100u;
+      inputs[i] = &data[next_random(&state) % (RANDOM_DATA_SIZE - lengths[i])];
+      sha256_calc(expected[i], inputs[i], lengths[i]);
+   }
+   for (k = 0u; k < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); k++)
+   {
+      cutil_cpu_override(m_kernel_features[k]);
+      for (j = 0u; j < sizeof(batch_sizes) / sizeof(batch_sizes[0]); j++)
+      {
+         //the batch starts at different positions so that long and short messages get mixed differently
+         const size_t n = batch_sizes[j];
+         const size_t first = (n < NUM_RANDOM_MESSAGES)? 120u + j : 0u;
+         memset(hashes, 0, NUM_RANDOM_MESSAGES * 32u);
+         sha256_calc_many(hashes, &inputs[first], &lengths[first], n);
+         for (i = 0u; i < n; i++)
+         {
+            CuAssertIntEquals(tc, 0, memcmp(hashes[i], expected[first + i], 32u));
+         }
+      }
+   }
+   cutil_cpu_reset();
+   free(data);
+   free(expected);
+   free(hashes);
+}
+
+/**
+ * Hashing can be checkpointed at any position and resumed in another context.
+ */
+static void test_sha256_export_import(CuTest* tc)
+{
+   uint8_t data[300];
+   uint8_t blob[SHA256_MIDSTATE_MAX_SIZE];
+   uint8_t expected[32];
+   uint8_t hash[32];
+   sha256_ctx_t ctx;
+   sha256_ctx_t resumed;
+   size_t i, split;
+   for (i = 0u; i < sizeof(data); i++)
+   {
+      data[i] = (uint8_t) (i * 131u + 7u);
+   }
+   sha256_calc(expected, data, sizeof(data));
+   for (split = 0u; split <= sizeof(data); split++)
+   {
+      size_t size;
+      sha256_init(&ctx);
+      sha256_update(&ctx, data, split);
+      size = sha256_export(&ctx, blob, sizeof(blob));
+      CuAssertUIntEquals(tc, SHA256_MIDSTATE_SIZE(split % SHA256_BLOCK_SIZE), size);
+      memset(&resumed, 0xAA, sizeof(resumed));
+      CuAssertTrue(tc, sha256_import(&resumed, blob, size));
+      sha256_update(&resumed, &data[split], sizeof(data) - split);
+      sha256_final(&resumed, hash);
+      CuAssertIntEquals(tc, 0, memcmp(hash, expected, sizeof(hash)));
+   }
+}
+
+static void test_sha256_import_invalid(CuTest* tc)
+{
+   uint8_t blob[SHA256_MIDSTATE_MAX_SIZE];
+   uint8_t expected[32];
+   uint8_t hash[32];
+   sha256_ctx_t ctx;
+   size_t size, i;
+   sha256_init(&ctx);
+   sha256_update(&ctx, "abc", 3u);
+   CuAssertUIntEquals(tc, 0u, sha256_export(&ctx, blob, SHA256_MIDSTATE_SIZE(3u) - 1u));
+   size = sha256_export(&ctx, blob, sizeof(blob));
+   CuAssertUIntEquals(tc, SHA256_MIDSTATE_SIZE(3u), size);
+   sha256_init(&ctx);
+   CuAssertTrue(tc, !sha256_import(&ctx, blob, size - 1u));
+   CuAssertTrue(tc, !sha256_import(&ctx, blob, 0u));
+   //any flipped bit is detected
+   for (i = 0u; i < size * 8u; i++)
+   {
+      blob[i / 8u] ^= (uint8_t) (1u << (i % 8u));
+      CuAssertTrue(tc, !sha256_import(&ctx, blob, size));
+      blob[i / 8u] ^= (uint8_t) (1u << (i % 8u));
+   }
+   //ctx was not modified by the failed imports
+   sha256_final(&ctx, hash);
+   check_hash(tc, "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", hash);
+   CuAssertTrue(tc, sha256_import(&ctx, blob, size));
+   sha256_final(&ctx, hash);
+   sha256_calc(expected, "abc", 3u);
+   CuAssertIntEquals(tc, 0, memcmp(hash, expected, sizeof(hash)));
+}
+
+static void test_sha512_family_vectors(CuTest* tc)
+{
+   uint8_t hash[SHA512_HASH_SIZE];
+   uint8_t block[1000];
+   sha512_ctx_t ctx;
+   int i;
+   const char *msg896 = "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu";
+   sha512_calc(hash, "", 0u);
+   check_digest(tc, "cf83e1357eefb8bdf1542850d66d8007d620e4050b5715dc83f4a921d36ce9ce47d0d13c5d85f2b0ff8318d2877eec2f63b931bd47417a81a538327af927da3e", hash, SHA512_HASH_SIZE);
+   sha512_calc(hash, "abc", 3u);
+   check_digest(tc, "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f", hash, SHA512_HASH_SIZE);
+   sha512_calc(hash, msg896, strlen(msg896));
+   check_digest(tc, "8e959b75dae313da8cf4f72814fc143f8f7779c6eb9f7fa17299aeadb6889018501d289e4900f7e4331b99dec4b5433ac7d329eeb6dd26545e96e55b874be909", hash, SHA512_HASH_SIZE);
+   sha384_calc(hash, "", 0u);
+   check_digest(tc, "38b060a751ac96384cd9327eb1b1e36a21fdb71114be07434c0cc7bf63f6e1da274edebfe76f65fbd51ad2f14898b95b", hash, SHA384_HASH_SIZE);
+   sha384_calc(hash, "abc", 3u);
+   check_digest(tc, "cb00753f45a35e8bb5a03d699ac65007272c32ab0eded1631a8b605a43ff5bed8086072ba1e7cc2358baeca134c825a7", hash, SHA384_HASH_SIZE);
+   sha384_calc(hash, msg896, strlen(msg896));
+   check_digest(tc, "09330c33f71147e83d192fc782cd1b4753111b173b3b05d22fa08086e3b0f712fcc7c71a557e2db966c3e9fa91746039", hash, SHA384_HASH_SIZE);
+   sha512_256_calc(hash, "", 0u);
+   check_digest(tc, "c672b8d1ef56ed28ab87c3622c5114069bdd3ad7b8f9737498d0c01ecef0967a", hash, SHA512_256_HASH_SIZE);
+   sha512_256_calc(hash, "abc", 3u);
+   check_digest(tc, "53048e2681941ef99b2e29b76b4c7dabe4c2d0c634fc6d46e0e2f13107e7af23", hash, SHA512_256_HASH_SIZE);
+   sha512_256_calc(hash, msg896, strlen(msg896));
+   check_digest(tc, "3928e184fb8690f840da3988121d31be65cb9d3ef83ee6146feac861e19b563a", hash, SHA512_256_HASH_SIZE);
+   //one million times 'a'
+   memset(block, 'a', sizeof(block));
+   sha512_init(&ctx);
+   for (i = 0; i < 1000; i++)
+   {
+      sha512_update(&ctx, block, sizeof(block));
+   }
+   sha512_final(&ctx, hash);
+   check_digest(tc, "e718483d0ce769644e2e42c7bc15b4638e1f98b13b2044285632a803afa973ebde0ff244877ea60a4cb0432ce577c31beb009c5c2c49aa2e4eadb217ad8cc09b", hash, SHA512_HASH_SIZE);
+   sha384_init(&ctx);
+   for (i = 0; i < 1000; i++)
+   {
+      sha512_update(&ctx, block, sizeof(block));
+   }
+   sha512_final(&ctx, hash);
+   check_digest(tc, "9d0e1809716474cb086e834e310a4a1ced149e9c00f248527972cec5704c2a5b07b8b3dc38ecc4ebae97ddd87f3d8985", hash, SHA384_HASH_SIZE);
+   sha512_256_init(&ctx);
+   for (i = 0; i < 1000; i++)
+   {
+      sha512_update(&ctx, block, sizeof(block));
+   }
+   sha512_final(&ctx, hash);
+   check_digest(tc, "9a59a052930187a97038cae692f30708aa6491923ef5194394dc68d56c74fb21", hash, SHA512_256_HASH_SIZE);
+}
+
+/**
+ * Same as test_sha256_streaming but around the SHA-512 padding boundaries (111, 112 and 128 bytes).
+ */
+static void test_sha512_streaming(CuTest* tc)
+{
+   uint8_t data[400];
+   uint8_t expected[SHA512_HASH_SIZE];
+   uint8_t hash[SHA512_HASH_SIZE];
+   sha512_ctx_t ctx;
+   size_t i, len, step;
+   for (i = 0u; i < sizeof(data); i++)
+   {
+      data[i] = (uint8_t) (i * 131u + 7u);
+   }
+   for (len = 0u; len <= 300u; len++)
+   {
+      sha512_calc(expected, data, len);
+      for (step = 1u; step <= 260u; step += (step < 140u)? 1u : 29u)
+      {
+         sha512_init(&ctx);
+         for (i = 0u; i < len; i += step)
+         {
+            sha512_update(&ctx, &data[i], (len - i < step)? len - i : step);
+         }
+         sha512_final(&ctx, hash);
+         CuAssertIntEquals(tc, 0, memcmp(hash, expected, sizeof(hash)));
+      }
+   }
+   //the truncated variants only write their own output size
+   memset(hash, 0xAA, sizeof(hash));
+   sha384_calc(hash, data, sizeof(data));
+   CuAssertUIntEquals(tc, 0xAA, hash[SHA384_HASH_SIZE]);
+   memset(hash, 0xAA, sizeof(hash));
+   sha512_256_calc(hash, data, sizeof(data));
+   CuAssertUIntEquals(tc, 0xAA, hash[SHA512_256_HASH_SIZE]);
+}
+
+static void check_hash(CuTest* tc, const char *expected, const uint8_t hash[32])
+{
+   check_digest(tc, expected, hash, 32u);
+}
+
+static void check_digest(CuTest* tc, const char *expected, const uint8_t *digest, size_t len)
+{
+   char text[HEX_ENCODED_SIZE(SHA512_HASH_SIZE) + 1u];
+   text[hex_encode(text, digest, len)] = '\0';
+   CuAssertStrEquals(tc, expected, text);
+}
+
+static uint32_t next_random(uint32_t *state)
+{
+   *state ^= *state << 13;
+   *state ^= *state >> 17;
+   *state ^= *state << 5;
+   return *state;
+}
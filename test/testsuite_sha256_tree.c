@@ -0,0 +1,194 @@
+/*****************************************************************************
+* \file      testsuite_sha256_tree.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for sha256_tree
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include "CuTest.h"
+#include "sha256_tree.h"
+#include "hex.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define DATA_SIZE 10000u
+
+//////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_sha256_tree_num_leaves(CuTest* tc);
+static void test_sha256_tree_known_roots(CuTest* tc);
+static void test_sha256_tree_thread_count(CuTest* tc);
+static void test_sha256_tree_reverify_leaf(CuTest* tc);
+static void test_sha256_tree_invalid_args(CuTest* tc);
+static void fill_data(uint8_t *data, size_t len);
+static void check_hash(CuTest* tc, const char *expected, const uint8_t hash[32]);
+
+//////////////////////////////////////////////////////////////////////////////
+// GLOBAL FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+CuSuite* testsuite_sha256_tree(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_sha256_tree_num_leaves);
+   SUITE_ADD_TEST(suite, test_sha256_tree_known_roots);
+   SUITE_ADD_TEST(suite, test_sha256_tree_thread_count);
+   SUITE_ADD_TEST(suite, test_sha256_tree_reverify_leaf);
+   SUITE_ADD_TEST(suite, test_sha256_tree_invalid_args);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+static void test_sha256_tree_num_leaves(CuTest* tc)
+{
+   CuAssertUIntEquals(tc, 1u, sha256_tree_num_leaves(0u, 1024u));
+   CuAssertUIntEquals(tc, 1u, sha256_tree_num_leaves(1u, 1024u));
+   CuAssertUIntEquals(tc, 1u, sha256_tree_num_leaves(1024u, 1024u));
+   CuAssertUIntEquals(tc, 2u, sha256_tree_num_leaves(1025u, 1024u));
+   CuAssertUIntEquals(tc, 10u, sha256_tree_num_leaves(DATA_SIZE, 1024u));
+}
+
+/**
+ * Expected roots were calculated independently from the RFC 6962 definition.
+ */
+static void test_sha256_tree_known_roots(CuTest* tc)
+{
+   uint8_t *data = (uint8_t*) malloc(DATA_SIZE);
+   uint8_t root[32];
+   CuAssertPtrNotNull(tc, data);
+   fill_data(data, DATA_SIZE);
+   CuAssertIntEquals(tc, 0, sha256_tree_calc(root, NULL, data, 0u, 1024u, 1u));
+   check_hash(tc, "6e340b9cffb37a989ca544e6bb780a2c78901d3fb33738768511a30617afa01d", root);
+   CuAssertIntEquals(tc, 0, sha256_tree_calc(root, NULL, data, DATA_SIZE, 1024u, 4u));
+   check_hash(tc, "45b7f7f63b5881db62c7c5d9c6f80a487711fee6f55608f81978e8ae34505b5d", root);
+   CuAssertIntEquals(tc, 0, sha256_tree_calc(root, NULL, data, DATA_SIZE, 4096u, 4u));
+   check_hash(tc, "ef3676c882de6efde23bc0a3b5642746541a0152f7912dd62067b180669ddf9b", root);
+   CuAssertIntEquals(tc, 0, sha256_tree_calc(root, NULL, data, DATA_SIZE, DATA_SIZE, 4u));
+   check_hash(tc, "5dd880ed5645b9bdbebf7d9102d7cb7216d6a5165aa88bdb197677187b96f81f", root);
+   CuAssertIntEquals(tc, 0, sha256_tree_calc(root, NULL, data, DATA_SIZE, 1u, 3u));
+   check_hash(tc, "e414c775561ec5c22858feb942ef772082b74ab6b8599a59ae69cd19b02b2f06", root);
+   free(data);
+}
+
+/**
+ * The root and the leaf hashes are the same no matter how many threads share the work.
+ */
+static void test_sha256_tree_thread_count(CuTest* tc)
+{
+   static const unsigned thread_counts[] = {1u, 2u, 3u, 7u, 0u, SHA256_TREE_MAX_THREADS + 10u};
+   uint8_t *data = (uint8_t*) malloc(DATA_SIZE);
+   uint8_t (*expectedLeaves)[32] = (uint8_t(*)[32]) malloc(DATA_SIZE * 32u);
+   uint8_t (*leaves)[32] = (uint8_t(*)[32]) malloc(DATA_SIZE * 32u);
+   uint8_t expected[32];
+   uint8_t root[32];
+   size_t leafSize, i, t;
+   CuAssertPtrNotNull(tc, data);
+   CuAssertPtrNotNull(tc, expectedLeaves);
+   CuAssertPtrNotNull(tc, leaves);
+   fill_data(data, DATA_SIZE);
+   for (leafSize = 7u; leafSize <= DATA_SIZE * 2u; leafSize *= 5u)
+   {
+      const size_t numLeaves = sha256_tree_num_leaves(DATA_SIZE, leafSize);
+      for (i = 0u; i < numLeaves; i++)
+      {
+         const size_t remaining = DATA_SIZE - i * leafSize;
+         sha256_tree_leaf(expectedLeaves[i], &data[i * leafSize], (remaining < leafSize)? remaining : leafSize);
+      }
+      sha256_tree_root(expected, (const uint8_t(*)[32]) expectedLeaves, numLeaves);
+      for (t = 0u; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++)
+      {
+         memset(leaves, 0, numLeaves * 32u);
+         CuAssertIntEquals(tc, 0, sha256_tree_calc(root, leaves, data, DATA_SIZE, leafSize, thread_counts[t]));
+         CuAssertIntEquals(tc, 0, memcmp(root, expected, sizeof(root)));
+         CuAssertIntEquals(tc, 0, memcmp(leaves, expectedLeaves, numLeaves * 32u));
+      }
+   }
+   free(data);
+   free(expectedLeaves);
+   free(leaves);
+}
+
+/**
+ * After a range of the data changes only the leaves covering it need to be rehashed.
+ */
+static void test_sha256_tree_reverify_leaf(CuTest* tc)
+{
+   uint8_t *data = (uint8_t*) malloc(DATA_SIZE);
+   uint8_t leaves[10][32];
+   uint8_t expected[32];
+   uint8_t root[32];
+   CuAssertPtrNotNull(tc, data);
+   fill_data(data, DATA_SIZE);
+   CuAssertIntEquals(tc, 0, sha256_tree_calc(root, leaves, data, DATA_SIZE, 1024u, 2u));
+   data[5000] ^= 0x01;
+   sha256_tree_leaf(leaves[4], &data[4096], 1024u);
+   sha256_tree_root(root, (const uint8_t(*)[32]) leaves, 10u);
+   CuAssertIntEquals(tc, 0, sha256_tree_calc(expected, NULL, data, DATA_SIZE, 1024u, 2u));
+   CuAssertIntEquals(tc, 0, memcmp(root, expected, sizeof(root)));
+   free(data);
+}
+
+static void test_sha256_tree_invalid_args(CuTest* tc)
+{
+   uint8_t data[10] = {0};
+   uint8_t root[32];
+   errno = 0;
+   CuAssertIntEquals(tc, -1, sha256_tree_calc(root, NULL, data, sizeof(data), 0u, 1u));
+   CuAssertIntEquals(tc, EINVAL, errno);
+   errno = 0;
+   CuAssertIntEquals(tc, -1, sha256_tree_calc(NULL, NULL, data, sizeof(data), 4u, 1u));
+   CuAssertIntEquals(tc, EINVAL, errno);
+   errno = 0;
+   CuAssertIntEquals(tc, -1, sha256_tree_calc(root, NULL, NULL, sizeof(data), 4u, 1u));
+   CuAssertIntEquals(tc, EINVAL, errno);
+}
+
+static void fill_data(uint8_t *data, size_t len)
+{
+   size_t i;
+   for (i = 0u; i < len; i++)
+   {
+      data[i] = (uint8_t) (i * 131u + 7u);
+   }
+}
+
+static void check_hash(CuTest* tc, const char *expected, const uint8_t hash[32])
+{
+   char text[HEX_ENCODED_SIZE(32u) + 1u];
+   text[hex_encode(text, hash, 32u)] = '\0';
+   CuAssertStrEquals(tc, expected, text);
+}
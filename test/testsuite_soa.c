@@ -0,0 +1,255 @@
+/*****************************************************************************
+* \file      testsuite_soa.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for soa_t
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "CuTest.h"
+#include "soa.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_sizes_in_same_class_share_allocator(CuTest* tc);
+static void test_alloc_large_object(CuTest* tc);
+static void test_realloc_within_size_class(CuTest* tc);
+static void test_realloc_between_size_classes(CuTest* tc);
+static void test_realloc_to_and_from_large_object(CuTest* tc);
+static void test_budget_tracks_chunks_and_large_objects(CuTest* tc);
+static void test_hard_limit_fails_alloc(CuTest* tc);
+static void test_soft_limit_calls_pressure_handler(CuTest* tc);
+
+//helper functions
+static void trim_on_pressure(void *arg, size_t bytesUsed, size_t bytesRequested);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static int m_pressure_count;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_soa(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_sizes_in_same_class_share_allocator);
+   SUITE_ADD_TEST(suite, test_alloc_large_object);
+   SUITE_ADD_TEST(suite, test_realloc_within_size_class);
+   SUITE_ADD_TEST(suite, test_realloc_between_size_classes);
+   SUITE_ADD_TEST(suite, test_realloc_to_and_from_large_object);
+   SUITE_ADD_TEST(suite, test_budget_tracks_chunks_and_large_objects);
+   SUITE_ADD_TEST(suite, test_hard_limit_fails_alloc);
+   SUITE_ADD_TEST(suite, test_soft_limit_calls_pressure_handler);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_sizes_in_same_class_share_allocator(CuTest* tc)
+{
+   soa_t allocator;
+   void *p1, *p2;
+   soa_init(&allocator);
+   p1 = soa_alloc(&allocator, SOA_OBJECT_ALIGN_SIZE + 1u);
+   p2 = soa_alloc(&allocator, 2u * SOA_OBJECT_ALIGN_SIZE);
+   CuAssertPtrNotNull(tc, p1);
+   CuAssertPtrNotNull(tc, p2);
+   CuAssertPtrNotNull(tc, allocator.fsa[1]);
+   CuAssertULIntEquals(tc, 2u * SOA_OBJECT_ALIGN_SIZE, allocator.fsa[1]->blockSize);
+   CuAssertIntEquals(tc, 1, (int) allocator.fsa[1]->chunks_len);
+   CuAssertIntEquals(tc, SOA_DEFAULT_NUM_BLOCKS - 2, allocator.fsa[1]->chunks[0].freeBlocks);
+   soa_free(&allocator, p1, SOA_OBJECT_ALIGN_SIZE + 1u);
+   soa_free(&allocator, p2, 2u * SOA_OBJECT_ALIGN_SIZE);
+   soa_destroy(&allocator);
+}
+
+static void test_alloc_large_object(CuTest* tc)
+{
+   soa_t allocator;
+   uint8_t *p;
+   soa_init(&allocator);
+   p = (uint8_t*) soa_alloc(&allocator, 1000u);
+   CuAssertPtrNotNull(tc, p);
+   memset(p, 0xAB, 1000u);
+   soa_free(&allocator, p, 1000u);
+   soa_destroy(&allocator);
+}
+
+static void test_realloc_within_size_class(CuTest* tc)
+{
+   soa_t allocator;
+   char *p, *q;
+   soa_init(&allocator);
+   p = (char*) soa_alloc(&allocator, 9u);
+   memcpy(p, "abcdefgh", 9u);
+   q = (char*) soa_realloc(&allocator, p, 9u, 12u);
+   CuAssertPtrEquals(tc, p, q);
+   CuAssertStrEquals(tc, "abcdefgh", q);
+   soa_free(&allocator, q, 12u);
+   soa_destroy(&allocator);
+}
+
+static void test_realloc_between_size_classes(CuTest* tc)
+{
+   soa_t allocator;
+   char *p, *q;
+   soa_init(&allocator);
+   p = (char*) soa_alloc(&allocator, 10u);
+   memcpy(p, "abcdefghi", 10u);
+   q = (char*) soa_realloc(&allocator, p, 10u, 28u);
+   CuAssertPtrNotNull(tc, q);
+   CuAssertTrue(tc, p != q);
+   CuAssertStrEquals(tc, "abcdefghi", q);
+   CuAssertIntEquals(tc, SOA_DEFAULT_NUM_BLOCKS, allocator.fsa[SOA_SIZE_CLASS(10u)]->chunks[0].freeBlocks);
+   CuAssertIntEquals(tc, SOA_DEFAULT_NUM_BLOCKS - 1, allocator.fsa[SOA_SIZE_CLASS(28u)]->chunks[0].freeBlocks);
+   //shrinking keeps the prefix
+   p = (char*) soa_realloc(&allocator, q, 28u, 4u);
+   CuAssertPtrNotNull(tc, p);
+   CuAssertIntEquals(tc, 0, memcmp(p, "abcd", 4u));
+   soa_free(&allocator, p, 4u);
+   soa_destroy(&allocator);
+}
+
+static void test_realloc_to_and_from_large_object(CuTest* tc)
+{
+   soa_t allocator;
+   uint8_t *p;
+   uint32_t i;
+   soa_init(&allocator);
+   p = (uint8_t*) soa_alloc(&allocator, 32u);
+   for (i = 0u; i < 32u; i++)
+   {
+      p[i] = (uint8_t) i;
+   }
+   p = (uint8_t*) soa_realloc(&allocator, p, 32u, 100u);
+   CuAssertPtrNotNull(tc, p);
+   CuAssertIntEquals(tc, SOA_DEFAULT_NUM_BLOCKS, allocator.fsa[SOA_SIZE_CLASS(32u)]->chunks[0].freeBlocks);
+   for (i = 32u; i < 100u; i++)
+   {
+      p[i] = (uint8_t) i;
+   }
+   p = (uint8_t*) soa_realloc(&allocator, p, 100u, 1000u);
+   CuAssertPtrNotNull(tc, p);
+   p = (uint8_t*) soa_realloc(&allocator, p, 1000u, 16u);
+   CuAssertPtrNotNull(tc, p);
+   for (i = 0u; i < 16u; i++)
+   {
+      CuAssertUIntEquals(tc, i, p[i]);
+   }
+   CuAssertPtrEquals(tc, NULL, soa_realloc(&allocator, p, 16u, 0u));
+   soa_destroy(&allocator);
+}
+
+static void test_budget_tracks_chunks_and_large_objects(CuTest* tc)
+{
+   soa_t allocator;
+   void *small, *large;
+   const size_t chunkSize = 4u * SOA_DEFAULT_NUM_BLOCKS;
+   soa_init(&allocator);
+   CuAssertULIntEquals(tc, 0u, soa_bytesUsed(&allocator));
+   small = soa_alloc(&allocator, 4u);
+   CuAssertULIntEquals(tc, chunkSize, soa_bytesUsed(&allocator));
+   large = soa_alloc(&allocator, 100u);
+   CuAssertULIntEquals(tc, chunkSize + 100u, soa_bytesUsed(&allocator));
+   large = soa_realloc(&allocator, large, 100u, 200u);
+   CuAssertULIntEquals(tc, chunkSize + 200u, soa_bytesUsed(&allocator));
+   soa_free(&allocator, large, 200u);
+   CuAssertULIntEquals(tc, chunkSize, soa_bytesUsed(&allocator));
+   CuAssertULIntEquals(tc, 0u, soa_trim(&allocator));
+   soa_free(&allocator, small, 4u);
+   CuAssertULIntEquals(tc, chunkSize, soa_trim(&allocator));
+   CuAssertULIntEquals(tc, 0u, soa_bytesUsed(&allocator));
+   soa_destroy(&allocator);
+}
+
+static void test_hard_limit_fails_alloc(CuTest* tc)
+{
+   soa_t allocator;
+   void *objects[SOA_DEFAULT_NUM_BLOCKS];
+   uint32_t i;
+   const size_t chunkSize = 4u * SOA_DEFAULT_NUM_BLOCKS;
+   soa_init(&allocator);
+   soa_setLimits(&allocator, SOA_BUDGET_UNLIMITED, chunkSize + 50u);
+   for (i = 0; i < SOA_DEFAULT_NUM_BLOCKS; i++)
+   {
+      objects[i] = soa_alloc(&allocator, 4u);
+      CuAssertPtrNotNull(tc, objects[i]);
+   }
+   //first chunk is full, a second chunk would exceed the limit
+   CuAssertPtrEquals(tc, NULL, soa_alloc(&allocator, 4u));
+   CuAssertIntEquals(tc, 1, (int) allocator.fsa[0]->chunks_len);
+   CuAssertPtrEquals(tc, NULL, soa_alloc(&allocator, 51u));
+   objects[0] = soa_realloc(&allocator, objects[0], 4u, 4u);
+   CuAssertPtrNotNull(tc, objects[0]);
+   CuAssertULIntEquals(tc, chunkSize, soa_bytesUsed(&allocator));
+   for (i = 0; i < SOA_DEFAULT_NUM_BLOCKS; i++)
+   {
+      soa_free(&allocator, objects[i], 4u);
+   }
+   soa_destroy(&allocator);
+   CuAssertULIntEquals(tc, 0u, soa_bytesUsed(&allocator));
+}
+
+static void test_soft_limit_calls_pressure_handler(CuTest* tc)
+{
+   soa_t allocator;
+   void *p;
+   const size_t chunkSize = 4u * SOA_DEFAULT_NUM_BLOCKS;
+   soa_init(&allocator);
+   //without trimming, the hard limit would be exceeded by one byte
+   soa_setLimits(&allocator, chunkSize, 3u * chunkSize - 1u);
+   soa_setPressureHandler(&allocator, trim_on_pressure, &allocator);
+   m_pressure_count = 0;
+   p = soa_alloc(&allocator, 4u);
+   CuAssertIntEquals(tc, 0, m_pressure_count);
+   soa_free(&allocator, p, 4u);
+   //the 4-byte chunk is empty but still held, the handler trims it to make room for a new size class
+   p = soa_alloc(&allocator, 8u);
+   CuAssertIntEquals(tc, 1, m_pressure_count);
+   CuAssertPtrNotNull(tc, p);
+   CuAssertIntEquals(tc, 0, (int) allocator.fsa[0]->chunks_len);
+   CuAssertULIntEquals(tc, 8u * SOA_DEFAULT_NUM_BLOCKS, soa_bytesUsed(&allocator));
+   soa_free(&allocator, p, 8u);
+   soa_destroy(&allocator);
+}
+
+static void trim_on_pressure(void *arg, size_t bytesUsed, size_t bytesRequested)
+{
+   (void) bytesUsed;
+   (void) bytesRequested;
+   m_pressure_count++;
+   soa_trim((soa_t*) arg);
+}
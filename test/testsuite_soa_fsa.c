@@ -50,6 +50,7 @@ static void test_alloc_1000_1_byte_blocks(CuTest* tc);
 static void test_fill_one_chunk(CuTest* tc);
 static void test_create_two_chunks(CuTest* tc);
 static void test_free_3_at_beginning_then_allocate_5_more(CuTest* tc);
+static void test_trim_releases_empty_chunks(CuTest* tc);
 
 //helper functions
 static void do_1_byte_test(CuTest* tc, int32_t numElements);
@@ -76,6 +77,7 @@ CuSuite* testsuite_soa_fsa(void)
    SUITE_ADD_TEST(suite, test_fill_one_chunk);
    SUITE_ADD_TEST(suite, test_create_two_chunks);
    SUITE_ADD_TEST(suite, test_free_3_at_beginning_then_allocate_5_more);
+   SUITE_ADD_TEST(suite, test_trim_releases_empty_chunks);
 
    return suite;
 }
@@ -193,6 +195,38 @@ static void test_free_3_at_beginning_then_allocate_5_more(CuTest* tc)
    soa_fsa_destroy(&fsa1);
 }
 
+static void test_trim_releases_empty_chunks(CuTest* tc)
+{
+   soa_fsa_t fsa1;
+   uint32_t i;
+   void *allocated[3*SOA_DEFAULT_NUM_BLOCKS];
+   soa_fsa_init(&fsa1, sizeof(uint32_t), SOA_DEFAULT_NUM_BLOCKS);
+   for(i=0; i<3*SOA_DEFAULT_NUM_BLOCKS; i++)
+   {
+      allocated[i] = soa_fsa_alloc(&fsa1);
+      CuAssertPtrNotNull(tc, allocated[i]);
+   }
+   CuAssertIntEquals(tc, 3, (int) fsa1.chunks_len);
+   CuAssertIntEquals(tc, 0, (int) soa_fsa_trim(&fsa1));
+   //empty the first chunk and half of the second
+   for(i=0; i<SOA_DEFAULT_NUM_BLOCKS+SOA_DEFAULT_NUM_BLOCKS/2; i++)
+   {
+      soa_fsa_free(&fsa1, allocated[i]);
+   }
+   CuAssertIntEquals(tc, 1, (int) soa_fsa_trim(&fsa1));
+   CuAssertIntEquals(tc, 2, (int) fsa1.chunks_len);
+   //remaining blocks can still be freed and reallocated
+   for(i=SOA_DEFAULT_NUM_BLOCKS+SOA_DEFAULT_NUM_BLOCKS/2; i<3*SOA_DEFAULT_NUM_BLOCKS; i++)
+   {
+      soa_fsa_free(&fsa1, allocated[i]);
+   }
+   CuAssertIntEquals(tc, 2, (int) soa_fsa_trim(&fsa1));
+   CuAssertIntEquals(tc, 0, (int) fsa1.chunks_len);
+   CuAssertPtrNotNull(tc, soa_fsa_alloc(&fsa1));
+   CuAssertIntEquals(tc, 1, (int) fsa1.chunks_len);
+   soa_fsa_destroy(&fsa1);
+}
+
 //Helper functions
 
 static void do_1_byte_test(CuTest* tc, int32_t numElements)
@@ -0,0 +1,174 @@
+/*****************************************************************************
+* \file      testsuite_soa_numa.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for soa_numa_t
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "CuTest.h"
+#include "soa_numa.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_OBJECTS 1000
+#define SMALL_NUM_BLOCKS 16u //16 blocks of 4 bytes fill exactly one region alignment unit
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_node_queries(CuTest* tc);
+static void test_alloc_free_local_node(CuTest* tc);
+static void test_objects_are_returned_to_owning_arena(CuTest* tc);
+static void test_free_at_start_of_adjacent_chunk(CuTest* tc);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_soa_numa(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_node_queries);
+   SUITE_ADD_TEST(suite, test_alloc_free_local_node);
+   SUITE_ADD_TEST(suite, test_objects_are_returned_to_owning_arena);
+   SUITE_ADD_TEST(suite, test_free_at_start_of_adjacent_chunk);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_node_queries(CuTest* tc)
+{
+   int maxNode = soa_numa_max_node();
+   int node = soa_numa_current_node();
+   CuAssertTrue(tc, maxNode >= 0);
+   CuAssertTrue(tc, maxNode < SOA_NUMA_MAX_NODES);
+   CuAssertTrue(tc, node >= 0);
+   CuAssertIntEquals(tc, node, soa_numa_current_node()); //cached value
+}
+
+static void test_alloc_free_local_node(CuTest* tc)
+{
+   soa_numa_t allocator;
+   int i;
+   uint32_t *objects[NUM_OBJECTS];
+   soa_numa_init(&allocator);
+   CuAssertTrue(tc, allocator.num_arenas >= 1);
+   for (i = 0; i < NUM_OBJECTS; i++)
+   {
+      objects[i] = (uint32_t*) soa_numa_alloc(&allocator, sizeof(uint32_t));
+      CuAssertPtrNotNull(tc, objects[i]);
+      *objects[i] = (uint32_t) i;
+   }
+   for (i = 0; i < NUM_OBJECTS; i++)
+   {
+      CuAssertUIntEquals(tc, (uint32_t) i, *objects[i]);
+      soa_numa_free(&allocator, objects[i], sizeof(uint32_t));
+   }
+   soa_numa_destroy(&allocator);
+}
+
+static void test_objects_are_returned_to_owning_arena(CuTest* tc)
+{
+   soa_numa_t allocator;
+   int i;
+   void *objects[NUM_OBJECTS];
+   size_t used;
+   //Forcing two arenas works on single node machines as well, the second arena is just left unbound
+   soa_numa_init_nodes(&allocator, 2);
+   for (i = 0; i < NUM_OBJECTS; i++)
+   {
+      objects[i] = soa_numa_alloc_on_node(&allocator, i % 2, 8u);
+      CuAssertPtrNotNull(tc, objects[i]);
+      memset(objects[i], 0xAA, 8u);
+      if (allocator.num_arenas == 2)
+      {
+         CuAssertIntEquals(tc, i % 2, soa_numa_arena_of(&allocator, objects[i]));
+      }
+   }
+   for (i = 0; i < NUM_OBJECTS; i++)
+   {
+      soa_numa_free(&allocator, objects[i], 8u);
+   }
+   if (allocator.num_arenas == 2)
+   {
+      CuAssertULIntEquals(tc, NUM_OBJECTS/2, allocator.arenas[0].num_free);
+      CuAssertULIntEquals(tc, NUM_OBJECTS/2, allocator.arenas[1].num_free);
+      //Released chunk memory is recycled by the region
+      used = allocator.arenas[1].region.used;
+      CuAssertIntEquals(tc, 2, (int) soa_fsa_trim(allocator.arenas[1].soa.fsa[SOA_SIZE_CLASS(8u)]));
+      objects[0] = soa_numa_alloc_on_node(&allocator, 1, 8u);
+      CuAssertIntEquals(tc, 1, soa_numa_arena_of(&allocator, objects[0]));
+      CuAssertULIntEquals(tc, used, allocator.arenas[1].region.used);
+      soa_numa_free(&allocator, objects[0], 8u);
+   }
+   soa_numa_destroy(&allocator);
+}
+
+/**
+ * Region memory is handed out back to back, the first block of a chunk directly follows the
+ * last block of the previous chunk and must be returned to its own chunk.
+ */
+static void test_free_at_start_of_adjacent_chunk(CuTest* tc)
+{
+   soa_numa_t allocator;
+   soa_fsa_t *fsa;
+   uint32_t i;
+   void *objects[2u*SMALL_NUM_BLOCKS];
+   //regions are only used with more than one arena
+   soa_numa_init_nodes(&allocator, 2);
+   soa_initFSA(&allocator.arenas[0].soa, sizeof(uint32_t), SMALL_NUM_BLOCKS);
+   for (i = 0u; i < 2u*SMALL_NUM_BLOCKS; i++)
+   {
+      objects[i] = soa_numa_alloc_on_node(&allocator, 0, sizeof(uint32_t));
+      CuAssertPtrNotNull(tc, objects[i]);
+   }
+   fsa = allocator.arenas[0].soa.fsa[SOA_SIZE_CLASS(sizeof(uint32_t))];
+   CuAssertIntEquals(tc, 2, (int) fsa->chunks_len);
+   if (allocator.arenas[0].region.base != 0)
+   {
+      CuAssertPtrEquals(tc, fsa->chunks[0].blockData + SMALL_NUM_BLOCKS * sizeof(uint32_t), fsa->chunks[1].blockData);
+   }
+   soa_numa_free(&allocator, fsa->chunks[1].blockData, sizeof(uint32_t));
+   CuAssertIntEquals(tc, 0, fsa->chunks[0].freeBlocks);
+   CuAssertIntEquals(tc, 1, fsa->chunks[1].freeBlocks);
+   //the freed block is handed out again from the second chunk
+   CuAssertPtrEquals(tc, fsa->chunks[1].blockData, soa_numa_alloc_on_node(&allocator, 0, sizeof(uint32_t)));
+   for (i = 0u; i < 2u*SMALL_NUM_BLOCKS; i++)
+   {
+      soa_numa_free(&allocator, objects[i], sizeof(uint32_t));
+   }
+   CuAssertIntEquals(tc, 2, (int) soa_fsa_trim(fsa));
+   soa_numa_destroy(&allocator);
+}
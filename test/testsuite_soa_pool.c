@@ -0,0 +1,277 @@
+/*****************************************************************************
+* \file      testsuite_soa_pool.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for soa_pool_t
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include "CuTest.h"
+#include "soa_pool.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_BLOCKS 16u
+#define NUM_OBJECTS (4u*NUM_BLOCKS)
+#define CONTIGUOUS_MAX_CHUNKS 8u
+
+//hands out chunk memory back to back (like soa_numa regions do) without any header gap
+typedef struct contiguous_memory_tag
+{
+   uint64_t data[CONTIGUOUS_MAX_CHUNKS * NUM_BLOCKS * sizeof(uint32_t) / sizeof(uint64_t)];
+   size_t used;
+} contiguous_memory_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_alloc_get_free(CuTest* tc);
+static void test_stale_handle_is_detected(CuTest* tc);
+static void test_invalid_handles(CuTest* tc);
+static void test_compact_releases_sparse_chunks(CuTest* tc);
+static void test_compact_is_incremental(CuTest* tc);
+static void test_compact_with_contiguous_chunks(CuTest* tc);
+static void check_compact_is_incremental(CuTest* tc, const soa_memory_handler_t *handler);
+static void *contiguous_alloc(void *arg, size_t size);
+static void contiguous_free(void *arg, void *ptr, size_t size);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_soa_pool(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_alloc_get_free);
+   SUITE_ADD_TEST(suite, test_stale_handle_is_detected);
+   SUITE_ADD_TEST(suite, test_invalid_handles);
+   SUITE_ADD_TEST(suite, test_compact_releases_sparse_chunks);
+   SUITE_ADD_TEST(suite, test_compact_is_incremental);
+   SUITE_ADD_TEST(suite, test_compact_with_contiguous_chunks);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_alloc_get_free(CuTest* tc)
+{
+   soa_pool_t pool;
+   soa_handle_t h1, h2;
+   uint32_t *p1, *p2;
+   soa_pool_init(&pool, sizeof(uint32_t), NUM_BLOCKS);
+   h1 = soa_pool_alloc(&pool);
+   h2 = soa_pool_alloc(&pool);
+   CuAssertTrue(tc, h1 != SOA_HANDLE_INVALID);
+   CuAssertTrue(tc, h2 != SOA_HANDLE_INVALID);
+   CuAssertTrue(tc, h1 != h2);
+   p1 = (uint32_t*) soa_pool_get(&pool, h1);
+   p2 = (uint32_t*) soa_pool_get(&pool, h2);
+   CuAssertPtrNotNull(tc, p1);
+   CuAssertPtrNotNull(tc, p2);
+   CuAssertTrue(tc, p1 != p2);
+   *p1 = 0x12345678u;
+   *p2 = 0x9ABCDEF0u;
+   CuAssertUIntEquals(tc, 2u, pool.num_live);
+   soa_pool_free(&pool, h1);
+   CuAssertUIntEquals(tc, 1u, pool.num_live);
+   CuAssertPtrEquals(tc, NULL, soa_pool_get(&pool, h1));
+   CuAssertUIntEquals(tc, 0x9ABCDEF0u, *(uint32_t*) soa_pool_get(&pool, h2));
+   soa_pool_destroy(&pool);
+}
+
+static void test_stale_handle_is_detected(CuTest* tc)
+{
+   soa_pool_t pool;
+   soa_handle_t h1, h2;
+   soa_pool_init(&pool, sizeof(uint32_t), NUM_BLOCKS);
+   h1 = soa_pool_alloc(&pool);
+   soa_pool_free(&pool, h1);
+   h2 = soa_pool_alloc(&pool);
+   //the slot is reused but with a new generation
+   CuAssertUIntEquals(tc, h1 & SOA_HANDLE_INDEX_MASK, h2 & SOA_HANDLE_INDEX_MASK);
+   CuAssertTrue(tc, h1 != h2);
+   CuAssertTrue(tc, !soa_pool_is_valid(&pool, h1));
+   CuAssertTrue(tc, soa_pool_is_valid(&pool, h2));
+   //freeing through a stale handle must not affect the new owner
+   soa_pool_free(&pool, h1);
+   CuAssertTrue(tc, soa_pool_is_valid(&pool, h2));
+   CuAssertUIntEquals(tc, 1u, pool.num_live);
+   soa_pool_destroy(&pool);
+}
+
+static void test_invalid_handles(CuTest* tc)
+{
+   soa_pool_t pool;
+   soa_pool_init(&pool, sizeof(uint32_t), NUM_BLOCKS);
+   CuAssertPtrEquals(tc, NULL, soa_pool_get(&pool, SOA_HANDLE_INVALID));
+   CuAssertPtrEquals(tc, NULL, soa_pool_get(&pool, 0xFFFFFFFFu));
+   CuAssertPtrEquals(tc, NULL, soa_pool_get(NULL, 1u << SOA_HANDLE_INDEX_BITS));
+   soa_pool_free(&pool, 0x00100005u);
+   CuAssertUIntEquals(tc, 0u, pool.num_live);
+   soa_pool_destroy(&pool);
+}
+
+static void test_compact_releases_sparse_chunks(CuTest* tc)
+{
+   soa_pool_t pool;
+   soa_handle_t handles[NUM_OBJECTS];
+   uint32_t i;
+   size_t numMoved;
+   soa_pool_init(&pool, sizeof(uint32_t), NUM_BLOCKS);
+   for (i = 0u; i < NUM_OBJECTS; i++)
+   {
+      handles[i] = soa_pool_alloc(&pool);
+      CuAssertTrue(tc, handles[i] != SOA_HANDLE_INVALID);
+      *(uint32_t*) soa_pool_get(&pool, handles[i]) = i;
+   }
+   CuAssertIntEquals(tc, 4, (int) pool.fsa.chunks_len);
+   //keep every fourth object, leaving all chunks sparsely populated
+   for (i = 0u; i < NUM_OBJECTS; i++)
+   {
+      if ( (i % 4u) != 0u)
+      {
+         soa_pool_free(&pool, handles[i]);
+         handles[i] = SOA_HANDLE_INVALID;
+      }
+   }
+   CuAssertIntEquals(tc, 4, (int) pool.fsa.chunks_len);
+   do
+   {
+      numMoved = soa_pool_compact(&pool, NUM_OBJECTS);
+   } while (numMoved > 0u);
+   CuAssertIntEquals(tc, 1, (int) pool.fsa.chunks_len);
+   CuAssertUIntEquals(tc, NUM_OBJECTS / 4u, pool.num_live);
+   for (i = 0u; i < NUM_OBJECTS; i += 4u)
+   {
+      uint32_t *p = (uint32_t*) soa_pool_get(&pool, handles[i]);
+      CuAssertPtrNotNull(tc, p);
+      CuAssertUIntEquals(tc, i, *p);
+   }
+   soa_pool_destroy(&pool);
+}
+
+static void test_compact_is_incremental(CuTest* tc)
+{
+   check_compact_is_incremental(tc, (const soa_memory_handler_t*) 0);
+}
+
+/**
+ * Blocks at the start of a chunk must not be credited to the chunk stored right before it.
+ */
+static void test_compact_with_contiguous_chunks(CuTest* tc)
+{
+   contiguous_memory_t memory;
+   soa_memory_handler_t handler;
+   soa_fsa_t fsa;
+   void *ptr[2u*NUM_BLOCKS];
+   uint32_t i;
+   memory.used = 0u;
+   handler.arg = &memory;
+   handler.alloc = contiguous_alloc;
+   handler.free = contiguous_free;
+   soa_fsa_init(&fsa, sizeof(uint32_t), NUM_BLOCKS);
+   soa_fsa_setMemoryHandler(&fsa, &handler);
+   for (i = 0u; i < 2u*NUM_BLOCKS; i++)
+   {
+      ptr[i] = soa_fsa_alloc(&fsa);
+      CuAssertPtrNotNull(tc, ptr[i]);
+   }
+   CuAssertIntEquals(tc, 2, (int) fsa.chunks_len);
+   CuAssertPtrEquals(tc, fsa.chunks[0].blockData + NUM_BLOCKS * sizeof(uint32_t), fsa.chunks[1].blockData);
+   //first block of the second chunk, right after the last block of the first chunk
+   soa_fsa_free(&fsa, fsa.chunks[1].blockData);
+   CuAssertIntEquals(tc, 0, fsa.chunks[0].freeBlocks);
+   CuAssertIntEquals(tc, 1, fsa.chunks[1].freeBlocks);
+   soa_fsa_destroy(&fsa);
+   check_compact_is_incremental(tc, &handler);
+}
+
+static void check_compact_is_incremental(CuTest* tc, const soa_memory_handler_t *handler)
+{
+   soa_pool_t pool;
+   soa_handle_t handles[2u*NUM_BLOCKS];
+   uint32_t i;
+   soa_pool_init(&pool, sizeof(uint32_t), NUM_BLOCKS);
+   if (handler != 0)
+   {
+      soa_fsa_setMemoryHandler(&pool.fsa, handler);
+   }
+   for (i = 0u; i < 2u*NUM_BLOCKS; i++)
+   {
+      handles[i] = soa_pool_alloc(&pool);
+      *(uint32_t*) soa_pool_get(&pool, handles[i]) = i;
+   }
+   //free 4 objects from first chunk and 12 from the second
+   for (i = 0u; i < 4u; i++)
+   {
+      soa_pool_free(&pool, handles[i]);
+   }
+   for (i = NUM_BLOCKS; i < NUM_BLOCKS + 12u; i++)
+   {
+      soa_pool_free(&pool, handles[i]);
+   }
+   CuAssertUIntEquals(tc, 1u, (unsigned int) soa_pool_compact(&pool, 1u));
+   CuAssertIntEquals(tc, 2, (int) pool.fsa.chunks_len);
+   CuAssertUIntEquals(tc, 3u, (unsigned int) soa_pool_compact(&pool, 10u));
+   CuAssertIntEquals(tc, 1, (int) pool.fsa.chunks_len);
+   CuAssertUIntEquals(tc, 0u, (unsigned int) soa_pool_compact(&pool, 10u));
+   for (i = 4u; i < NUM_BLOCKS; i++)
+   {
+      CuAssertUIntEquals(tc, i, *(uint32_t*) soa_pool_get(&pool, handles[i]));
+   }
+   for (i = NUM_BLOCKS + 12u; i < 2u*NUM_BLOCKS; i++)
+   {
+      CuAssertUIntEquals(tc, i, *(uint32_t*) soa_pool_get(&pool, handles[i]));
+   }
+   soa_pool_destroy(&pool);
+}
+
+static void *contiguous_alloc(void *arg, size_t size)
+{
+   contiguous_memory_t *memory = (contiguous_memory_t*) arg;
+   void *p;
+   if (sizeof(memory->data) - memory->used < size)
+   {
+      return (void*) 0;
+   }
+   p = (uint8_t*) memory->data + memory->used;
+   memory->used += size;
+   return p;
+}
+
+static void contiguous_free(void *arg, void *ptr, size_t size)
+{
+   (void) arg;
+   (void) ptr;
+   (void) size;
+}
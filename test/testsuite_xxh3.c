@@ -0,0 +1,209 @@
+/*****************************************************************************
+* \file      testsuite_xxh3.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for xxh3
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+#include <stdlib.h>
+#include "CuTest.h"
+#include "xxh3.h"
+#include "cutil_cpu.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define DATA_SIZE 5000u
+#define TEST_SEED 12345u
+
+typedef struct xxh3_vector_tag
+{
+   size_t len;
+   uint64_t hash64;
+   uint64_t hash64_seeded;
+   uint64_t hash128_lo;
+   uint64_t hash128_hi;
+   uint64_t hash128_seeded_hi;
+} xxh3_vector_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_xxh3_reference_vectors(CuTest* tc);
+static void test_xxh3_streaming(CuTest* tc);
+static void test_xxh3_digest_and_continue(CuTest* tc);
+static void test_xxh3_all_kernels(CuTest* tc);
+static void check_vectors(CuTest* tc, const uint8_t *data);
+static void fill_data(uint8_t *data, size_t len);
+
+//////////////////////////////////////////////////////////////////////////////
+// LOCAL VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//calculated with the reference implementation (xxHash 0.8) over fill_data, covering every length class
+static const xxh3_vector_t m_vectors[] =
+{
+   {0u, 0x2d06800538d394c2ull, 0xa706d6c022c3723bull, 0x6001c324468d497full, 0x99aa06d3014798d8ull, 0x89280ae42c9456b2ull},
+   {1u, 0x4c5cca45d0f4811full, 0x788ca7825a2c003dull, 0x4c5cca45d0f4811full, 0x495b62073ef70ca4ull, 0x77cbff159a4c40dfull},
+   {3u, 0x6e3e2670e61106acull, 0x0eb69c6b6e90e7edull, 0x6e3e2670e61106acull, 0x390cdc5b4a895dd7ull, 0xb2ff3355bf503d24ull},
+   {4u, 0x5c4c63133443d03full, 0x78f4934100ea66f5ull, 0x3d668af6f2a44d77ull, 0xaa6e2f274640a3f4ull, 0x198fa5f878af0894ull},
+   {8u, 0xf9fd4dd0b04d78f5ull, 0x0ead6da601126de0ull, 0x61ddbe7f31a6100dull, 0x6a86a3bda6af4e3dull, 0xbb9191b35419c636ull},
+   {9u, 0x7c20df9712c26edfull, 0x9d97117d30067f10ull, 0x8c7b67fd458a936bull, 0x664c7ca18afd6255ull, 0x12a16e6648bc7b44ull},
+   {16u, 0x86abf6baccea0858ull, 0xd17da3361abf122bull, 0xe2ce54a7c19c730dull, 0x7f9a218b0425449aull, 0xc51ff2570be4e694ull},
+   {17u, 0xb58bf5dc5022d071ull, 0x0475c7a1a8de1790ull, 0x8d96ef110fcdebb4ull, 0x66fc23f6439dbd77ull, 0xd9e107477fd64739ull},
+   {128u, 0x10d17f72c0ccba41ull, 0x51a24f555d921510ull, 0xff361dec1385710aull, 0xaec730751478556cull, 0xd7d4fae200975b7cull},
+   {129u, 0x1648bdc3db49d1a2ull, 0xb0cb090103fcd846ull, 0x4545b3a09738e31aull, 0x98cd36ccbb557926ull, 0x371365182cb63829ull},
+   {240u, 0xb6cfaf343fab81e6ull, 0x1a8a13180649f40cull, 0x3f2c53e72293711full, 0x5293e17bf553903dull, 0xc5b0afddf6027633ull},
+   {241u, 0x956cae592c67279eull, 0x2a79dd1e7f8c892eull, 0x956cae592c67279eull, 0xb53840fe3fedf161ull, 0xc9e05ea19168a656ull},
+   {1024u, 0x70bd377d9574f4bbull, 0x0d7475f5c84a5ec4ull, 0x70bd377d9574f4bbull, 0xf69630613f24324dull, 0x2b5a3e5162818407ull},
+   {1025u, 0x66c4487c41e127a7ull, 0x1e89d238fb26ebe6ull, 0x66c4487c41e127a7ull, 0x621af7b8277effa4ull, 0x4b1b908c50d38ca7ull},
+   {4999u, 0xc3af6109daa0965bull, 0x9ee8d03f601111a0ull, 0xc3af6109daa0965bull, 0x87e70b4ea9c61edbull, 0xb4228f5406c9211dull}
+};
+
+//forces each kernel variant in turn
+static const uint32_t m_kernel_features[] = {CUTIL_CPU_ALL, CUTIL_CPU_AVX2 | CUTIL_CPU_SSE2, CUTIL_CPU_SSE2, 0u};
+
+//////////////////////////////////////////////////////////////////////////////
+// GLOBAL FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+CuSuite* testsuite_xxh3(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_xxh3_reference_vectors);
+   SUITE_ADD_TEST(suite, test_xxh3_streaming);
+   SUITE_ADD_TEST(suite, test_xxh3_digest_and_continue);
+   SUITE_ADD_TEST(suite, test_xxh3_all_kernels);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// LOCAL FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+static void test_xxh3_reference_vectors(CuTest* tc)
+{
+   uint8_t *data = (uint8_t*) malloc(DATA_SIZE);
+   CuAssertPtrNotNull(tc, data);
+   fill_data(data, DATA_SIZE);
+   check_vectors(tc, data);
+   free(data);
+}
+
+/**
+ * Any split of the input across xxh3_update calls gives the one-shot hashes, including splits
+ * that leave less than one stripe in the buffer before the digest.
+ */
+static void test_xxh3_streaming(CuTest* tc)
+{
+   uint8_t *data = (uint8_t*) malloc(DATA_SIZE);
+   xxh3_state_t state;
+   size_t len, step, i;
+   CuAssertPtrNotNull(tc, data);
+   fill_data(data, DATA_SIZE);
+   for (len = 0u; len <= 2200u; len += (len < 300u)? 1u : 61u)
+   {
+      const uint64_t expected64 = xxh3_64(data, len, TEST_SEED);
+      const xxh3_128_t expected128 = xxh3_128(data, len, TEST_SEED);
+      for (step = 1u; step <= 700u; step = step * 3u + 1u)
+      {
+         xxh3_128_t hash128;
+         xxh3_init(&state, TEST_SEED);
+         for (i = 0u; i < len; i += step)
+         {
+            xxh3_update(&state, &data[i], (len - i < step)? len - i : step);
+         }
+         CuAssertTrue(tc, xxh3_digest64(&state) == expected64);
+         hash128 = xxh3_digest128(&state);
+         CuAssertTrue(tc, (hash128.lo == expected128.lo) && (hash128.hi == expected128.hi));
+      }
+   }
+   free(data);
+}
+
+/**
+ * A digest does not modify the state, hashing can continue afterwards
+ */
+static void test_xxh3_digest_and_continue(CuTest* tc)
+{
+   uint8_t *data = (uint8_t*) malloc(DATA_SIZE);
+   xxh3_state_t state;
+   size_t i;
+   CuAssertPtrNotNull(tc, data);
+   fill_data(data, DATA_SIZE);
+   xxh3_init(&state, 0u);
+   for (i = 0u; i < DATA_SIZE; i += 100u)
+   {
+      xxh3_update(&state, &data[i], 100u);
+      CuAssertTrue(tc, xxh3_digest64(&state) == xxh3_64(data, i + 100u, 0u));
+   }
+   free(data);
+}
+
+static void test_xxh3_all_kernels(CuTest* tc)
+{
+   uint8_t *data = (uint8_t*) malloc(DATA_SIZE);
+   size_t k;
+   CuAssertPtrNotNull(tc, data);
+   fill_data(data, DATA_SIZE);
+   for (k = 0u; k < sizeof(m_kernel_features) / sizeof(m_kernel_features[0]); k++)
+   {
+      cutil_cpu_override(m_kernel_features[k]);
+      check_vectors(tc, data);
+      test_xxh3_streaming(tc);
+   }
+   cutil_cpu_reset();
+   free(data);
+}
+
+static void check_vectors(CuTest* tc, const uint8_t *data)
+{
+   size_t i;
+   for (i = 0u; i < sizeof(m_vectors) / sizeof(m_vectors[0]); i++)
+   {
+      const xxh3_vector_t *vector = &m_vectors[i];
+      xxh3_128_t hash128 = xxh3_128(data, vector->len, 0u);
+      CuAssertTrue(tc, xxh3_64(data, vector->len, 0u) == vector->hash64);
+      CuAssertTrue(tc, xxh3_64(data, vector->len, TEST_SEED) == vector->hash64_seeded);
+      CuAssertTrue(tc, hash128.lo == vector->hash128_lo);
+      CuAssertTrue(tc, hash128.hi == vector->hash128_hi);
+      hash128 = xxh3_128(data, vector->len, TEST_SEED);
+      CuAssertTrue(tc, hash128.hi == vector->hash128_seeded_hi);
+   }
+}
+
+static void fill_data(uint8_t *data, size_t len)
+{
+   size_t i;
+   for (i = 0u; i < len; i++)
+   {
+      data[i] = (uint8_t) (i * 131u + 7u);
+   }
+}